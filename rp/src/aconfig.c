@@ -17,12 +17,23 @@ static SettingsConfigEntry defaultEntries[] = {
     {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER, SETTINGS_TYPE_STRING, "/hd"},
     {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE, SETTINGS_TYPE_STRING, "C"},
     {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_2, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_2, SETTINGS_TYPE_STRING, "D"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_2, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_3, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_3, SETTINGS_TYPE_STRING, "E"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_3, SETTINGS_TYPE_BOOL, "false"},
 
     // ACSI configuration
     {ACONFIG_PARAM_DRIVES_ACSI_ENABLED, SETTINGS_TYPE_BOOL, "false"},
     {ACONFIG_PARAM_DRIVES_ACSI_ID, SETTINGS_TYPE_INT, "7"},
     {ACONFIG_PARAM_DRIVES_ACSI_DRIVE, SETTINGS_TYPE_STRING, "C"},
     {ACONFIG_PARAM_DRIVES_ACSI_IMAGE, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_ACSI_READAHEAD, SETTINGS_TYPE_BOOL, "true"},
+    {ACONFIG_PARAM_DRIVES_ACSI_IMAGE_2, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_ACSI_ID_2, SETTINGS_TYPE_INT, "6"},
+    {ACONFIG_PARAM_DRIVES_ACSI_IMAGE_3, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_ACSI_ID_3, SETTINGS_TYPE_INT, "5"},
 
     // FLOPPY configuration
     {ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED, SETTINGS_TYPE_BOOL, "true"},
@@ -40,8 +51,30 @@ static SettingsConfigEntry defaultEntries[] = {
     {ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A_8, SETTINGS_TYPE_STRING, ""},
     {ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A_9, SETTINGS_TYPE_STRING, ""},
     {ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A_10, SETTINGS_TYPE_STRING, ""},
+
+    // USB mass storage while the emulation runs
+    {ACONFIG_PARAM_DRIVES_USB_RUNTIME, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_USB_RUNTIME_RW, SETTINGS_TYPE_BOOL, "false"},
+
+    // Boot snapshot in flash
+    {ACONFIG_PARAM_DRIVES_BOOT_CACHE, SETTINGS_TYPE_BOOL, "true"},
+
+    // Diagnostics
+    {ACONFIG_PARAM_DRIVES_ROM3_CAPTURE, SETTINGS_TYPE_BOOL, "false"},
+
+    // Performance profiles
+    {ACONFIG_PARAM_PERF_PROFILE, SETTINGS_TYPE_STRING, "standard"},
+    {ACONFIG_PARAM_PERF_PROFILE_SETUP, SETTINGS_TYPE_STRING, "standard"},
 };
 
+// Every entry may be set by the user, and a set entry is saved even at its
+// default: the magic entry and all the defaults must fit in the config
+// sector and its overflow
+_Static_assert(sizeof(defaultEntries) / sizeof(defaultEntries[0]) + 1 <=
+                   SETTINGS_FLASH_ENTRIES(ACONFIG_BUFFER_SIZE,
+                                          ACONFIG_OVERFLOW_SIZE),
+               "App settings don't fit in their flash regions");
+
 // Create a global context for our settings
 static SettingsContext gSettingsCtx;
 
@@ -161,6 +194,12 @@ int aconfig_init(const char *currentAppId) {
   }
 
   DPRINTF("Initializing app settings\n");
+  // The Booster gives each app one sector. The entries beyond it go to a
+  // sector of the app flash.
+  settings_set_overflow(
+      &gSettingsCtx,
+      (uint32_t)&_app_config_overflow_flash_start - XIP_BASE,
+      ACONFIG_OVERFLOW_SIZE);
   int err = settings_init(&gSettingsCtx, defaultEntries,
                           sizeof(defaultEntries) / sizeof(defaultEntries[0]),
                           flashAddress - XIP_BASE, ACONFIG_BUFFER_SIZE,
@@ -12,14 +12,39 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "acsi_index.h"
+#include "acsi_kernel.h"
+#include "acsi_scancache.h"
+#include "bootcache.h"
+#include "cmdtrace.h"
+
 static uint32_t memorySharedAddress = 0;
 static uint32_t memoryRandomTokenAddress = 0;
 static uint32_t memoryRandomTokenSeedAddress = 0;
-static char acsiImagePath[MAX_FILENAME_LENGTH + 1] = {0};
-// Set whenever acsiImagePath is (re)written; cleared after
-// acsiEnsureRuntimeImageOpen confirms the currently-open image still
-// matches the configured path. Avoids a per-I/O strncmp on the hot path.
-static bool acsiImagePathDirty = true;
+// One configured image. Each target keeps its own open file, fastseek
+// table and write-behind state, so flushing or rewriting one image never
+// touches the others.
+typedef struct {
+  char imagePath[MAX_FILENAME_LENGTH + 1];
+  // Set whenever imagePath is (re)written; cleared after
+  // acsiEnsureTargetOpen confirms the currently-open image still matches
+  // the configured path. Avoids a per-I/O strncmp on the hot path.
+  bool imagePathDirty;
+  uint8_t acsiId;
+  AcsiImageContext image;
+  // Write-behind flush state. Writes mark the image dirty and record when
+  // the dirty window opened; acsi_tick() flushes via f_sync once the window
+  // has aged past ACSI_FLUSH_INTERVAL_MS with no further writes resetting
+  // it.
+  volatile bool writeDirty;
+  volatile uint32_t writeDirtyAtMs;
+} AcsiTarget;
+
+// Target 0 is the ACSI_IMAGE one. A target with no image is left out.
+static AcsiTarget acsiTargets[ACSI_MAX_TARGETS] = {0};
+// Fastseek entries each image may use: ACSI_IMAGE_CLTBL_MAX split among
+// the targets with an image.
+static size_t acsiCltblLimit = ACSI_IMAGE_CLTBL_MAX;
 static FATFS acsiFilesys = {0};
 static uint32_t acsiFirstVolumeDrive = 0;
 static uint32_t acsiLastVolumeDrive = 0;
@@ -43,22 +68,23 @@ static uint32_t acsiPunInfoStartSectors[ACSI_PUN_INFO_MAXUNITS] = {0};
 static uint32_t acsiPartitionSectorCounts[ACSI_PUN_INFO_MAXUNITS] = {0};
 static uint16_t acsiLogicalSectorSizes[ACSI_PUN_INFO_MAXUNITS] = {0};
 static uint16_t acsiLogicalToPhysicalRatios[ACSI_PUN_INFO_MAXUNITS] = {0};
+// Sector kernel of each drive, chosen when it is mounted. NULL while the
+// drive is not served.
+static const AcsiSectorKernel *acsiDriveKernels[ACSI_PUN_INFO_MAXUNITS] = {0};
 // Per-drive layout metadata captured during acsiBuildAnnouncedVolumeData,
 // surfaced to the setup-screen boot summary via acsi_printBootInfo.
 static uint8_t acsiPartitionStyle[ACSI_PUN_INFO_MAXUNITS] = {0};
 static bool acsiPartitionViewIsTos[ACSI_PUN_INFO_MAXUNITS] = {0};
-static AcsiImageContext acsiRuntimeImage = {0};
-
-// Write-behind flush state. Writes mark the image dirty and record when
-// the dirty window opened; acsi_tick() flushes via f_sync once the window
-// has aged past ACSI_FLUSH_INTERVAL_MS with no further writes resetting it.
-static volatile bool acsiWriteDirty = false;
-static volatile uint32_t acsiWriteDirtyAtMs = 0;
+// Target serving each announced drive
+static uint8_t acsiDriveTargets[ACSI_PUN_INFO_MAXUNITS] = {0};
+// Output of the image tests run from the setup terminal, NULL at boot
+static AcsiBootInfoPrint acsiTestPrint = NULL;
 
-static inline void __not_in_flash_func(acsiMarkWriteDirty)(void) {
-  if (!acsiWriteDirty) {
-    acsiWriteDirtyAtMs = to_ms_since_boot(get_absolute_time());
-    acsiWriteDirty = true;
+static inline void __not_in_flash_func(acsiMarkWriteDirty)(
+    AcsiTarget *target) {
+  if (!target->writeDirty) {
+    target->writeDirtyAtMs = to_ms_since_boot(get_absolute_time());
+    target->writeDirty = true;
   }
 }
 
@@ -121,8 +147,40 @@ typedef struct {
 static AcsiBPBData acsiBpbData[ACSI_PUN_INFO_MAXUNITS] = {0};
 static uint32_t acsiBpbPointers[ACSI_PUN_INFO_MAXUNITS] = {0};
 
+// What the partition scan finds, as kept in the scan cache in flash
+typedef struct {
+  AcsiBPBData bpbData[ACSI_PUN_INFO_MAXUNITS];
+  uint32_t bpbPointers[ACSI_PUN_INFO_MAXUNITS];
+  uint32_t punInfoStartSectors[ACSI_PUN_INFO_MAXUNITS];
+  uint32_t partitionSectorCounts[ACSI_PUN_INFO_MAXUNITS];
+  uint16_t logicalSectorSizes[ACSI_PUN_INFO_MAXUNITS];
+  uint16_t logicalToPhysicalRatios[ACSI_PUN_INFO_MAXUNITS];
+  uint8_t punInfoUnits[ACSI_PUN_INFO_MAXUNITS];
+  uint8_t partitionStyle[ACSI_PUN_INFO_MAXUNITS];
+  uint8_t partitionViewIsTos[ACSI_PUN_INFO_MAXUNITS];
+  uint8_t driveTargets[ACSI_PUN_INFO_MAXUNITS];
+  // Drives registered with acsi_index_set_drive, and their geometry
+  uint8_t indexed[ACSI_PUN_INFO_MAXUNITS];
+  AcsiFat16Geometry indexGeometries[ACSI_PUN_INFO_MAXUNITS];
+  uint32_t firstVolumeDrive;
+  uint32_t lastVolumeDrive;
+  uint16_t punInfoPuns;
+  uint16_t oversizedSectorSize;
+  uint8_t volumeDriveRangeValid;
+  uint8_t punInfoValid;
+  uint8_t reserved[2];
+} AcsiScanResults;
+
+_Static_assert(sizeof(AcsiScanCacheHeader) + sizeof(AcsiScanResults) <=
+                   ACSI_SCANCACHE_REVOKE_OFFSET,
+               "The ACSI scan results do not fit in the scan cache sector");
+
+// Set while a full scan runs, to collect the index geometries
+static AcsiScanResults *acsiScanResults = NULL;
+
 static bool acsiIsEnabledSetting(void);
-static uint8_t acsiGetIdSetting(void);
+static bool acsiIsReadAheadSetting(void);
+static uint8_t acsiGetIdSetting(const char *key, uint8_t defaultId);
 static uint8_t acsiGetStartDriveSetting(void);
 static char acsiDriveNumberToLetter(uint32_t driveNumber);
 static inline uint16_t acsiReadLe16(const BYTE *buffer, size_t offset);
@@ -136,8 +194,10 @@ static void acsiResetPartitionSectorCounts(void) {
   memset(acsiPartitionSectorCounts, 0, sizeof(acsiPartitionSectorCounts));
   memset(acsiLogicalSectorSizes, 0, sizeof(acsiLogicalSectorSizes));
   memset(acsiLogicalToPhysicalRatios, 0, sizeof(acsiLogicalToPhysicalRatios));
+  memset(acsiDriveKernels, 0, sizeof(acsiDriveKernels));
   memset(acsiPartitionStyle, 0, sizeof(acsiPartitionStyle));
   memset(acsiPartitionViewIsTos, 0, sizeof(acsiPartitionViewIsTos));
+  memset(acsiDriveTargets, 0, sizeof(acsiDriveTargets));
 }
 
 static void __not_in_flash_func(acsiSetRwStatus)(int32_t status) {
@@ -147,31 +207,41 @@ static void __not_in_flash_func(acsiSetRwStatus)(int32_t status) {
 
   WRITE_WORD(memorySharedAddress, offset + 2u, rawStatus & 0xFFFFu);
   WRITE_WORD(memorySharedAddress, offset, rawStatus >> 16);
+  cmdtrace_setResult(status);
 }
 
 static bool __not_in_flash_func(acsiDriveIsOwned)(uint16_t driveNumber) {
   return driveNumber < ACSI_PUN_INFO_MAXUNITS &&
          acsiBpbPointers[driveNumber] != 0u &&
          acsiPartitionSectorCounts[driveNumber] != 0u &&
-         acsiLogicalSectorSizes[driveNumber] != 0u &&
-         acsiLogicalToPhysicalRatios[driveNumber] != 0u;
+         acsiDriveKernels[driveNumber] != NULL;
 }
 
 static uint16_t acsiGetLogicalToPhysicalRatio(uint32_t logicalSectorSize) {
-  switch (logicalSectorSize) {
-    case 512u:
-      return 1u;
-    case 1024u:
-      return 2u;
-    case 2048u:
-      return 4u;
-    case 4096u:
-      return 8u;
-    case 8192u:
-      return 16u;
-    default:
-      return 0u;
+  const AcsiSectorKernel *kernel = acsi_kernel_get(logicalSectorSize);
+  return (kernel != NULL) ? (uint16_t)(1u << kernel->ratioShift) : 0u;
+}
+
+// Pick the sector kernel of a drive from its layout. The last physical
+// sector of the drive must be a 32-bit LBA: the kernels map sectors without
+// 64-bit arithmetic.
+static void acsiSelectDriveKernel(uint16_t driveNumber) {
+  const AcsiSectorKernel *kernel =
+      acsi_kernel_get(acsiLogicalSectorSizes[driveNumber]);
+  acsiDriveKernels[driveNumber] = NULL;
+  if (kernel == NULL || (1u << kernel->ratioShift) !=
+                            acsiLogicalToPhysicalRatios[driveNumber]) {
+    return;
   }
+  uint64_t end = (uint64_t)acsiPunInfoStartSectors[driveNumber] +
+                 ((uint64_t)acsiPartitionSectorCounts[driveNumber]
+                  << kernel->ratioShift);
+  if (end > 0xFFFFFFFFu) {
+    DPRINTF("ACSI drive %c past the 32-bit LBA range\n",
+            acsiDriveNumberToLetter(driveNumber));
+    return;
+  }
+  acsiDriveKernels[driveNumber] = kernel;
 }
 
 static uint32_t acsiBuildInitialMediaChangedMask(void) {
@@ -187,29 +257,29 @@ static uint32_t acsiBuildInitialMediaChangedMask(void) {
   return mask;
 }
 
-static FRESULT __not_in_flash_func(acsiEnsureRuntimeImageOpen)(void) {
-  if (acsiImagePath[0] == '\0') {
+static FRESULT __not_in_flash_func(acsiEnsureTargetOpen)(AcsiTarget *target) {
+  if (target->imagePath[0] == '\0') {
     return FR_INVALID_OBJECT;
   }
 
   // Fast path: image already open and the configured path hasn't been
   // touched since the last successful open. Skips the per-I/O strncmp.
-  if (acsiRuntimeImage.isOpen && !acsiImagePathDirty) {
+  if (target->image.isOpen && !target->imagePathDirty) {
     return FR_OK;
   }
 
-  if (acsiRuntimeImage.isOpen) {
-    if (strncmp(acsiRuntimeImage.imagePath, acsiImagePath,
-                sizeof(acsiRuntimeImage.imagePath)) == 0) {
-      acsiImagePathDirty = false;
+  if (target->image.isOpen) {
+    if (strncmp(target->image.imagePath, target->imagePath,
+                sizeof(target->image.imagePath)) == 0) {
+      target->imagePathDirty = false;
       return FR_OK;
     }
-    acsi_image_close(&acsiRuntimeImage);
+    acsi_image_close(&target->image);
   }
 
-  FRESULT fr = acsi_image_open(&acsiRuntimeImage, acsiImagePath, false);
+  FRESULT fr = acsi_image_open(&target->image, target->imagePath, false);
   if (fr == FR_OK) {
-    acsiImagePathDirty = false;
+    target->imagePathDirty = false;
     return FR_OK;
   }
 
@@ -222,7 +292,22 @@ static FRESULT __not_in_flash_func(acsiEnsureRuntimeImageOpen)(void) {
     return fr;
   }
 
-  return acsi_image_open(&acsiRuntimeImage, acsiImagePath, false);
+  return acsi_image_open(&target->image, target->imagePath, false);
+}
+
+static bool acsiHasImage(void) {
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    if (acsiTargets[index].imagePath[0] != '\0') {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void acsiCloseTargets(void) {
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    acsi_image_close(&acsiTargets[index].image);
+  }
 }
 
 static void acsiResetBpbCache(void) {
@@ -381,6 +466,7 @@ static void acsiResetPunInfoCache(void) {
   memset(acsiPunInfoUnits, 0x80, sizeof(acsiPunInfoUnits));
   memset(acsiPunInfoStartSectors, 0, sizeof(acsiPunInfoStartSectors));
   acsiResetPartitionSectorCounts();
+  acsi_index_clear_drives();
 }
 
 static void acsiWritePunInfoToSharedMemory(void) {
@@ -582,28 +668,26 @@ static void acsiSetVolumeDriveRange(uint32_t firstDrive, uint32_t lastDrive) {
   acsiVolumeDriveRangeValid = true;
 }
 
-static void acsiBuildAnnouncedVolumeData(
-    AcsiImageContext *context, uint8_t acsiId, uint8_t firstDrive,
-    const AcsiPartitionEntry *usablePartitions, uint8_t usablePartitionCount) {
-  acsiResetVolumeDriveRange();
-  acsiResetPunInfoCache();
-  acsiResetBpbCache();
-  acsiScanOversizedSectorSize = 0;
-
+// Announce the usable partitions of one target, and return the drive
+// number the next target starts at.
+static uint32_t acsiBuildAnnouncedVolumeData(
+    AcsiImageContext *context, uint8_t targetIndex, uint8_t acsiId,
+    uint32_t firstDrive, const AcsiPartitionEntry *usablePartitions,
+    uint8_t usablePartitionCount) {
   if (context == NULL || usablePartitions == NULL ||
       usablePartitionCount == 0u) {
-    return;
+    return firstDrive;
   }
 
   // firstDrive is the drive-letter slot (2='C' .. 15='P') for the FIRST
   // announced partition. Subsequent partitions take the next consecutive
   // letter. acsiId is the physical ACSI ID tag stored in pun_info for
   // every owned slot — independent of the letter range.
-  uint32_t driveNumber = (uint32_t)firstDrive;
+  uint32_t driveNumber = firstDrive;
   if (driveNumber < 2u || driveNumber >= ACSI_PUN_INFO_MAXUNITS) {
     DPRINTF("ACSI cannot announce logical drive %lu (out of C..P range)\n",
             (unsigned long)driveNumber);
-    return;
+    return firstDrive;
   }
 
   bool haveFirstDrive = false;
@@ -709,8 +793,21 @@ static void acsiBuildAnnouncedVolumeData(
     acsiPartitionSectorCounts[driveNumber] = logicalSectorCount;
     acsiLogicalSectorSizes[driveNumber] = logicalSectorSize;
     acsiLogicalToPhysicalRatios[driveNumber] = logicalToPhysicalRatio;
+    acsiSelectDriveKernel((uint16_t)driveNumber);
     acsiPartitionStyle[driveNumber] = (uint8_t)tosDosStyle;
     acsiPartitionViewIsTos[driveNumber] = (strcmp(viewName, "TOS") == 0);
+    acsiDriveTargets[driveNumber] = targetIndex;
+    if (!acsiPartitionViewIsTos[driveNumber] && targetIndex == 0u) {
+      // The read-ahead index walks the DOS FAT of the first target; the
+      // hybrid TOS view uses a different layout and is read without it,
+      // as are the other targets.
+      acsi_index_set_drive((uint16_t)driveNumber, &geometry,
+                           logicalToPhysicalRatio);
+      if (acsiScanResults != NULL) {
+        acsiScanResults->indexed[driveNumber] = 1u;
+        acsiScanResults->indexGeometries[driveNumber] = geometry;
+      }
+    }
     DPRINTF(
         "ACSI drive %c view=%s start=%lu recsize=%u logical_sectors=%lu "
         "ratio=%u\n",
@@ -719,53 +816,72 @@ static void acsiBuildAnnouncedVolumeData(
         (unsigned long)logicalSectorCount,
         (unsigned int)logicalToPhysicalRatio);
 
-    if (!haveFirstDrive) {
+    if (!haveFirstDrive && !acsiVolumeDriveRangeValid) {
       acsiFirstVolumeDrive = driveNumber;
-      haveFirstDrive = true;
     }
+    haveFirstDrive = true;
     lastDrive = driveNumber;
     driveNumber++;
   }
 
   if (!haveFirstDrive) {
-    return;
+    return driveNumber;
   }
 
   acsiSetVolumeDriveRange(acsiFirstVolumeDrive, lastDrive);
   acsiPunInfoPuns = (uint16_t)(lastDrive + 1u);
   acsiPunInfoValid = true;
+  return driveNumber;
 }
 
-static void acsiRefreshVolumeDriveRange(uint8_t acsiId, uint8_t firstDrive) {
+// Scan the partitions of one target and announce them from firstDrive on.
+// Returns the drive number the next target starts at.
+static uint32_t acsiScanTarget(uint8_t targetIndex, uint32_t firstDrive) {
+  const AcsiTarget *target = &acsiTargets[targetIndex];
   AcsiImageContext context = {0};
   AcsiPartitionEntry usablePartitions[ACSI_MAX_PARTITIONS] = {0};
   uint8_t usablePartitionCount = 0;
 
-  acsiResetVolumeDriveRange();
-  acsiResetPunInfoCache();
-  acsiResetBpbCache();
-
-  if (acsiImagePath[0] == '\0') {
-    return;
+  if (target->imagePath[0] == '\0') {
+    return firstDrive;
   }
 
-  FRESULT fr = acsi_image_open(&context, acsiImagePath, true);
+  acsi_scancache_trace_target(targetIndex);
+  FRESULT fr = acsi_image_open(&context, target->imagePath, true);
   if (fr != FR_OK) {
-    DPRINTF("ACSI volume range: cannot open image (%d)\n", (int)fr);
-    return;
+    DPRINTF("ACSI volume range: cannot open image %u (%d)\n",
+            (unsigned int)targetIndex, (int)fr);
+    return firstDrive;
   }
 
   fr = acsi_enumerate_partitions(&context, usablePartitions,
                                  &usablePartitionCount);
   if (fr != FR_OK) {
     acsi_image_close(&context);
-    DPRINTF("ACSI volume range: cannot enumerate partitions (%d)\n", (int)fr);
-    return;
+    DPRINTF("ACSI volume range: cannot enumerate partitions of image %u (%d)\n",
+            (unsigned int)targetIndex, (int)fr);
+    return firstDrive;
   }
 
-  acsiBuildAnnouncedVolumeData(&context, acsiId, firstDrive,
-                               usablePartitions, usablePartitionCount);
+  uint32_t nextDrive = acsiBuildAnnouncedVolumeData(
+      &context, targetIndex, target->acsiId, firstDrive, usablePartitions,
+      usablePartitionCount);
   acsi_image_close(&context);
+  return nextDrive;
+}
+
+static void acsiRefreshVolumeDriveRange(uint8_t firstDrive) {
+  acsiResetVolumeDriveRange();
+  acsiResetPunInfoCache();
+  acsiResetBpbCache();
+  acsiScanOversizedSectorSize = 0;
+
+  // The targets take consecutive drive letters, in order
+  uint32_t nextDrive = firstDrive;
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    nextDrive = acsiScanTarget(index, nextDrive);
+  }
+
   if (!acsiVolumeDriveRangeValid) {
     DPRINTF("ACSI volume range: no FAT16 volumes with valid BPB found\n");
     return;
@@ -779,6 +895,124 @@ static void acsiRefreshVolumeDriveRange(uint8_t acsiId, uint8_t firstDrive) {
           (unsigned int)(acsiLastVolumeDrive - acsiFirstVolumeDrive + 1u));
 }
 
+// Identity of what the scan reads: the firmware, the first drive letter,
+// and the ID, path, size and date of each image
+static uint32_t acsiScanCacheKey(uint8_t firstDrive) {
+  uint32_t key = acsi_scancache_hash(ACSI_SCANCACHE_HASH_SEED, RELEASE_VERSION,
+                                     strlen(RELEASE_VERSION));
+  key = acsi_scancache_hash(key, &firstDrive, sizeof(firstDrive));
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    const AcsiTarget *target = &acsiTargets[index];
+    if (target->imagePath[0] == '\0') {
+      continue;
+    }
+    FILINFO fno = {0};
+    FRESULT fr = f_stat(target->imagePath, &fno);
+    uint32_t stamp[4] = {(uint32_t)fr, (uint32_t)fno.fsize,
+                         (uint32_t)((uint64_t)fno.fsize >> 32),
+                         ((uint32_t)fno.fdate << 16) | fno.ftime};
+    key = acsi_scancache_hash(key, &index, sizeof(index));
+    key = acsi_scancache_hash(key, &target->acsiId, sizeof(target->acsiId));
+    key = acsi_scancache_hash(key, target->imagePath,
+                              strlen(target->imagePath));
+    key = acsi_scancache_hash(key, stamp, sizeof(stamp));
+  }
+  return key;
+}
+
+static void acsiCaptureScanResults(AcsiScanResults *results) {
+  memcpy(results->bpbData, acsiBpbData, sizeof(acsiBpbData));
+  memcpy(results->bpbPointers, acsiBpbPointers, sizeof(acsiBpbPointers));
+  memcpy(results->punInfoStartSectors, acsiPunInfoStartSectors,
+         sizeof(acsiPunInfoStartSectors));
+  memcpy(results->partitionSectorCounts, acsiPartitionSectorCounts,
+         sizeof(acsiPartitionSectorCounts));
+  memcpy(results->logicalSectorSizes, acsiLogicalSectorSizes,
+         sizeof(acsiLogicalSectorSizes));
+  memcpy(results->logicalToPhysicalRatios, acsiLogicalToPhysicalRatios,
+         sizeof(acsiLogicalToPhysicalRatios));
+  memcpy(results->punInfoUnits, acsiPunInfoUnits, sizeof(acsiPunInfoUnits));
+  memcpy(results->partitionStyle, acsiPartitionStyle,
+         sizeof(acsiPartitionStyle));
+  memcpy(results->driveTargets, acsiDriveTargets, sizeof(acsiDriveTargets));
+  for (uint8_t drive = 0; drive < ACSI_PUN_INFO_MAXUNITS; ++drive) {
+    results->partitionViewIsTos[drive] = acsiPartitionViewIsTos[drive];
+  }
+  results->firstVolumeDrive = acsiFirstVolumeDrive;
+  results->lastVolumeDrive = acsiLastVolumeDrive;
+  results->punInfoPuns = acsiPunInfoPuns;
+  results->oversizedSectorSize = acsiScanOversizedSectorSize;
+  results->volumeDriveRangeValid = acsiVolumeDriveRangeValid;
+  results->punInfoValid = acsiPunInfoValid;
+}
+
+static void acsiRestoreScanResults(const AcsiScanResults *results) {
+  acsiResetVolumeDriveRange();
+  acsiResetPunInfoCache();
+  acsiResetBpbCache();
+
+  memcpy(acsiBpbData, results->bpbData, sizeof(acsiBpbData));
+  memcpy(acsiBpbPointers, results->bpbPointers, sizeof(acsiBpbPointers));
+  memcpy(acsiPunInfoStartSectors, results->punInfoStartSectors,
+         sizeof(acsiPunInfoStartSectors));
+  memcpy(acsiPartitionSectorCounts, results->partitionSectorCounts,
+         sizeof(acsiPartitionSectorCounts));
+  memcpy(acsiLogicalSectorSizes, results->logicalSectorSizes,
+         sizeof(acsiLogicalSectorSizes));
+  memcpy(acsiLogicalToPhysicalRatios, results->logicalToPhysicalRatios,
+         sizeof(acsiLogicalToPhysicalRatios));
+  memcpy(acsiPunInfoUnits, results->punInfoUnits, sizeof(acsiPunInfoUnits));
+  memcpy(acsiPartitionStyle, results->partitionStyle,
+         sizeof(acsiPartitionStyle));
+  memcpy(acsiDriveTargets, results->driveTargets, sizeof(acsiDriveTargets));
+  for (uint8_t drive = 0; drive < ACSI_PUN_INFO_MAXUNITS; ++drive) {
+    acsiPartitionViewIsTos[drive] = (results->partitionViewIsTos[drive] != 0);
+    if (acsiPartitionSectorCounts[drive] != 0u) {
+      acsiSelectDriveKernel(drive);
+    }
+    if (results->indexed[drive] != 0u) {
+      acsi_index_set_drive(drive, &results->indexGeometries[drive],
+                           results->logicalToPhysicalRatios[drive]);
+    }
+  }
+  acsiFirstVolumeDrive = results->firstVolumeDrive;
+  acsiLastVolumeDrive = results->lastVolumeDrive;
+  acsiPunInfoPuns = results->punInfoPuns;
+  acsiScanOversizedSectorSize = results->oversizedSectorSize;
+  acsiVolumeDriveRangeValid = (results->volumeDriveRangeValid != 0u);
+  acsiPunInfoValid = (results->punInfoValid != 0u);
+}
+
+// Take the drives from the scan cache when the images did not change since
+// they were scanned. Otherwise scan them and cache the results.
+static void acsiDiscoverVolumes(uint8_t firstDrive) {
+  uint32_t key = acsiScanCacheKey(firstDrive);
+  AcsiScanResults *results = calloc(1, sizeof(AcsiScanResults));
+  if (results == NULL) {
+    acsiRefreshVolumeDriveRange(firstDrive);
+    return;
+  }
+
+  if (acsi_scancache_load(key, results, sizeof(*results))) {
+    acsiRestoreScanResults(results);
+    DPRINTF("ACSI volume range from the scan cache: %u drives\n",
+            acsiVolumeDriveRangeValid
+                ? (unsigned int)(acsiLastVolumeDrive - acsiFirstVolumeDrive +
+                                 1u)
+                : 0u);
+    free(results);
+    return;
+  }
+
+  acsiScanResults = results;
+  acsi_scancache_trace_start();
+  acsiRefreshVolumeDriveRange(firstDrive);
+  acsiScanResults = NULL;
+  acsiCaptureScanResults(results);
+  acsi_scancache_store(key, results, sizeof(*results));
+  free(results);
+}
+
 static void acsiResetHookTraceState(void) {
   acsiLastLoggedHooksInstalled = 0;
   acsiLastLoggedOldHdvInit = 0;
@@ -933,23 +1167,44 @@ static void acsiTraceBpbData(uint32_t driveAndPhase, uint32_t value1,
   }
 }
 
-static void acsiLoadConfiguredState(bool *enabledOut, uint8_t *acsiIdOut,
-                                    uint8_t *firstDriveOut) {
-  acsiImagePath[0] = '\0';
-  acsiImagePathDirty = true;
+static void acsiLoadTargetPath(AcsiTarget *target, const char *key) {
+  target->imagePath[0] = '\0';
+  target->imagePathDirty = true;
 
-  SettingsConfigEntry *image = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_IMAGE);
+  SettingsConfigEntry *image = settings_find_entry(aconfig_getContext(), key);
   if ((image != NULL) && (image->value[0] != '\0')) {
-    strncpy(acsiImagePath, image->value, MAX_FILENAME_LENGTH);
-    acsiImagePath[MAX_FILENAME_LENGTH] = '\0';
+    strncpy(target->imagePath, image->value, MAX_FILENAME_LENGTH);
+    target->imagePath[MAX_FILENAME_LENGTH] = '\0';
   }
+}
+
+static void acsiLoadConfiguredState(bool *enabledOut, uint8_t *acsiIdOut,
+                                    uint8_t *firstDriveOut) {
+  static const char *const imageKeys[ACSI_MAX_TARGETS] = {
+      ACONFIG_PARAM_DRIVES_ACSI_IMAGE, ACONFIG_PARAM_DRIVES_ACSI_IMAGE_2,
+      ACONFIG_PARAM_DRIVES_ACSI_IMAGE_3};
+  static const char *const idKeys[ACSI_MAX_TARGETS] = {
+      ACONFIG_PARAM_DRIVES_ACSI_ID, ACONFIG_PARAM_DRIVES_ACSI_ID_2,
+      ACONFIG_PARAM_DRIVES_ACSI_ID_3};
+  static const uint8_t defaultIds[ACSI_MAX_TARGETS] = {7u, 6u, 5u};
+
+  uint8_t imageCount = 0;
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    AcsiTarget *target = &acsiTargets[index];
+    acsiLoadTargetPath(target, imageKeys[index]);
+    target->acsiId = acsiGetIdSetting(idKeys[index], defaultIds[index]);
+    if (target->imagePath[0] != '\0') {
+      imageCount++;
+    }
+  }
+  acsiCltblLimit =
+      ACSI_IMAGE_CLTBL_MAX / ((imageCount > 0u) ? imageCount : 1u);
 
   if (enabledOut != NULL) {
     *enabledOut = acsiIsEnabledSetting();
   }
   if (acsiIdOut != NULL) {
-    *acsiIdOut = acsiGetIdSetting();
+    *acsiIdOut = acsiTargets[0].acsiId;
   }
   if (firstDriveOut != NULL) {
     *firstDriveOut = acsiGetStartDriveSetting();
@@ -957,29 +1212,19 @@ static void acsiLoadConfiguredState(bool *enabledOut, uint8_t *acsiIdOut,
 }
 
 static bool acsiIsEnabledSetting(void) {
-  SettingsConfigEntry *enabled = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ENABLED);
-  if ((enabled == NULL) || (enabled->value[0] == '\0')) {
-    return false;
-  }
-
-  return (enabled->value[0] == 't') || (enabled->value[0] == 'T') ||
-         (enabled->value[0] == 'y') || (enabled->value[0] == 'Y') ||
-         (enabled->value[0] == '1');
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_ACSI_ENABLED, false);
 }
 
-static uint8_t acsiGetIdSetting(void) {
-  SettingsConfigEntry *acsiId = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ID);
-  if ((acsiId == NULL) || (acsiId->value[0] == '\0')) {
-    return 7;
-  }
+static bool acsiIsReadAheadSetting(void) {
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_ACSI_READAHEAD, false);
+}
 
-  char *endptr = NULL;
-  long value = strtol(acsiId->value, &endptr, 10);
-  if ((acsiId->value == endptr) || (*endptr != '\0') || (value < 0) ||
-      (value > 7)) {
-    return 7;
+static uint8_t acsiGetIdSetting(const char *key, uint8_t defaultId) {
+  int value = settings_get_int(aconfig_getContext(), key, -1);
+  if ((value < 0) || (value > 7)) {
+    return defaultId;
   }
 
   return (uint8_t)value;
@@ -1904,9 +2149,9 @@ static FRESULT acsiSetupFastseek(AcsiImageContext *context) {
     DWORD needed = tbl[0];  // FatFS writes the required size here.
     free(tbl);
     context->file.cltbl = NULL;
-    if (needed == 0 || needed > ACSI_IMAGE_CLTBL_MAX) {
+    if (needed == 0 || needed > acsiCltblLimit) {
       DPRINTF("ACSI fastseek skipped: image too fragmented (%lu DWORDs > %u)\n",
-              (unsigned long)needed, (unsigned)ACSI_IMAGE_CLTBL_MAX);
+              (unsigned long)needed, (unsigned)acsiCltblLimit);
       return FR_NOT_ENOUGH_CORE;
     }
     tbl = (DWORD *)malloc((size_t)needed * sizeof(DWORD));
@@ -1942,6 +2187,7 @@ FRESULT acsi_image_open(AcsiImageContext *context, const char *imagePath,
   }
 
   memset(context, 0, sizeof(*context));
+  context->cacheSource = BOOTCACHE_NO_SOURCE;
   snprintf(context->imagePath, sizeof(context->imagePath), "%s", imagePath);
 
   BYTE mode = FA_OPEN_EXISTING | FA_READ;
@@ -1954,7 +2200,19 @@ FRESULT acsi_image_open(AcsiImageContext *context, const char *imagePath,
     return fr;
   }
 
-  context->imageSizeBytes = f_size(&context->file);
+  uint32_t sparseSectors = 0;
+  fr = acsi_sparse_open(&context->file, &context->sparse, &sparseSectors);
+  if (fr != FR_OK) {
+    (void)f_close(&context->file);
+    acsi_image_close(context);
+    return fr;
+  }
+
+  // A sparse image is as large as the disk it holds, not as its file
+  context->imageSizeBytes =
+      (context->sparse != NULL)
+          ? (FSIZE_t)sparseSectors * (FSIZE_t)ACSI_IMAGE_SECTOR_SIZE
+          : f_size(&context->file);
   if (context->imageSizeBytes < (FSIZE_t)ACSI_IMAGE_SECTOR_SIZE) {
     acsi_image_close(context);
     return FR_INVALID_OBJECT;
@@ -1971,6 +2229,14 @@ FRESULT acsi_image_open(AcsiImageContext *context, const char *imagePath,
   context->readOnly = readOnly;
   context->isOpen = true;
 
+  // The boot snapshot knows the image by its size and date
+  FILINFO fno;
+  if (f_stat(context->imagePath, &fno) == FR_OK) {
+    context->cacheSource =
+        bootcache_open_source(context->imagePath, fno.fsize, fno.fdate,
+                              fno.ftime, BOOTCACHE_UNIT_SECTOR);
+  }
+
   // Best-effort fastseek setup. Failure is non-fatal: we fall back to
   // linear-walk lseek automatically when context->file.cltbl is NULL.
   (void)acsiSetupFastseek(context);
@@ -1993,6 +2259,11 @@ void acsi_image_close(AcsiImageContext *context) {
     context->cltblEntries = 0;
   }
 
+  if (context->sparse != NULL) {
+    acsi_sparse_close(context->sparse);
+    context->sparse = NULL;
+  }
+
   memset(&context->file, 0, sizeof(context->file));
   context->imageSizeBytes = 0;
   context->totalSectors = 0;
@@ -2020,19 +2291,35 @@ FRESULT __not_in_flash_func(acsi_image_read_sectors)(AcsiImageContext *context,
     return FR_INVALID_PARAMETER;
   }
 
-  FSIZE_t offset = (FSIZE_t)lba * (FSIZE_t)ACSI_IMAGE_SECTOR_SIZE;
-  FRESULT fr = f_lseek(&context->file, offset);
-  if (fr != FR_OK) {
-    return fr;
+  if (bootcache_read(context->cacheSource, lba, (uint32_t)bytesToRead,
+                     buffer)) {
+    acsi_scancache_trace_read(lba, sectorCount);
+    return FR_OK;
   }
 
-  unsigned int bytesRead = 0;
-  fr = f_read(&context->file, buffer, (UINT)bytesToRead, &bytesRead);
-  if (fr != FR_OK) {
-    return fr;
+  FRESULT fr;
+  if (context->sparse != NULL) {
+    fr = acsi_sparse_read(context->sparse, &context->file, lba, sectorCount,
+                          buffer);
+  } else {
+    FSIZE_t offset = (FSIZE_t)lba * (FSIZE_t)ACSI_IMAGE_SECTOR_SIZE;
+    fr = f_lseek(&context->file, offset);
+    if (fr != FR_OK) {
+      return fr;
+    }
+
+    unsigned int bytesRead = 0;
+    fr = f_read(&context->file, buffer, (UINT)bytesToRead, &bytesRead);
+    if ((fr == FR_OK) && (bytesRead != (UINT)bytesToRead)) {
+      fr = FR_INT_ERR;
+    }
   }
 
-  return (bytesRead == (UINT)bytesToRead) ? FR_OK : FR_INT_ERR;
+  if (fr == FR_OK) {
+    bootcache_record(context->cacheSource, lba, (uint32_t)bytesToRead);
+    acsi_scancache_trace_read(lba, sectorCount);
+  }
+  return fr;
 }
 
 FRESULT __not_in_flash_func(acsi_image_write_sectors)(
@@ -2047,6 +2334,8 @@ FRESULT __not_in_flash_func(acsi_image_write_sectors)(
     return FR_DENIED;
   }
 
+  bootcache_note_write(context->cacheSource);
+
   size_t bytesToWrite = (size_t)sectorCount * ACSI_IMAGE_SECTOR_SIZE;
   if (bufferSize < bytesToWrite) {
     return FR_INVALID_PARAMETER;
@@ -2057,6 +2346,13 @@ FRESULT __not_in_flash_func(acsi_image_write_sectors)(
     return FR_INVALID_PARAMETER;
   }
 
+  if (context->sparse != NULL) {
+    // Sectors of zeros are not stored: formatting a fresh image only
+    // allocates the blocks of the boot sectors, FATs and root folder
+    return acsi_sparse_write(context->sparse, &context->file, lba,
+                             sectorCount, buffer);
+  }
+
   FSIZE_t offset = (FSIZE_t)lba * (FSIZE_t)ACSI_IMAGE_SECTOR_SIZE;
   FRESULT fr = f_lseek(&context->file, offset);
   if (fr != FR_OK) {
@@ -2591,6 +2887,9 @@ static void acsiTestLog(const char *fmt, ...) {
   }
 
   DPRINTFRAW("%s", buffer);
+  if (acsiTestPrint != NULL) {
+    acsiTestPrint(buffer);
+  }
 }
 
 static void acsiFormatSize(uint64_t bytes, char *output, size_t outputSize) {
@@ -2828,7 +3127,7 @@ static FRESULT acsiListNamedRootSubdirectory(AcsiImageContext *context,
                                 directoryEntry.firstCluster, label);
 }
 
-static void acsiRunImageTests(void) {
+static void acsiRunImageTests(const char *imagePath) {
   AcsiImageContext context = {0};
   AcsiPartitionEntry primaryPartitions[ACSI_PARTITION_COUNT] = {0};
   AcsiPartitionEntry usablePartitions[ACSI_MAX_PARTITIONS] = {0};
@@ -2836,9 +3135,9 @@ static void acsiRunImageTests(void) {
   uint8_t usablePartitionCount = 0;
   acsiTestLog("\nACSI image tests\n");
   acsiTestLog("----------------\n");
-  acsiTestLog("Image: %s\n", acsiImagePath);
+  acsiTestLog("Image: %s\n", imagePath);
 
-  FRESULT fr = acsi_image_open(&context, acsiImagePath, true);
+  FRESULT fr = acsi_image_open(&context, imagePath, true);
   if (fr != FR_OK) {
     acsiTestLog("ERROR: cannot open image (%d)\n", (int)fr);
     return;
@@ -3013,28 +3312,44 @@ void acsi_preInit(void) {
   acsiResetPunInfoCache();
 
   if (!enabled) {
-    DPRINTF("ACSI tests skipped because ACSI is disabled.\n");
+    DPRINTF("ACSI scan skipped because ACSI is disabled.\n");
     return;
   }
 
-  if (acsiImagePath[0] == '\0') {
-    DPRINTF("ACSI tests skipped because no image is configured.\n");
+  if (!acsiHasImage()) {
+    DPRINTF("ACSI scan skipped because no image is configured.\n");
     return;
   }
 
   FRESULT fr = f_mount(&acsiFilesys, "0:", 1);
   if (fr != FR_OK) {
-    DPRINTF("ACSI tests cannot mount SD card (%d)\n", (int)fr);
+    DPRINTF("ACSI scan cannot mount SD card (%d)\n", (int)fr);
     return;
   }
 
-  acsiRefreshVolumeDriveRange(acsiId, firstDrive);
-  DPRINTF("Running ACSI tests before driver initialization.\n");
-  acsiRunImageTests();
+  acsiDiscoverVolumes(firstDrive);
 
   (void)f_mount(NULL, "0:", 1);
 }
 
+void acsi_runImageTests(AcsiBootInfoPrint print) {
+  acsiLoadConfiguredState(NULL, NULL, NULL);
+  if (!acsiHasImage()) {
+    if (print != NULL) {
+      print("ACSI: no image configured.\n");
+    }
+    return;
+  }
+
+  acsiTestPrint = print;
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    if (acsiTargets[index].imagePath[0] != '\0') {
+      acsiRunImageTests(acsiTargets[index].imagePath);
+    }
+  }
+  acsiTestPrint = NULL;
+}
+
 void acsi_printBootInfo(AcsiBootInfoPrint print) {
   if (print == NULL) {
     return;
@@ -3045,28 +3360,43 @@ void acsi_printBootInfo(AcsiBootInfoPrint print) {
     return;
   }
 
-  if (acsiImagePath[0] == '\0') {
+  if (!acsiHasImage()) {
     print("ACSI: no image configured.\n");
     return;
   }
 
   char line[96];
 
-  // Image path — trim to the last 30 chars so long paths still fit.
-  const char *shortPath = acsiImagePath;
-  size_t pathLen = strlen(acsiImagePath);
-  const size_t maxPathChars = 30u;
-  if (pathLen > maxPathChars) {
-    shortPath = acsiImagePath + (pathLen - maxPathChars);
-    snprintf(line, sizeof(line), "Image: ..%s\n", shortPath);
-  } else {
-    snprintf(line, sizeof(line), "Image: %s\n", shortPath);
-  }
-  print(line);
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    const AcsiTarget *target = &acsiTargets[index];
+    if (target->imagePath[0] == '\0') {
+      continue;
+    }
 
-  uint8_t acsiId = acsiGetIdSetting();
-  snprintf(line, sizeof(line), "ACSI ID: %u\n", (unsigned int)acsiId);
-  print(line);
+    // Image path — trim to the last 30 chars so long paths still fit.
+    const char *shortPath = target->imagePath;
+    size_t pathLen = strlen(target->imagePath);
+    const size_t maxPathChars = 30u;
+    const char *ellipsis = "";
+    if (pathLen > maxPathChars) {
+      shortPath = target->imagePath + (pathLen - maxPathChars);
+      ellipsis = "..";
+    }
+    snprintf(line, sizeof(line), "Image: %s%s\n", ellipsis, shortPath);
+    print(line);
+
+    snprintf(line, sizeof(line), "ACSI ID: %u\n",
+             (unsigned int)target->acsiId);
+    print(line);
+
+    const AcsiSparse *sparse = target->image.sparse;
+    if (sparse != NULL) {
+      snprintf(line, sizeof(line), "Sparse: %lu of %lu blocks in use\n",
+               (unsigned long)acsi_sparse_allocated_blocks(sparse),
+               (unsigned long)acsi_sparse_block_count(sparse));
+      print(line);
+    }
+  }
 
   if (!acsiVolumeDriveRangeValid) {
     if (acsiScanOversizedSectorSize > 0u) {
@@ -3132,7 +3462,7 @@ void acsi_printBootInfo(AcsiBootInfoPrint print) {
 void __not_in_flash_func(acsi_init)() {
   DPRINTF("Initializing ACSI placeholder...\n");
 
-  acsi_image_close(&acsiRuntimeImage);
+  acsiCloseTargets();
   memorySharedAddress = (unsigned int)&__rom_in_ram_start__;
   memoryRandomTokenAddress = memorySharedAddress + ACSIEMUL_RANDOM_TOKEN_OFFSET;
   memoryRandomTokenSeedAddress =
@@ -3143,6 +3473,8 @@ void __not_in_flash_func(acsi_init)() {
   uint8_t acsiId = 0;
   uint8_t firstDrive = 2u;  // 'C' — unused here but acsiLoadConfiguredState expects it
   acsiLoadConfiguredState(&enabled, &acsiId, &firstDrive);
+  acsi_index_init(&acsiTargets[0].image,
+                  enabled && acsiIsReadAheadSetting());
 
   SET_SHARED_PRIVATE_VAR(ACSIEMUL_SVAR_ENABLED,
                          enabled ? 0xFFFFFFFFu : 0xDEAD0000u,
@@ -3190,7 +3522,15 @@ void __not_in_flash_func(acsi_init)() {
       "start_drive=%c (%u) image=%s\n",
       enabled ? "true" : "false", (unsigned int)acsiId,
       acsiDriveNumberToLetter(firstDrive), (unsigned int)firstDrive,
-      (acsiImagePath[0] != '\0') ? acsiImagePath : "<not set>");
+      (acsiTargets[0].imagePath[0] != '\0') ? acsiTargets[0].imagePath
+                                              : "<not set>");
+  for (uint8_t index = 1; index < ACSI_MAX_TARGETS; ++index) {
+    if (acsiTargets[index].imagePath[0] != '\0') {
+      DPRINTF("ACSI extra target: acsi_id=%u image=%s\n",
+              (unsigned int)acsiTargets[index].acsiId,
+              acsiTargets[index].imagePath);
+    }
+  }
   DPRINTF("ACSI shared drive range: first=%c (%lu) last=%c (%lu)\n",
           acsiDriveNumberToLetter(acsiFirstVolumeDrive),
           (unsigned long)acsiFirstVolumeDrive,
@@ -3199,24 +3539,76 @@ void __not_in_flash_func(acsi_init)() {
   DPRINTF("ACSI mediach mask init: %08lX\n", (unsigned long)mediaChangedMask);
 }
 
-void __not_in_flash_func(acsi_tick)(void) {
-  if (!acsiWriteDirty || !acsiRuntimeImage.isOpen ||
-      acsiRuntimeImage.readOnly) {
+static void __not_in_flash_func(acsiFlushTick)(AcsiTarget *target) {
+  if (!target->writeDirty || !target->image.isOpen ||
+      target->image.readOnly) {
     return;
   }
   uint32_t now = to_ms_since_boot(get_absolute_time());
-  if ((now - acsiWriteDirtyAtMs) < ACSI_FLUSH_INTERVAL_MS) {
+  if ((now - target->writeDirtyAtMs) < ACSI_FLUSH_INTERVAL_MS) {
     return;
   }
-  FRESULT fr = f_sync(&acsiRuntimeImage.file);
+  FRESULT fr = f_sync(&target->image.file);
   if (fr != FR_OK) {
     DPRINTF("ACSI tick f_sync failed (%d)\n", (int)fr);
     // Leave dirty so the next tick retries; pushing the timestamp forward
     // avoids tight-looping on a persistent error.
-    acsiWriteDirtyAtMs = now;
+    target->writeDirtyAtMs = now;
+    return;
+  }
+  target->writeDirty = false;
+}
+
+// A sparse image that grew lost its fastseek link map. Build it again once
+// the writes have settled and been flushed.
+static void acsiSparseTick(AcsiTarget *target) {
+  AcsiImageContext *image = &target->image;
+  if (!image->isOpen || target->writeDirty ||
+      !acsi_sparse_linkmap_stale(image->sparse)) {
     return;
   }
-  acsiWriteDirty = false;
+  acsi_sparse_linkmap_rebuilt(image->sparse);
+  if (image->cltbl != NULL) {
+    free(image->cltbl);
+    image->cltbl = NULL;
+    image->cltblEntries = 0;
+  }
+  (void)acsiSetupFastseek(image);
+}
+
+void __not_in_flash_func(acsi_tick)(void) {
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    acsiFlushTick(&acsiTargets[index]);
+    acsiSparseTick(&acsiTargets[index]);
+  }
+  // Prefetch while the Atari is busy with the data it already got
+  acsi_index_tick();
+}
+
+void acsi_release(void) {
+  for (uint8_t index = 0; index < ACSI_MAX_TARGETS; ++index) {
+    AcsiTarget *target = &acsiTargets[index];
+    if (target->writeDirty && target->image.isOpen &&
+        !target->image.readOnly) {
+      FRESULT fr = f_sync(&target->image.file);
+      if (fr != FR_OK) {
+        DPRINTF("ACSI release f_sync failed (%d)\n", (int)fr);
+      }
+    }
+    target->writeDirty = false;
+    acsi_image_close(&target->image);
+  }
+  // The prefetched sectors and chains may not survive the host writes
+  acsi_index_init(&acsiTargets[0].image,
+                  acsiIsEnabledSetting() && acsiIsReadAheadSetting());
+}
+
+void acsi_resume(void) {
+  // The image reopens on the next access. Report a media change so the
+  // Atari drops its own buffers.
+  SET_SHARED_PRIVATE_VAR(ACSIEMUL_SVAR_MEDIA_CHANGED_MASK,
+                         acsiBuildInitialMediaChangedMask(),
+                         memorySharedAddress, ACSIEMUL_SHARED_VARIABLES_OFFSET);
 }
 
 void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
@@ -3244,7 +3636,8 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      FRESULT fr = acsiEnsureRuntimeImageOpen();
+      AcsiTarget *target = &acsiTargets[acsiDriveTargets[driveNumber]];
+      FRESULT fr = acsiEnsureTargetOpen(target);
       if (fr != FR_OK) {
         DPRINTF("ACSI read open error drive=%c sector=%lu (%d)\n",
                 acsiDriveNumberToLetter(driveNumber),
@@ -3253,34 +3646,22 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      uint32_t recsize = acsiLogicalSectorSizes[driveNumber];
-      uint32_t physicalSectorCount = acsiLogicalToPhysicalRatios[driveNumber];
-      if ((recsize < ACSI_IMAGE_SECTOR_SIZE) ||
-          (recsize > ACSIEMUL_IMAGE_BUFFER_SIZE) ||
-          (physicalSectorCount == 0u)) {
-        DPRINTF("ACSI invalid mapping drive=%c recsize=%u ratio=%u\n",
-                acsiDriveNumberToLetter(driveNumber), (unsigned int)recsize,
-                (unsigned int)physicalSectorCount);
-        acsiSetRwStatus(-11);
-        break;
-      }
-
-      uint64_t physicalSector =
-          (uint64_t)acsiPunInfoStartSectors[driveNumber] +
-          ((uint64_t)logicalSector * (uint64_t)physicalSectorCount);
+      // The kernel of the drive was checked against the buffer size and
+      // the 32-bit LBA range at mount
+      const AcsiSectorKernel *kernel = acsiDriveKernels[driveNumber];
+      uint32_t recsize = kernel->sectorSize;
+      uint32_t physicalSectorCount = acsi_kernel_physical(kernel, 1u);
+      uint32_t physicalSector = acsiPunInfoStartSectors[driveNumber] +
+                                acsi_kernel_physical(kernel, logicalSector);
       DPRINTF(
           "ACSI READ_SECTOR physical drive=%c recno=%lu lba=%lu recsize=%u "
           "phys_count=%u\n",
           acsiDriveNumberToLetter(driveNumber), (unsigned long)logicalSector,
           (unsigned long)physicalSector, (unsigned int)recsize,
           (unsigned int)physicalSectorCount);
-      if (physicalSector > 0xFFFFFFFFu) {
-        acsiSetRwStatus(-11);
-        break;
-      }
 
-      fr = acsi_image_read_sectors(
-          &acsiRuntimeImage, (uint32_t)physicalSector,
+      fr = acsi_index_read_sectors(
+          &target->image, driveNumber, physicalSector,
           (uint16_t)physicalSectorCount,
           (void *)(uintptr_t)(memorySharedAddress +
                               ACSIEMUL_IMAGE_BUFFER_OFFSET),
@@ -3294,8 +3675,10 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      CHANGE_ENDIANESS_BLOCK16(
-          memorySharedAddress + ACSIEMUL_IMAGE_BUFFER_OFFSET, recsize);
+      kernel->swap(
+          (void *)(uintptr_t)(memorySharedAddress +
+                              ACSIEMUL_IMAGE_BUFFER_OFFSET),
+          1u);
       DPRINTF("ACSI READ_SECTOR ok drive=%c recno=%lu lba=%lu recsize=%u\n",
               acsiDriveNumberToLetter(driveNumber),
               (unsigned long)logicalSector, (unsigned long)physicalSector,
@@ -3313,16 +3696,13 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      uint32_t recsize = acsiLogicalSectorSizes[driveNumber];
-      uint32_t physicalSectorCount = acsiLogicalToPhysicalRatios[driveNumber];
-      uint32_t totalBytes = (uint32_t)sectorCount * recsize;
-      uint32_t totalPhysical = (uint32_t)sectorCount * physicalSectorCount;
+      const AcsiSectorKernel *kernel = acsiDriveKernels[driveNumber];
+      uint32_t recsize = kernel->sectorSize;
+      uint32_t totalBytes = acsi_kernel_bytes(kernel, sectorCount);
+      uint32_t totalPhysical = acsi_kernel_physical(kernel, sectorCount);
 
-      // recsize and physicalSectorCount are guaranteed non-zero (and recsize
-      // is a valid power of two in [512, 8192]) by acsiDriveIsOwned +
-      // the drive-table population gate, so only the batch-size ceiling
-      // needs checking here (totalBytes = sectorCount × recsize, and
-      // sectorCount comes from the wire).
+      // acsiDriveIsOwned guarantees a kernel, so only the batch-size
+      // ceiling needs checking here (sectorCount comes from the wire).
       if (totalBytes > ACSIEMUL_IMAGE_BUFFER_SIZE) {
         DPRINTF(
             "ACSI BATCH invalid drive=%c recsize=%u count=%u total=%lu "
@@ -3340,22 +3720,20 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      FRESULT fr = acsiEnsureRuntimeImageOpen();
+      AcsiTarget *target = &acsiTargets[acsiDriveTargets[driveNumber]];
+      FRESULT fr = acsiEnsureTargetOpen(target);
       if (fr != FR_OK) {
         acsiSetRwStatus(-11);
         break;
       }
 
-      uint64_t physicalSector =
-          (uint64_t)acsiPunInfoStartSectors[driveNumber] +
-          ((uint64_t)logicalSector * (uint64_t)physicalSectorCount);
-      if ((physicalSector + totalPhysical) > 0xFFFFFFFFu) {
-        acsiSetRwStatus(-11);
-        break;
-      }
+      // In the partition, so in the 32-bit LBA range checked at mount
+      uint32_t physicalSector = acsiPunInfoStartSectors[driveNumber] +
+                                acsi_kernel_physical(kernel, logicalSector);
 
-      fr = acsi_image_read_sectors(
-          &acsiRuntimeImage, (uint32_t)physicalSector, (uint16_t)totalPhysical,
+      fr = acsi_index_read_sectors(
+          &target->image, driveNumber, physicalSector,
+          (uint16_t)totalPhysical,
           (void *)(uintptr_t)(memorySharedAddress +
                               ACSIEMUL_IMAGE_BUFFER_OFFSET),
           totalBytes);
@@ -3368,8 +3746,10 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      CHANGE_ENDIANESS_BLOCK16(
-          memorySharedAddress + ACSIEMUL_IMAGE_BUFFER_OFFSET, totalBytes);
+      kernel->swap(
+          (void *)(uintptr_t)(memorySharedAddress +
+                              ACSIEMUL_IMAGE_BUFFER_OFFSET),
+          sectorCount);
       DPRINTF("ACSI BATCH ok drive=%c recno=%lu count=%u total=%lu\n",
               acsiDriveNumberToLetter(driveNumber),
               (unsigned long)logicalSector, (unsigned int)sectorCount,
@@ -3400,16 +3780,18 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         chunkSize = 1024u;
       }
 
-      if (!acsiDriveIsOwned(driveNumber)) {
-        DPRINTF("ACSI WRITE rejected: drive %u not owned\n",
-                (unsigned int)driveNumber);
+      if (!acsiDriveIsOwned(driveNumber) ||
+          logicalSector >= acsiPartitionSectorCounts[driveNumber]) {
+        DPRINTF("ACSI WRITE rejected: drive %u not owned or recno=%lu\n",
+                (unsigned int)driveNumber, (unsigned long)logicalSector);
         acsiSetRwStatus(-8);
         break;
       }
 
-      uint32_t recsize = acsiLogicalSectorSizes[driveNumber];
-      // acsiDriveIsOwned guarantees recsize is a valid power of two in
-      // [512, 8192]; only the chunk/offset bounds (from the wire) remain.
+      const AcsiSectorKernel *kernel = acsiDriveKernels[driveNumber];
+      uint32_t recsize = kernel->sectorSize;
+      // acsiDriveIsOwned guarantees a kernel; only the chunk/offset bounds
+      // (from the wire) remain.
       if (chunkSize == 0u || offsetInSector + chunkSize > recsize) {
         DPRINTF(
             "ACSI WRITE invalid drive=%c recno=%lu offset=%lu chunk=%lu "
@@ -3441,30 +3823,35 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
       }
 
       // Last chunk: byte-swap the assembled sector and flush to SD.
-      CHANGE_ENDIANESS_BLOCK16(
-          memorySharedAddress + ACSIEMUL_IMAGE_BUFFER_OFFSET, recsize);
+      kernel->swap(
+          (void *)(uintptr_t)(memorySharedAddress +
+                              ACSIEMUL_IMAGE_BUFFER_OFFSET),
+          1u);
 
-      FRESULT fr = acsiEnsureRuntimeImageOpen();
+      AcsiTarget *target = &acsiTargets[acsiDriveTargets[driveNumber]];
+      FRESULT fr = acsiEnsureTargetOpen(target);
       if (fr != FR_OK) {
         DPRINTF("ACSI WRITE open error (%d)\n", (int)fr);
         acsiSetRwStatus(-11);
         break;
       }
 
-      if (acsiRuntimeImage.readOnly) {
+      if (target->image.readOnly) {
         DPRINTF("ACSI WRITE rejected: image is read-only\n");
         acsiSetRwStatus(-13);
         break;
       }
 
-      uint32_t physicalSectorCount = acsiLogicalToPhysicalRatios[driveNumber];
-      uint64_t physicalSector =
-          (uint64_t)acsiPunInfoStartSectors[driveNumber] +
-          ((uint64_t)logicalSector * (uint64_t)physicalSectorCount);
+      uint32_t physicalSectorCount = acsi_kernel_physical(kernel, 1u);
+      uint32_t physicalSector = acsiPunInfoStartSectors[driveNumber] +
+                                acsi_kernel_physical(kernel, logicalSector);
 
+      acsi_index_note_write(driveNumber, physicalSector,
+                            (uint16_t)physicalSectorCount);
+      acsi_scancache_note_write(acsiDriveTargets[driveNumber], physicalSector,
+                                (uint16_t)physicalSectorCount);
       fr = acsi_image_write_sectors(
-          &acsiRuntimeImage, (uint32_t)physicalSector,
-          (uint16_t)physicalSectorCount,
+          &target->image, physicalSector, (uint16_t)physicalSectorCount,
           (void *)(uintptr_t)(memorySharedAddress +
                                ACSIEMUL_IMAGE_BUFFER_OFFSET),
           recsize);
@@ -3479,7 +3866,7 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
       DPRINTF("ACSI WRITE ok drive=%c recno=%lu recsize=%lu\n",
               acsiDriveNumberToLetter(driveNumber),
               (unsigned long)logicalSector, (unsigned long)recsize);
-      acsiMarkWriteDirty();
+      acsiMarkWriteDirty(target);
       acsiSetRwStatus(0);
     } break;
     case ACSIEMUL_WRITE_SECTOR_BATCH: {
@@ -3516,10 +3903,11 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
         break;
       }
 
-      uint32_t recsize = acsiLogicalSectorSizes[driveNumber];
-      // acsiDriveIsOwned guarantees recsize != 0; the remaining checks cover
+      const AcsiSectorKernel *kernel = acsiDriveKernels[driveNumber];
+      uint32_t recsize = kernel->sectorSize;
+      // acsiDriveIsOwned guarantees a kernel; the remaining checks cover
       // wire-supplied values (totalBytes, chunkSize, offsetInBatch).
-      if (totalBytes == 0u || (totalBytes % recsize) != 0u ||
+      if (totalBytes == 0u || (totalBytes & (recsize - 1u)) != 0u ||
           totalBytes > ACSIEMUL_IMAGE_BUFFER_SIZE || chunkSize == 0u ||
           offsetInBatch + chunkSize > totalBytes) {
         DPRINTF(
@@ -3553,44 +3941,50 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
       }
 
       // Last chunk — byte-swap the full batch and flush in one write.
-      CHANGE_ENDIANESS_BLOCK16(
-          memorySharedAddress + ACSIEMUL_IMAGE_BUFFER_OFFSET, totalBytes);
+      uint32_t logicalSectorCount = totalBytes >> kernel->sectorShift;
+      kernel->swap(
+          (void *)(uintptr_t)(memorySharedAddress +
+                              ACSIEMUL_IMAGE_BUFFER_OFFSET),
+          logicalSectorCount);
 
-      FRESULT fr = acsiEnsureRuntimeImageOpen();
+      AcsiTarget *target = &acsiTargets[acsiDriveTargets[driveNumber]];
+      FRESULT fr = acsiEnsureTargetOpen(target);
       if (fr != FR_OK) {
         DPRINTF("ACSI WRITE_BATCH open error (%d)\n", (int)fr);
         acsiSetRwStatus(-11);
         break;
       }
 
-      if (acsiRuntimeImage.readOnly) {
+      if (target->image.readOnly) {
         DPRINTF("ACSI WRITE_BATCH rejected: image is read-only\n");
         acsiSetRwStatus(-13);
         break;
       }
 
-      uint32_t logicalSectorCount = totalBytes / recsize;
-      uint32_t physicalSectorCount = acsiLogicalToPhysicalRatios[driveNumber];
-      uint64_t physicalSector =
-          (uint64_t)acsiPunInfoStartSectors[driveNumber] +
-          ((uint64_t)startLogicalSector * (uint64_t)physicalSectorCount);
-      uint64_t totalPhysical =
-          (uint64_t)logicalSectorCount * (uint64_t)physicalSectorCount;
+      // In the partition, so in the 32-bit LBA range checked at mount.
+      // totalBytes fits the buffer, so totalPhysical fits 16 bits.
+      uint32_t physicalSector =
+          acsiPunInfoStartSectors[driveNumber] +
+          acsi_kernel_physical(kernel, startLogicalSector);
+      uint32_t totalPhysical = acsi_kernel_physical(kernel, logicalSectorCount);
 
-      if ((physicalSector + totalPhysical) > 0xFFFFFFFFu ||
-          totalPhysical > 0xFFFFu) {
+      if ((startLogicalSector + logicalSectorCount) >
+          acsiPartitionSectorCounts[driveNumber]) {
         DPRINTF(
             "ACSI WRITE_BATCH out of range drive=%c recno=%lu count=%lu\n",
             acsiDriveNumberToLetter(driveNumber),
             (unsigned long)startLogicalSector,
             (unsigned long)logicalSectorCount);
-        acsiSetRwStatus(-11);
+        acsiSetRwStatus(-8);
         break;
       }
 
+      acsi_index_note_write(driveNumber, physicalSector,
+                            (uint16_t)totalPhysical);
+      acsi_scancache_note_write(acsiDriveTargets[driveNumber], physicalSector,
+                                (uint16_t)totalPhysical);
       fr = acsi_image_write_sectors(
-          &acsiRuntimeImage, (uint32_t)physicalSector,
-          (uint16_t)totalPhysical,
+          &target->image, physicalSector, (uint16_t)totalPhysical,
           (void *)(uintptr_t)(memorySharedAddress +
                                ACSIEMUL_IMAGE_BUFFER_OFFSET),
           totalBytes);
@@ -3609,7 +4003,7 @@ void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
           acsiDriveNumberToLetter(driveNumber),
           (unsigned long)startLogicalSector,
           (unsigned long)logicalSectorCount, (unsigned long)totalBytes);
-      acsiMarkWriteDirty();
+      acsiMarkWriteDirty(target);
       acsiSetRwStatus(0);
     } break;
     case ACSIEMUL_DEBUG: {
@@ -0,0 +1,570 @@
+/**
+ * File: acsi_index.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Lazy FAT16 directory and cluster chain index of the ACSI
+ * partitions, used to prefetch file reads along their own FAT chain.
+ */
+
+#include "acsi_index.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ACSI_INDEX_FAT_EOC 0xFFF8u
+#define ACSI_INDEX_NO_LBA 0xFFFFFFFFu
+
+typedef struct {
+  bool valid;
+  uint16_t clusterSectors;  // Physical sectors per cluster
+  uint32_t fatStartLBA;
+  uint32_t rootDirStartLBA;
+  uint32_t dataStartLBA;
+  uint32_t clusterCount;
+} AcsiIndexDrive;
+
+typedef struct {
+  uint32_t fileSize;
+  uint16_t firstCluster;  // 0 when the slot is free
+  uint8_t driveNumber;
+  bool isDirectory;
+} AcsiIndexFile;
+
+typedef struct {
+  uint32_t startLba;
+  uint32_t sectorCount;
+} AcsiIndexRun;
+
+// Window of a file's cluster chain, merged into physically contiguous runs.
+// nextLba is where the Atari is expected to read next; the prefetch starts
+// there. Until the window is built it holds the end of the last read.
+typedef struct {
+  bool inUse;
+  bool needsWindow;
+  bool wantPrefetch;
+  uint8_t driveNumber;
+  uint16_t firstCluster;
+  uint16_t nextCluster;  // First cluster after the window, 0 at the end
+  uint32_t remainingClusters;
+  uint32_t nextLba;
+  uint32_t lastUsed;
+  uint16_t runCount;
+  AcsiIndexRun runs[ACSI_INDEX_CHAIN_RUNS];
+} AcsiIndexChain;
+
+static AcsiImageContext *indexImage = NULL;
+static bool indexEnabled = false;
+static AcsiIndexDrive indexDrives[ACSI_PUN_INFO_MAXUNITS] = {0};
+static AcsiIndexFile indexFiles[ACSI_INDEX_FILES] = {0};
+static uint32_t indexFileNext = 0;
+static AcsiIndexChain indexChains[ACSI_INDEX_CHAINS] = {0};
+static uint32_t indexUseCounter = 0;
+
+// Last FAT sector read while walking a chain. Consecutive links almost
+// always live in the same sector.
+static BYTE indexFatSector[ACSI_IMAGE_SECTOR_SIZE] = {0};
+static uint32_t indexFatSectorLba = ACSI_INDEX_NO_LBA;
+
+// Read-ahead buffer, allocated only when the index is enabled. Each slot
+// holds one physical sector tagged with its LBA.
+static BYTE *readAheadBuffer = NULL;
+static uint32_t readAheadLba[ACSI_READAHEAD_SECTORS] = {0};
+static uint32_t readAheadValidMask = 0;
+static uint32_t readAheadHits = 0;
+static uint32_t readAheadMisses = 0;
+
+_Static_assert(ACSI_READAHEAD_SECTORS <= 32u,
+               "read-ahead slots are tracked in a 32-bit mask");
+
+static inline uint16_t indexReadLe16(const BYTE *buffer, size_t offset) {
+  return (uint16_t)buffer[offset] | ((uint16_t)buffer[offset + 1u] << 8);
+}
+
+static inline uint32_t indexReadLe32(const BYTE *buffer, size_t offset) {
+  return (uint32_t)buffer[offset] | ((uint32_t)buffer[offset + 1u] << 8) |
+         ((uint32_t)buffer[offset + 2u] << 16) |
+         ((uint32_t)buffer[offset + 3u] << 24);
+}
+
+static void indexResetRuntime(void) {
+  memset(indexFiles, 0, sizeof(indexFiles));
+  memset(indexChains, 0, sizeof(indexChains));
+  indexFileNext = 0;
+  indexUseCounter = 0;
+  indexFatSectorLba = ACSI_INDEX_NO_LBA;
+  readAheadValidMask = 0;
+  readAheadHits = 0;
+  readAheadMisses = 0;
+}
+
+static void indexDropDrive(uint16_t driveNumber) {
+  for (uint32_t i = 0; i < ACSI_INDEX_FILES; i++) {
+    if (indexFiles[i].driveNumber == driveNumber) {
+      indexFiles[i].firstCluster = 0;
+    }
+  }
+  for (uint32_t i = 0; i < ACSI_INDEX_CHAINS; i++) {
+    if (indexChains[i].driveNumber == driveNumber) {
+      indexChains[i].inUse = false;
+    }
+  }
+  indexFatSectorLba = ACSI_INDEX_NO_LBA;
+}
+
+static int __not_in_flash_func(readAheadFindSlot)(uint32_t lba) {
+  for (uint32_t slot = 0; slot < ACSI_READAHEAD_SECTORS; slot++) {
+    if ((readAheadValidMask & (1u << slot)) && readAheadLba[slot] == lba) {
+      return (int)slot;
+    }
+  }
+  return -1;
+}
+
+// Copy the prefetched sectors found at the start of the request. Returns
+// how many sectors were served from RAM.
+static uint16_t __not_in_flash_func(readAheadCopy)(uint32_t lba,
+                                                   uint16_t sectorCount,
+                                                   BYTE *buffer) {
+  uint16_t copied = 0;
+  while (copied < sectorCount) {
+    int slot = readAheadFindSlot(lba + copied);
+    if (slot < 0) break;
+    memcpy(buffer + ((size_t)copied * ACSI_IMAGE_SECTOR_SIZE),
+           readAheadBuffer + ((size_t)slot * ACSI_IMAGE_SECTOR_SIZE),
+           ACSI_IMAGE_SECTOR_SIZE);
+    copied++;
+  }
+  return copied;
+}
+
+static AcsiIndexFile *indexFindFile(uint16_t driveNumber, uint16_t cluster) {
+  for (uint32_t i = 0; i < ACSI_INDEX_FILES; i++) {
+    if (indexFiles[i].firstCluster == cluster &&
+        indexFiles[i].driveNumber == driveNumber) {
+      return &indexFiles[i];
+    }
+  }
+  return NULL;
+}
+
+static void indexAddFile(uint16_t driveNumber, uint16_t cluster,
+                         uint32_t fileSize, bool isDirectory) {
+  AcsiIndexFile *file = indexFindFile(driveNumber, cluster);
+  if (file == NULL) {
+    file = &indexFiles[indexFileNext];
+    indexFileNext = (indexFileNext + 1u) % ACSI_INDEX_FILES;
+  }
+  file->firstCluster = cluster;
+  file->driveNumber = (uint8_t)driveNumber;
+  file->fileSize = fileSize;
+  file->isDirectory = isDirectory;
+}
+
+// Record the entries of directory sectors just read by the Atari. The data
+// is still in the image byte order.
+static void indexDirectorySectors(uint16_t driveNumber, const BYTE *buffer,
+                                  uint32_t sectorCount) {
+  for (uint32_t offset = 0; offset < sectorCount * ACSI_IMAGE_SECTOR_SIZE;
+       offset += ACSI_ROOT_DIR_ENTRY_SIZE) {
+    const BYTE *entry = buffer + offset;
+    uint8_t attributes = entry[11];
+    if (entry[0] == 0x00u) {
+      return;  // End of directory
+    }
+    // Skip deleted entries, "." / "..", long names and the volume label
+    if (entry[0] == 0xE5u || entry[0] == '.' || attributes == 0x0Fu ||
+        (attributes & 0x08u) != 0u) {
+      continue;
+    }
+    uint16_t cluster = indexReadLe16(entry, 26);
+    if (cluster < 2u ||
+        cluster >= (indexDrives[driveNumber].clusterCount + 2u)) {
+      continue;
+    }
+    indexAddFile(driveNumber, cluster, indexReadLe32(entry, 28),
+                 (attributes & 0x10u) != 0u);
+  }
+}
+
+static FRESULT indexReadFatLink(const AcsiIndexDrive *drive, uint16_t cluster,
+                                uint16_t *nextCluster) {
+  uint32_t fatOffset = (uint32_t)cluster * 2u;
+  uint32_t sectorLba =
+      drive->fatStartLBA + (fatOffset / ACSI_IMAGE_SECTOR_SIZE);
+  if (sectorLba != indexFatSectorLba) {
+    indexFatSectorLba = ACSI_INDEX_NO_LBA;
+    FRESULT fr = acsi_image_read_sectors(indexImage, sectorLba, 1,
+                                         indexFatSector,
+                                         sizeof(indexFatSector));
+    if (fr != FR_OK) {
+      return fr;
+    }
+    indexFatSectorLba = sectorLba;
+  }
+  // FAT16 links are 2-byte aligned: never split across two sectors
+  *nextCluster =
+      indexReadLe16(indexFatSector, fatOffset % ACSI_IMAGE_SECTOR_SIZE);
+  return FR_OK;
+}
+
+static int indexChainFindRun(const AcsiIndexChain *chain, uint32_t lba) {
+  for (uint16_t i = 0; i < chain->runCount; i++) {
+    const AcsiIndexRun *run = &chain->runs[i];
+    if (lba >= run->startLba && lba < run->startLba + run->sectorCount) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+// Move the expected read position past a read served inside the window.
+static void indexChainAdvance(AcsiIndexChain *chain, int run, uint32_t endLba) {
+  chain->lastUsed = ++indexUseCounter;
+  chain->nextLba = endLba;
+  const AcsiIndexRun *current = &chain->runs[run];
+  if (endLba < current->startLba + current->sectorCount) {
+    chain->wantPrefetch = true;
+  } else if ((uint16_t)(run + 1) < chain->runCount) {
+    chain->nextLba = chain->runs[run + 1].startLba;
+    chain->wantPrefetch = true;
+  } else if (chain->nextCluster != 0u) {
+    chain->needsWindow = true;
+  } else {
+    chain->inUse = false;  // Whole file read
+  }
+}
+
+// Walk the FAT from nextCluster and rebuild the runs of the window.
+static void indexBuildWindow(AcsiIndexChain *chain) {
+  const AcsiIndexDrive *drive = &indexDrives[chain->driveNumber];
+  uint16_t cluster = chain->nextCluster;
+  uint32_t walked = 0;
+
+  chain->needsWindow = false;
+  chain->runCount = 0;
+  while (cluster != 0u && chain->remainingClusters > 0u &&
+         walked < ACSI_INDEX_WINDOW_CLUSTERS) {
+    uint32_t lba = drive->dataStartLBA +
+                   ((uint32_t)(cluster - 2u) * drive->clusterSectors);
+    AcsiIndexRun *last =
+        (chain->runCount > 0u) ? &chain->runs[chain->runCount - 1u] : NULL;
+    if (last != NULL && last->startLba + last->sectorCount == lba) {
+      last->sectorCount += drive->clusterSectors;
+    } else if (chain->runCount < ACSI_INDEX_CHAIN_RUNS) {
+      chain->runs[chain->runCount].startLba = lba;
+      chain->runs[chain->runCount].sectorCount = drive->clusterSectors;
+      chain->runCount++;
+    } else {
+      break;  // Window full: cluster starts the next one
+    }
+    chain->remainingClusters--;
+    walked++;
+
+    uint16_t next = 0;
+    if (indexReadFatLink(drive, cluster, &next) != FR_OK) {
+      cluster = 0;
+      break;
+    }
+    // End of chain, bad cluster or a link out of range: stop here
+    if (next >= ACSI_INDEX_FAT_EOC || next < 2u ||
+        next >= drive->clusterCount + 2u) {
+      cluster = 0;
+      break;
+    }
+    cluster = next;
+  }
+  chain->nextCluster = (chain->remainingClusters > 0u) ? cluster : 0u;
+
+  if (chain->runCount == 0u) {
+    chain->inUse = false;
+    return;
+  }
+  DPRINTF("ACSI index: chain cluster=%u runs=%u next=%u left=%lu\n",
+          (unsigned int)chain->firstCluster, (unsigned int)chain->runCount,
+          (unsigned int)chain->nextCluster,
+          (unsigned long)chain->remainingClusters);
+
+  // First window: the last read is inside it. Next windows: the reader
+  // continues at the start of the new window.
+  int run = indexChainFindRun(chain, chain->nextLba - 1u);
+  if (run >= 0) {
+    indexChainAdvance(chain, run, chain->nextLba);
+  } else {
+    chain->nextLba = chain->runs[0].startLba;
+    chain->wantPrefetch = true;
+  }
+}
+
+static void indexStartChain(uint16_t driveNumber, const AcsiIndexFile *file,
+                            uint32_t nextLba) {
+  const AcsiIndexDrive *drive = &indexDrives[driveNumber];
+  AcsiIndexChain *chain = NULL;
+  for (uint32_t i = 0; i < ACSI_INDEX_CHAINS; i++) {
+    AcsiIndexChain *candidate = &indexChains[i];
+    if (candidate->inUse && candidate->driveNumber == driveNumber &&
+        candidate->firstCluster == file->firstCluster) {
+      chain = candidate;  // Same file opened again: restart its chain
+      break;
+    }
+    if (chain == NULL || !candidate->inUse ||
+        (chain->inUse && candidate->lastUsed < chain->lastUsed)) {
+      chain = candidate;
+    }
+  }
+
+  uint32_t clusterBytes =
+      (uint32_t)drive->clusterSectors * ACSI_IMAGE_SECTOR_SIZE;
+  memset(chain, 0, sizeof(*chain));
+  chain->inUse = true;
+  chain->needsWindow = true;
+  chain->driveNumber = (uint8_t)driveNumber;
+  chain->firstCluster = file->firstCluster;
+  chain->nextCluster = file->firstCluster;
+  chain->remainingClusters =
+      (uint32_t)(((uint64_t)file->fileSize + clusterBytes - 1u) /
+                 clusterBytes);
+  chain->nextLba = nextLba;
+  chain->lastUsed = ++indexUseCounter;
+  DPRINTF("ACSI index: file cluster=%u size=%lu hits=%lu misses=%lu\n",
+          (unsigned int)file->firstCluster, (unsigned long)file->fileSize,
+          (unsigned long)readAheadHits, (unsigned long)readAheadMisses);
+}
+
+static void indexNoteRead(uint16_t driveNumber, uint32_t lba,
+                          uint16_t sectorCount, const BYTE *buffer) {
+  const AcsiIndexDrive *drive = &indexDrives[driveNumber];
+  uint32_t endLba = lba + sectorCount;
+
+  // Sequential read of a file with a chain in RAM
+  for (uint32_t i = 0; i < ACSI_INDEX_CHAINS; i++) {
+    AcsiIndexChain *chain = &indexChains[i];
+    if (!chain->inUse || chain->driveNumber != driveNumber ||
+        chain->needsWindow) {
+      continue;
+    }
+    int run = indexChainFindRun(chain, endLba - 1u);
+    if (run >= 0) {
+      indexChainAdvance(chain, run, endLba);
+      return;
+    }
+  }
+
+  if (lba >= drive->rootDirStartLBA && lba < drive->dataStartLBA) {
+    uint32_t rootSectors = drive->dataStartLBA - lba;
+    indexDirectorySectors(driveNumber, buffer,
+                          (sectorCount < rootSectors) ? sectorCount
+                                                      : rootSectors);
+    return;
+  }
+
+  // Only the first sector of a cluster can start a file or a directory
+  if (lba < drive->dataStartLBA ||
+      ((lba - drive->dataStartLBA) % drive->clusterSectors) != 0u) {
+    return;
+  }
+  uint32_t cluster =
+      2u + ((lba - drive->dataStartLBA) / drive->clusterSectors);
+  if (cluster >= drive->clusterCount + 2u) {
+    return;
+  }
+  const AcsiIndexFile *file = indexFindFile(driveNumber, (uint16_t)cluster);
+  if (file == NULL) {
+    return;
+  }
+  if (file->isDirectory) {
+    indexDirectorySectors(driveNumber, buffer,
+                          (sectorCount < drive->clusterSectors)
+                              ? sectorCount
+                              : drive->clusterSectors);
+    return;
+  }
+  if ((uint64_t)file->fileSize >
+      (uint64_t)sectorCount * ACSI_IMAGE_SECTOR_SIZE) {
+    indexStartChain(driveNumber, file, endLba);
+  }
+}
+
+// Fill the read-ahead buffer from the expected read position, following
+// the runs of the window.
+static void indexPrefetch(AcsiIndexChain *chain) {
+  chain->wantPrefetch = false;
+  if (readAheadFindSlot(chain->nextLba) >= 0) {
+    return;  // Still ahead of the reader
+  }
+  int run = indexChainFindRun(chain, chain->nextLba);
+  if (run < 0) {
+    return;
+  }
+
+  readAheadValidMask = 0;
+  uint32_t slot = 0;
+  uint32_t lba = chain->nextLba;
+  while (slot < ACSI_READAHEAD_SECTORS && (uint16_t)run < chain->runCount) {
+    const AcsiIndexRun *current = &chain->runs[run];
+    uint32_t count = current->startLba + current->sectorCount - lba;
+    if (count > ACSI_READAHEAD_SECTORS - slot) {
+      count = ACSI_READAHEAD_SECTORS - slot;
+    }
+    FRESULT fr = acsi_image_read_sectors(
+        indexImage, lba, (uint16_t)count,
+        readAheadBuffer + (slot * ACSI_IMAGE_SECTOR_SIZE),
+        (ACSI_READAHEAD_SECTORS - slot) * ACSI_IMAGE_SECTOR_SIZE);
+    if (fr != FR_OK) {
+      DPRINTF("ACSI index: prefetch lba=%lu failed (%d)\n",
+              (unsigned long)lba, (int)fr);
+      return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      readAheadLba[slot + i] = lba + i;
+      readAheadValidMask |= (1u << (slot + i));
+    }
+    slot += count;
+    run++;
+    if ((uint16_t)run < chain->runCount) {
+      lba = chain->runs[run].startLba;
+    }
+  }
+}
+
+void acsi_index_init(AcsiImageContext *context, bool enabled) {
+  indexImage = context;
+  indexResetRuntime();
+
+  if (enabled && readAheadBuffer == NULL) {
+    readAheadBuffer = malloc(ACSI_READAHEAD_SECTORS * ACSI_IMAGE_SECTOR_SIZE);
+    if (readAheadBuffer == NULL) {
+      DPRINTF("ACSI index: cannot allocate the read-ahead buffer\n");
+    }
+  } else if (!enabled && readAheadBuffer != NULL) {
+    free(readAheadBuffer);
+    readAheadBuffer = NULL;
+  }
+  indexEnabled = enabled && (readAheadBuffer != NULL) && (context != NULL);
+  DPRINTF("ACSI index: %s\n", indexEnabled ? "enabled" : "disabled");
+}
+
+void acsi_index_clear_drives(void) {
+  memset(indexDrives, 0, sizeof(indexDrives));
+  indexResetRuntime();
+}
+
+void acsi_index_set_drive(uint16_t driveNumber,
+                          const AcsiFat16Geometry *geometry, uint16_t ratio) {
+  if (driveNumber >= ACSI_PUN_INFO_MAXUNITS || geometry == NULL) {
+    return;
+  }
+  AcsiIndexDrive *drive = &indexDrives[driveNumber];
+  memset(drive, 0, sizeof(*drive));
+
+  uint32_t clusterSectors = (uint32_t)geometry->sectorsPerCluster * ratio;
+  if (clusterSectors == 0u || clusterSectors > 0xFFFFu) {
+    return;
+  }
+  drive->clusterSectors = (uint16_t)clusterSectors;
+  drive->fatStartLBA = geometry->fatStartLBA;
+  drive->rootDirStartLBA = geometry->rootDirStartLBA;
+  drive->dataStartLBA = geometry->dataStartLBA;
+  drive->clusterCount = geometry->clusterCount;
+  drive->valid = true;
+}
+
+FRESULT __not_in_flash_func(acsi_index_read_sectors)(
+    AcsiImageContext *context, uint16_t driveNumber, uint32_t lba,
+    uint16_t sectorCount, void *buffer, size_t bufferSize) {
+  if (!indexEnabled || context != indexImage || buffer == NULL ||
+      bufferSize < (size_t)sectorCount * ACSI_IMAGE_SECTOR_SIZE) {
+    return acsi_image_read_sectors(context, lba, sectorCount, buffer,
+                                   bufferSize);
+  }
+
+  BYTE *bytes = (BYTE *)buffer;
+  uint16_t cached = readAheadCopy(lba, sectorCount, bytes);
+  FRESULT fr = FR_OK;
+  if (cached < sectorCount) {
+    size_t cachedBytes = (size_t)cached * ACSI_IMAGE_SECTOR_SIZE;
+    fr = acsi_image_read_sectors(context, lba + cached,
+                                 (uint16_t)(sectorCount - cached),
+                                 bytes + cachedBytes, bufferSize - cachedBytes);
+  }
+  if (cached > 0u) {
+    readAheadHits++;
+  } else {
+    readAheadMisses++;
+  }
+
+  if (fr == FR_OK && driveNumber < ACSI_PUN_INFO_MAXUNITS &&
+      indexDrives[driveNumber].valid) {
+    indexNoteRead(driveNumber, lba, sectorCount, bytes);
+  }
+  return fr;
+}
+
+void acsi_index_note_write(uint16_t driveNumber, uint32_t lba,
+                           uint16_t sectorCount) {
+  if (!indexEnabled || sectorCount == 0u) {
+    return;
+  }
+
+  uint32_t endLba = lba + sectorCount;
+  for (uint32_t slot = 0; slot < ACSI_READAHEAD_SECTORS; slot++) {
+    if (readAheadLba[slot] >= lba && readAheadLba[slot] < endLba) {
+      readAheadValidMask &= ~(1u << slot);
+    }
+  }
+  if (indexFatSectorLba >= lba && indexFatSectorLba < endLba) {
+    indexFatSectorLba = ACSI_INDEX_NO_LBA;
+  }
+
+  if (driveNumber >= ACSI_PUN_INFO_MAXUNITS ||
+      !indexDrives[driveNumber].valid) {
+    return;
+  }
+  const AcsiIndexDrive *drive = &indexDrives[driveNumber];
+  // FAT and root directory writes change chains and entries
+  if (lba < drive->dataStartLBA) {
+    indexDropDrive(driveNumber);
+    return;
+  }
+  uint32_t firstCluster =
+      2u + ((lba - drive->dataStartLBA) / drive->clusterSectors);
+  uint32_t lastCluster =
+      2u + ((endLba - 1u - drive->dataStartLBA) / drive->clusterSectors);
+  for (uint32_t cluster = firstCluster;
+       cluster <= lastCluster && cluster < drive->clusterCount + 2u;
+       cluster++) {
+    const AcsiIndexFile *file = indexFindFile(driveNumber, (uint16_t)cluster);
+    if (file != NULL && file->isDirectory) {
+      indexDropDrive(driveNumber);
+      return;
+    }
+  }
+}
+
+void acsi_index_tick(void) {
+  if (!indexEnabled) {
+    return;
+  }
+
+  // Most recently used chain with work to do
+  AcsiIndexChain *chain = NULL;
+  for (uint32_t i = 0; i < ACSI_INDEX_CHAINS; i++) {
+    AcsiIndexChain *candidate = &indexChains[i];
+    if (!candidate->inUse ||
+        !(candidate->needsWindow || candidate->wantPrefetch)) {
+      continue;
+    }
+    if (chain == NULL || candidate->lastUsed > chain->lastUsed) {
+      chain = candidate;
+    }
+  }
+  if (chain == NULL) {
+    return;
+  }
+
+  if (chain->needsWindow) {
+    indexBuildWindow(chain);
+  } else {
+    indexPrefetch(chain);
+  }
+}
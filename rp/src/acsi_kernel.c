@@ -0,0 +1,57 @@
+/**
+ * File: acsi_kernel.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: ACSI sector kernels, one per logical sector size.
+ */
+
+#include "acsi_kernel.h"
+
+#include "pico/stdlib.h"
+
+// Swaps the two bytes of both 16-bit words of a longword
+#define ACSI_KERNEL_SWAP16X2(value) \
+  ((((value) & 0x00FF00FFu) << 8) | (((value) >> 8) & 0x00FF00FFu))
+
+// The trip count of the inner loop is a constant of each kernel: no
+// remainder to handle, and four longwords per iteration
+#define ACSI_KERNEL_SWAP(size)                                              \
+  static void __not_in_flash_func(acsiKernelSwap##size)(void *buffer,       \
+                                                        uint32_t sectors) { \
+    uint32_t *words = (uint32_t *)buffer;                                   \
+    while (sectors-- > 0u) {                                                \
+      for (uint32_t i = 0; i < (size) / 4u; i += 4u) {                      \
+        words[i] = ACSI_KERNEL_SWAP16X2(words[i]);                          \
+        words[i + 1u] = ACSI_KERNEL_SWAP16X2(words[i + 1u]);                \
+        words[i + 2u] = ACSI_KERNEL_SWAP16X2(words[i + 2u]);                \
+        words[i + 3u] = ACSI_KERNEL_SWAP16X2(words[i + 3u]);                \
+      }                                                                     \
+      words += (size) / 4u;                                                 \
+    }                                                                       \
+  }
+
+ACSI_KERNEL_SWAP(512)
+ACSI_KERNEL_SWAP(1024)
+ACSI_KERNEL_SWAP(2048)
+ACSI_KERNEL_SWAP(4096)
+ACSI_KERNEL_SWAP(8192)
+
+static const AcsiSectorKernel acsiKernels[ACSI_KERNEL_COUNT] = {
+    {512u, 9u, 0u, acsiKernelSwap512},   {1024u, 10u, 1u, acsiKernelSwap1024},
+    {2048u, 11u, 2u, acsiKernelSwap2048}, {4096u, 12u, 3u, acsiKernelSwap4096},
+    {8192u, 13u, 4u, acsiKernelSwap8192},
+};
+
+const AcsiSectorKernel *acsi_kernel_get(uint32_t logicalSectorSize) {
+  for (uint8_t i = 0; i < ACSI_KERNEL_COUNT; ++i) {
+    if (acsiKernels[i].sectorSize == logicalSectorSize) {
+      return &acsiKernels[i];
+    }
+  }
+  return NULL;
+}
+
+const AcsiSectorKernel *acsi_kernel_at(uint8_t index) {
+  return (index < ACSI_KERNEL_COUNT) ? &acsiKernels[index] : NULL;
+}
@@ -0,0 +1,251 @@
+/**
+ * File: acsi_scancache.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: ACSI partition scan results kept in flash between boots.
+ */
+
+#include "acsi_scancache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "constants.h"
+#include "debug.h"
+#include "hardware/flash.h"
+#include "pico/flash.h"
+#include "pico/stdlib.h"
+
+_Static_assert(sizeof(AcsiScanCacheHeader) <= ACSI_SCANCACHE_REVOKE_OFFSET,
+               "The scan cache header overlaps the revoke page");
+
+typedef struct {
+  const uint8_t *data;
+  size_t offset;  // From the start of the cache sector
+  size_t size;
+  bool erase;  // The whole sector first
+} ScanCacheWrite;
+
+static bool cacheEnabled = false;
+// Ranges read by the scan being traced, freed by acsi_scancache_store
+static AcsiScanRange *traceRanges = NULL;
+static uint16_t traceCount = 0;
+static uint8_t traceTarget = 0;
+// Set while the scan in flash is valid: writes are checked against it
+static bool watching = false;
+
+static inline const AcsiScanCacheHeader *flashHeader(void) {
+  return (const AcsiScanCacheHeader *)&_acsi_scan_flash_start;
+}
+
+static inline uint32_t flashOffset(void) {
+  return (uint32_t)&_acsi_scan_flash_start - XIP_BASE;
+}
+
+static inline bool isRevoked(void) {
+  return ((const uint8_t *)flashHeader())[ACSI_SCANCACHE_REVOKE_OFFSET] !=
+         0xFF;
+}
+
+uint32_t acsi_scancache_hash(uint32_t hash, const void *data, size_t size) {
+  const uint8_t *p = (const uint8_t *)data;
+  while (size-- > 0) {
+    hash ^= *p++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t checksumRecord(const AcsiScanCacheHeader *header) {
+  const uint8_t *start = (const uint8_t *)&header->key;
+  size_t size = sizeof(AcsiScanCacheHeader) -
+                offsetof(AcsiScanCacheHeader, key) + header->resultsSize;
+  return acsi_scancache_hash(ACSI_SCANCACHE_HASH_SEED, start, size);
+}
+
+void acsi_scancache_init(bool enabled) {
+  cacheEnabled = enabled;
+  watching = false;
+  free(traceRanges);
+  traceRanges = NULL;
+  traceCount = 0;
+}
+
+bool acsi_scancache_load(uint32_t key, void *results, size_t size) {
+  if (!cacheEnabled || results == NULL) {
+    return false;
+  }
+
+  const AcsiScanCacheHeader *header = flashHeader();
+  if (header->magic != ACSI_SCANCACHE_MAGIC ||
+      header->version != ACSI_SCANCACHE_VERSION || header->key != key ||
+      header->resultsSize != size || isRevoked()) {
+    return false;
+  }
+  if (header->rangeCount > ACSI_SCANCACHE_MAX_RANGES &&
+      header->rangeCount != ACSI_SCANCACHE_ALL_SECTORS) {
+    return false;
+  }
+  if (checksumRecord(header) != header->checksum) {
+    DPRINTF("ACSI scan cache: bad checksum\n");
+    return false;
+  }
+
+  memcpy(results, (const uint8_t *)header + sizeof(AcsiScanCacheHeader),
+         size);
+  watching = true;
+  return true;
+}
+
+void acsi_scancache_trace_start(void) {
+  free(traceRanges);
+  traceRanges = NULL;
+  traceCount = 0;
+  traceTarget = 0;
+  if (!cacheEnabled) {
+    return;
+  }
+  traceRanges = malloc(ACSI_SCANCACHE_MAX_RANGES * sizeof(AcsiScanRange));
+  if (traceRanges == NULL) {
+    DPRINTF("ACSI scan cache: no memory to trace the scan\n");
+  }
+}
+
+void acsi_scancache_trace_target(uint8_t target) { traceTarget = target; }
+
+void __not_in_flash_func(acsi_scancache_trace_read)(uint32_t lba,
+                                                    uint16_t sectors) {
+  if (traceRanges == NULL || traceCount == ACSI_SCANCACHE_ALL_SECTORS) {
+    return;
+  }
+
+  for (uint16_t i = 0; i < traceCount; ++i) {
+    AcsiScanRange *range = &traceRanges[i];
+    if (range->target != traceTarget) continue;
+    if (lba >= range->lba && lba + sectors <= range->lba + range->sectors) {
+      return;
+    }
+    // Sequential reads grow the last range
+    if (i + 1u == traceCount && lba == range->lba + range->sectors &&
+        (uint32_t)range->sectors + sectors <= 0xFFFFu) {
+      range->sectors += sectors;
+      return;
+    }
+  }
+
+  if (traceCount == ACSI_SCANCACHE_MAX_RANGES) {
+    traceCount = ACSI_SCANCACHE_ALL_SECTORS;
+    return;
+  }
+  AcsiScanRange *range = &traceRanges[traceCount++];
+  range->lba = lba;
+  range->sectors = sectors;
+  range->target = traceTarget;
+  range->reserved = 0;
+}
+
+static void flashWrite(void *param) {
+  const ScanCacheWrite *write = (const ScanCacheWrite *)param;
+  if (write->erase) {
+    flash_range_erase(flashOffset(), ACSI_SCANCACHE_FLASH_SIZE);
+  }
+  flash_range_program(flashOffset() + write->offset, write->data,
+                      write->size);
+}
+
+// Core 1 runs flash-resident code during the emulation: flash_safe_execute
+// holds it in RAM for the write
+static bool writeFlash(const ScanCacheWrite *write) {
+  int err = flash_safe_execute(flashWrite, (void *)write,
+                               ACSI_SCANCACHE_FLASH_TIMEOUT_MS);
+  if (err != PICO_OK) {
+    DPRINTF("ACSI scan cache: flash write failed: %d\n", err);
+  }
+  return err == PICO_OK;
+}
+
+void acsi_scancache_store(uint32_t key, const void *results, size_t size) {
+  if (traceRanges == NULL || results == NULL ||
+      sizeof(AcsiScanCacheHeader) + size > ACSI_SCANCACHE_REVOKE_OFFSET) {
+    free(traceRanges);
+    traceRanges = NULL;
+    return;
+  }
+
+  // Whole pages, padded with erased bytes
+  size_t recordSize = sizeof(AcsiScanCacheHeader) + size;
+  size_t programSize =
+      (recordSize + FLASH_PAGE_SIZE - 1u) & ~(size_t)(FLASH_PAGE_SIZE - 1u);
+  uint8_t *record = malloc(programSize);
+  if (record == NULL) {
+    DPRINTF("ACSI scan cache: no memory to store the scan\n");
+    free(traceRanges);
+    traceRanges = NULL;
+    return;
+  }
+  memset(record, 0xFF, programSize);
+
+  AcsiScanCacheHeader *header = (AcsiScanCacheHeader *)record;
+  memset(header, 0, sizeof(*header));
+  header->magic = ACSI_SCANCACHE_MAGIC;
+  header->version = ACSI_SCANCACHE_VERSION;
+  header->key = key;
+  header->resultsSize = (uint16_t)size;
+  header->rangeCount = traceCount;
+  if (traceCount != ACSI_SCANCACHE_ALL_SECTORS) {
+    memcpy(header->ranges, traceRanges, traceCount * sizeof(AcsiScanRange));
+  }
+  memcpy(record + sizeof(AcsiScanCacheHeader), results, size);
+  header->checksum = checksumRecord(header);
+
+  free(traceRanges);
+  traceRanges = NULL;
+
+  ScanCacheWrite write = {record, 0, programSize, true};
+  bool stored = writeFlash(&write);
+  free(record);
+  if (!stored) return;
+
+  DPRINTF("ACSI scan cache: stored %u bytes, %u ranges\n",
+          (unsigned int)recordSize, (unsigned int)header->rangeCount);
+  watching = true;
+}
+
+static void revoke(void) {
+  watching = false;
+  if (flashHeader()->magic != ACSI_SCANCACHE_MAGIC || isRevoked()) {
+    return;
+  }
+
+  // Bits only go from 1 to 0, so the page is programmed without erasing
+  uint8_t page[FLASH_PAGE_SIZE];
+  memset(page, 0, sizeof(page));
+  ScanCacheWrite write = {page, ACSI_SCANCACHE_REVOKE_OFFSET, sizeof(page),
+                          false};
+  if (!writeFlash(&write)) return;
+  DPRINTF("ACSI scan cache revoked\n");
+}
+
+void __not_in_flash_func(acsi_scancache_note_write)(uint8_t target,
+                                                    uint32_t lba,
+                                                    uint16_t sectors) {
+  if (!watching) {
+    return;
+  }
+
+  const AcsiScanCacheHeader *header = flashHeader();
+  if (header->rangeCount != ACSI_SCANCACHE_ALL_SECTORS) {
+    bool overlaps = false;
+    for (uint16_t i = 0; i < header->rangeCount && !overlaps; ++i) {
+      const AcsiScanRange *range = &header->ranges[i];
+      overlaps = (range->target == target) &&
+                 (lba < range->lba + range->sectors) &&
+                 (range->lba < lba + sectors);
+    }
+    if (!overlaps) {
+      return;
+    }
+  }
+  revoke();
+}
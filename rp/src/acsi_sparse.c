@@ -0,0 +1,307 @@
+/**
+ * File: acsi_sparse.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Sparse ACSI image container. Holes read as zeros and new
+ * blocks are appended to the file the first time non-zero data is written.
+ */
+
+#include "acsi_sparse.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "pico/stdlib.h"
+
+#define SPARSE_SECTOR_SIZE 512u
+#define SPARSE_MAP_ENTRIES (SPARSE_SECTOR_SIZE / sizeof(uint32_t))
+#define SPARSE_NO_MAP_SECTOR 0xFFFFFFFFu
+
+_Static_assert(sizeof(AcsiSparseHeader) == 32,
+               "AcsiSparseHeader must match the on-disk header");
+
+struct AcsiSparse {
+  AcsiSparseHeader header;
+  uint8_t blockShift;
+  uint32_t nextBlock;  // Data block given to the next allocation
+  uint32_t allocated;
+  bool linkmapStale;
+  uint32_t mapCacheSector;  // Map sector held in mapCache
+  uint32_t mapCache[SPARSE_MAP_ENTRIES];
+  uint8_t zeros[SPARSE_SECTOR_SIZE];
+  uint32_t bitmap[];  // One bit per block, set when allocated
+};
+
+static inline bool sparseIsAllocated(const AcsiSparse *sparse,
+                                     uint32_t block) {
+  return (sparse->bitmap[block >> 5] & (1u << (block & 31u))) != 0;
+}
+
+static inline FSIZE_t sparseBlockOffset(const AcsiSparse *sparse,
+                                        uint32_t dataBlock) {
+  // Data blocks are numbered from 1: 0 is a hole in the map
+  uint64_t sector = (uint64_t)sparse->header.dataSector +
+                    ((uint64_t)(dataBlock - 1u) << sparse->blockShift);
+  return (FSIZE_t)(sector * SPARSE_SECTOR_SIZE);
+}
+
+static FRESULT sparseLoadMapSector(AcsiSparse *sparse, FIL *file,
+                                   uint32_t mapSector) {
+  if (sparse->mapCacheSector == mapSector) return FR_OK;
+  sparse->mapCacheSector = SPARSE_NO_MAP_SECTOR;
+  FSIZE_t offset =
+      (FSIZE_t)(sparse->header.mapSector + mapSector) * SPARSE_SECTOR_SIZE;
+  UINT br = 0;
+  FRESULT fr = f_lseek(file, offset);
+  if (fr == FR_OK) {
+    fr = f_read(file, sparse->mapCache, SPARSE_SECTOR_SIZE, &br);
+  }
+  if (fr != FR_OK) return fr;
+  if (br != SPARSE_SECTOR_SIZE) return FR_INT_ERR;
+  sparse->mapCacheSector = mapSector;
+  return FR_OK;
+}
+
+static FRESULT sparseGetDataBlock(AcsiSparse *sparse, FIL *file,
+                                  uint32_t block, uint32_t *dataBlock) {
+  FRESULT fr = sparseLoadMapSector(sparse, file, block / SPARSE_MAP_ENTRIES);
+  if (fr != FR_OK) return fr;
+  *dataBlock = sparse->mapCache[block % SPARSE_MAP_ENTRIES];
+  return (*dataBlock == 0) ? FR_INT_ERR : FR_OK;
+}
+
+static bool __not_in_flash_func(sparseIsZero)(const uint8_t *data,
+                                              size_t size) {
+  if (((uintptr_t)data & 3u) != 0) {
+    for (size_t i = 0; i < size; i++) {
+      if (data[i] != 0) return false;
+    }
+    return true;
+  }
+  const uint32_t *words = (const uint32_t *)data;
+  for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+    if (words[i] != 0) return false;
+  }
+  return true;
+}
+
+static FRESULT sparseWriteAll(FIL *file, const void *data, UINT size) {
+  UINT bw = 0;
+  FRESULT fr = f_write(file, data, size, &bw);
+  if (fr != FR_OK) return fr;
+  return (bw == size) ? FR_OK : FR_DENIED;  // Card full
+}
+
+// Append a data block for block, with the sectors from first on taken from
+// data and the rest zero, then point the map at it.
+static FRESULT sparseAllocate(AcsiSparse *sparse, FIL *file, uint32_t block,
+                              uint32_t first, uint32_t count,
+                              const uint8_t *data) {
+  // FatFs cannot grow a file while the fastseek link map is on
+  if (file->cltbl != NULL) {
+    file->cltbl = NULL;
+    sparse->linkmapStale = true;
+  }
+
+  uint32_t dataBlock = sparse->nextBlock;
+  uint32_t blockSectors = sparse->header.blockSectors;
+  FRESULT fr = f_lseek(file, sparseBlockOffset(sparse, dataBlock));
+  for (uint32_t i = 0; fr == FR_OK && i < first; i++) {
+    fr = sparseWriteAll(file, sparse->zeros, SPARSE_SECTOR_SIZE);
+  }
+  if (fr == FR_OK) {
+    fr = sparseWriteAll(file, data, count * SPARSE_SECTOR_SIZE);
+  }
+  for (uint32_t i = first + count; fr == FR_OK && i < blockSectors; i++) {
+    fr = sparseWriteAll(file, sparse->zeros, SPARSE_SECTOR_SIZE);
+  }
+  if (fr != FR_OK) return fr;
+  sparse->nextBlock++;
+
+  // The map sector goes to the card after the data: a power cut leaves at
+  // most an unused block at the end of the file
+  uint32_t mapSector = block / SPARSE_MAP_ENTRIES;
+  fr = sparseLoadMapSector(sparse, file, mapSector);
+  if (fr != FR_OK) return fr;
+  sparse->mapCache[block % SPARSE_MAP_ENTRIES] = dataBlock;
+  fr = f_lseek(file, (FSIZE_t)(sparse->header.mapSector + mapSector) *
+                         SPARSE_SECTOR_SIZE);
+  if (fr == FR_OK) {
+    fr = sparseWriteAll(file, sparse->mapCache, SPARSE_SECTOR_SIZE);
+  }
+  if (fr != FR_OK) {
+    sparse->mapCacheSector = SPARSE_NO_MAP_SECTOR;
+    return fr;
+  }
+  sparse->bitmap[block >> 5] |= 1u << (block & 31u);
+  sparse->allocated++;
+  return FR_OK;
+}
+
+FRESULT acsi_sparse_open(FIL *file, AcsiSparse **sparseOut,
+                         uint32_t *totalSectorsOut) {
+  *sparseOut = NULL;
+  AcsiSparseHeader header;
+  UINT br = 0;
+  FRESULT fr = f_lseek(file, 0);
+  if (fr == FR_OK) fr = f_read(file, &header, sizeof(header), &br);
+  if (fr != FR_OK) return fr;
+  if (br != sizeof(header) ||
+      memcmp(header.magic, ACSI_SPARSE_MAGIC, ACSI_SPARSE_MAGIC_SIZE) != 0) {
+    return FR_OK;  // Plain image
+  }
+
+  uint32_t blockSectors = header.blockSectors;
+  uint32_t mapSectors =
+      (header.blockCount + SPARSE_MAP_ENTRIES - 1) / SPARSE_MAP_ENTRIES;
+  if (header.version != ACSI_SPARSE_VERSION ||
+      header.sectorSize != SPARSE_SECTOR_SIZE || blockSectors == 0 ||
+      (blockSectors & (blockSectors - 1)) != 0 ||
+      (uint64_t)header.blockCount * blockSectors < header.totalSectors ||
+      header.mapSector != ACSI_SPARSE_MAP_SECTOR ||
+      header.dataSector < header.mapSector + mapSectors ||
+      (header.dataSector & (blockSectors - 1)) != 0) {
+    DPRINTF("ACSI sparse: bad header\n");
+    return FR_INVALID_OBJECT;
+  }
+  if (header.blockCount > ACSI_SPARSE_MAX_BLOCKS) {
+    DPRINTF("ACSI sparse: %lu blocks, the bitmap does not fit\n",
+            (unsigned long)header.blockCount);
+    return FR_NOT_ENOUGH_CORE;
+  }
+
+  size_t bitmapWords = (header.blockCount + 31u) / 32u;
+  AcsiSparse *sparse =
+      malloc(sizeof(AcsiSparse) + bitmapWords * sizeof(uint32_t));
+  if (sparse == NULL) return FR_NOT_ENOUGH_CORE;
+  memset(sparse, 0, sizeof(AcsiSparse) + bitmapWords * sizeof(uint32_t));
+  sparse->header = header;
+  while ((1u << sparse->blockShift) < blockSectors) sparse->blockShift++;
+  sparse->mapCacheSector = SPARSE_NO_MAP_SECTOR;
+
+  // A block cut short by a power loss is skipped, not reused
+  FSIZE_t dataStart = (FSIZE_t)header.dataSector * SPARSE_SECTOR_SIZE;
+  FSIZE_t blockBytes = (FSIZE_t)blockSectors * SPARSE_SECTOR_SIZE;
+  uint32_t dataBlocks = 0;
+  if (f_size(file) > dataStart) {
+    dataBlocks =
+        (uint32_t)((f_size(file) - dataStart + blockBytes - 1) / blockBytes);
+  }
+  sparse->nextBlock = dataBlocks + 1u;
+
+  for (uint32_t block = 0; block < header.blockCount; block++) {
+    if (block % SPARSE_MAP_ENTRIES == 0) {
+      fr = sparseLoadMapSector(sparse, file, block / SPARSE_MAP_ENTRIES);
+      if (fr != FR_OK) break;
+    }
+    uint32_t dataBlock = sparse->mapCache[block % SPARSE_MAP_ENTRIES];
+    if (dataBlock == 0) continue;
+    if (dataBlock > dataBlocks) {
+      DPRINTF("ACSI sparse: block %lu out of the file\n",
+              (unsigned long)block);
+      fr = FR_INVALID_OBJECT;
+      break;
+    }
+    sparse->bitmap[block >> 5] |= 1u << (block & 31u);
+    sparse->allocated++;
+  }
+  if (fr != FR_OK) {
+    free(sparse);
+    return fr;
+  }
+
+  DPRINTF("ACSI sparse image: %lu sectors, %lu of %lu blocks in use\n",
+          (unsigned long)header.totalSectors, (unsigned long)sparse->allocated,
+          (unsigned long)header.blockCount);
+  *sparseOut = sparse;
+  *totalSectorsOut = header.totalSectors;
+  return FR_OK;
+}
+
+void acsi_sparse_close(AcsiSparse *sparse) { free(sparse); }
+
+FRESULT __not_in_flash_func(acsi_sparse_read)(AcsiSparse *sparse, FIL *file,
+                                              uint32_t lba,
+                                              uint16_t sectorCount,
+                                              void *buffer) {
+  uint8_t *out = (uint8_t *)buffer;
+  uint32_t mask = sparse->header.blockSectors - 1u;
+  while (sectorCount > 0) {
+    uint32_t block = lba >> sparse->blockShift;
+    uint32_t first = lba & mask;
+    uint32_t count = sparse->header.blockSectors - first;
+    if (count > sectorCount) count = sectorCount;
+    UINT bytes = count * SPARSE_SECTOR_SIZE;
+
+    if (!sparseIsAllocated(sparse, block)) {
+      memset(out, 0, bytes);
+    } else {
+      uint32_t dataBlock = 0;
+      FRESULT fr = sparseGetDataBlock(sparse, file, block, &dataBlock);
+      if (fr == FR_OK) {
+        fr = f_lseek(file, sparseBlockOffset(sparse, dataBlock) +
+                               (FSIZE_t)first * SPARSE_SECTOR_SIZE);
+      }
+      UINT br = 0;
+      if (fr == FR_OK) fr = f_read(file, out, bytes, &br);
+      if (fr != FR_OK) return fr;
+      if (br != bytes) return FR_INT_ERR;
+    }
+    lba += count;
+    sectorCount -= count;
+    out += bytes;
+  }
+  return FR_OK;
+}
+
+FRESULT __not_in_flash_func(acsi_sparse_write)(AcsiSparse *sparse,
+                                               FIL *file, uint32_t lba,
+                                               uint16_t sectorCount,
+                                               const void *buffer) {
+  const uint8_t *in = (const uint8_t *)buffer;
+  uint32_t mask = sparse->header.blockSectors - 1u;
+  while (sectorCount > 0) {
+    uint32_t block = lba >> sparse->blockShift;
+    uint32_t first = lba & mask;
+    uint32_t count = sparse->header.blockSectors - first;
+    if (count > sectorCount) count = sectorCount;
+    UINT bytes = count * SPARSE_SECTOR_SIZE;
+
+    FRESULT fr = FR_OK;
+    if (sparseIsAllocated(sparse, block)) {
+      uint32_t dataBlock = 0;
+      fr = sparseGetDataBlock(sparse, file, block, &dataBlock);
+      if (fr == FR_OK) {
+        fr = f_lseek(file, sparseBlockOffset(sparse, dataBlock) +
+                               (FSIZE_t)first * SPARSE_SECTOR_SIZE);
+      }
+      if (fr == FR_OK) fr = sparseWriteAll(file, in, bytes);
+    } else if (!sparseIsZero(in, bytes)) {
+      fr = sparseAllocate(sparse, file, block, first, count, in);
+    }
+    // Zeros written to a hole are already there
+    if (fr != FR_OK) return fr;
+    lba += count;
+    sectorCount -= count;
+    in += bytes;
+  }
+  return FR_OK;
+}
+
+bool acsi_sparse_linkmap_stale(const AcsiSparse *sparse) {
+  return sparse != NULL && sparse->linkmapStale;
+}
+
+void acsi_sparse_linkmap_rebuilt(AcsiSparse *sparse) {
+  sparse->linkmapStale = false;
+}
+
+uint32_t acsi_sparse_allocated_blocks(const AcsiSparse *sparse) {
+  return sparse->allocated;
+}
+
+uint32_t acsi_sparse_block_count(const AcsiSparse *sparse) {
+  return sparse->header.blockCount;
+}
@@ -0,0 +1,614 @@
+/**
+ * File: bootcache.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Boot snapshot of the ACSI sectors and GEMDRIVE file chunks
+ * read while the Atari boots, kept in flash for the next boot.
+ */
+
+#include "bootcache.h"
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "acsi.h"
+#include "constants.h"
+#include "debug.h"
+#include "hardware/flash.h"
+#include "pico/flash.h"
+#include "pico/stdlib.h"
+
+_Static_assert(sizeof(BootcacheIndex) <= BOOTCACHE_REVOKE_OFFSET,
+               "The boot cache index overlaps the revoke page");
+
+typedef enum {
+  BOOTCACHE_OFF,
+  BOOTCACHE_RECORDING,
+  BOOTCACHE_RECORDED,  // Waiting for the Atari to go idle
+  BOOTCACHE_SAVING,
+  BOOTCACHE_DONE,
+} BootcacheState;
+
+typedef struct {
+  BootcacheSourceInfo info;
+  int16_t flashIndex;  // Source in the snapshot, -1 if none
+  bool written;
+  bool recordable;  // Path short enough to open it again
+} BootcacheSource;
+
+// Freed once the snapshot is written or found up to date
+typedef struct {
+  char paths[BOOTCACHE_MAX_SOURCES][BOOTCACHE_PATH_SIZE];
+  BootcacheChunk chunks[BOOTCACHE_MAX_CHUNKS];
+  uint16_t chunkCount;
+  uint32_t bytes;
+  int16_t lastChunk[BOOTCACHE_MAX_SOURCES];  // To extend sequential reads
+} BootcacheRecorder;
+
+typedef struct {
+  uint8_t index[BOOTCACHE_SECTOR_SIZE];
+  uint8_t data[BOOTCACHE_SECTOR_SIZE];
+  int16_t sourceOf[BOOTCACHE_MAX_SOURCES];  // RAM source of each new one
+  uint16_t step;
+  uint16_t steps;
+  int16_t openSource;
+  FIL file;
+  AcsiImageContext image;
+} BootcacheSaver;
+
+static BootcacheState state = BOOTCACHE_OFF;
+static const BootcacheIndex *snapshot = NULL;
+static BootcacheSource sources[BOOTCACHE_MAX_SOURCES] = {0};
+static uint8_t sourceCount = 0;
+static BootcacheRecorder *recorder = NULL;
+static BootcacheSaver *saver = NULL;
+static bool needsSave = false;
+static uint32_t recordStartMs = 0;
+static uint32_t lastActivityMs = 0;
+// The saver reads the sources through the same calls as the Atari
+static bool saverReading = false;
+static bool saveAborted = false;
+
+static inline const uint8_t *flashBase(void) {
+  return (const uint8_t *)&_boot_cache_flash_start;
+}
+
+static inline uint32_t flashOffset(void) {
+  return (uint32_t)&_boot_cache_flash_start - XIP_BASE;
+}
+
+static inline uint32_t nowMs(void) {
+  return to_ms_since_boot(get_absolute_time());
+}
+
+// FNV-1a, not case sensitive as FAT
+static uint32_t hashPath(const char *path) {
+  uint32_t h = 2166136261u;
+  while (*path != '\0') {
+    h ^= (uint8_t)tolower((unsigned char)*path++);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static uint32_t checksumIndex(const BootcacheIndex *index) {
+  const uint8_t *p = (const uint8_t *)&index->sourceCount;
+  const uint8_t *end = (const uint8_t *)index + sizeof(BootcacheIndex);
+  uint32_t h = 2166136261u;
+  while (p < end) {
+    h ^= *p++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Erase and program run from flash_safe_execute: core 1 runs the SELECT
+// loop during the emulation and must be parked in RAM while XIP is off.
+typedef struct {
+  uint32_t offset;
+  const uint8_t *data;  // NULL: nothing to program
+  size_t size;
+  bool erase;
+} FlashWrite;
+
+static void flashWrite(void *param) {
+  const FlashWrite *write = (const FlashWrite *)param;
+  if (write->erase) flash_range_erase(write->offset, write->size);
+  if (write->data != NULL) {
+    flash_range_program(write->offset, write->data, write->size);
+  }
+}
+
+static bool flashWriteSafe(const FlashWrite *write) {
+  int err = flash_safe_execute(flashWrite, (void *)write,
+                               BOOTCACHE_FLASH_TIMEOUT_MS);
+  if (err != PICO_OK) {
+    DPRINTF("Boot cache: flash write at 0x%X failed: %d\n",
+            (unsigned int)write->offset, err);
+  }
+  return err == PICO_OK;
+}
+
+static bool isRevoked(uint16_t flashIndex) {
+  return flashBase()[BOOTCACHE_REVOKE_OFFSET + flashIndex] != 0xFF;
+}
+
+// Clear the byte of a snapshot source. Bits only go from 1 to 0, so the
+// page is programmed without erasing the sector.
+static void revokeFlashSource(uint16_t flashIndex) {
+  if (isRevoked(flashIndex)) return;
+  uint8_t page[FLASH_PAGE_SIZE];
+  memset(page, 0xFF, sizeof(page));
+  page[flashIndex] = 0;
+  FlashWrite write = {flashOffset() + BOOTCACHE_REVOKE_OFFSET, page,
+                      sizeof(page), false};
+  if (!flashWriteSafe(&write)) return;
+  DPRINTF("Boot cache source %u revoked\n", flashIndex);
+}
+
+static void finish(void);
+
+void bootcache_init(bool enabled) {
+  state = BOOTCACHE_OFF;
+  snapshot = NULL;
+  sourceCount = 0;
+  needsSave = false;
+  recordStartMs = 0;
+  memset(sources, 0, sizeof(sources));
+  finish();  // Of a previous session
+  state = BOOTCACHE_OFF;
+  if (!enabled) {
+    DPRINTF("Boot cache disabled\n");
+    return;
+  }
+
+  const BootcacheIndex *index = (const BootcacheIndex *)flashBase();
+  if ((index->magic == BOOTCACHE_MAGIC) &&
+      (index->version == BOOTCACHE_VERSION) &&
+      (index->sourceCount <= BOOTCACHE_MAX_SOURCES) &&
+      (index->chunkCount <= BOOTCACHE_MAX_CHUNKS) &&
+      (index->dataBytes <= BOOTCACHE_DATA_SIZE) &&
+      (index->checksum == checksumIndex(index))) {
+    snapshot = index;
+    DPRINTF("Boot cache: %u sources, %u chunks, %u bytes\n",
+            index->sourceCount, index->chunkCount, index->dataBytes);
+  } else {
+    DPRINTF("Boot cache empty\n");
+  }
+
+  recorder = calloc(1, sizeof(BootcacheRecorder));
+  if (recorder == NULL) {
+    DPRINTF("Boot cache: no memory to record, serving only\n");
+    state = BOOTCACHE_DONE;
+    return;
+  }
+  state = BOOTCACHE_RECORDING;
+}
+
+int16_t bootcache_open_source(const char *path, FSIZE_t size, WORD fdate,
+                              WORD ftime, uint8_t unitShift) {
+  if ((state == BOOTCACHE_OFF) || (path == NULL)) return BOOTCACHE_NO_SOURCE;
+
+  BootcacheSourceInfo info = {0};
+  info.hash = hashPath(path);
+  info.mtime = ((uint32_t)fdate << 16) | ftime;
+  info.size = (uint64_t)size;
+  info.unitShift = unitShift;
+
+  for (uint8_t i = 0; i < sourceCount; i++) {
+    BootcacheSource *source = &sources[i];
+    if (source->info.hash != info.hash) continue;
+    if ((source->info.mtime != info.mtime) ||
+        (source->info.size != info.size)) {
+      // Changed since it was first opened
+      bootcache_note_write(i);
+    }
+    return i;
+  }
+  if (sourceCount == BOOTCACHE_MAX_SOURCES) return BOOTCACHE_NO_SOURCE;
+
+  BootcacheSource *source = &sources[sourceCount];
+  source->info = info;
+  source->flashIndex = -1;
+  for (uint16_t i = 0; (snapshot != NULL) && (i < snapshot->sourceCount);
+       i++) {
+    const BootcacheSourceInfo *cached = &snapshot->sources[i];
+    if ((cached->hash == info.hash) && (cached->mtime == info.mtime) &&
+        (cached->size == info.size) && (cached->unitShift == unitShift) &&
+        !isRevoked(i)) {
+      source->flashIndex = (int16_t)i;
+      break;
+    }
+  }
+  if ((recorder != NULL) && (strlen(path) < BOOTCACHE_PATH_SIZE)) {
+    strcpy(recorder->paths[sourceCount], path);
+    recorder->lastChunk[sourceCount] = -1;
+    source->recordable = true;
+  }
+  DPRINTF("Boot cache source %u: %s (%s)\n", sourceCount, path,
+          (source->flashIndex >= 0) ? "cached" : "not cached");
+  return (int16_t)sourceCount++;
+}
+
+// Chunk of the snapshot holding all the bytes, or NULL
+static const BootcacheChunk *__not_in_flash_func(findChunk)(
+    uint16_t flashIndex, uint32_t start, uint32_t bytes, uint8_t unitShift) {
+  int lo = 0;
+  int hi = (int)snapshot->chunkCount - 1;
+  const BootcacheChunk *found = NULL;
+  // Last chunk of the source starting at or before start
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    const BootcacheChunk *chunk = &snapshot->chunks[mid];
+    if ((chunk->source < flashIndex) ||
+        ((chunk->source == flashIndex) && (chunk->start <= start))) {
+      if (chunk->source == flashIndex) found = chunk;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  if (found == NULL) return NULL;
+  uint64_t skip = (uint64_t)(start - found->start) << unitShift;
+  return (skip + bytes <= found->length) ? found : NULL;
+}
+
+static void recordRange(int16_t index, uint32_t start, uint32_t bytes,
+                        bool served) {
+  BootcacheSource *source = &sources[index];
+  if ((state != BOOTCACHE_RECORDING) || !source->recordable ||
+      source->written || (bytes == 0)) {
+    return;
+  }
+  if (recordStartMs == 0) recordStartMs = nowMs() | 1u;
+
+  uint8_t shift = source->info.unitShift;
+  for (uint16_t i = 0; i < recorder->chunkCount; i++) {
+    const BootcacheChunk *chunk = &recorder->chunks[i];
+    if ((chunk->source == index) && (chunk->start <= start) &&
+        (((uint64_t)(start - chunk->start) << shift) + bytes <=
+         chunk->length)) {
+      return;  // Read again
+    }
+  }
+
+  // Sectors of an image are padded to their size in the data area
+  uint32_t padded = bytes + (1u << shift) - 1u;
+  if (recorder->bytes + padded > BOOTCACHE_DATA_SIZE) {
+    DPRINTF("Boot cache full after %u bytes\n", recorder->bytes);
+    state = BOOTCACHE_RECORDED;
+    return;
+  }
+
+  int16_t last = recorder->lastChunk[index];
+  BootcacheChunk *chunk = (last >= 0) ? &recorder->chunks[last] : NULL;
+  if ((chunk != NULL) &&
+      (((uint64_t)chunk->start << shift) + chunk->length ==
+       ((uint64_t)start << shift))) {
+    chunk->length += bytes;
+  } else if (recorder->chunkCount < BOOTCACHE_MAX_CHUNKS) {
+    recorder->lastChunk[index] = (int16_t)recorder->chunkCount;
+    chunk = &recorder->chunks[recorder->chunkCount++];
+    chunk->source = (uint8_t)index;
+    chunk->start = start;
+    chunk->length = bytes;
+  } else {
+    state = BOOTCACHE_RECORDED;
+    return;
+  }
+  recorder->bytes += bytes;
+  if (!served) needsSave = true;
+}
+
+bool __not_in_flash_func(bootcache_read)(int16_t index, uint32_t start,
+                                         uint32_t bytes, void *buffer) {
+  if ((index < 0) || (state == BOOTCACHE_OFF)) return false;
+  if (!saverReading) lastActivityMs = nowMs();
+  const BootcacheSource *source = &sources[index];
+  if ((snapshot == NULL) || (source->flashIndex < 0) || source->written) {
+    return false;
+  }
+  uint8_t shift = source->info.unitShift;
+  const BootcacheChunk *chunk =
+      findChunk((uint16_t)source->flashIndex, start, bytes, shift);
+  if (chunk == NULL) return false;
+  memcpy(buffer,
+         flashBase() + BOOTCACHE_SECTOR_SIZE + chunk->dataOffset +
+             ((start - chunk->start) << shift),
+         bytes);
+  recordRange(index, start, bytes, true);
+  return true;
+}
+
+void bootcache_record(int16_t index, uint32_t start, uint32_t bytes) {
+  if ((index < 0) || (state == BOOTCACHE_OFF)) return;
+  if (!saverReading) lastActivityMs = nowMs();
+  recordRange(index, start, bytes, false);
+}
+
+FRESULT __not_in_flash_func(bootcache_f_read)(int16_t index, FIL *fp,
+                                              void *buff, UINT btr,
+                                              UINT *br) {
+  FSIZE_t offset = f_tell(fp);
+  if ((index >= 0) && (offset <= 0xFFFFFFFFu)) {
+    FSIZE_t left = f_size(fp) - offset;
+    UINT wanted = (left < btr) ? (UINT)left : btr;
+    if ((wanted > 0) &&
+        bootcache_read(index, (uint32_t)offset, wanted, buff)) {
+      *br = wanted;
+      // Only the position moves. The data is not read from the card.
+      return f_lseek(fp, offset + wanted);
+    }
+  }
+  FRESULT fr = f_read(fp, buff, btr, br);
+  if ((fr == FR_OK) && (offset <= 0xFFFFFFFFu)) {
+    bootcache_record(index, (uint32_t)offset, *br);
+  }
+  return fr;
+}
+
+void bootcache_note_write(int16_t index) {
+  if ((index < 0) || (state == BOOTCACHE_OFF)) return;
+  BootcacheSource *source = &sources[index];
+  if (source->written) return;
+  source->written = true;
+  if (source->flashIndex >= 0) {
+    revokeFlashSource((uint16_t)source->flashIndex);
+  }
+  if (state != BOOTCACHE_SAVING) return;
+  // The data already in the new snapshot may be stale
+  const BootcacheIndex *pending = (const BootcacheIndex *)saver->index;
+  for (uint16_t i = 0; i < pending->sourceCount; i++) {
+    if (saver->sourceOf[i] == index) {
+      DPRINTF("Boot cache: source %d written while saving\n", index);
+      saveAborted = true;
+    }
+  }
+}
+
+void bootcache_note_write_path(const char *path) {
+  if ((state == BOOTCACHE_OFF) || (path == NULL)) return;
+  uint32_t hash = hashPath(path);
+  for (uint8_t i = 0; i < sourceCount; i++) {
+    if (sources[i].info.hash == hash) {
+      bootcache_note_write(i);
+      return;
+    }
+  }
+  // Not opened in this session, but maybe in the snapshot
+  for (uint16_t i = 0; (snapshot != NULL) && (i < snapshot->sourceCount);
+       i++) {
+    if (snapshot->sources[i].hash == hash) revokeFlashSource(i);
+  }
+}
+
+// Lay out the new index: the sources still unchanged, their chunks sorted
+// by source and start, packed in the data area
+static bool buildIndex(void) {
+  BootcacheIndex *index = (BootcacheIndex *)saver->index;
+  memset(saver->index, 0xFF, sizeof(saver->index));
+  memset(index, 0, sizeof(BootcacheIndex));
+  int16_t newIndexOf[BOOTCACHE_MAX_SOURCES];
+  for (uint8_t i = 0; i < sourceCount; i++) {
+    newIndexOf[i] = -1;
+    const BootcacheSource *source = &sources[i];
+    if (source->written || !source->recordable) continue;
+    // Still the same file as when it was read
+    FILINFO fno;
+    if ((f_stat(recorder->paths[i], &fno) != FR_OK) ||
+        ((uint64_t)fno.fsize != source->info.size) ||
+        ((((uint32_t)fno.fdate << 16) | fno.ftime) != source->info.mtime)) {
+      continue;
+    }
+    newIndexOf[i] = (int16_t)index->sourceCount;
+    saver->sourceOf[index->sourceCount] = (int16_t)i;
+    index->sources[index->sourceCount++] = source->info;
+  }
+
+  for (uint16_t i = 0; i < recorder->chunkCount; i++) {
+    BootcacheChunk chunk = recorder->chunks[i];
+    if (newIndexOf[chunk.source] < 0) continue;
+    chunk.source = (uint8_t)newIndexOf[chunk.source];
+    // Insertion sort, the recording is short
+    uint16_t at = index->chunkCount++;
+    while ((at > 0) &&
+           ((index->chunks[at - 1].source > chunk.source) ||
+            ((index->chunks[at - 1].source == chunk.source) &&
+             (index->chunks[at - 1].start > chunk.start)))) {
+      index->chunks[at] = index->chunks[at - 1];
+      at--;
+    }
+    index->chunks[at] = chunk;
+  }
+  if (index->chunkCount == 0) return false;
+
+  uint32_t offset = 0;
+  for (uint16_t i = 0; i < index->chunkCount; i++) {
+    BootcacheChunk *chunk = &index->chunks[i];
+    uint32_t unit = 1u << index->sources[chunk->source].unitShift;
+    uint32_t aligned = (offset + unit - 1u) & ~(unit - 1u);
+    if (aligned + chunk->length > BOOTCACHE_DATA_SIZE) {
+      // The padding of the images did not fit
+      memset(&index->chunks[i], 0,
+             (index->chunkCount - i) * sizeof(BootcacheChunk));
+      index->chunkCount = i;
+      break;
+    }
+    chunk->dataOffset = aligned;
+    offset = aligned + chunk->length;
+  }
+  index->dataBytes = offset;
+  index->magic = BOOTCACHE_MAGIC;
+  index->version = BOOTCACHE_VERSION;
+  index->checksum = checksumIndex(index);
+  return index->chunkCount > 0;
+}
+
+static void closeSaveSource(void) {
+  if (saver->openSource < 0) return;
+  if (sources[saver->sourceOf[saver->openSource]].info.unitShift ==
+      BOOTCACHE_UNIT_SECTOR) {
+    acsi_image_close(&saver->image);
+  } else {
+    (void)f_close(&saver->file);
+  }
+  saver->openSource = -1;
+}
+
+// Read length bytes at offset of a chunk from the card
+static FRESULT readChunk(const BootcacheChunk *chunk, uint32_t offset,
+                         uint8_t *buffer, uint32_t length) {
+  const BootcacheSourceInfo *info =
+      &((const BootcacheIndex *)saver->index)->sources[chunk->source];
+  const char *path = recorder->paths[saver->sourceOf[chunk->source]];
+  FRESULT fr = FR_OK;
+  if (saver->openSource != chunk->source) {
+    closeSaveSource();
+    fr = (info->unitShift == BOOTCACHE_UNIT_SECTOR)
+             ? acsi_image_open(&saver->image, path, true)
+             : f_open(&saver->file, path, FA_READ);
+    if (fr != FR_OK) return fr;
+    saver->openSource = chunk->source;
+  }
+
+  if (info->unitShift == BOOTCACHE_UNIT_SECTOR) {
+    return acsi_image_read_sectors(
+        &saver->image, chunk->start + (offset >> BOOTCACHE_UNIT_SECTOR),
+        (uint16_t)(length >> BOOTCACHE_UNIT_SECTOR), buffer, length);
+  }
+  UINT br = 0;
+  fr = f_lseek(&saver->file, (FSIZE_t)chunk->start + offset);
+  if (fr == FR_OK) fr = f_read(&saver->file, buffer, length, &br);
+  return ((fr == FR_OK) && (br != length)) ? FR_INT_ERR : fr;
+}
+
+// Fill the data of flash sector step (1 is the first after the index)
+static FRESULT fillDataSector(uint16_t step) {
+  const BootcacheIndex *index = (const BootcacheIndex *)saver->index;
+  uint32_t sectorStart = (uint32_t)(step - 1u) * BOOTCACHE_SECTOR_SIZE;
+  uint32_t sectorEnd = sectorStart + BOOTCACHE_SECTOR_SIZE;
+  memset(saver->data, 0xFF, sizeof(saver->data));
+  for (uint16_t i = 0; i < index->chunkCount; i++) {
+    const BootcacheChunk *chunk = &index->chunks[i];
+    uint32_t from = chunk->dataOffset;
+    uint32_t to = chunk->dataOffset + chunk->length;
+    if ((to <= sectorStart) || (from >= sectorEnd)) continue;
+    if (from < sectorStart) from = sectorStart;
+    if (to > sectorEnd) to = sectorEnd;
+    FRESULT fr =
+        readChunk(chunk, from - chunk->dataOffset,
+                  saver->data + (from - sectorStart), to - from);
+    if (fr != FR_OK) return fr;
+  }
+  return FR_OK;
+}
+
+static bool programSector(uint16_t sector, const uint8_t *data) {
+  FlashWrite write = {
+      flashOffset() + (uint32_t)sector * BOOTCACHE_SECTOR_SIZE, data,
+      BOOTCACHE_SECTOR_SIZE, true};
+  return flashWriteSafe(&write);
+}
+
+static void finish(void) {
+  if (saver != NULL) {
+    closeSaveSource();
+    free(saver);
+    saver = NULL;
+  }
+  free(recorder);
+  recorder = NULL;
+  state = BOOTCACHE_DONE;
+}
+
+static void startSave(void) {
+  saver = malloc(sizeof(BootcacheSaver));
+  if (saver == NULL) {
+    DPRINTF("Boot cache: no memory to save\n");
+    finish();
+    return;
+  }
+  saver->openSource = -1;
+  saveAborted = false;
+  if (!buildIndex()) {
+    DPRINTF("Boot cache: nothing to save\n");
+    finish();
+    return;
+  }
+  const BootcacheIndex *index = (const BootcacheIndex *)saver->index;
+  // Index erased first, data sectors, then the index again. A power cut in
+  // between leaves no snapshot, never a wrong one.
+  saver->step = 0;
+  saver->steps = (uint16_t)(2u + (index->dataBytes + BOOTCACHE_SECTOR_SIZE -
+                                  1u) / BOOTCACHE_SECTOR_SIZE);
+  // The old snapshot goes away with its index sector
+  snapshot = NULL;
+  for (uint8_t i = 0; i < sourceCount; i++) sources[i].flashIndex = -1;
+  state = BOOTCACHE_SAVING;
+  DPRINTF("Boot cache: saving %u chunks, %u bytes\n", index->chunkCount,
+          index->dataBytes);
+}
+
+static void saveStep(void) {
+  if (saveAborted) {
+    finish();
+    return;
+  }
+  uint16_t step = saver->step++;
+  if (step == 0) {
+    if (!programSector(0, NULL)) finish();
+  } else if (step + 1u < saver->steps) {
+    saverReading = true;
+    FRESULT fr = fillDataSector(step);
+    saverReading = false;
+    if (fr != FR_OK) {
+      DPRINTF("Boot cache: read error %d, snapshot dropped\n", fr);
+      finish();
+      return;
+    }
+    if (!programSector(step, saver->data)) finish();
+  } else {
+    if (!programSector(0, saver->index)) {
+      finish();
+      return;
+    }
+    // Served from now on too, and revoked if written
+    snapshot = (const BootcacheIndex *)flashBase();
+    for (uint16_t i = 0; i < snapshot->sourceCount; i++) {
+      sources[saver->sourceOf[i]].flashIndex = (int16_t)i;
+    }
+    DPRINTF("Boot cache saved\n");
+    finish();
+  }
+}
+
+void bootcache_tick(void) {
+  switch (state) {
+    case BOOTCACHE_RECORDING:
+      if ((recordStartMs != 0) &&
+          (nowMs() - recordStartMs >= BOOTCACHE_RECORD_MS)) {
+        DPRINTF("Boot cache recording done: %u chunks, %u bytes\n",
+                recorder->chunkCount, recorder->bytes);
+        state = BOOTCACHE_RECORDED;
+      }
+      break;
+    case BOOTCACHE_RECORDED:
+      if (nowMs() - lastActivityMs < BOOTCACHE_IDLE_MS) break;
+      if (needsSave) {
+        startSave();
+      } else {
+        DPRINTF("Boot cache up to date\n");
+        finish();
+      }
+      break;
+    case BOOTCACHE_SAVING:
+      // Interrupts are off while a sector is written: only when idle
+      if (nowMs() - lastActivityMs >= BOOTCACHE_IDLE_MS) saveStep();
+      break;
+    default:
+      break;
+  }
+}
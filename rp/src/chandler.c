@@ -9,6 +9,7 @@
 #include "chandler.h"
 
 #include "blink.h"
+#include "cmdtrace.h"
 #include "commemul.h"
 
 static TransmissionProtocol pendingProtocol;
@@ -16,12 +17,24 @@ static bool protocolPending = false;
 
 static uint32_t incrementalCmdCount = 0;
 
+// When the main loop last polled the ROM3 bus or finished a command, and
+// how long it was away before the current poll. A command completed in
+// this poll waited at most that long (see cmdtrace_begin).
+static uint32_t lastPollUs = 0;
+static uint32_t pollGapUs = 0;
+static uint32_t pendingWaitUs = 0;
+
+// One bit per app ID. Commands of a suspended app are dropped unanswered.
+static uint32_t suspendedApps = 0;
+
 static uint32_t memorySharedAddress = 0;
 static uint32_t memoryRandomTokenAddress = 0;
 static uint32_t memoryRandomTokenSeedAddress = 0;
 
-// Head of the callback list
+// Head of the callback list, and the nodes it is made of
 static CommandCallbackNode *callbackListHead = NULL;
+static CommandCallbackNode callbackNodes[CHANDLER_MAX_CALLBACKS];
+static uint8_t callbackCount = 0;
 
 static inline void __not_in_flash_func(chandler_clear_pending_protocol)(void) {
   pendingProtocol.command_id = 0;
@@ -54,19 +67,24 @@ void __not_in_flash_func(chandler_init)() {
   memoryRandomTokenSeedAddress =
       memorySharedAddress + CHANDLER_RANDOM_TOKEN_SEED_OFFSET;
   chandler_clear_pending_protocol();
+  cmdtrace_init();
 }
 
 /**
  * @brief Register a callback
  *
- * Adds the callback to the linked list of callbacks.
+ * Adds the callback to the linked list of callbacks, with one of the
+ * CHANDLER_MAX_CALLBACKS static nodes.
  *
  * @param cb The callback function to register.
  */
 void __not_in_flash_func(chandler_addCB)(CommandCallback cb) {
   if (!cb) return;
-  CommandCallbackNode *node = malloc(sizeof(*node));
-  if (!node) return;
+  if (callbackCount == CHANDLER_MAX_CALLBACKS) {
+    DPRINTF("No room for more command callbacks\n");
+    return;
+  }
+  CommandCallbackNode *node = &callbackNodes[callbackCount++];
   node->cb = cb;
   node->next = NULL;
   if (!callbackListHead) {
@@ -104,6 +122,7 @@ static inline void __not_in_flash_func(handle_protocol_command)(
 
   tprotocol_copy_safely(&pendingProtocol, protocol);
   protocolPending = true;
+  pendingWaitUs = pollGapUs;
 }
 
 static inline void __not_in_flash_func(handle_protocol_checksum_error)(
@@ -126,6 +145,9 @@ static inline void __not_in_flash_func(chandler_consume_rom3_sample)(
 // Invoke this function to process the commands from the active loop in the
 // main function
 void __not_in_flash_func(chandler_loop)() {
+  uint32_t now = time_us_32();
+  pollGapUs = now - lastPollUs;
+  lastPollUs = now;
   commemul_poll(chandler_consume_rom3_sample);
 
   if (!protocolPending) {
@@ -147,6 +169,13 @@ void __not_in_flash_func(chandler_loop)() {
     return;
   }
 
+  if ((suspendedApps & CHANDLER_APP_BIT(commandId >> 8)) != 0u) {
+    // The token is not updated, so the Atari driver times out as if the
+    // cartridge did not answer.
+    chandler_clear_pending_protocol();
+    return;
+  }
+
   // DPRINTF("Command ID: %4x. Size: %d. Random token: 0x%08X,
   // Checksum:0x%04X\n",
   //         pendingProtocol.command_id, pendingProtocol.payload_size,
@@ -188,9 +217,14 @@ void __not_in_flash_func(chandler_loop)() {
   //     }
   // #endif
 
+  cmdtrace_begin(commandId, pendingProtocol.payload_size, payloadPtr,
+                 pendingWaitUs);
   for (CommandCallbackNode *cur = callbackListHead; cur; cur = cur->next) {
     if (cur->cb) cur->cb(&pendingProtocol, payloadPtr);
   }
+  cmdtrace_end();
+  // The handlers' own time is in the duration, not in the next wait
+  lastPollUs = time_us_32();
 #if defined(CYW43_WL_GPIO_LED_PIN)
   if (blink_isSequenceActive()) {
     incrementalCmdCount++;
@@ -211,3 +245,8 @@ void __not_in_flash_func(chandler_loop)() {
 
   chandler_clear_pending_protocol();
 }
+
+void chandler_setSuspendedApps(uint32_t appMask) {
+  DPRINTF("Suspended apps mask: %08lX\n", (unsigned long)appMask);
+  suspendedApps = appMask;
+}
@@ -0,0 +1,139 @@
+/**
+ * File: cmdtrace.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Fixed-size RAM trace ring of the commands dispatched by the
+ * command handler, with export to the SD card.
+ */
+
+#include "cmdtrace.h"
+
+#include <string.h>
+
+#include "tprotocol.h"
+
+typedef struct {
+  uint32_t magic;
+  uint16_t session;
+  uint16_t version;  // A new entry layout starts a new ring
+  uint32_t head;  // Total entries written since the ring was cleared
+  CmdTraceEntry entries[CMDTRACE_ENTRIES];
+} CmdTraceRing;
+
+// Not cleared by the C runtime: a watchdog reset into setup keeps the trace
+// of the session that hung.
+static CmdTraceRing __uninitialized_ram(traceRing);
+
+// Entry being filled by the current dispatch. NULL when no command is open.
+static CmdTraceEntry *currentEntry = NULL;
+
+void cmdtrace_init(void) {
+  if ((traceRing.magic != CMDTRACE_MAGIC) ||
+      (traceRing.version != CMDTRACE_VERSION)) {
+    memset(&traceRing, 0, sizeof(traceRing));
+    traceRing.magic = CMDTRACE_MAGIC;
+    traceRing.version = CMDTRACE_VERSION;
+  } else {
+    traceRing.session++;
+  }
+  currentEntry = NULL;
+  DPRINTF("Command trace: session %u, %lu entries kept\n", traceRing.session,
+          (unsigned long)cmdtrace_getCount());
+}
+
+void __not_in_flash_func(cmdtrace_begin)(uint16_t commandId,
+                                         uint16_t payloadSize,
+                                         const uint16_t *payloadPtr,
+                                         uint32_t waitUs) {
+  CmdTraceEntry *entry =
+      &traceRing.entries[traceRing.head & CMDTRACE_ENTRIES_MASK];
+  traceRing.head++;
+
+  entry->commandId = commandId;
+  entry->payloadSize = payloadSize;
+  entry->result = CMDTRACE_RESULT_NONE;
+  entry->session = traceRing.session;
+  entry->durationUs = 0;
+  entry->waitUs = waitUs;
+
+  // Only copy what the ST actually sent, after the 4 bytes of random token
+  uint32_t available = (payloadSize > 4u) ? (payloadSize - 4u) / 4u : 0u;
+  for (uint32_t i = 0; i < CMDTRACE_PARAMS; i++) {
+    entry->params[i] =
+        (i < available) ? TPROTO_GET_PAYLOAD_PARAM32(payloadPtr + (i * 2u)) : 0;
+  }
+
+  currentEntry = entry;
+  entry->timestampUs = time_us_32();
+}
+
+void __not_in_flash_func(cmdtrace_setResult)(int32_t result) {
+  if (currentEntry != NULL) {
+    currentEntry->result = (int16_t)result;
+  }
+}
+
+void __not_in_flash_func(cmdtrace_end)(void) {
+  if (currentEntry == NULL) return;
+  currentEntry->durationUs = time_us_32() - currentEntry->timestampUs;
+  currentEntry = NULL;
+}
+
+uint32_t cmdtrace_getCount(void) {
+  // Cold boot: the RAM holds random data until cmdtrace_init runs
+  if (traceRing.magic != CMDTRACE_MAGIC) return 0;
+  return (traceRing.head < CMDTRACE_ENTRIES) ? traceRing.head
+                                             : CMDTRACE_ENTRIES;
+}
+
+FRESULT cmdtrace_dumpToFile(const char *path, uint32_t *count) {
+  uint32_t total = cmdtrace_getCount();
+  uint32_t first = traceRing.head - total;
+
+  CmdTraceFileHeader header = {
+      .magic = CMDTRACE_MAGIC,
+      .version = CMDTRACE_VERSION,
+      .entrySize = sizeof(CmdTraceEntry),
+      .count = total,
+      .dropped = first,
+  };
+
+  FIL file;
+  FRESULT fr = f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS);
+  if (fr != FR_OK) {
+    DPRINTF("Error opening trace file %s: %d\n", path, fr);
+    return fr;
+  }
+
+  UINT written = 0;
+  fr = f_write(&file, &header, sizeof(header), &written);
+  if ((fr == FR_OK) && (written != sizeof(header))) fr = FR_DISK_ERR;
+
+  // Oldest first. The ring wraps at most once, so two writes are enough.
+  uint32_t start = first & CMDTRACE_ENTRIES_MASK;
+  uint32_t firstChunk = CMDTRACE_ENTRIES - start;
+  if (firstChunk > total) firstChunk = total;
+  if (fr == FR_OK) {
+    UINT bytes = firstChunk * sizeof(CmdTraceEntry);
+    fr = f_write(&file, &traceRing.entries[start], bytes, &written);
+    if ((fr == FR_OK) && (written != bytes)) fr = FR_DISK_ERR;
+  }
+  if ((fr == FR_OK) && (total > firstChunk)) {
+    UINT bytes = (total - firstChunk) * sizeof(CmdTraceEntry);
+    fr = f_write(&file, &traceRing.entries[0], bytes, &written);
+    if ((fr == FR_OK) && (written != bytes)) fr = FR_DISK_ERR;
+  }
+
+  FRESULT closeResult = f_close(&file);
+  if (fr == FR_OK) fr = closeResult;
+  if (fr != FR_OK) {
+    DPRINTF("Error writing trace file %s: %d\n", path, fr);
+    return fr;
+  }
+
+  DPRINTF("Command trace: %lu entries written to %s\n", (unsigned long)total,
+          path);
+  if (count != NULL) *count = total;
+  return FR_OK;
+}
@@ -11,8 +11,10 @@
 #include "../../build/commemul.pio.h"
 #include "constants.h"
 #include "debug.h"
+#include "hardware/clocks.h"
 #include "hardware/dma.h"
 #include "hardware/pio.h"
+#include "perfprofile.h"
 
 #define COMM_RING_BITS 15u
 #define COMM_RING_SIZE_BYTES (1ul << COMM_RING_BITS)
@@ -23,11 +25,24 @@
 static uint16_t commRing[COMM_RING_WORDS]
     __attribute__((aligned(COMM_RING_SIZE_BYTES)));
 static uint32_t commReadIdx = 0;
+static volatile uint32_t commLastSampleUs = 0;
 static int commDmaChannel = -1;
 static int commSm = -1;
 static bool commInitialized = false;
 static PIO commPio = pio0;
 
+// ROM3 capture. Two halves: commemul_poll fills one while the main loop
+// writes the other to the SD card.
+static CommEmulCaptureRecord *captureBuffer = NULL;
+static bool captureActive = false;
+static bool captureHalfFull[2] = {false, false};
+static uint32_t captureHalf = 0;
+static uint32_t captureFill = 0;
+static uint32_t captureLastUs = 0;
+static uint32_t captureDropped = 0;
+static uint32_t captureRecords = 0;
+static FIL captureFile;
+
 void commemul_init(void) {
   if (commInitialized) {
     return;
@@ -49,7 +64,7 @@ void commemul_init(void) {
   commSm = pio_claim_unused_sm(commPio, true);
   commemul_read_program_init(commPio, commSm, offset, READ_ADDR_GPIO_BASE,
                              READ_ADDR_PIN_COUNT, READ_SIGNAL_GPIO_BASE,
-                             SAMPLE_DIV_FREQ);
+                             perfprofile_getPioDivider());
 
   pio_sm_set_enabled(commPio, commSm, false);
   pio_sm_clear_fifos(commPio, commSm);
@@ -78,17 +93,262 @@ void commemul_init(void) {
           (unsigned int)COMM_RING_SIZE_BYTES);
 }
 
-void __not_in_flash_func(commemul_poll)(CommEmulSampleCallback callback) {
-  if ((!commInitialized) || (callback == NULL)) {
+static inline bool __not_in_flash_func(commemul_captureAppend)(
+    uint16_t sample, uint16_t deltaUs) {
+  if (captureHalfFull[captureHalf]) {
+    // Both halves are waiting for the SD card
+    return false;
+  }
+
+  CommEmulCaptureRecord *rec =
+      &captureBuffer[(captureHalf * COMMEMUL_CAPTURE_HALF_RECORDS) +
+                     captureFill];
+  rec->sample = sample;
+  rec->deltaUs = deltaUs;
+  if (++captureFill == COMMEMUL_CAPTURE_HALF_RECORDS) {
+    captureHalfFull[captureHalf] = true;
+    captureHalf ^= 1u;
+    captureFill = 0;
+  }
+  return true;
+}
+
+static inline void __not_in_flash_func(commemul_captureSample)(
+    uint16_t sample) {
+  uint32_t nowUs = time_us_32();
+
+  if (captureDropped != 0) {
+    uint16_t lost =
+        (captureDropped > 0xFFFFu) ? 0xFFFFu : (uint16_t)captureDropped;
+    if (!commemul_captureAppend(lost, COMMEMUL_CAPTURE_DELTA_GAP)) {
+      captureDropped++;
+      return;
+    }
+    captureDropped = 0;
+  }
+
+  uint32_t deltaUs = nowUs - captureLastUs;
+  if (deltaUs > COMMEMUL_CAPTURE_DELTA_MAX) {
+    deltaUs = COMMEMUL_CAPTURE_DELTA_MAX;
+  }
+  if (!commemul_captureAppend(sample, (uint16_t)deltaUs)) {
+    captureDropped++;
     return;
   }
+  captureLastUs = nowUs;
+}
 
+static inline uint32_t __not_in_flash_func(commemul_writeIdx)(void) {
   uint32_t transfersWritten =
       COMM_DMA_TRANSFER_COUNT - dma_hw->ch[commDmaChannel].transfer_count;
-  uint32_t writeIdx = transfersWritten & COMM_RING_MASK;
+  return transfersWritten & COMM_RING_MASK;
+}
+
+void __not_in_flash_func(commemul_poll)(CommEmulSampleCallback callback) {
+  if ((!commInitialized) || (callback == NULL)) {
+    return;
+  }
+
+  uint32_t writeIdx = commemul_writeIdx();
+  if (commReadIdx != writeIdx) {
+    commLastSampleUs = time_us_32();
+  }
+
+  if (captureActive) {
+    // Separate loop so the normal path does not pay for the capture check
+    while (commReadIdx != writeIdx) {
+      uint16_t sample = commRing[commReadIdx];
+      commemul_captureSample(sample);
+      callback(sample);
+      commReadIdx = (commReadIdx + 1u) & COMM_RING_MASK;
+    }
+    return;
+  }
 
   while (commReadIdx != writeIdx) {
     callback(commRing[commReadIdx]);
     commReadIdx = (commReadIdx + 1u) & COMM_RING_MASK;
   }
 }
+
+bool __not_in_flash_func(commemul_hasPendingSamples)(void) {
+  return commInitialized && (commReadIdx != commemul_writeIdx());
+}
+
+uint32_t __not_in_flash_func(commemul_getLastSampleUs)(void) {
+  return commLastSampleUs;
+}
+
+static FRESULT commemul_captureWrite(const CommEmulCaptureRecord *records,
+                                     uint32_t count) {
+  UINT bytes = count * sizeof(CommEmulCaptureRecord);
+  UINT written = 0;
+  FRESULT fr = f_write(&captureFile, records, bytes, &written);
+  if ((fr == FR_OK) && (written != bytes)) fr = FR_DISK_ERR;
+  if (fr == FR_OK) captureRecords += count;
+  return fr;
+}
+
+static FRESULT commemul_captureFlushHalf(uint32_t half) {
+  FRESULT fr = commemul_captureWrite(
+      &captureBuffer[half * COMMEMUL_CAPTURE_HALF_RECORDS],
+      COMMEMUL_CAPTURE_HALF_RECORDS);
+  captureHalfFull[half] = false;
+  return fr;
+}
+
+static void commemul_captureRelease(void) {
+  captureActive = false;
+  free(captureBuffer);
+  captureBuffer = NULL;
+}
+
+// A capture resumed after the USB host keeps the records already in the
+// file, if its header matches this firmware
+static FRESULT commemul_captureSeekEnd(void) {
+  CommEmulCaptureHeader header;
+  UINT read = 0;
+  FRESULT fr = f_read(&captureFile, &header, sizeof(header), &read);
+  if (fr != FR_OK) return fr;
+  if ((read != sizeof(header)) || (header.magic != COMMEMUL_CAPTURE_MAGIC) ||
+      (header.version != COMMEMUL_CAPTURE_VERSION) ||
+      (header.recordSize != sizeof(CommEmulCaptureRecord))) {
+    return FR_NO_FILE;
+  }
+  // Drop a record cut short by a power off
+  FSIZE_t records =
+      (f_size(&captureFile) - sizeof(header)) / sizeof(CommEmulCaptureRecord);
+  fr = f_lseek(&captureFile,
+               sizeof(header) + records * sizeof(CommEmulCaptureRecord));
+  if (fr == FR_OK) fr = f_truncate(&captureFile);
+  return fr;
+}
+
+static FRESULT commemul_captureOpen(const char *path, bool append) {
+  if (captureActive) {
+    return FR_OK;
+  }
+
+  captureBuffer =
+      malloc(2u * COMMEMUL_CAPTURE_HALF_RECORDS * sizeof(*captureBuffer));
+  if (captureBuffer == NULL) {
+    DPRINTF("ROM3 capture: not enough memory\n");
+    return FR_NOT_ENOUGH_CORE;
+  }
+
+  FRESULT fr = f_open(&captureFile, path,
+                      FA_READ | FA_WRITE |
+                          (append ? FA_OPEN_ALWAYS : FA_CREATE_ALWAYS));
+  if (fr != FR_OK) {
+    DPRINTF("ROM3 capture: error opening %s: %d\n", path, fr);
+    free(captureBuffer);
+    captureBuffer = NULL;
+    return fr;
+  }
+
+  bool resumed = false;
+  if (append) {
+    fr = commemul_captureSeekEnd();
+    resumed = (fr == FR_OK);
+    if (fr == FR_NO_FILE) {
+      // Empty or not a capture: start it again
+      fr = f_lseek(&captureFile, 0);
+      if (fr == FR_OK) fr = f_truncate(&captureFile);
+    }
+  }
+
+  if ((fr == FR_OK) && !resumed) {
+    CommEmulCaptureHeader header = {
+        .magic = COMMEMUL_CAPTURE_MAGIC,
+        .version = COMMEMUL_CAPTURE_VERSION,
+        .recordSize = sizeof(CommEmulCaptureRecord),
+        // Above SAMPLE_DIV_FREQ under the fast and turbo profiles
+        .pioDivider256 =
+            (uint32_t)(perfprofile_getPioDivider() * 256.f + 0.5f),
+        .sysClockKhz = clock_get_hz(clk_sys) / 1000u,
+    };
+    UINT written = 0;
+    fr = f_write(&captureFile, &header, sizeof(header), &written);
+    if ((fr == FR_OK) && (written != sizeof(header))) fr = FR_DISK_ERR;
+  }
+  if (fr != FR_OK) {
+    DPRINTF("ROM3 capture: error preparing %s: %d\n", path, fr);
+    f_close(&captureFile);
+    free(captureBuffer);
+    captureBuffer = NULL;
+    return fr;
+  }
+
+  captureHalfFull[0] = false;
+  captureHalfFull[1] = false;
+  captureHalf = 0;
+  captureFill = 0;
+  captureDropped = 0;
+  captureRecords = 0;
+  // The first record saturates its delta, so the replay restarts its parser
+  // there and not in the middle of the command cut by the USB host
+  captureLastUs = time_us_32() - (resumed ? COMMEMUL_CAPTURE_DELTA_MAX : 0);
+  captureActive = true;
+  DPRINTF("ROM3 capture %s: %s\n", resumed ? "resumed" : "started", path);
+  return FR_OK;
+}
+
+FRESULT commemul_captureStart(const char *path) {
+  return commemul_captureOpen(path, false);
+}
+
+FRESULT commemul_captureResume(const char *path) {
+  return commemul_captureOpen(path, true);
+}
+
+void commemul_captureTick(void) {
+  if (!captureActive) {
+    return;
+  }
+
+  // When both halves are full the one being pointed at is the oldest
+  uint32_t oldest =
+      captureHalfFull[captureHalf] ? captureHalf : (captureHalf ^ 1u);
+  bool flushed = false;
+  FRESULT fr = FR_OK;
+  for (uint32_t i = 0; (i < 2u) && (fr == FR_OK); i++) {
+    uint32_t half = oldest ^ i;
+    if (captureHalfFull[half]) {
+      fr = commemul_captureFlushHalf(half);
+      flushed = true;
+    }
+  }
+  if ((fr == FR_OK) && flushed) {
+    // Keep the file readable if the user powers off mid capture
+    fr = f_sync(&captureFile);
+  }
+  if (fr != FR_OK) {
+    DPRINTF("ROM3 capture: write error %d. Capture stopped\n", fr);
+    f_close(&captureFile);
+    commemul_captureRelease();
+  }
+}
+
+void commemul_captureStop(void) {
+  if (!captureActive) {
+    return;
+  }
+
+  commemul_captureTick();
+  if (!captureActive) {
+    // The tick already failed and closed the file
+    return;
+  }
+
+  FRESULT fr = FR_OK;
+  if (captureFill > 0) {
+    fr = commemul_captureWrite(
+        &captureBuffer[captureHalf * COMMEMUL_CAPTURE_HALF_RECORDS],
+        captureFill);
+  }
+  FRESULT closeResult = f_close(&captureFile);
+  if (fr == FR_OK) fr = closeResult;
+  DPRINTF("ROM3 capture stopped: %lu records (%d)\n",
+          (unsigned long)captureRecords, fr);
+  commemul_captureRelease();
+}
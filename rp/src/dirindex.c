@@ -0,0 +1,540 @@
+/**
+ * File: dirindex.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Sorted folder index of the setup browser. The index is built
+ * with an external merge sort: runs of entries sorted in RAM are written to
+ * a temporary file and merged into the index, so the RAM needed does not
+ * depend on the size of the folder.
+ */
+
+#include "dirindex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "debug.h"
+#include "usb_mass_cache.h"
+
+#define DIRINDEX_MAGIC 0x5844494Du  // "MIDX"
+#define DIRINDEX_VERSION 2
+#define DIRINDEX_NAME_SIZE (MAX_FILENAME_LENGTH + 1)
+#define DIRINDEX_KEY_SIZE 128
+#define DIRINDEX_PATH_SIZE 32
+#define DIRINDEX_WAY_ENTRIES (DIRINDEX_RUN_ENTRIES / DIRINDEX_MERGE_WAYS)
+
+#define DIRINDEX_RUN_FILE_A DIRINDEX_FOLDER "/RUNA.TMP"
+#define DIRINDEX_RUN_FILE_B DIRINDEX_FOLDER "/RUNB.TMP"
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entrySize;
+  uint32_t listing;  // Hash of the names and attributes in the folder
+  uint32_t entries;  // Entries in the folder, before the selection
+  uint32_t count;
+  uint32_t dirs;
+  char key[DIRINDEX_KEY_SIZE];  // Folder, selection and filter
+} DirIndexHeader;
+
+typedef char DirIndexEntry[DIRINDEX_NAME_SIZE];
+
+typedef struct {
+  uint32_t pos;  // Next entry of the run to read from the file
+  uint32_t end;
+  uint16_t head;  // Next entry of the buffer
+  uint16_t len;
+} DirIndexWay;
+
+static inline bool isDirEntry(const char *name) {
+  size_t len = strlen(name);
+  return len > 0 && name[len - 1] == '/';
+}
+
+// Directories first, then names in alphabetical order
+static int entryCmp(const void *a, const void *b) {
+  const char *e1 = (const char *)a;
+  const char *e2 = (const char *)b;
+  bool dir1 = isDirEntry(e1);
+  bool dir2 = isDirEntry(e2);
+  if (dir1 != dir2) return dir1 ? -1 : 1;
+  return strcasecmp(e1, e2);
+}
+
+static uint32_t keyHash(const char *key) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (; *key; key++) {
+    hash = (hash ^ (uint8_t)*key) * 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t hashBytes(uint32_t hash, const void *data, size_t len) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// FatFs keeps no reliable folder timestamp, and the root folder has none.
+// One pass over the folder, without sorting or writing, tells whether the
+// index still matches it.
+static FRESULT listFolder(const char *path, uint32_t *listing,
+                          uint32_t *entries) {
+  DIR dir;
+  FILINFO fno;
+  FRESULT res = f_opendir(&dir, path);
+  if (res != FR_OK) return res;
+  *listing = 2166136261u;
+  *entries = 0;
+  while ((res = f_readdir(&dir, &fno)) == FR_OK && fno.fname[0]) {
+    *listing = hashBytes(*listing, fno.fname, strlen(fno.fname) + 1);
+    *listing = hashBytes(*listing, &fno.fattrib, sizeof(fno.fattrib));
+    (*entries)++;
+  }
+  f_closedir(&dir);
+  return res;
+}
+
+// The USB cache may hold the FAT and folder sectors written here, if a host
+// mounts the card again
+static void invalidateUsbCache(void) {
+  if (usb_mass_cache_isReady()) usb_mass_cache_invalidate();
+}
+
+// Index files of folders that are gone, and runs left by a build that was
+// cut short, are deleted once per boot
+static void pruneIndexes(void) {
+  static bool pruned = false;
+  if (pruned) return;
+  pruned = true;
+
+  DIR dir;
+  FILINFO fno;
+  if (f_opendir(&dir, DIRINDEX_FOLDER) != FR_OK) return;
+  uint32_t removed = 0;
+  while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0]) {
+    char name[DIRINDEX_PATH_SIZE];
+    const char *ext = strrchr(fno.fname, '.');
+    if ((fno.fattrib & AM_DIR) || (ext == NULL) ||
+        (snprintf(name, sizeof(name), DIRINDEX_FOLDER "/%s", fno.fname) >=
+         (int)sizeof(name))) {
+      continue;
+    }
+    bool keep = true;
+    if (strcasecmp(ext, ".TMP") == 0) {
+      keep = false;
+    } else if (strcasecmp(ext, ".IDX") == 0) {
+      FIL file;
+      DirIndexHeader header;
+      UINT br = 0;
+      keep = false;
+      if (f_open(&file, name, FA_READ) == FR_OK) {
+        if (f_read(&file, &header, sizeof(header), &br) == FR_OK &&
+            br == sizeof(header) && header.magic == DIRINDEX_MAGIC &&
+            header.version == DIRINDEX_VERSION) {
+          header.key[DIRINDEX_KEY_SIZE - 1] = '\0';
+          keep = true;
+          // The key is folder|selection|tag. A key cut at the end of the
+          // field can't be checked, and is kept.
+          char *tag = strrchr(header.key, '|');
+          if (tag != NULL) *tag = '\0';
+          char *selection = strrchr(header.key, '|');
+          if (selection != NULL) {
+            *selection = '\0';
+            DIR folder;
+            keep = (f_opendir(&folder, header.key) == FR_OK);
+            if (keep) f_closedir(&folder);
+          }
+        }
+        f_close(&file);
+      }
+    }
+    if (!keep && f_unlink(name) == FR_OK) removed++;
+  }
+  f_closedir(&dir);
+  if (removed > 0) invalidateUsbCache();
+  DPRINTF("Folder indexes pruned: %lu\n", (unsigned long)removed);
+}
+
+static FRESULT readEntries(FIL *file, uint32_t first, DirIndexEntry *entries,
+                           uint32_t count, FSIZE_t base) {
+  UINT br = 0;
+  FRESULT res = f_lseek(file, base + (FSIZE_t)first * DIRINDEX_NAME_SIZE);
+  if (res == FR_OK) {
+    res = f_read(file, entries, count * DIRINDEX_NAME_SIZE, &br);
+  }
+  if (res == FR_OK && br != count * DIRINDEX_NAME_SIZE) res = FR_INT_ERR;
+  return res;
+}
+
+static FRESULT indexEntries(DirIndex *index, uint32_t first,
+                            DirIndexEntry *entries, uint32_t count) {
+  if (index->ram != NULL) {
+    memcpy(entries, index->ram[first], count * DIRINDEX_NAME_SIZE);
+    return FR_OK;
+  }
+  return readEntries(&index->file, first, entries, count,
+                     sizeof(DirIndexHeader));
+}
+
+static FRESULT writeEntries(FIL *file, const DirIndexEntry *entries,
+                            uint32_t count) {
+  UINT bw = 0;
+  FRESULT res = f_write(file, entries, count * DIRINDEX_NAME_SIZE, &bw);
+  if (res == FR_OK && bw != count * DIRINDEX_NAME_SIZE) res = FR_DISK_ERR;
+  return res;
+}
+
+// Merge the runs of runLen entries from first to last of src into dst
+static FRESULT mergeRuns(FIL *src, uint32_t total, uint32_t runLen,
+                         uint32_t first, uint32_t last, FIL *dst,
+                         DirIndexEntry *buffer) {
+  DirIndexWay ways[DIRINDEX_MERGE_WAYS];
+  uint32_t numWays = last - first;
+  for (uint32_t i = 0; i < numWays; i++) {
+    ways[i].pos = (first + i) * runLen;
+    ways[i].end = ways[i].pos + runLen;
+    if (ways[i].end > total) ways[i].end = total;
+    ways[i].head = 0;
+    ways[i].len = 0;
+  }
+
+  for (;;) {
+    int best = -1;
+    for (uint32_t i = 0; i < numWays; i++) {
+      DirIndexWay *way = &ways[i];
+      if (way->head == way->len) {
+        if (way->pos == way->end) continue;
+        uint32_t n = way->end - way->pos;
+        if (n > DIRINDEX_WAY_ENTRIES) n = DIRINDEX_WAY_ENTRIES;
+        FRESULT res =
+            readEntries(src, way->pos, buffer + i * DIRINDEX_WAY_ENTRIES, n, 0);
+        if (res != FR_OK) return res;
+        way->pos += n;
+        way->head = 0;
+        way->len = n;
+      }
+      if (best < 0 ||
+          entryCmp(buffer[i * DIRINDEX_WAY_ENTRIES + way->head],
+                   buffer[best * DIRINDEX_WAY_ENTRIES + ways[best].head]) <
+              0) {
+        best = (int)i;
+      }
+    }
+    if (best < 0) return FR_OK;
+    FRESULT res = writeEntries(
+        dst, &buffer[best * DIRINDEX_WAY_ENTRIES + ways[best].head], 1);
+    if (res != FR_OK) return res;
+    ways[best].head++;
+  }
+}
+
+// Read the folder into sorted runs of DIRINDEX_RUN_ENTRIES entries
+static FRESULT writeRuns(const char *path, bool dirs_only,
+                         EntryFilterFn filter_fn, FIL *runs,
+                         DirIndexEntry *buffer, uint32_t *count,
+                         uint32_t *dirs) {
+  DIR dir;
+  FILINFO fno;
+  FRESULT res = f_opendir(&dir, path);
+  if (res != FR_OK) return res;
+
+  uint32_t len = 0;
+  while ((res = f_readdir(&dir, &fno)) == FR_OK && fno.fname[0]) {
+    if (dirs_only && !(fno.fattrib & AM_DIR)) continue;
+    if (filter_fn && !filter_fn(fno.fname, fno.fattrib)) continue;
+    snprintf(buffer[len], DIRINDEX_NAME_SIZE, "%s%s", fno.fname,
+             (fno.fattrib & AM_DIR) ? "/" : "");
+    if (fno.fattrib & AM_DIR) (*dirs)++;
+    (*count)++;
+    if (++len == DIRINDEX_RUN_ENTRIES) {
+      qsort(buffer, len, DIRINDEX_NAME_SIZE, entryCmp);
+      res = writeEntries(runs, buffer, len);
+      if (res != FR_OK) break;
+      len = 0;
+    }
+  }
+  f_closedir(&dir);
+  if (res == FR_OK && len > 0) {
+    qsort(buffer, len, DIRINDEX_NAME_SIZE, entryCmp);
+    res = writeEntries(runs, buffer, len);
+  }
+  return res;
+}
+
+static FRESULT buildIndex(const char *path, bool dirs_only,
+                          EntryFilterFn filter_fn, const char *indexPath,
+                          DirIndexHeader *header) {
+  sdcard_ensureFolder(DIRINDEX_FOLDER);
+  f_chmod(DIRINDEX_FOLDER, AM_HID, AM_HID);
+
+  DirIndexEntry *buffer = malloc(DIRINDEX_RUN_ENTRIES * DIRINDEX_NAME_SIZE);
+  if (buffer == NULL) return FR_NOT_ENOUGH_CORE;
+
+  static FIL files[2];
+  const char *names[2] = {DIRINDEX_RUN_FILE_A, DIRINDEX_RUN_FILE_B};
+  bool opened[2] = {false, false};
+  FIL index;
+  bool indexOpen = false;
+
+  FRESULT res =
+      f_open(&files[0], names[0], FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
+  opened[0] = (res == FR_OK);
+  if (res == FR_OK) {
+    res = writeRuns(path, dirs_only, filter_fn, &files[0], buffer,
+                    &header->count, &header->dirs);
+  }
+
+  // Merge DIRINDEX_MERGE_WAYS runs at a time until they fit in one pass
+  uint32_t runLen = DIRINDEX_RUN_ENTRIES;
+  uint32_t numRuns = (header->count + runLen - 1) / runLen;
+  int src = 0;
+  while (res == FR_OK && numRuns > DIRINDEX_MERGE_WAYS) {
+    int dst = 1 - src;
+    if (opened[dst]) f_close(&files[dst]);
+    res = f_open(&files[dst], names[dst],
+                 FA_READ | FA_WRITE | FA_CREATE_ALWAYS);
+    opened[dst] = (res == FR_OK);
+    for (uint32_t run = 0; res == FR_OK && run < numRuns;
+         run += DIRINDEX_MERGE_WAYS) {
+      uint32_t last = run + DIRINDEX_MERGE_WAYS;
+      if (last > numRuns) last = numRuns;
+      res = mergeRuns(&files[src], header->count, runLen, run, last,
+                      &files[dst], buffer);
+    }
+    runLen *= DIRINDEX_MERGE_WAYS;
+    numRuns = (numRuns + DIRINDEX_MERGE_WAYS - 1) / DIRINDEX_MERGE_WAYS;
+    src = dst;
+  }
+
+  // The last pass writes the index. The header is written again at the
+  // end, so an index left half built is never valid.
+  UINT bw = 0;
+  uint32_t count = header->count;
+  if (res == FR_OK) {
+    res = f_open(&index, indexPath, FA_WRITE | FA_CREATE_ALWAYS);
+    indexOpen = (res == FR_OK);
+  }
+  if (res == FR_OK) {
+    header->count = 0;
+    res = f_write(&index, header, sizeof(*header), &bw);
+    header->count = count;
+  }
+  if (res == FR_OK && numRuns > 0) {
+    res = mergeRuns(&files[src], count, runLen, 0, numRuns, &index, buffer);
+  }
+  if (res == FR_OK) res = f_lseek(&index, 0);
+  if (res == FR_OK) res = f_write(&index, header, sizeof(*header), &bw);
+
+  if (indexOpen) f_close(&index);
+  for (int i = 0; i < 2; i++) {
+    if (opened[i]) {
+      f_close(&files[i]);
+      f_unlink(names[i]);
+    }
+  }
+  free(buffer);
+  if (res != FR_OK && indexOpen) f_unlink(indexPath);
+  return res;
+}
+
+// The first DIRINDEX_RUN_ENTRIES entries of the folder, sorted in RAM
+static FRESULT openInRam(DirIndex *index, const char *path, bool dirs_only,
+                         EntryFilterFn filter_fn) {
+  index->ram = malloc(DIRINDEX_RUN_ENTRIES * DIRINDEX_NAME_SIZE);
+  if (index->ram == NULL) return FR_NOT_ENOUGH_CORE;
+
+  DIR dir;
+  FILINFO fno;
+  FRESULT res = f_opendir(&dir, path);
+  if (res != FR_OK) {
+    free(index->ram);
+    index->ram = NULL;
+    return res;
+  }
+  uint32_t len = 0;
+  while ((res = f_readdir(&dir, &fno)) == FR_OK && fno.fname[0]) {
+    if (dirs_only && !(fno.fattrib & AM_DIR)) continue;
+    if (filter_fn && !filter_fn(fno.fname, fno.fattrib)) continue;
+    if (len == DIRINDEX_RUN_ENTRIES) {
+      DPRINTF("Folder %s: only %u entries shown\n", path,
+              DIRINDEX_RUN_ENTRIES);
+      break;
+    }
+    snprintf(index->ram[len], DIRINDEX_NAME_SIZE, "%s%s", fno.fname,
+             (fno.fattrib & AM_DIR) ? "/" : "");
+    if (fno.fattrib & AM_DIR) index->dirs++;
+    len++;
+  }
+  f_closedir(&dir);
+  if (res != FR_OK) {
+    free(index->ram);
+    index->ram = NULL;
+    index->dirs = 0;
+    return res;
+  }
+  qsort(index->ram, len, DIRINDEX_NAME_SIZE, entryCmp);
+  index->open = true;
+  index->count = len;
+  DPRINTF("Folder %s sorted in RAM: %lu entries\n", path,
+          (unsigned long)len);
+  return FR_OK;
+}
+
+FRESULT dirindex_open(DirIndex *index, const char *path, bool dirs_only,
+                      EntryFilterFn filter_fn, const char *tag, bool parent,
+                      bool ram_only) {
+  dirindex_close(index);
+  index->parent = parent;
+  index->count = 0;
+  index->dirs = 0;
+
+  if (ram_only) return openInRam(index, path, dirs_only, filter_fn);
+
+  pruneIndexes();
+
+  DirIndexHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = DIRINDEX_MAGIC;
+  header.version = DIRINDEX_VERSION;
+  header.entrySize = DIRINDEX_NAME_SIZE;
+  FRESULT res = listFolder(path, &header.listing, &header.entries);
+  if (res != FR_OK) {
+    DPRINTF("Error reading folder %s: %d\n", path, res);
+    return res;
+  }
+  snprintf(header.key, sizeof(header.key), "%s|%c|%s", path,
+           dirs_only ? 'D' : 'A', (tag != NULL) ? tag : "");
+  char indexPath[DIRINDEX_PATH_SIZE];
+  snprintf(indexPath, sizeof(indexPath), DIRINDEX_FOLDER "/%08lX.IDX",
+           (unsigned long)keyHash(header.key));
+
+  // Use the index on the card if it was built for the same folder as it is
+  res = f_open(&index->file, indexPath, FA_READ);
+  if (res == FR_OK) {
+    DirIndexHeader stored;
+    UINT br = 0;
+    res = f_read(&index->file, &stored, sizeof(stored), &br);
+    if (res == FR_OK && br == sizeof(stored) &&
+        stored.magic == header.magic && stored.version == header.version &&
+        stored.entrySize == header.entrySize &&
+        stored.listing == header.listing &&
+        stored.entries == header.entries &&
+        strncmp(stored.key, header.key, sizeof(header.key)) == 0 &&
+        f_size(&index->file) ==
+            sizeof(stored) + (FSIZE_t)stored.count * DIRINDEX_NAME_SIZE) {
+      index->open = true;
+      index->count = stored.count;
+      index->dirs = stored.dirs;
+      DPRINTF("Folder index %s: %lu entries\n", indexPath,
+              (unsigned long)stored.count);
+      return FR_OK;
+    }
+    f_close(&index->file);
+  }
+
+  DPRINTF("Building folder index %s for %s\n", indexPath, path);
+  res = buildIndex(path, dirs_only, filter_fn, indexPath, &header);
+  invalidateUsbCache();
+  if (res == FR_OK) res = f_open(&index->file, indexPath, FA_READ);
+  if (res != FR_OK) {
+    DPRINTF("Error building the folder index: %d\n", res);
+    return res;
+  }
+  index->open = true;
+  index->count = header.count;
+  index->dirs = header.dirs;
+  DPRINTF("Folder index built: %lu entries\n", (unsigned long)header.count);
+  return FR_OK;
+}
+
+uint32_t dirindex_count(const DirIndex *index) {
+  return index->count + (index->parent ? 1 : 0);
+}
+
+uint32_t dirindex_read(DirIndex *index, uint32_t first,
+                       char entries[][MAX_FILENAME_LENGTH + 1],
+                       uint32_t count) {
+  uint32_t total = dirindex_count(index);
+  if (first >= total) return 0;
+  if (count > total - first) count = total - first;
+
+  uint32_t done = 0;
+  if (index->parent && first == 0) {
+    snprintf(entries[0], DIRINDEX_NAME_SIZE, "..");
+    done = 1;
+  }
+  uint32_t entry = first + done - (index->parent ? 1 : 0);
+  if (done < count && index->open &&
+      indexEntries(index, entry, entries + done, count - done) != FR_OK) {
+    DPRINTF("Error reading the folder index\n");
+    return done;
+  }
+  return count;
+}
+
+static bool entryStartsWith(DirIndex *index, uint32_t entry,
+                            const char *prefix) {
+  DirIndexEntry name;
+  if (indexEntries(index, entry, &name, 1) != FR_OK) return false;
+  return strncasecmp(name, prefix, strlen(prefix)) == 0;
+}
+
+// First entry from first to last that is not before prefix
+static uint32_t lowerBound(DirIndex *index, uint32_t first, uint32_t last,
+                           const char *prefix) {
+  size_t len = strlen(prefix);
+  while (first < last) {
+    uint32_t mid = first + (last - first) / 2;
+    DirIndexEntry name;
+    if (indexEntries(index, mid, &name, 1) != FR_OK) return last;
+    if (strncasecmp(name, prefix, len) < 0) {
+      first = mid + 1;
+    } else {
+      last = mid;
+    }
+  }
+  return first;
+}
+
+uint32_t dirindex_find(DirIndex *index, const char *prefix, uint32_t from) {
+  if (!index->open || prefix[0] == '\0') return DIRINDEX_NOT_FOUND;
+  uint32_t skip = index->parent ? 1 : 0;
+  uint32_t entry = (from > skip) ? from - skip : 0;
+
+  // The entries with the prefix are together in the folders and in the files
+  if (entry < index->count && entryStartsWith(index, entry, prefix)) {
+    return entry + skip;
+  }
+  uint32_t found[2];
+  int numFound = 0;
+  uint32_t dir = lowerBound(index, 0, index->dirs, prefix);
+  if (dir < index->dirs && entryStartsWith(index, dir, prefix)) {
+    found[numFound++] = dir;
+  }
+  uint32_t file = lowerBound(index, index->dirs, index->count, prefix);
+  if (file < index->count && entryStartsWith(index, file, prefix)) {
+    found[numFound++] = file;
+  }
+  if (numFound == 0) return DIRINDEX_NOT_FOUND;
+  for (int i = 0; i < numFound; i++) {
+    if (found[i] >= entry) return found[i] + skip;
+  }
+  return found[0] + skip;
+}
+
+void dirindex_close(DirIndex *index) {
+  if (index->ram != NULL) {
+    free(index->ram);
+    index->ram = NULL;
+  } else if (index->open) {
+    f_close(&index->file);
+  }
+  index->open = false;
+}
@@ -16,9 +16,28 @@ static uint32_t displaysHighresTranstableAddress = 0;
 _Static_assert(DISPLAY_BUFFER_SIZE <= UINT32_MAX,
                "Buffer size exceeds allowed limits");
 
+// The rows of tiles are checksummed a word at a time
+_Static_assert(DISPLAY_TILE_ROW_BYTES * DISPLAY_TILES_HEIGHT ==
+                       DISPLAY_BUFFER_SIZE &&
+                   DISPLAY_TILE_ROW_BYTES % sizeof(uint32_t) == 0,
+               "Rows of tiles must split the buffer in whole words");
+_Static_assert(DISPLAY_TILES_HEIGHT <= 32, "One bit per row of tiles");
+_Static_assert(DISPLAY_ROW_GENERATION_OFFSET + DISPLAY_TILES_HEIGHT * 4 <=
+                   0x2000,
+               "Row generations overflow the display window");
+
+// Generation of the last refresh that changed the buffer. Never reset, so
+// the remote computer keeps following it when the display is set up again.
+static uint32_t displayGeneration = 0;
+
+// Checksums of the rows of tiles at the last refresh
+static uint32_t rowChecksums[DISPLAY_TILES_HEIGHT] = {0};
+static bool rowChecksumsValid = false;
+
 // Allocate the framebuffer
 #if DISPLAY_BYPASS_FRAMEBUFFER == 0
-static unsigned char u8g2Buffer[DISPLAY_BUFFER_SIZE] = {0};
+static unsigned char u8g2Buffer[DISPLAY_BUFFER_SIZE]
+    __attribute__((aligned(4))) = {0};
 #else
 static unsigned char *u8g2Buffer = NULL;
 #endif
@@ -145,6 +164,9 @@ void display_setupU8g2() {
   // Calculate tile buffer height
   uint8_t tileBufHeight = DISPLAY_HEIGHT / DISPLAY_TILE_HEIGHT;
 
+  // The shared buffer may hold anything now: send every row on next refresh
+  rowChecksumsValid = false;
+
   u8g2_SetupBuffer(&u8g2, u8g2Buffer, tileBufHeight,
                    u8g2_ll_hvline_horizontal_right_lsb, U8G2_R0);
 
@@ -152,12 +174,55 @@ void display_setupU8g2() {
   u8g2_InitDisplay(&u8g2);  // Initialize display (will use dummy callbacks)
 }
 
+// FNV-1a over the words of a row of tiles
+static uint32_t checksumTileRow(const unsigned char *row) {
+  const uint32_t *words = (const uint32_t *)row;
+  uint32_t checksum = 2166136261u;
+  for (size_t i = 0; i < DISPLAY_TILE_ROW_BYTES / sizeof(uint32_t); i++) {
+    checksum = (checksum ^ words[i]) * 16777619u;
+  }
+  return checksum;
+}
+
 void display_refresh() {
+  // One bit per row of tiles that changed since the last refresh
+  uint32_t dirtyRows = 0;
+  for (int row = 0; row < DISPLAY_TILES_HEIGHT; row++) {
+    uint32_t checksum =
+        checksumTileRow(u8g2Buffer + row * DISPLAY_TILE_ROW_BYTES);
+    if (!rowChecksumsValid || checksum != rowChecksums[row]) {
+      rowChecksums[row] = checksum;
+      dirtyRows |= 1u << row;
+    }
+  }
+  rowChecksumsValid = true;
+  if (dirtyRows == 0) {
+    // Nothing changed: the remote computer keeps its copy
+    return;
+  }
+
 #if DISPLAY_BYPASS_FRAMEBUFFER == 0
-  uint32_t *displayBuffer = (void *)display_getAddress();
-  COPY_AND_SWAP_16BIT_DMA(displayBuffer, (uint16_t *)u8g2Buffer,
-                          DISPLAY_BUFFER_SIZE);
+  // Copy the span from the first to the last changed row in one transfer
+  uint32_t firstRow = __builtin_ctz(dirtyRows);
+  uint32_t lastRow = 31 - __builtin_clz(dirtyRows);
+  uint32_t offset = firstRow * DISPLAY_TILE_ROW_BYTES;
+  uint32_t *displayBuffer = (void *)(display_getAddress() + offset);
+  COPY_AND_SWAP_16BIT_DMA(displayBuffer, (uint16_t *)(u8g2Buffer + offset),
+                          (lastRow - firstRow + 1) * DISPLAY_TILE_ROW_BYTES);
 #endif
+
+  // The rows first, so the remote computer never sees the new generation
+  // before the rows that changed in it
+  displayGeneration++;
+  for (int row = 0; row < DISPLAY_TILES_HEIGHT; row++) {
+    if (dirtyRows & (1u << row)) {
+      WRITE_AND_SWAP_LONGWORD(display_getAddress(),
+                              DISPLAY_ROW_GENERATION_OFFSET + row * 4,
+                              displayGeneration);
+    }
+  }
+  WRITE_AND_SWAP_LONGWORD(display_getAddress(), DISPLAY_GENERATION_OFFSET,
+                          displayGeneration);
 }
 
 void display_drawProductInfo() {
@@ -8,7 +8,12 @@
 
 #include "emul.h"
 
+#include "acsi_scancache.h"
+#include "bootcache.h"
+#include "cmdtrace.h"
 #include "commemul.h"
+#include "perfprofile.h"
+#include "sramstat.h"
 
 // inclusw in the C file to avoid multiple definitions
 #include "target_firmware.h"  // Include the target firmware binary
@@ -42,6 +47,10 @@ static void cmdY2KPatch(const char *arg);
 static void cmdUTCOffset(const char *arg);
 static void cmdHost(const char *arg);
 static void cmdPort(const char *arg);
+static void cmdTraceDump(const char *arg);
+static void cmdAcsiTest(const char *arg);
+static void cmdSramStat(const char *arg);
+static void cmdPerf(const char *arg);
 
 // Command table
 static const Command commands[] = {
@@ -80,6 +89,10 @@ static const Command commands[] = {
     {"put_int", term_cmdPutInt},
     {"put_bool", term_cmdPutBool},
     {"put_str", term_cmdPutString},
+    {"trace", cmdTraceDump},
+    {"acsitest", cmdAcsiTest},
+    {"sram", cmdSramStat},
+    {"perf", cmdPerf},
 };
 
 // Number of commands in the table
@@ -110,10 +123,17 @@ static int appStatus = APP_MODE_SETUP;
 // USB Mass Storage ready
 static bool usbMassStorageReady = false;
 static volatile bool pendingDriveACycle = false;
+static volatile bool pendingTraceDump = false;
+// USB mass storage kept connected during the emulation
+static bool usbRuntimeActive = false;
 
 // Folder search
 #define NAV_LINES_PER_PAGE 16
 #define NAV_LINES_PER_PAGE_OFFSET 4
+#define NAV_SEARCH_SIZE 16
+#define NAV_SEARCH_TIMEOUT_MS 1000
+#define NAV_FILTER_FLOPPIES "FLOPPIES"
+#define NAV_FILTER_ACSI "ACSI"
 enum navStatus {
   NAV_DIR_ERROR = -1,
   NAV_DIR_FIRST_TIME_OK = 0,
@@ -123,12 +143,16 @@ enum navStatus {
 };
 
 typedef struct {
-  uint16_t count;
-  uint16_t selected;
-  uint16_t page;
-  char entries[MAX_ENTRIES_DIR][MAX_FILENAME_LENGTH + 1];
+  uint32_t count;
+  uint32_t selected;
+  uint32_t page;
+  DirIndex index;  // Sorted entries of the folder on the SD card
+  char entries[NAV_LINES_PER_PAGE][MAX_FILENAME_LENGTH + 1];  // Page shown
   char folderPath[MAX_FILENAME_LENGTH + 1];
   char topDir[MAX_FILENAME_LENGTH + 1];
+  char search[NAV_SEARCH_SIZE];  // Name typed so far
+  uint8_t searchLen;
+  uint32_t searchTimeMs;
 } DirNavigation;
 
 static DirNavigation *navState = NULL;
@@ -168,9 +192,72 @@ static bool __not_in_flash_func(isTrue)(const char *value) {
 }
 
 static bool isRTCEnabled(void) {
-  SettingsConfigEntry *rtcEnabled = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_RTC_ENABLED);
-  return (rtcEnabled != NULL) && isTrue(rtcEnabled->value);
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_RTC_ENABLED, false);
+}
+
+static bool isRom3CaptureEnabled(void) {
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_ROM3_CAPTURE, false);
+}
+
+static bool isUsbRuntimeEnabled(void) {
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_USB_RUNTIME, false);
+}
+
+static bool isUsbRuntimeRwEnabled(void) {
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_USB_RUNTIME_RW, false);
+}
+
+static bool isBootCacheEnabled(void) {
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_BOOT_CACHE, false);
+}
+
+// A writable USB host gets the SD card for itself. The drives close their
+// files first and their commands go unanswered until the host lets go.
+static void lendSdCardToUsbHost(void) {
+  DPRINTF("Lending the SD card to the USB host...\n");
+  chandler_setSuspendedApps(CHANDLER_APP_BIT(APP_GEMDRVEMUL) |
+                            CHANDLER_APP_BIT(APP_ACSIEMUL) |
+                            CHANDLER_APP_BIT(APP_FLOPPYEMUL));
+  commemul_captureStop();
+  gemdrive_release();
+  acsi_release();
+  floppy_release();
+  FRESULT fr = f_unmount("0:");
+  if (fr != FR_OK) {
+    DPRINTF("Error unmounting the SD card: %d\n", fr);
+  }
+}
+
+static void reclaimSdCardFromUsbHost(void) {
+  DPRINTF("Reclaiming the SD card from the USB host...\n");
+  FRESULT fr = f_mount(&fsys, "0:", 1);
+  if (fr != FR_OK) {
+    DPRINTF("Error mounting the SD card: %d\n", fr);
+  }
+  acsi_resume();
+  floppy_resume();
+  if (isRom3CaptureEnabled()) {
+    commemul_captureResume(COMMEMUL_CAPTURE_PATH);
+  }
+  chandler_setSuspendedApps(0);
+}
+
+static void __not_in_flash_func(serviceUsbRuntime)(void) {
+  bool wantsCard = usb_mass_runtimeHostWantsCard();
+  if (wantsCard != usb_mass_runtimeHostOwnsCard()) {
+    if (wantsCard) {
+      lendSdCardToUsbHost();
+    } else {
+      reclaimSdCardFromUsbHost();
+    }
+    usb_mass_runtimeSetHostOwnsCard(wantsCard);
+  }
+  usb_mass_runtimeService();
 }
 
 static int getBootStatusAfterSetup(void) {
@@ -381,25 +468,19 @@ static bool parseAcsiId(const char *value, uint8_t *idOut) {
 }
 
 static uint8_t getConfiguredAcsiId(void) {
-  SettingsConfigEntry *acsiId = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ID);
-  uint8_t id = 7;
-  if ((acsiId != NULL) && parseAcsiId(acsiId->value, &id)) {
-    return id;
-  }
-  return 7;
+  int id = settings_get_int(aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ID,
+                            -1);
+  return (id >= 0 && id <= 7) ? (uint8_t)id : 7;
 }
 
 static bool isGemdriveEnabledConfigured(void) {
-  SettingsConfigEntry *gemDrive = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_GEMDRIVE_ENABLED);
-  return (gemDrive != NULL) && isTrue(gemDrive->value);
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_GEMDRIVE_ENABLED, false);
 }
 
 static bool isAcsiEnabledConfigured(void) {
-  SettingsConfigEntry *acsiEnabled = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ENABLED);
-  return (acsiEnabled != NULL) && isTrue(acsiEnabled->value);
+  return settings_get_bool(aconfig_getContext(),
+                           ACONFIG_PARAM_DRIVES_ACSI_ENABLED, false);
 }
 
 static char getConfiguredGemdriveDriveLetter(void) {
@@ -485,7 +566,7 @@ static void buildSelectedPath(char out[MAX_FILENAME_LENGTH + 1],
 // Remove last path component (".." navigation)
 static void __not_in_flash_func(pathUp)() {
   char temp[MAX_FILENAME_LENGTH + 1];
-  char *segments[MAX_ENTRIES_DIR];
+  char *segments[MAX_FILENAME_LENGTH / 2 + 1];
   int sp = 0;
 
   // Copy and tokenize
@@ -579,6 +660,18 @@ static void showSetupMessageScreen(const char *message) {
   display_refresh();
 }
 
+// Saves the app settings. On failure the error is shown and the change only
+// lasts until the next reset.
+static bool saveSettings(void) {
+  if (settings_save(aconfig_getContext(), true) == 0) {
+    return true;
+  }
+  showSetupMessageScreen(
+      "Error: the settings could not be saved. The change is lost at the "
+      "next reset.");
+  return false;
+}
+
 static void __not_in_flash_func(showCounter)(int cdown);
 
 static void drawSetupInfoLine(const char *message) {
@@ -707,6 +800,8 @@ static void printSdHealthLine(void) {
 
 static void __not_in_flash_func(menu)(void) {
   term_setCommandLevel(TERM_COMMAND_LEVEL_SINGLE_KEY);
+  // Back from any folder browser
+  if (navState != NULL) dirindex_close(&navState->index);
 
   showTitle();
 
@@ -967,12 +1062,106 @@ void cmdHiddenSettings(const char *arg) {
   term_printString("  put_int - Set integer (key and value)\n");
   term_printString("  put_bool- Set boolean (key and value)\n");
   term_printString("  put_str - Set string (key and value)\n");
+  term_printString("  trace   - Dump command trace to SD\n");
+  term_printString("  acsitest- Check the ACSI images\n");
+  term_printString("  sram    - Show RAM use, heap peak and pools\n");
   term_printString("\n");
   term_setCommandLevel(TERM_COMMAND_LEVEL_COMMAND_INPUT);
   haltCountdown = true;
   term_printString("Enter command. ESC to return > ");
 }
 
+void cmdTraceDump(const char *arg) {
+  (void)arg;
+  uint32_t count = 0;
+  FRESULT fr = cmdtrace_dumpToFile(CMDTRACE_DUMP_PATH, &count);
+  if (fr != FR_OK) {
+    TPRINTF("Error writing %s: %d\n", CMDTRACE_DUMP_PATH, fr);
+    return;
+  }
+  TPRINTF("%lu commands written to %s\n", (unsigned long)count,
+          CMDTRACE_DUMP_PATH);
+}
+
+void cmdAcsiTest(const char *arg) {
+  (void)arg;
+  acsi_runImageTests(term_printString);
+}
+
+void cmdSramStat(const char *arg) {
+  (void)arg;
+  SramStat stat;
+  sramstat_get(&stat);
+  TPRINTF("Static RAM: %u of %u bytes\n", (unsigned int)stat.staticBytes,
+          (unsigned int)stat.staticBudget);
+  TPRINTF("Heap budget: %u bytes\n", (unsigned int)stat.heapBudget);
+  TPRINTF("Heap in use: %u bytes\n", (unsigned int)stat.heapInUse);
+  TPRINTF("Heap taken : %u bytes\n", (unsigned int)stat.heapSize);
+  TPRINTF("Heap peak  : %u bytes\n", (unsigned int)stat.heapPeak);
+  const SlabPool *pool;
+  for (uint8_t i = 0; (pool = gemdrive_getPool(i)) != NULL; i++) {
+    if (pool->name == NULL) continue;
+    TPRINTF("Pool %-5s : %u/%u used, %u peak, %lu full\n", pool->name,
+            pool->inUse, pool->capacity, pool->peak,
+            (unsigned long)pool->exhausted);
+  }
+}
+
+static void printPerfProfileSetting(const char *mode, const char *param) {
+  SettingsConfigEntry *entry = settings_find_entry(aconfig_getContext(), param);
+  const char *name = (entry != NULL) ? entry->value : PERFPROFILE_STANDARD;
+  const PerfProfile *profile = perfprofile_find(name);
+  const char *why = "unknown profile";
+  if ((profile != NULL) && perfprofile_validate(profile, &why)) why = "ok";
+  TPRINTF("%-9s : %s (%s)\n", mode, name, why);
+}
+
+void cmdPerf(const char *arg) {
+  (void)arg;
+  const PerfProfile *active = perfprofile_getActive();
+  printPerfProfileSetting("Setup", ACONFIG_PARAM_PERF_PROFILE_SETUP);
+  printPerfProfileSetting("Emulation", ACONFIG_PARAM_PERF_PROFILE);
+  TPRINTF("Profiles  :");
+  const PerfProfile *profile;
+  for (uint8_t i = 0; (profile = perfprofile_at(i)) != NULL; i++) {
+    TPRINTF(" %s", profile->name);
+  }
+  TPRINTF("\n");
+
+  // Only the profile applied at boot can be measured
+  uint32_t sysKhz = clock_get_hz(clk_sys) / 1000u;
+  TPRINTF("Active    : %s, %lu KHz, %s\n", active->name,
+          (unsigned long)sysKhz, VOLTAGE_VALUES[active->voltage]);
+  uint32_t pioDivMilli = (uint32_t)(perfprofile_getPioDivider() * 1000.f);
+  TPRINTF("PIO div   : %lu.%03lu\n", (unsigned long)(pioDivMilli / 1000u),
+          (unsigned long)(pioDivMilli % 1000u));
+  TPRINTF("Flash     : %lu KHz\n",
+          (unsigned long)(sysKhz / perfprofile_getFlashDivider()));
+  SettingsConfigEntry *baud =
+      settings_find_entry(gconfig_getContext(), PARAM_SD_BAUD_RATE_KB);
+  uint32_t baudKhz = (baud != NULL) ? (uint32_t)atoi(baud->value) : 0;
+  if (baudKhz > active->sdSpiMaxKhz) baudKhz = active->sdSpiMaxKhz;
+  TPRINTF("SD SPI    : %s KHz set, %lu KHz cap, %lu KHz real\n",
+          (baud != NULL) ? baud->value : "-",
+          (unsigned long)active->sdSpiMaxKhz,
+          (unsigned long)perfprofile_getSpiKhz(baudKhz));
+
+  PerfSelfTest test;
+  perfprofile_selfTest(&test);
+  TPRINTF("RAM copy  : %lu KB/s\n", (unsigned long)test.ramKBPerS);
+  TPRINTF("Flash read: %lu KB/s, %lu ns latency\n",
+          (unsigned long)test.flashKBPerS,
+          (unsigned long)test.flashLatencyNs);
+  uint32_t writeKBPerS = 0;
+  uint32_t readKBPerS = 0;
+  if (runSdHealthTest(&writeKBPerS, &readKBPerS)) {
+    TPRINTF("SD 4KB    : W=%lu KB/s  R=%lu KB/s\n", (unsigned long)writeKBPerS,
+            (unsigned long)readKBPerS);
+  } else {
+    TPRINTF("SD 4KB    : ERROR\n");
+  }
+}
+
 //
 // GEMDRIVE commands
 //
@@ -994,26 +1183,28 @@ void cmdGemdriveEnabled(const char *arg) {
 
   settings_put_bool(aconfig_getContext(), ACONFIG_PARAM_DRIVES_GEMDRIVE_ENABLED,
                     newEnabled);
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   haltCountdown = true;
   menu();
   display_refresh();
 }
 
 static void drawPage(uint16_t top_offset) {
-  uint16_t start = navState->page * NAV_LINES_PER_PAGE;
-  uint16_t end = start + NAV_LINES_PER_PAGE;
+  uint32_t start = navState->page * NAV_LINES_PER_PAGE;
+  uint32_t end = start + NAV_LINES_PER_PAGE;
   if (end > navState->count) {
     end = navState->count;
   }
 
-  for (uint16_t i = start; i < end; i++) {
+  for (uint32_t i = start; i < end; i++) {
     uint8_t row = i - start;
     vt52Cursor(row + top_offset, 0);
     term_printString(i == navState->selected ? ">" : " ");
     char buffer[TERM_SCREEN_SIZE_X + 1];
     snprintf(buffer, sizeof(buffer), " %-*s", TERM_SCREEN_SIZE_X - 2,
-             navState->entries[i]);
+             navState->entries[row]);
     term_printString(buffer);
   }
 
@@ -1021,16 +1212,24 @@ static void drawPage(uint16_t top_offset) {
   vt52Cursor(TERM_SCREEN_SIZE_Y - 3,
              0);  // Bottom three lines of the screen for status
   char infoBuffer[128];
-  int totalPages =
+  uint32_t totalPages =
       (navState->count + NAV_LINES_PER_PAGE - 1) / NAV_LINES_PER_PAGE;
-  sprintf(infoBuffer, "Page %d/%d\n", navState->page + 1, totalPages);
+  if (navState->searchLen > 0) {
+    sprintf(infoBuffer, "Page %lu/%lu. Find: %s\n",
+            (unsigned long)navState->page + 1, (unsigned long)totalPages,
+            navState->search);
+  } else {
+    sprintf(infoBuffer, "Page %lu/%lu. Type a name to find it\n",
+            (unsigned long)navState->page + 1, (unsigned long)totalPages);
+  }
   term_printString(infoBuffer);
   term_printString("Use cursor keys and RETURN to navigate.\n");
   term_printString("SPACE to confirm selection. ESC to exit");
 }
 
 static enum navStatus __not_in_flash_func(navigate_directory)(
-    bool first_time, bool dirs_only, char key, EntryFilterFn filter_fn,
+    bool first_time, bool dirs_only, const char *keys,
+    EntryFilterFn filter_fn, const char *filter_tag,
     char top_folder[MAX_FILENAME_LENGTH + 1]);
 
 static uint8_t floppyDriveASetSlotFromKey(char key) {
@@ -1120,7 +1319,7 @@ static void floppyDriveASetRenderBrowser(void) {
   term_printString(navState->folderPath);
   drawPage(NAV_LINES_PER_PAGE_OFFSET);
   vt52Cursor(TERM_SCREEN_SIZE_Y - 1, 0);
-  term_printString("SPACE=select image, M=back to slot menu");
+  term_printString("SPACE=select image, SHIFT+M=slot menu");
   display_refresh();
 }
 
@@ -1140,8 +1339,9 @@ static void floppyDriveASetOpenBrowser(uint8_t slotIndex) {
   }
   navState->folderPath[sizeof(navState->folderPath) - 1] = '\0';
 
-  enum navStatus status = navigate_directory(true, false, '\0', floppiesFilter,
-                                             navState->folderPath);
+  enum navStatus status =
+      navigate_directory(true, false, NULL, floppiesFilter,
+                         NAV_FILTER_FLOPPIES, navState->folderPath);
   if (status == NAV_DIR_FIRST_TIME_OK || status == NAV_DIR_NEXT_TIME_OK) {
     floppyDriveASetRenderBrowser();
   } else {
@@ -1165,15 +1365,93 @@ static void handleSelectShortPress(void) {
   reset_device();
 }
 
+// Runs on core 1: only flag the dump, the SD card belongs to core 0.
+static void handleSelectMediumPress(void) {
+  if (appStatus == APP_EMULATION_RUNTIME) {
+    pendingTraceDump = true;
+    return;
+  }
+
+  handleSelectShortPress();
+}
+
+static const char *navSelectedEntry(void) {
+  return navState->entries[navState->selected -
+                           navState->page * NAV_LINES_PER_PAGE];
+}
+
+// Move the selection, reading the page of the entry from the index
+static void __not_in_flash_func(navSelect)(uint32_t entry) {
+  uint32_t page = entry / NAV_LINES_PER_PAGE;
+  navState->selected = entry;
+  if (page != navState->page || navState->entries[0][0] == '\0') {
+    navState->page = page;
+    memset(navState->entries, 0, sizeof(navState->entries));
+    dirindex_read(&navState->index, page * NAV_LINES_PER_PAGE,
+                  navState->entries, NAV_LINES_PER_PAGE);
+  }
+}
+
+static FRESULT __not_in_flash_func(navOpenFolder)(bool dirs_only,
+                                                  EntryFilterFn filter_fn,
+                                                  const char *filter_tag) {
+  const char *path =
+      (strlen(navState->folderPath) == 0) ? "/" : navState->folderPath;
+  // Add ".." if not at root or top_dir
+  bool parent = (strcmp(path, "/") != 0) &&
+                (strlen(navState->topDir) > 0 &&
+                 strcmp(path, navState->topDir) != 0);
+  navState->count = 0;
+  navState->selected = 0;
+  navState->page = 0;
+  navState->searchLen = 0;
+  memset(navState->entries, 0, sizeof(navState->entries));
+  // Building the index of a big folder takes a while
+  vt52Cursor(TERM_SCREEN_SIZE_Y - 3, 0);
+  term_printString("Reading folder...\n");
+  display_refresh();
+  // Nothing is written to the card while a USB host has it mounted
+  FRESULT result = dirindex_open(&navState->index, path, dirs_only, filter_fn,
+                                 filter_tag, parent, usbMassStorageReady);
+  if (result == FR_OK) {
+    navState->count = dirindex_count(&navState->index);
+    navSelect(0);
+  }
+  DPRINTF("Loaded %lu entries\n", (unsigned long)navState->count);
+  return result;
+}
+
+// Find the entry whose name starts with the keys typed. Typing the same
+// first letter again goes to the next entry with it.
+static void __not_in_flash_func(navSearch)(char key) {
+  uint32_t now = to_ms_since_boot(get_absolute_time());
+  if (now - navState->searchTimeMs > NAV_SEARCH_TIMEOUT_MS) {
+    navState->searchLen = 0;
+  }
+  navState->searchTimeMs = now;
+
+  bool again = (navState->searchLen == 1) && (navState->search[0] == key);
+  uint32_t from = navState->selected;
+  if (navState->searchLen == 0 || again) {
+    from++;
+  }
+  if (!again && navState->searchLen < NAV_SEARCH_SIZE - 1) {
+    navState->search[navState->searchLen++] = key;
+    navState->search[navState->searchLen] = '\0';
+  }
+  uint32_t found = dirindex_find(&navState->index, navState->search, from);
+  if (found != DIRINDEX_NOT_FOUND) {
+    navSelect(found);
+  }
+}
+
 static enum navStatus __not_in_flash_func(navigate_directory)(
-    bool first_time, bool dirs_only, char key, EntryFilterFn filter_fn,
+    bool first_time, bool dirs_only, const char *keys,
+    EntryFilterFn filter_fn, const char *filter_tag,
     char top_folder[MAX_FILENAME_LENGTH + 1]) {
   enum navStatus status = NAV_DIR_ERROR;
   if (first_time) {
     DPRINTF("First time loading directory.\n");
-    navState->count = 0;
-    navState->selected = 0;
-    navState->page = 0;
     // Set the top folder
     if (top_folder != NULL) {
       strncpy(navState->topDir, top_folder, sizeof(navState->topDir));
@@ -1182,11 +1460,7 @@ static enum navStatus __not_in_flash_func(navigate_directory)(
       strncpy(navState->topDir, "/", sizeof(navState->topDir));
       navState->topDir[sizeof(navState->topDir) - 1] = '\0';
     }
-    memset(navState->entries, 0, sizeof(navState->entries));
-    FRESULT result = sdcard_loadDirectory(
-        (strlen(navState->folderPath) == 0) ? "/" : navState->folderPath,
-        navState->entries, &navState->count, &navState->selected,
-        &navState->page, dirs_only, filter_fn, navState->topDir);
+    FRESULT result = navOpenFolder(dirs_only, filter_fn, filter_tag);
     if (result != FR_OK) {
       term_printString("Error loading directory.\n");
     } else {
@@ -1195,67 +1469,61 @@ static enum navStatus __not_in_flash_func(navigate_directory)(
   } else {
     DPRINTF("Next times loading directory.\n");
     status = NAV_DIR_NEXT_TIME_OK;
-    int totalPages =
+    char key = (keys != NULL) ? keys[0] : '\0';
+    bool shiftKey = (keys != NULL) && (key != '\0') && (keys[1] == 'S');
+    uint32_t totalPages =
         (navState->count + NAV_LINES_PER_PAGE - 1) / NAV_LINES_PER_PAGE;
     switch (key) {
       case TERM_KEYBOARD_KEY_UP:
+        navState->searchLen = 0;
         if (navState->selected > 0) {
-          navState->selected--;
+          navSelect(navState->selected - 1);
         }
         break;
       case TERM_KEYBOARD_KEY_DOWN:
-        if ((navState->selected < navState->count - 1) &&
-            (navState->selected % NAV_LINES_PER_PAGE <
-             NAV_LINES_PER_PAGE - 1)) {
-          navState->selected++;
+        navState->searchLen = 0;
+        if (navState->selected + 1 < navState->count) {
+          navSelect(navState->selected + 1);
         }
         break;
       case TERM_KEYBOARD_KEY_LEFT:
+        navState->searchLen = 0;
         if (navState->page > 0) {
-          navState->page--;
-          navState->selected = navState->page * NAV_LINES_PER_PAGE;
+          navSelect((navState->page - 1) * NAV_LINES_PER_PAGE);
         }
         break;
       case TERM_KEYBOARD_KEY_RIGHT:
+        navState->searchLen = 0;
         if (navState->page < (totalPages - 1)) {
-          navState->page++;
-          navState->selected = navState->page * NAV_LINES_PER_PAGE;
-          DPRINTF("Page: %d\n", navState->page);
+          navSelect((navState->page + 1) * NAV_LINES_PER_PAGE);
+          DPRINTF("Page: %lu\n", (unsigned long)navState->page);
         }
         break;
       case '\r':
       case '\n': {
+        navState->searchLen = 0;
         // If the selected entry is a directory or two dots, navigate into it
-        if ((navState->entries[navState->selected]
-                              [strlen(navState->entries[navState->selected]) -
-                               1] == '/') ||
-            (strcmp(navState->entries[navState->selected], "..") == 0)) {
+        const char *entry = navSelectedEntry();
+        size_t entryLen = strlen(entry);
+        if ((entryLen > 0 && entry[entryLen - 1] == '/') ||
+            (strcmp(entry, "..") == 0)) {
           // Select the entry
-          navState->count = 0;
-          navState->page = 0;
           char newFolderPath[MAX_FILENAME_LENGTH + 1];
           DPRINTF("Old folder path: %s\n", navState->folderPath);
           size_t len = strlen(navState->folderPath);
           if (len > 0 && navState->folderPath[len - 1] != '/') {
             snprintf(newFolderPath, sizeof(newFolderPath), "%s/%s",
-                     navState->folderPath,
-                     navState->entries[navState->selected]);
+                     navState->folderPath, entry);
           } else {
             snprintf(newFolderPath, sizeof(newFolderPath), "%s%s",
-                     navState->folderPath,
-                     navState->entries[navState->selected]);
+                     navState->folderPath, entry);
           }
           strncpy(navState->folderPath, newFolderPath, sizeof(newFolderPath));
           DPRINTF("Selected entry raw: %s\n", navState->folderPath);
           // Path up
           pathUp();
           DPRINTF("Selected entry with path up: %s\n", navState->folderPath);
-          memset(navState->entries, 0, sizeof(navState->entries));
-          navState->selected = 0;
-          FRESULT result = sdcard_loadDirectory(
-              navState->folderPath, navState->entries, &navState->count,
-              &navState->selected, &navState->page, dirs_only, filter_fn,
-              navState->topDir);
+          FRESULT result = navOpenFolder(dirs_only, filter_fn, filter_tag);
           if (result != FR_OK) {
             term_printString("Error loading directory.\n");
             status = NAV_DIR_ERROR;
@@ -1265,19 +1533,19 @@ static enum navStatus __not_in_flash_func(navigate_directory)(
       }
       case ' ': {
         // Confirm selection
+        navState->searchLen = 0;
         status = NAV_DIR_SELECTED;
         break;
       }
       default:
-        // Return the ASCII uppercase value of the key
-        // This is used to select the entry
-        if (key >= 'a' && key <= 'z') {
-          key = key - 'a' + 'A';
-        }
-        // Check if the key is a valid entry
-        if (key >= 'A' && key <= 'Z') {
+        // SHIFT + letter: return the ASCII uppercase value of the key, used
+        // by the callers as commands. Other keys find entries by name.
+        if (shiftKey && key >= 'A' && key <= 'Z') {
           status = key;
           DPRINTF("Navigation menu Key: %c\n", key);
+        } else if (key >= TERM_KEYBOARD_KEY_START &&
+                   key <= TERM_KEYBOARD_KEY_END) {
+          navSearch(key);
         }
         break;
     }
@@ -1301,15 +1569,16 @@ void __not_in_flash_func(cmdGemdriveFolder)(const char *arg) {
         strncpy(navState->folderPath, gemDriveFolder->value,
                 sizeof(navState->folderPath));
         term_setCommandLevel(TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY);
-        status = navigate_directory(true, true, '\0', floppiesFilter, NULL);
+        status = navigate_directory(true, true, NULL, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, NULL);
         break;
       }
       case TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY: {
         // If we are here is because we have already entered the command
         DPRINTF("GEMDRIVE key: %d\n", arg[0]);
-        char key = arg[0];
         // Check if the key is a valid navigation key
-        status = navigate_directory(false, true, key, floppiesFilter, NULL);
+        status = navigate_directory(false, true, arg, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, NULL);
         break;
       }
       default:
@@ -1321,7 +1590,7 @@ void __not_in_flash_func(cmdGemdriveFolder)(const char *arg) {
         // Print the navState->selected entry
         DPRINTF("Entries: %d\n", navState->count);
         DPRINTF("Selected entry: %d = %s\n", navState->selected,
-                navState->entries[navState->selected]);
+                navSelectedEntry());
         // Redraw the navState->page
         showTitle();
         DPRINTF("Folder: %s\n", navState->folderPath);
@@ -1336,8 +1605,10 @@ void __not_in_flash_func(cmdGemdriveFolder)(const char *arg) {
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER,
                             navState->folderPath);
-        settings_save(aconfig_getContext(), true);
-        DPRINTF("Folder: %s. SAVED!\n", navState->entries[navState->selected]);
+        if (!saveSettings()) {
+          break;
+        }
+        DPRINTF("Folder: %s. SAVED!\n", navSelectedEntry());
         menu();
         term_setCommandLevel(TERM_COMMAND_LEVEL_SINGLE_KEY);
         break;
@@ -1396,7 +1667,9 @@ void cmdGemdriveDrive(const char *arg) {
         }
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE, driveBuffer);
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          return;
+        }
         menu();
       }
     }
@@ -1436,7 +1709,9 @@ void cmdAcsiEnabled(const char *arg) {
 
   settings_put_bool(aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ENABLED,
                     newEnabled);
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   haltCountdown = true;
   menu();
   display_refresh();
@@ -1453,12 +1728,13 @@ void __not_in_flash_func(cmdAcsiImage)(const char *arg) {
       seedFolderPathFromStoredFile(
           (acsiImage != NULL) ? acsiImage->value : NULL, navState->folderPath);
       term_setCommandLevel(TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY);
-      status = navigate_directory(true, false, '\0', acsiImagesFilter, NULL);
+      status = navigate_directory(true, false, NULL, acsiImagesFilter,
+                                  NAV_FILTER_ACSI, NULL);
       break;
     }
     case TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY: {
-      char key = (arg != NULL) ? arg[0] : '\0';
-      status = navigate_directory(false, false, key, acsiImagesFilter, NULL);
+      status = navigate_directory(false, false, arg, acsiImagesFilter,
+                                  NAV_FILTER_ACSI, NULL);
       break;
     }
     default:
@@ -1471,7 +1747,7 @@ void __not_in_flash_func(cmdAcsiImage)(const char *arg) {
       renderAcsiImageBrowser(NULL);
       break;
     case NAV_DIR_SELECTED: {
-      const char *selected = navState->entries[navState->selected];
+      const char *selected = navSelectedEntry();
       size_t selectedLen = strlen(selected);
       if ((selectedLen > 0 && selected[selectedLen - 1] == '/') ||
           (strcmp(selected, "..") == 0)) {
@@ -1483,7 +1759,9 @@ void __not_in_flash_func(cmdAcsiImage)(const char *arg) {
       buildSelectedPath(pathBuffer, navState->folderPath, selected);
       settings_put_string(aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_IMAGE,
                           pathBuffer);
-      settings_save(aconfig_getContext(), true);
+      if (!saveSettings()) {
+        break;
+      }
       DPRINTF("ACSI image: %s. SAVED!\n", pathBuffer);
       menu();
       term_setCommandLevel(TERM_COMMAND_LEVEL_SINGLE_KEY);
@@ -1523,7 +1801,9 @@ void cmdAcsiId(const char *arg) {
   snprintf(idBuffer, sizeof(idBuffer), "%u", acsiId);
   settings_put_string(aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_ID,
                       idBuffer);
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   menu();
   display_refresh();
 }
@@ -1576,7 +1856,9 @@ void cmdAcsiDrive(const char *arg) {
   char letterBuffer[2] = {letter, '\0'};
   settings_put_string(aconfig_getContext(), ACONFIG_PARAM_DRIVES_ACSI_DRIVE,
                       letterBuffer);
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   menu();
   display_refresh();
 }
@@ -1590,7 +1872,9 @@ void cmdFloppyEnabled(const char *arg) {
       aconfig_getContext(), ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED);
   settings_put_bool(aconfig_getContext(), ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED,
                     !isTrue(floppyDrive->value));
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   haltCountdown = true;
   menu();
   display_refresh();
@@ -1612,15 +1896,16 @@ void __not_in_flash_func(cmdFloppiesFolder)(const char *arg) {
         strncpy(navState->folderPath, floppyDriveFolder->value,
                 sizeof(navState->folderPath));
         term_setCommandLevel(TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY);
-        status = navigate_directory(true, true, '\0', floppiesFilter, NULL);
+        status = navigate_directory(true, true, NULL, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, NULL);
         break;
       }
       case TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY: {
         // If we are here is because we have already entered the command
         DPRINTF("Floppy folder key: %d\n", arg[0]);
-        char key = arg[0];
         // Check if the key is a valid navigation key
-        status = navigate_directory(false, true, key, floppiesFilter, NULL);
+        status = navigate_directory(false, true, arg, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, NULL);
         break;
       }
       default:
@@ -1632,7 +1917,7 @@ void __not_in_flash_func(cmdFloppiesFolder)(const char *arg) {
         // Print the navState->selected entry
         DPRINTF("Entries: %d\n", navState->count);
         DPRINTF("Selected entry: %d = %s\n", navState->selected,
-                navState->entries[navState->selected]);
+                navSelectedEntry());
         // Redraw the navState->page
         showTitle();
         DPRINTF("Folder: %s\n", navState->folderPath);
@@ -1647,8 +1932,10 @@ void __not_in_flash_func(cmdFloppiesFolder)(const char *arg) {
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_FLOPPY_FOLDER,
                             navState->folderPath);
-        settings_save(aconfig_getContext(), true);
-        DPRINTF("Folder: %s. SAVED!\n", navState->entries[navState->selected]);
+        if (!saveSettings()) {
+          break;
+        }
+        DPRINTF("Folder: %s. SAVED!\n", navSelectedEntry());
         menu();
         term_setCommandLevel(TERM_COMMAND_LEVEL_SINGLE_KEY);
         break;
@@ -1674,17 +1961,16 @@ static void selectFloppyDrive(const char *arg, bool driveA) {
         strncpy(navState->folderPath, floppyDriveFolder->value,
                 sizeof(navState->folderPath));
         term_setCommandLevel(TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY);
-        status = navigate_directory(true, false, '\0', floppiesFilter,
-                                    navState->folderPath);
+        status = navigate_directory(true, false, NULL, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, navState->folderPath);
         break;
       }
       case TERM_COMMAND_LEVEL_COMMAND_SINGLE_KEY_REENTRY: {
         // If we are here is because we have already entered the command
         DPRINTF("Floppy Drive %c key: %d\n", arg[0], driveA ? 'A' : 'B');
-        char key = arg[0];
         // Check if the key is a valid navigation key
-        status = navigate_directory(false, false, key, floppiesFilter,
-                                    navState->folderPath);
+        status = navigate_directory(false, false, arg, floppiesFilter,
+                                    NAV_FILTER_FLOPPIES, navState->folderPath);
         break;
       }
       default:
@@ -1696,7 +1982,7 @@ static void selectFloppyDrive(const char *arg, bool driveA) {
         // Print the navState->selected entry
         DPRINTF("Entries: %d\n", navState->count);
         DPRINTF("Selected entry: %d = %s\n", navState->selected,
-                navState->entries[navState->selected]);
+                navSelectedEntry());
         // Redraw the navState->page
         showTitle();
         DPRINTF("Folder: %s\n", navState->folderPath);
@@ -1712,12 +1998,14 @@ static void selectFloppyDrive(const char *arg, bool driveA) {
         // Save the navState->selected entry
         char bufTmp[MAX_FILENAME_LENGTH + 1];
         snprintf(bufTmp, sizeof(bufTmp), "%s/%s", navState->folderPath,
-                 navState->entries[navState->selected]);
+                 navSelectedEntry());
         settings_put_string(aconfig_getContext(),
                             driveA ? ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A
                                    : ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_B,
                             bufTmp);
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          break;
+        }
         DPRINTF("Drive %c file: %s. SAVED!\n", driveA ? 'A' : 'B', bufTmp);
         menu();
         term_setCommandLevel(TERM_COMMAND_LEVEL_SINGLE_KEY);
@@ -1774,7 +2062,9 @@ void cmdFloppyDriveASet(const char *arg) {
       if (shiftKey) {
         settings_put_string(aconfig_getContext(),
                             floppyDriveASetKeys[slotIndex], "");
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          return;
+        }
         floppyDriveASetRenderMenu();
         return;
       }
@@ -1783,8 +2073,9 @@ void cmdFloppyDriveASet(const char *arg) {
       return;
     }
     case FLOPPY_DRIVE_A_SET_ASSIGN: {
-      enum navStatus status = navigate_directory(
-          false, false, key, floppiesFilter, navState->folderPath);
+      enum navStatus status =
+          navigate_directory(false, false, arg, floppiesFilter,
+                             NAV_FILTER_FLOPPIES, navState->folderPath);
 
       switch (status) {
         case NAV_DIR_FIRST_TIME_OK:
@@ -1794,12 +2085,15 @@ void cmdFloppyDriveASet(const char *arg) {
         case NAV_DIR_SELECTED: {
           char pathBuffer[MAX_FILENAME_LENGTH + 1];
           snprintf(pathBuffer, sizeof(pathBuffer), "%s/%s",
-                   navState->folderPath, navState->entries[navState->selected]);
+                   navState->folderPath, navSelectedEntry());
           settings_put_string(aconfig_getContext(),
                               floppyDriveASetKeys[floppyDriveASetTargetSlot],
                               pathBuffer);
-          settings_save(aconfig_getContext(), true);
           floppyDriveASetState = FLOPPY_DRIVE_A_SET_SELECT;
+          // SPACE on the error goes back to the menu
+          if (!saveSettings()) {
+            return;
+          }
           floppyDriveASetRenderMenu();
           return;
         }
@@ -1836,7 +2130,9 @@ static void ejectFloppyDrive(bool driveA) {
         aconfig_getContext(), driveA ? ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A
                                      : ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_B);
     settings_put_string(aconfig_getContext(), floppyDriveEject->key, "");
-    settings_save(aconfig_getContext(), true);
+    if (!saveSettings()) {
+      return;
+    }
     haltCountdown = true;
     menu();
     display_refresh();
@@ -1863,7 +2159,9 @@ void cmdBootEnabled(const char *arg) {
     settings_put_bool(aconfig_getContext(),
                       ACONFIG_PARAM_DRIVES_FLOPPY_BOOT_ENABLED,
                       !isTrue(bootEnabled->value));
-    settings_save(aconfig_getContext(), true);
+    if (!saveSettings()) {
+      return;
+    }
     haltCountdown = true;
     menu();
     display_refresh();
@@ -1881,7 +2179,9 @@ void cmdXbiosEnabled(const char *arg) {
     settings_put_bool(aconfig_getContext(),
                       ACONFIG_PARAM_DRIVES_FLOPPY_XBIOS_ENABLED,
                       !isTrue(xbiosEnabled->value));
-    settings_save(aconfig_getContext(), true);
+    if (!saveSettings()) {
+      return;
+    }
     haltCountdown = true;
     menu();
     display_refresh();
@@ -1897,7 +2197,9 @@ void cmdRTCEnabled(const char *arg) {
       aconfig_getContext(), ACONFIG_PARAM_DRIVES_RTC_ENABLED);
   settings_put_bool(aconfig_getContext(), ACONFIG_PARAM_DRIVES_RTC_ENABLED,
                     !isTrue(rtcEnabled->value));
-  settings_save(aconfig_getContext(), true);
+  if (!saveSettings()) {
+    return;
+  }
   haltCountdown = true;
   menu();
   display_refresh();
@@ -1912,7 +2214,9 @@ void cmdY2KPatch(const char *arg) {
         aconfig_getContext(), ACONFIG_PARAM_DRIVES_RTC_Y2K_PATCH);
     settings_put_bool(aconfig_getContext(), ACONFIG_PARAM_DRIVES_RTC_Y2K_PATCH,
                       !isTrue(y2kPatch->value));
-    settings_save(aconfig_getContext(), true);
+    if (!saveSettings()) {
+      return;
+    }
     haltCountdown = true;
     menu();
     display_refresh();
@@ -1954,7 +2258,9 @@ void cmdUTCOffset(const char *arg) {
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_RTC_UTC_OFFSET,
                             term_getInputBuffer());
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          return;
+        }
         menu();
       }
     }
@@ -1990,7 +2296,9 @@ void cmdHost(const char *arg) {
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_RTC_NTP_HOST,
                             term_getInputBuffer());
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          return;
+        }
         menu();
       }
     }
@@ -2031,7 +2339,9 @@ void cmdPort(const char *arg) {
         settings_put_string(aconfig_getContext(),
                             ACONFIG_PARAM_DRIVES_RTC_NTP_PORT,
                             term_getInputBuffer());
-        settings_save(aconfig_getContext(), true);
+        if (!saveSettings()) {
+          return;
+        }
         menu();
       }
     }
@@ -2069,6 +2379,7 @@ static void preinit() {
 static void deinit() {
   // Free the memory allocated for navState
   if (navState != NULL) {
+    dirindex_close(&navState->index);
     free(navState);
     navState = NULL;
   }
@@ -2221,6 +2532,8 @@ void __not_in_flash_func(emul_start)() {
   // Short press: reset the device and restart the app
   // Long press: reset the device and erase the flash.
   select_configure();
+  // Medium press (3s) in runtime: dump the command trace to the SD card.
+  select_setMediumPressCallback(handleSelectMediumPress);
   select_coreWaitPush(handleSelectShortPress,
                       reset_deviceAndEraseFlash);  // Wait for the SELECT
                                                    // button to be pushed
@@ -2386,7 +2699,14 @@ void __not_in_flash_func(emul_start)() {
       case APP_EMULATION_RUNTIME: {
         // The app is running in emulation mode
 
-        if (pendingDriveACycle) {
+        if (usbRuntimeActive) {
+          serviceUsbRuntime();
+        }
+
+        // The card is not ours while a writable USB host has it
+        bool sdCardLent = usb_mass_runtimeHostOwnsCard();
+
+        if (pendingDriveACycle && !sdCardLent) {
           pendingDriveACycle = false;
           uint8_t newSlot = 0;
           FRESULT cycleResult = floppy_cycleDriveA(&newSlot);
@@ -2397,12 +2717,26 @@ void __not_in_flash_func(emul_start)() {
           }
         }
 
+        if (pendingTraceDump && !sdCardLent) {
+          pendingTraceDump = false;
+          if (cmdtrace_dumpToFile(CMDTRACE_DUMP_PATH, NULL) == FR_OK) {
+            if (usbRuntimeActive) {
+              usb_mass_runtimeDumpStats(USB_MASS_STATS_PATH);
+            }
+            blink_startCountSequence(1);
+          }
+        }
+
         // Call all the "drives" loops
         chandler_loop();
+        // Diagnostics only: writes the captured ROM3 samples to the SD card
+        commemul_captureTick();
         // Deferred write-behind flushers. Cheap poll: both return
         // immediately unless something was written ≥ their interval ago.
         acsi_tick();
         floppy_tick();
+        // Writes the boot snapshot once the Atari is idle
+        bootcache_tick();
         if (!gemLaunched) {
           DPRINTF("Jumping to desktop...\n");
           SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_START);
@@ -2418,7 +2752,12 @@ void __not_in_flash_func(emul_start)() {
         deinit();
 
         // // Disable the USB if nothing is mounted
-        if (!usbMassStorageMounted) {
+        bool usbRuntime = isUsbRuntimeEnabled();
+        if (usbRuntime && !usbInitialized) {
+          // The cable can also be plugged in later
+          usbInitialized = usb_mass_init();
+        }
+        if (!(usbRuntime && usbInitialized) && !usbMassStorageMounted) {
           // Disconnect the USB mass storage
           DPRINTF("Disconnecting the USB mass storage...\n");
           tud_disconnect();
@@ -2428,6 +2767,13 @@ void __not_in_flash_func(emul_start)() {
         // DPRINTF("Forcing disconnect the USB mass storage...\n");
         // tud_disconnect();
 
+        // Before the ACSI scan, which reads the partition tables or takes
+        // them from the scan cache. Off with the USB runtime: core 1 runs
+        // TinyUSB from flash and the host could change the images behind
+        // our back.
+        bootcache_init(isBootCacheEnabled() && !usbRuntime);
+        acsi_scancache_init(isBootCacheEnabled() && !usbRuntime);
+
         DPRINTF("Running ACSI pre-init...\n");
         if (isAcsiEnabledConfigured()) {
           showTitle();
@@ -2445,6 +2791,10 @@ void __not_in_flash_func(emul_start)() {
         // Initialize Command Handler init
         DPRINTF("Initializing the command handler...\n");
         chandler_init();  // Initialize the command handler
+        if (isRom3CaptureEnabled()) {
+          DPRINTF("Starting the ROM3 capture...\n");
+          commemul_captureStart(COMMEMUL_CAPTURE_PATH);
+        }
 
         // Initializing the GEMDRIVE
         DPRINTF("Initializing the GEMDRIVE...\n");
@@ -2464,6 +2814,17 @@ void __not_in_flash_func(emul_start)() {
         chandler_addCB(floppy_loop);    // Add the floppy drives loop
         chandler_addCB(rtc_loop);       // Add the RTC loop
 
+        if (usbRuntime && usbInitialized) {
+          DPRINTF("Keeping the USB mass storage during the emulation...\n");
+          usbRuntimeActive = usb_mass_runtimeStart(isUsbRuntimeRwEnabled());
+          if (usbRuntimeActive) {
+            // Core 1 runs the USB device task from now on
+            select_setIdleCallback(usb_mass_runtimeTask);
+          } else {
+            tud_disconnect();
+          }
+        }
+
         // Check remote commands
         appStatus = APP_EMULATION_RUNTIME;
 
@@ -122,13 +122,15 @@ static const char *const floppyDriveASlotKeys[FLOPPY_DRIVE_A_SLOT_MAX + 1] = {
 };
 
 static uint8_t currentDriveASlot = FLOPPY_DRIVE_A_SLOT_MIN;
-static bool floppyMediaChangeClearPending[2] = {false, false};
-static uint16_t floppyMediaChangeClearSector[2] = {0, 0};
+// Media generation published to the Atari, one per drive
+static uint32_t floppyMediaGeneration[2] = {0u, 0u};
 
 // Write-behind flush state per drive. FLOPPYEMUL_WRITE_SECTORS marks the
 // drive dirty; floppy_tick() issues a deferred f_sync once no writes have
 // arrived for FLOPPY_FLUSH_INTERVAL_MS.
 static volatile bool floppyDirty[2] = {false, false};
+// Images closed by floppy_release, reopened by floppy_resume
+static char floppyReleasedPath[2][FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH];
 static volatile uint32_t floppyDirtyAtMs[2] = {0, 0};
 
 // Bounded retry counter for floppy_tick's deferred f_sync. A wedged SD card
@@ -138,6 +140,20 @@ static volatile uint32_t floppyDirtyAtMs[2] = {0, 0};
 #define FLOPPY_FLUSH_FAIL_MAX 5u
 static uint8_t floppyFlushFailCount[2] = {0u, 0u};
 
+// Image of the next Drive A slot, opened by floppy_tick() while the drive is
+// idle. floppy_cycleDriveA() swaps it in without touching the card.
+typedef struct {
+  uint8_t slot;  // 0 when nothing is open
+  bool isRW;
+  FIL fobj;
+  BPBData bpb;
+  char fullPath[FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH];
+} FloppyStandby;
+
+static FloppyStandby floppyStandbyA = {0};
+static bool floppyStandbyPending = false;
+static volatile uint32_t floppyLastCommandMs = 0;
+
 static inline void __not_in_flash_func(floppyMarkWriteDirty)(uint8_t drive) {
   if (drive > 1) return;
   if (!floppyDirty[drive]) {
@@ -167,60 +183,17 @@ static inline BPBData *floppyGetBPBData(FloppyDrive drive) {
   return (drive == FLOPPY_DRIVE_A) ? &BPBDataA : &BPBDataB;
 }
 
-static inline uint32_t floppyGetMediaChangedVarIndex(FloppyDrive drive) {
-  return (drive == FLOPPY_DRIVE_A) ? FLOPPYEMUL_SVAR_MEDIA_CHANGED_A
-                                   : FLOPPYEMUL_SVAR_MEDIA_CHANGED_B;
-}
-
-static inline void floppySetMediaChange(FloppyDrive drive, uint32_t status) {
-  SET_SHARED_PRIVATE_VAR(floppyGetMediaChangedVarIndex(drive), status,
-                         memorySharedAddress,
+// A new image is in the drive. The Atari reports the change on the next
+// Mediach and stops once TOS has fetched the BPB with Getbpb.
+static inline void floppyNewMedia(FloppyDrive drive) {
+  uint32_t generation = ++floppyMediaGeneration[drive];
+  SET_SHARED_PRIVATE_VAR((drive == FLOPPY_DRIVE_A)
+                             ? FLOPPYEMUL_SVAR_MEDIA_GEN_A
+                             : FLOPPYEMUL_SVAR_MEDIA_GEN_B,
+                         generation, memorySharedAddress,
                          FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
 }
 
-static inline uint16_t floppyGetRootDirStartSector(const BPBData *bpb) {
-  if (bpb == NULL || bpb->datrec < bpb->rdlen) {
-    return 0;
-  }
-  return (uint16_t)(bpb->datrec - bpb->rdlen);
-}
-
-static inline void floppyResetMediaChangeClearOnRootRead(FloppyDrive drive) {
-  floppyMediaChangeClearPending[drive] = false;
-  floppyMediaChangeClearSector[drive] = 0;
-}
-
-static inline void floppyArmMediaChangeClearOnRootRead(FloppyDrive drive) {
-  uint16_t rootSector =
-      floppyGetRootDirStartSector(floppyGetBPBData(drive));
-  if (rootSector == 0u) {
-    // Malformed BPB (datrec < rdlen, or NULL). If we armed with sector 0,
-    // the very common "read boot sector" that happens early in TOS's
-    // media-change detection would clear MED_CHANGED prematurely, before
-    // TOS has refreshed its cached directory state. Leave the flag set
-    // and let the Atari-side state machine deal with it.
-    floppyMediaChangeClearPending[drive] = false;
-    floppyMediaChangeClearSector[drive] = 0u;
-    return;
-  }
-  floppyMediaChangeClearSector[drive] = rootSector;
-  floppyMediaChangeClearPending[drive] = true;
-}
-
-static inline void floppyMaybeClearMediaChangeAfterRead(FloppyDrive drive,
-                                                        uint16_t lSector) {
-  if (!floppyMediaChangeClearPending[drive]) {
-    return;
-  }
-
-  if (lSector != floppyMediaChangeClearSector[drive]) {
-    return;
-  }
-
-  floppySetMediaChange(drive, FLOPPY_MEDIA_NOCHANGE);
-  floppyResetMediaChangeClearOnRootRead(drive);
-}
-
 static inline bool floppyTransferSizeIsValid(uint16_t sSize) {
   if (sSize == 0) {
     DPRINTF("ERROR: Floppy transfer size must be greater than zero\n");
@@ -671,7 +644,6 @@ static FRESULT __not_in_flash_func(floppyMountDrivePath)(FloppyDrive drive, cons
   char *fullPath = floppyGetFullPath(drive);
   BPBData *bpb = floppyGetBPBData(drive);
   FloppyDiskState *state = floppyGetStatePtr(drive);
-  floppyResetMediaChangeClearOnRootRead(drive);
 
   snprintf(fullPath, FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH, "%s", fname);
   DPRINTF("Mounting drive %c path: %s\n",
@@ -820,6 +792,98 @@ FRESULT __not_in_flash_func(vDriveOpen)(uint8_t drive) {
   return FR_OK;  // Return success if the BPB was created successfully
 }
 
+static void floppyStandbyClose(void) {
+  if (floppyStandbyA.slot == 0) return;
+  (void)floppyImgClose(&floppyStandbyA.fobj);
+  memset(&floppyStandbyA.fobj, 0, sizeof(floppyStandbyA.fobj));
+  floppyStandbyA.fullPath[0] = '\0';
+  floppyStandbyA.slot = 0;
+}
+
+// Open the image of the slot after the current one, with its BPB
+static void floppyStandbyPreload(void) {
+  floppyStandbyPending = false;
+  if (!floppy_canCycleDriveA()) return;
+  uint8_t nextSlot = floppyFindNextConfiguredDriveASlot(currentDriveASlot);
+  if (nextSlot == 0 || nextSlot == currentDriveASlot) return;
+  if (floppyStandbyA.slot == nextSlot) return;
+  floppyStandbyClose();
+
+  char *path = floppyStandbyA.fullPath;
+  if (!floppyGetDriveAPathForSlot(nextSlot, path,
+                                  sizeof(floppyStandbyA.fullPath))) {
+    path[0] = '\0';
+    return;
+  }
+  bool isRW = isFloppyRW(path);
+  if (floppyImgOpen(path, isRW, &floppyStandbyA.fobj) != FR_OK) {
+    path[0] = '\0';
+    return;
+  }
+  if (createBPB(&floppyStandbyA.fobj, &floppyStandbyA.bpb) != FR_OK) {
+    (void)floppyImgClose(&floppyStandbyA.fobj);
+    memset(&floppyStandbyA.fobj, 0, sizeof(floppyStandbyA.fobj));
+    path[0] = '\0';
+    return;
+  }
+  floppyStandbyA.isRW = isRW;
+  floppyStandbyA.slot = nextSlot;
+  DPRINTF("Drive A slot %u preloaded: %s\n", nextSlot, path);
+}
+
+static void floppySwapBytes(void *a, void *b, size_t size) {
+  uint8_t *pa = (uint8_t *)a;
+  uint8_t *pb = (uint8_t *)b;
+  for (size_t i = 0; i < size; ++i) {
+    uint8_t tmp = pa[i];
+    pa[i] = pb[i];
+    pb[i] = tmp;
+  }
+}
+
+// Swap the preloaded image into Drive A, in place. The image going out is
+// kept as the next standby when the slots only hold two disks, or closed
+// otherwise.
+static FRESULT floppyStandbySwap(uint8_t nextSlot) {
+  uint8_t previousSlot = currentDriveASlot;
+  FloppyDiskState previousState = floppyDiskStatus.stateA;
+  bool wasMounted = floppyStateIsMounted(previousState);
+  if (previousState == FLOPPY_DISK_MOUNTED_RW) {
+    // Pending writes of the outgoing image go to the card now
+    FRESULT fr = f_sync(&fobjA);
+    if (fr != FR_OK) {
+      DPRINTF("ERROR: Could not flush drive A (%d)\n", fr);
+      return fr;
+    }
+  }
+
+  floppySwapBytes(&fobjA, &floppyStandbyA.fobj, sizeof(fobjA));
+  floppySwapBytes(&BPBDataA, &floppyStandbyA.bpb, sizeof(BPBDataA));
+  floppySwapBytes(fullPathA, floppyStandbyA.fullPath, sizeof(fullPathA));
+  floppyDiskStatus.stateA = floppyStandbyA.isRW ? FLOPPY_DISK_MOUNTED_RW
+                                                : FLOPPY_DISK_MOUNTED_RO;
+  memcpy((void *)(memorySharedAddress + FLOPPYEMUL_BPB_DATA_A), &BPBDataA,
+         sizeof(BPBDataA));
+  SET_SHARED_PRIVATE_VAR_BIT(FLOPPYEMUL_SVAR_EMULATION_MODE, 0,
+                             memorySharedAddress,
+                             FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
+  currentDriveASlot = nextSlot;
+  floppyDirty[0] = false;
+  floppyFlushFailCount[0] = 0u;
+
+  floppyStandbyA.isRW = (previousState == FLOPPY_DISK_MOUNTED_RW);
+  if (wasMounted &&
+      floppyFindNextConfiguredDriveASlot(nextSlot) == previousSlot) {
+    floppyStandbyA.slot = previousSlot;
+  } else {
+    floppyStandbyA.slot = wasMounted ? previousSlot : 0;
+    floppyStandbyClose();
+    floppyStandbyPending = true;
+  }
+  DPRINTF("Drive A swapped to preloaded slot %u: %s\n", nextSlot, fullPathA);
+  return FR_OK;
+}
+
 bool floppy_canCycleDriveA(void) {
   SettingsConfigEntry *floppyEnabledParam = settings_find_entry(
       aconfig_getContext(), ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED);
@@ -845,6 +909,20 @@ FRESULT floppy_cycleDriveA(uint8_t *newSlotIndex) {
     return FR_INVALID_NAME;
   }
 
+  if (floppyStandbyA.slot == nextSlot &&
+      strcmp(floppyStandbyA.fullPath, nextPath) == 0) {
+    FRESULT swapResult = floppyStandbySwap(nextSlot);
+    if (swapResult != FR_OK) return swapResult;
+    floppyNewMedia(FLOPPY_DRIVE_A);
+    if (newSlotIndex != NULL) {
+      *newSlotIndex = currentDriveASlot;
+    }
+    return FR_OK;
+  }
+  // Stale standby (settings changed). Close it: the same image cannot be
+  // opened twice for writing.
+  floppyStandbyClose();
+
   char previousPath[FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH] = {0};
   snprintf(previousPath, sizeof(previousPath), "%s", fullPathA);
   uint8_t previousSlot = currentDriveASlot;
@@ -867,14 +945,57 @@ FRESULT floppy_cycleDriveA(uint8_t *newSlotIndex) {
   }
 
   currentDriveASlot = nextSlot;
-  floppySetMediaChange(FLOPPY_DRIVE_A, FLOPPY_MEDIA_CHANGED);
-  floppyArmMediaChangeClearOnRootRead(FLOPPY_DRIVE_A);
+  // The outgoing image was flushed when it was closed
+  floppyDirty[0] = false;
+  floppyFlushFailCount[0] = 0u;
+  floppyStandbyPending = true;
+  floppyNewMedia(FLOPPY_DRIVE_A);
   if (newSlotIndex != NULL) {
     *newSlotIndex = currentDriveASlot;
   }
   return FR_OK;
 }
 
+void floppy_release(void) {
+  floppyStandbyClose();
+  floppyStandbyPending = false;
+  for (uint8_t drive = 0; drive < 2; ++drive) {
+    FloppyDrive floppyDrive = (FloppyDrive)drive;
+    FloppyDiskState *state = floppyGetStatePtr(floppyDrive);
+    floppyReleasedPath[drive][0] = '\0';
+    floppyDirty[drive] = false;
+    if (!floppyStateIsMounted(*state)) continue;
+
+    // Keep the emulation mode bit: the Atari must not fall back to the
+    // physical drive while the card is away.
+    snprintf(floppyReleasedPath[drive], FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH,
+             "%s", floppyGetFullPath(floppyDrive));
+    FIL *fobj = floppyGetFileObject(floppyDrive);
+    (void)floppyImgClose(fobj);
+    memset(fobj, 0, sizeof(*fobj));
+    *state = FLOPPY_DISK_UNMOUNTED;
+  }
+}
+
+void floppy_resume(void) {
+  for (uint8_t drive = 0; drive < 2; ++drive) {
+    FloppyDrive floppyDrive = (FloppyDrive)drive;
+    if (floppyReleasedPath[drive][0] == '\0') continue;
+
+    FRESULT fr =
+        floppyMountDrivePath(floppyDrive, floppyReleasedPath[drive]);
+    floppyReleasedPath[drive][0] = '\0';
+    if (fr != FR_OK) {
+      DPRINTF("Floppy %c: cannot reopen the image (%d)\n",
+              (drive == 0) ? 'A' : 'B', (int)fr);
+      continue;
+    }
+    // The host may have changed the image
+    floppyNewMedia(floppyDrive);
+  }
+  floppyStandbyPending = true;
+}
+
 void __not_in_flash_func(floppy_init)() {
   FRESULT fr; /* FatFs function common result code */
 
@@ -956,11 +1077,19 @@ void __not_in_flash_func(floppy_init)() {
   SET_SHARED_PRIVATE_VAR(FLOPPYEMUL_SVAR_ENABLED,
                          floppyEnabled ? 0xFFFFFFFF : 0, memorySharedAddress,
                          FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
-  floppySetMediaChange(FLOPPY_DRIVE_A, FLOPPY_MEDIA_NOCHANGE);
-  floppySetMediaChange(FLOPPY_DRIVE_B, FLOPPY_MEDIA_NOCHANGE);
-  floppyResetMediaChangeClearOnRootRead(FLOPPY_DRIVE_A);
-  floppyResetMediaChangeClearOnRootRead(FLOPPY_DRIVE_B);
+  // Same generation on both sides: no change to report at boot
+  floppyMediaGeneration[FLOPPY_DRIVE_A] = 0u;
+  floppyMediaGeneration[FLOPPY_DRIVE_B] = 0u;
+  SET_SHARED_PRIVATE_VAR(FLOPPYEMUL_SVAR_MEDIA_GEN_A, 0u, memorySharedAddress,
+                         FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
+  SET_SHARED_PRIVATE_VAR(FLOPPYEMUL_SVAR_MEDIA_GEN_B, 0u, memorySharedAddress,
+                         FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
+  SET_SHARED_PRIVATE_VAR(FLOPPYEMUL_SVAR_MEDIA_SEEN_A, 0u, memorySharedAddress,
+                         FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
+  SET_SHARED_PRIVATE_VAR(FLOPPYEMUL_SVAR_MEDIA_SEEN_B, 0u, memorySharedAddress,
+                         FLOPPYEMUL_SHARED_VARIABLES_OFFSET);
   currentDriveASlot = FLOPPY_DRIVE_A_SLOT_MIN;
+  floppyStandbyPending = true;
 
   fr = vDriveOpen(FLOPPY_DRIVE_A);  // Open floppy drive A
   if (fr != FR_OK) {
@@ -1037,6 +1166,7 @@ void __not_in_flash_func(floppy_loop)(TransmissionProtocol *lastProtocol,
 
   // Only check the FLOPPYEMUL commands
   if (((lastProtocol->command_id >> 8) & 0xFF) != APP_FLOPPYEMUL) return;
+  floppyLastCommandMs = to_ms_since_boot(get_absolute_time());
 
   // Handle the command
   switch (lastProtocol->command_id) {
@@ -1234,8 +1364,6 @@ void __not_in_flash_func(floppy_loop)(TransmissionProtocol *lastProtocol,
       DPRINTF("Read sector %i of size %i bytes to memory address %08X\n",
               lSector, sSize, memorySharedAddress + FLOPPYEMUL_IMAGE);
       CHANGE_ENDIANESS_BLOCK16(memorySharedAddress + FLOPPYEMUL_IMAGE, sSize);
-      floppyMaybeClearMediaChangeAfterRead(
-          (diskNum == 0) ? FLOPPY_DRIVE_A : FLOPPY_DRIVE_B, lSector);
       break;
     }
     case FLOPPYEMUL_WRITE_SECTORS: {
@@ -1400,4 +1528,11 @@ void __not_in_flash_func(floppy_tick)(void) {
     floppyDirty[drive] = false;
     floppyFlushFailCount[drive] = 0u;
   }
+
+  // Open the next Drive A image once the drive is quiet and flushed
+  if (floppyStandbyPending &&
+      floppyStateIsMounted(floppyDiskStatus.stateA) && !floppyDirty[0] &&
+      (now - floppyLastCommandMs) >= FLOPPY_PRELOAD_IDLE_MS) {
+    floppyStandbyPreload();
+  }
 }
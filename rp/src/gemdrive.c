@@ -9,8 +9,12 @@
 #include "gemdrive.h"
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 
+_Static_assert(FF_FS_LOCK >= GEMDRIVE_FS_LOCK_BUDGET,
+               "FF_FS_LOCK can't hold the open files and folders");
+
 // The GEMDOS calls
 const char *GEMDOS_CALLS[93] = {
     "Pterm0",    // 0x00
@@ -166,18 +170,23 @@ const uint8_t BLACKLISTED_GEMDOS_CALLS[52] = {
 
 static FATFS filesys;
 
-// Let's substitute the flags
-static char hdFolder[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-static char drive = 'C';
-static uint32_t driveNum = 0;
+// Drive letters of GEMDRIVE, each with its folder and Dsetpath. The first
+// one is always mounted.
+static GemdriveVolume volumes[GEMDRIVE_MAX_DRIVES];
+static uint8_t volumeCount = 0;
 
-// Save Dsetpath variables
-static char dpathStr[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
+// Drive of the paths without drive letter
+static GemdriveVolume *activeVolume = &volumes[0];
 
 // Save Fsetdta variables
-// Single linked list of DTAs (no hash table, no static pool)
+// Single linked list of DTAs, newest first
 static DTANode *dtaHead = NULL;
 
+// Pools of the runtime objects, taken from the heap once at init
+static SlabPool filePool = {0};
+static SlabPool dtaPool = {0};
+static SlabPool dirPool = {0};
+
 // Structures to store the file descriptors
 static FileDescriptors *fdescriptors =
     NULL;  // Initialize the head of the list to NULL
@@ -197,6 +206,46 @@ static bool isTrue(const char *value) {
   return false;
 }
 
+// The drive with the given number (0 is A), or NULL if it is not one of the
+// GEMDRIVE drives
+static GemdriveVolume *__not_in_flash_func(findVolume)(uint32_t number) {
+  for (uint8_t i = 0; i < volumeCount; i++) {
+    if (volumes[i].number == number) return &volumes[i];
+  }
+  return NULL;
+}
+
+// The drive of a GEMDOS path: the one of its drive letter, or the active
+// drive if it has none
+static GemdriveVolume *__not_in_flash_func(findPathVolume)(const char *path) {
+  if ((path[0] != '\0') && (path[1] == ':')) {
+    GemdriveVolume *volume =
+        findVolume((uint32_t)(toupper((unsigned char)path[0]) - 'A'));
+    if (volume != NULL) return volume;
+  }
+  return activeVolume;
+}
+
+// The drive whose root folder holds a local path, or NULL. The deepest root
+// wins when the folders of two drives are nested.
+static GemdriveVolume *findLocalVolume(const char *localPath) {
+  GemdriveVolume *found = NULL;
+  size_t foundLen = 0;
+  for (uint8_t i = 0; i < volumeCount; i++) {
+    const char *folder = volumes[i].folder;
+    size_t len = strlen(folder);
+    if ((found != NULL) && (len < foundLen)) continue;
+    if (strncmp(localPath, folder, len) != 0) continue;
+    if ((len > 0) && (folder[len - 1] != '/') && (localPath[len] != '/') &&
+        (localPath[len] != '\0')) {
+      continue;
+    }
+    found = &volumes[i];
+    foundLen = len;
+  }
+  return found;
+}
+
 // Erase the values in the DTA transfer area
 static void __not_in_flash_func(nullifyDTA)(uint32_t mem) {
   // defensive overflow guard
@@ -215,8 +264,8 @@ static void __not_in_flash_func(nullifyDTA)(uint32_t mem) {
 }
 
 // Helpers: allocate/release from pool
-static DTANode *dta_node_alloc(void) {
-  DTANode *n = (DTANode *)malloc(sizeof(DTANode));
+static DTANode *__not_in_flash_func(dta_node_alloc)(void) {
+  DTANode *n = (DTANode *)slab_alloc(&dtaPool);
   if (!n) return NULL;
   memset(n, 0, sizeof *n);
   return n;
@@ -225,21 +274,32 @@ static DTANode *dta_node_alloc(void) {
 static void __not_in_flash_func(dta_node_free)(DTANode *n) {
   if (!n) return;
 
-  // DTANode owns 'dj' and 'pat'. Ensure DIR is closed and dj->pat is detached
-  // before freeing to avoid dangling pointers and FS state leaks.
+  // DTANode owns 'dj'. Ensure DIR is closed before freeing to avoid FS state
+  // leaks.
   if (n->dj) {
-    // Detach DIR's internal pattern pointer first
-    n->dj->pat = NULL;
     // Close directory if it was opened; ignore errors on cleanup
     (void)f_closedir(n->dj);
-    free(n->dj);
+    slab_free(&dirPool, n->dj);
     n->dj = NULL;
   }
-  if (n->pat) {
-    free(n->pat);
-    n->pat = NULL;
+  slab_free(&dtaPool, n);
+}
+
+// Unlink the least recently used DTA, at the tail of the list, and give its
+// node back to the pool
+static void __not_in_flash_func(releaseOldestDTA)(void) {
+  DTANode *p = dtaHead, *prev = NULL;
+  if (!p) return;
+  while (p->next) {
+    prev = p;
+    p = p->next;
   }
-  free(n);
+  if (prev)
+    prev->next = NULL;
+  else
+    dtaHead = NULL;
+  DPRINTF("DTA pool full. Reusing the DTA of %x\n", p->key);
+  dta_node_free(p);
 }
 
 // Hash no longer used; keep stub for potential diagnostics
@@ -252,26 +312,31 @@ static int __not_in_flash_func(insertDTA)(uint32_t key) {
     if (p->key == key) return -2;  // already exists
   }
   DTANode *n = dta_node_alloc();
+  if (!n) {
+    releaseOldestDTA();
+    n = dta_node_alloc();
+  }
   if (!n) return -1;
   n->key = key;
   n->attribs = 0xFFFFFFFF;
   memset(&n->data, 0, sizeof n->data);
   n->dj = NULL;
-  n->pat = NULL;
   n->next = dtaHead;
   dtaHead = n;
   return 0;
 }
 
-// Lookup function
+// Lookup function. The node found moves to the head, so a search still
+// walked by Fsnext is not the one reused when the pool is full.
 static DTANode *__not_in_flash_func(lookupDTA)(uint32_t key) {
-  for (DTANode *p = dtaHead; p; p = p->next) {
-    if (p->key == key) {
-      // Keep DIR's pattern pointer mirrored to node's owned 'pat'. Callers
-      // must not free 'pat'; it is released centrally by dta_node_free().
-      if (p->dj && p->dj->pat != p->pat) p->dj->pat = p->pat;
-      return p;
+  for (DTANode *p = dtaHead, *prev = NULL; p; prev = p, p = p->next) {
+    if (p->key != key) continue;
+    if (prev) {
+      prev->next = p->next;
+      p->next = dtaHead;
+      dtaHead = p;
     }
+    return p;
   }
   return NULL;
 }
@@ -315,7 +380,7 @@ static void __not_in_flash_func(cleanDTAHashTable)(void) {
 }
 
 static void __not_in_flash_func(searchPath2ST)(
-    const char *fspec_str,
+    const char *folder, const char *fspec_str,
     char *internal_path,  // caller must ensure this is at least
                           // 2*GEMDRIVE_MAX_FOLDER_LENGTH
     char *path_forwardslash, char *name_pattern) {
@@ -334,7 +399,7 @@ static void __not_in_flash_func(searchPath2ST)(
 
   // build the internal Path: caller-supplied buffer must be big enough!
   if (snprintf(internal_path, GEMDRIVE_FATFS_MAX_FOLDER_LENGTH, "%s/%s",
-               hdFolder,
+               folder,
                path_forwardslash) >= GEMDRIVE_FATFS_MAX_FOLDER_LENGTH) {
     // handle overflow
     DPRINTF("ERROR: Internal path buffer overflow\n");
@@ -346,13 +411,6 @@ static void __not_in_flash_func(searchPath2ST)(
     memmove(p, p + 1, strlen(p + 1) + 1);
   }
 
-  // strip trailing ".*"
-  size_t np_len = strlen(name_pattern);
-  if (np_len >= 2 && name_pattern[np_len - 1] == '*' &&
-      name_pattern[np_len - 2] == '.') {
-    name_pattern[np_len - 2] = '\0';
-  }
-
   // strip leading slash or backslash
   if (name_pattern[0] == '/' || name_pattern[0] == '\\') {
     memmove(name_pattern, name_pattern + 1, strlen(name_pattern + 1) + 1);
@@ -371,6 +429,290 @@ static void __not_in_flash_func(remove_trailing_spaces)(char *str) {
   str[len] = '\0';
 }
 
+// Replace the altname with the 8.3 name the Atari sees
+static void __not_in_flash_func(setAtariName)(FILINFO *fno) {
+  if (fno->altname[0] == 0) {
+    // Copy the fname to altname. It's already a 8.3 file format
+    memcpy(fno->altname, fno->fname, sizeof(fno->altname));
+  }
+  char shortenFname[14];
+  char upperFilename[14];
+  char filteredFilename[14];
+  sdcard_filterFname(fno->altname, filteredFilename);
+  sdcard_upperFname(filteredFilename, upperFilename);
+  sdcard_shortenFname(upperFilename, shortenFname);
+  memcpy(fno->altname, shortenFname, 13);
+}
+
+// Recent f_stat results. Desktops and make tools ask for the attributes and
+// dates of the same files over and over.
+static GemdriveStatEntry statCache[GEMDRIVE_STAT_CACHE_ENTRIES];
+static GemdriveStatEntry statScratch;  // Paths too long for the cache
+static uint32_t statCacheClock = 0;
+
+// FNV-1a of the path, not case sensitive as FAT
+static uint32_t __not_in_flash_func(statCacheHash)(const char *path) {
+  uint32_t h = 2166136261u;
+  while (*path != '\0') {
+    h ^= (uint8_t)tolower((unsigned char)*path++);
+    h *= 16777619u;
+  }
+  return h | 1u;
+}
+
+static const char *__not_in_flash_func(statCacheName)(const char *path) {
+  const char *slash = strrchr(path, '/');
+  return (slash != NULL) ? slash + 1 : path;
+}
+
+// The f_stat of a resolved path, from the cache if possible. Only the files
+// found are cached.
+static FRESULT __not_in_flash_func(statCacheGet)(
+    const char *path, const GemdriveStatEntry **entryOut) {
+  uint32_t hash = statCacheHash(path);
+  GemdriveStatEntry *entry = &statCache[0];
+  for (int i = 0; i < GEMDRIVE_STAT_CACHE_ENTRIES; i++) {
+    GemdriveStatEntry *cached = &statCache[i];
+    if ((cached->hash == hash) && (strcasecmp(cached->path, path) == 0)) {
+      cached->lastUse = ++statCacheClock;
+      *entryOut = cached;
+      return FR_OK;
+    }
+    if (cached->lastUse < entry->lastUse) entry = cached;
+  }
+
+  FILINFO fno;
+  FRESULT fr = f_stat(path, &fno);
+  if (fr != FR_OK) return fr;
+  if (strlen(path) >= sizeof(entry->path)) entry = &statScratch;
+  setAtariName(&fno);
+  entry->hash = (entry == &statScratch) ? 0 : hash;
+  strncpy(entry->path, path, sizeof(entry->path) - 1);
+  entry->path[sizeof(entry->path) - 1] = '\0';
+  memcpy(entry->name, fno.altname, sizeof(entry->name));
+  entry->fattrib = fno.fattrib;
+  entry->fdate = fno.fdate;
+  entry->ftime = fno.ftime;
+  entry->fsize = fno.fsize;
+  entry->attribReply = SWAP_LONGWORD(sdcard_attribsFAT2ST(fno.fattrib));
+  entry->dateReply = SWAP_LONGWORD(fno.fdate);
+  entry->timeReply = SWAP_LONGWORD(fno.ftime);
+  entry->lastUse = ++statCacheClock;
+  *entryOut = entry;
+  return FR_OK;
+}
+
+// Forget a file changed by GEMDRIVE. Entries go by name, so the same file
+// reached through another path ("/A/../B") goes as well.
+static void __not_in_flash_func(statCacheInvalidate)(const char *path) {
+  const char *name = statCacheName(path);
+  for (int i = 0; i < GEMDRIVE_STAT_CACHE_ENTRIES; i++) {
+    if ((statCache[i].hash != 0) &&
+        (strcasecmp(statCacheName(statCache[i].path), name) == 0)) {
+      memset(&statCache[i], 0, sizeof(GemdriveStatEntry));
+    }
+  }
+}
+
+static void __not_in_flash_func(statCacheFlush)(void) {
+  memset(statCache, 0, sizeof(statCache));
+}
+
+// Fsfirst and Fsnext on FAT16 and FAT32 walk the 8.3 entries of the folder
+// in the sectors themselves: f_readdir would decode the long name of every
+// entry, and the Atari only sees the 8.3 names of the few that match.
+#define RAW_DIR_ENTRY_SIZE 32
+#define RAW_DIR_MAX_OFFSET 0x200000  // 64K entries, as FatFS
+#define RAW_DIR_DELETED 0xE5
+#define RAW_DIR_ATTR_MASK 0x3F
+#define RAW_DIR_ATTR_VOL 0x08
+#define RAW_DIR_ATTR_LFN 0x0F
+#define RAW_DIR_LFN_LAST 0x40
+
+static inline uint16_t rawWord(const BYTE *ptr) {
+  return (uint16_t)(ptr[0] | (ptr[1] << 8));
+}
+
+static inline uint32_t rawDword(const BYTE *ptr) {
+  return (uint32_t)rawWord(ptr) | ((uint32_t)rawWord(ptr + 2) << 16);
+}
+
+// Load a sector in the window of the volume as FatFS does, writing back the
+// sector in the window first if FatFS changed it
+static FRESULT __not_in_flash_func(rawMoveWindow)(FATFS *fs, LBA_t sect) {
+  if (sect == fs->winsect) return FR_OK;
+  if (fs->wflag) {
+    if (disk_write(fs->pdrv, fs->win, fs->winsect, 1) != RES_OK) {
+      return FR_DISK_ERR;
+    }
+    fs->wflag = 0;
+    // Sectors of the first FAT go to the second one as well
+    if ((fs->winsect - fs->fatbase < fs->fsize) && (fs->n_fats == 2)) {
+      disk_write(fs->pdrv, fs->win, fs->winsect + fs->fsize, 1);
+    }
+  }
+  if (disk_read(fs->pdrv, fs->win, sect, 1) != RES_OK) {
+    fs->winsect = (LBA_t)0 - 1;
+    return FR_DISK_ERR;
+  }
+  fs->winsect = sect;
+  return FR_OK;
+}
+
+// Move the directory to its next entry, following the cluster chain as
+// dir_next of FatFS. dj->sect is 0 past the last entry.
+static FRESULT __not_in_flash_func(rawNextEntry)(DIR *dj) {
+  FATFS *fs = dj->obj.fs;
+  DWORD ofs = dj->dptr + RAW_DIR_ENTRY_SIZE;
+  if (ofs >= RAW_DIR_MAX_OFFSET) dj->sect = 0;
+  if (dj->sect == 0) return FR_OK;
+  if (ofs % FF_MAX_SS == 0) {
+    dj->sect++;
+    if (dj->clust == 0) {
+      // Fixed root folder of FAT16
+      if (ofs / RAW_DIR_ENTRY_SIZE >= fs->n_rootdir) {
+        dj->sect = 0;
+        return FR_OK;
+      }
+    } else if (((ofs / FF_MAX_SS) & (fs->csize - 1)) == 0) {
+      LBA_t fatSect;
+      DWORD next;
+      if (fs->fs_type == FS_FAT16) {
+        fatSect = fs->fatbase + dj->clust / (FF_MAX_SS / 2);
+      } else {
+        fatSect = fs->fatbase + dj->clust / (FF_MAX_SS / 4);
+      }
+      FRESULT fr = rawMoveWindow(fs, fatSect);
+      if (fr != FR_OK) return fr;
+      if (fs->fs_type == FS_FAT16) {
+        next = rawWord(fs->win + dj->clust * 2 % FF_MAX_SS);
+      } else {
+        next = rawDword(fs->win + dj->clust * 4 % FF_MAX_SS) & 0x0FFFFFFF;
+      }
+      if (next <= 1) return FR_INT_ERR;
+      if (next >= fs->n_fatent) {
+        // End of the chain
+        dj->sect = 0;
+        return FR_OK;
+      }
+      dj->clust = next;
+      dj->sect = fs->database + (LBA_t)fs->csize * (next - 2);
+    }
+  }
+  dj->dptr = ofs;
+  dj->dir = fs->win + ofs % FF_MAX_SS;
+  return FR_OK;
+}
+
+// Checksum of the 8.3 name kept in the entries of its long name
+static BYTE __not_in_flash_func(rawSfnSum)(const BYTE *entry) {
+  BYTE sum = 0;
+  for (int i = 0; i < 11; i++) {
+    sum = (BYTE)((sum >> 1) + (sum << 7) + entry[i]);
+  }
+  return sum;
+}
+
+static FRESULT __not_in_flash_func(findNextMatchRaw)(DTANode *node,
+                                                     FILINFO *fno) {
+  DIR *dj = node->dj;
+  FATFS *fs = dj->obj.fs;
+  // Next ordinal expected of a long name, 0 once the long name is complete
+  BYTE lfnOrd = 0xFF;
+  BYTE lfnSum = 0;
+  bool lfnDot = false;
+  while (dj->sect != 0) {
+    FRESULT fr = rawMoveWindow(fs, dj->sect);
+    if (fr != FR_OK) return fr;
+    BYTE entry[RAW_DIR_ENTRY_SIZE];
+    memcpy(entry, fs->win + dj->dptr % FF_MAX_SS, RAW_DIR_ENTRY_SIZE);
+    if (entry[0] == 0) {
+      // End of the folder
+      dj->sect = 0;
+      break;
+    }
+    fr = rawNextEntry(dj);
+    if (fr != FR_OK) return fr;
+
+    BYTE attr = entry[11] & RAW_DIR_ATTR_MASK;
+    if (entry[0] == RAW_DIR_DELETED) {
+      lfnOrd = 0xFF;
+      continue;
+    }
+    if (attr == RAW_DIR_ATTR_LFN) {
+      BYTE ord = entry[0];
+      if (ord & RAW_DIR_LFN_LAST) {
+        ord &= (BYTE)~RAW_DIR_LFN_LAST;
+        lfnOrd = ord;
+        lfnSum = entry[13];
+      }
+      if ((ord == lfnOrd) && (ord != 0) && (entry[13] == lfnSum)) {
+        lfnOrd--;
+        // The first character of the long name is in the last entry
+        if (lfnOrd == 0) lfnDot = (rawWord(entry + 1) == '.');
+      } else {
+        lfnOrd = 0xFF;
+      }
+      continue;
+    }
+    bool lfnValid = (lfnOrd == 0);
+    lfnOrd = 0xFF;
+    // Dot entries and the volume label
+    if (entry[0] == '.' || (attr & ~AM_ARC) == RAW_DIR_ATTR_VOL) continue;
+    if (!gemdrive_match_attribs(&node->match, sdcard_attribsFAT2ST(attr))) {
+      continue;
+    }
+    // The 8.3 name as FatFS returns it in altname, then the Atari name
+    char sfn[13];
+    int len = 0;
+    for (int i = 0; i < 11; i++) {
+      char c = (char)entry[i];
+      if (c == ' ') continue;
+      if (i == 0 && c == 0x05) c = (char)RAW_DIR_DELETED;
+      if (i == 8) sfn[len++] = '.';
+      sfn[len++] = c;
+    }
+    sfn[len] = '\0';
+    memcpy(fno->fname, sfn, len + 1);
+    fno->altname[0] = '\0';
+    setAtariName(fno);
+    if (!gemdrive_match_name(&node->match, fno->altname)) continue;
+    // Files of the host starting with a dot (._ of macOS) are hidden
+    if (lfnValid && lfnDot && (rawSfnSum(entry) == lfnSum)) continue;
+    fno->fattrib = attr;
+    fno->ftime = rawWord(entry + 22);
+    fno->fdate = rawWord(entry + 24);
+    fno->fsize = rawDword(entry + 28);
+    return FR_OK;
+  }
+  fno->fname[0] = '\0';
+  fno->altname[0] = '\0';
+  return FR_OK;
+}
+
+// Read the directory up to the next entry matching the Fsfirst filespec and
+// attributes. The attributes are checked first, then the Atari name.
+static FRESULT __not_in_flash_func(findNextMatch)(DTANode *node,
+                                                  FILINFO *fno) {
+  FATFS *fs = node->dj->obj.fs;
+  if ((fs != NULL) && (node->dj->obj.id == fs->id) &&
+      ((fs->fs_type == FS_FAT16) || (fs->fs_type == FS_FAT32))) {
+    return findNextMatchRaw(node, fno);
+  }
+  for (;;) {
+    FRESULT fr = f_readdir(node->dj, fno);
+    if (fr != FR_OK || fno->fname[0] == '\0') return fr;
+    // Files of the host starting with a dot (., .., ._ of macOS) are hidden
+    if (fno->fname[0] == '.') continue;
+    if (!gemdrive_match_attribs(&node->match,
+                                sdcard_attribsFAT2ST(fno->fattrib))) {
+      continue;
+    }
+    setAtariName(fno);
+    if (gemdrive_match_name(&node->match, fno->altname)) return FR_OK;
+  }
+}
+
 static void __not_in_flash_func(populateDTA)(uint32_t memory_address_dta,
                                              uint32_t dta_address,
                                              int16_t gemdos_err_code,
@@ -383,7 +725,6 @@ static void __not_in_flash_func(populateDTA)(uint32_t memory_address_dta,
     if (fno) {
       memcpy(data->d_fname, fno->altname, 13);
       data->d_fname[13] = '\0';  // Ensure null-termination
-      data->d_offset_drive = driveNum;
       data->d_attrib = sdcard_attribsFAT2ST(fno->fattrib);
       data->d_time = fno->ftime;
       data->d_date = fno->fdate;
@@ -453,17 +794,90 @@ static void __not_in_flash_func(addFile)(FileDescriptors **head,
   newFDescriptor->fd = new_fd;
   newFDescriptor->offset = 0;
   newFDescriptor->seek_dirty = false;
+  newFDescriptor->cacheSource = BOOTCACHE_NO_SOURCE;
+  newFDescriptor->fastseek = GEMDRIVE_FASTSEEK_NONE;
+  newFDescriptor->fobject.cltbl = NULL;
   newFDescriptor->next = *head;
   *head = newFDescriptor;
   DPRINTF("File %s added with fd %i\n", fpath, new_fd);
 }
 
+// exFAT files without a FAT chain (NoFatChain) are one run of clusters:
+// the map is written from the first cluster and the size, no walk needed.
+static bool __not_in_flash_func(fillContiguousLinkMap)(FileDescriptors *file) {
+#if FF_FS_EXFAT
+  FIL *fp = &file->fobject;
+  FATFS *fs = fp->obj.fs;
+  if ((fs->fs_type != FS_EXFAT) || (fp->obj.stat != 2) ||
+      (fp->obj.sclust == 0)) {
+    return false;
+  }
+#if FF_MAX_SS == FF_MIN_SS
+  FSIZE_t clusterBytes = (FSIZE_t)fs->csize * FF_MAX_SS;
+#else
+  FSIZE_t clusterBytes = (FSIZE_t)fs->csize * fs->ssize;
+#endif
+  file->cltbl[0] = 4;
+  file->cltbl[1] =
+      (DWORD)((fp->obj.objsize + clusterBytes - 1) / clusterBytes);
+  file->cltbl[2] = fp->obj.sclust;
+  file->cltbl[3] = 0;
+  fp->cltbl = file->cltbl;
+  return true;
+#else
+  (void)file;
+  return false;
+#endif
+}
+
+// Built on the first seek that moves the file position, so files read or
+// written straight through never pay for it
+static void __not_in_flash_func(attachLinkMap)(FileDescriptors *file) {
+  FIL *fp = &file->fobject;
+  if (file->cacheSource != BOOTCACHE_NO_SOURCE) {
+    file->fastseek = GEMDRIVE_FASTSEEK_OFF;
+    return;
+  }
+  // Still NONE: a file written past the minimum size gets a map later
+  if (f_size(fp) < GEMDRIVE_FASTSEEK_MIN_SIZE) return;
+  if (!fillContiguousLinkMap(file)) {
+    file->cltbl[0] = GEMDRIVE_FASTSEEK_TABLE_LEN;
+    fp->cltbl = file->cltbl;
+    FRESULT res = f_lseek(fp, CREATE_LINKMAP);
+    if (res != FR_OK) {
+      // FR_NOT_ENOUGH_CORE: more fragments than the map holds
+      DPRINTF("No fast seek for %s (%d, %u DWORDs needed)\n", file->fpath,
+              res, file->cltbl[0]);
+      fp->cltbl = NULL;
+      file->fastseek = GEMDRIVE_FASTSEEK_OFF;
+      return;
+    }
+  }
+  file->fastseek = GEMDRIVE_FASTSEEK_ON;
+  DPRINTF("Fast seek for %s, %u DWORDs\n", file->fpath, file->cltbl[0]);
+}
+
+// FatFS can't grow a file with a link map: it is dropped before a write
+// past the end and built again on a later seek
+static inline void __not_in_flash_func(detachLinkMapIfGrowing)(
+    FileDescriptors *file, FSIZE_t end) {
+  if ((file->fastseek == GEMDRIVE_FASTSEEK_ON) &&
+      (end > f_size(&file->fobject))) {
+    file->fobject.cltbl = NULL;
+    file->fastseek = GEMDRIVE_FASTSEEK_NONE;
+  }
+}
+
 static inline FRESULT __not_in_flash_func(syncFileOffsetIfNeeded)(
     FileDescriptors *file) {
   if ((file == NULL) || !file->seek_dirty) {
     return FR_OK;
   }
 
+  if ((file->fastseek == GEMDRIVE_FASTSEEK_NONE) &&
+      (file->offset != f_tell(&file->fobject))) {
+    attachLinkMap(file);
+  }
   FRESULT res = f_lseek(&file->fobject, file->offset);
   if (res == FR_OK) {
     file->seek_dirty = false;
@@ -513,8 +927,8 @@ static int __not_in_flash_func(deleteFileByFD)(FileDescriptors **head,
       } else {
         *head = cur->next;
       }
-      // Free the node’s memory
-      free(cur);
+      // Give the node back to the pool
+      slab_free(&filePool, cur);
       return 1;  // one node deleted
     }
     prev = cur;
@@ -551,8 +965,8 @@ static void __not_in_flash_func(cleanFileDescriptors)(FileDescriptors **head) {
     f_close(&cur->fobject);
     // Keep track of the next node
     next = cur->next;
-    // Free this node
-    free(cur);
+    // Give this node back to the pool
+    slab_free(&filePool, cur);
     // Move to next
     cur = next;
   }
@@ -561,9 +975,10 @@ static void __not_in_flash_func(cleanFileDescriptors)(FileDescriptors **head) {
   DPRINTF("All file descriptors cleaned.\n");
 }
 
-// dpathStr, hdFolder are global variables
-static void __not_in_flash_func(getLocalFullPathname)(uint16_t *pyldPtr,
-                                                      char *tmp_filepath) {
+// Returns the drive of the path, with the folder of the drive and its default
+// path in tmp_filepath
+static GemdriveVolume *__not_in_flash_func(getLocalFullPathname)(
+    uint16_t *pyldPtr, char *tmp_filepath) {
   // Obtain the fname string and keep it in memory
   // concatenated path and filename
   char path_filename[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
@@ -571,29 +986,31 @@ static void __not_in_flash_func(getLocalFullPathname)(uint16_t *pyldPtr,
 
   COPY_AND_CHANGE_ENDIANESS_BLOCK16(pyldPtr, path_filename,
                                     GEMDRIVE_MAX_FOLDER_LENGTH);
-  DPRINTF("dpathStr: %s\n", dpathStr);
+  GemdriveVolume *volume = findPathVolume(path_filename);
+  const char *dpath = volume->dpath;
+  DPRINTF("Drive %c: dpath: %s\n", volume->letter, dpath);
   DPRINTF("path_filename: %s\n", path_filename);
   if (path_filename[1] == ':') {
     // If the path has the drive letter, jump two positions
-    // and ignore the dpathStr
+    // and ignore the dpath
     snprintf(path_filename, GEMDRIVE_MAX_FOLDER_LENGTH, "%s",
              path_filename + 2);
     DPRINTF("New path_filename: %s\n", path_filename);
-    snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/", hdFolder);
+    snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/", volume->folder);
   } else if (path_filename[0] == '\\') {
-    // If the path filename has a backslash, ignore the dpathStr
+    // If the path filename has a backslash, ignore the dpath
     DPRINTF("New path_filename: %s\n", path_filename);
-    snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/", hdFolder);
+    snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/", volume->folder);
   } else {
     // If the path filename does not have a drive letter,
-    // concatenate the path with the hdFolder and the filename
+    // concatenate the path with the folder and the filename
     // If the path has the drive letter, jump two positions
-    if (dpathStr[1] == ':') {
-      snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/%s", hdFolder,
-               dpathStr + 2);
+    if (dpath[1] == ':') {
+      snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/%s", volume->folder,
+               dpath + 2);
     } else {
-      snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/%s", hdFolder,
-               dpathStr);
+      snprintf(tmp_path, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/%s", volume->folder,
+               dpath);
     }
   }
   snprintf(tmp_filepath, GEMDRIVE_MAX_FOLDER_LENGTH, "%s/%s", tmp_path,
@@ -602,6 +1019,7 @@ static void __not_in_flash_func(getLocalFullPathname)(uint16_t *pyldPtr,
 
   // Remove duplicated forward slashes
   sdcard_removeDupSlashes(tmp_filepath);
+  return volume;
 }
 
 static void printVars(uint32_t mem) {
@@ -717,15 +1135,59 @@ static void initVariables(uint32_t mem) {
     WRITE_LONGWORD_RAW(mem, i * 4, 0);
   }
 }
+// Make volume the drive of the paths without drive letter. The Atari reads
+// it to know when the current drive moves to another GEMDRIVE drive.
+static void __not_in_flash_func(selectVolume)(GemdriveVolume *volume) {
+  activeVolume = volume;
+  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_ACTIVE_DRIVE, volume->number,
+                 memorySharedAddress, GEMDRIVE_SHARED_VARIABLES_OFFSET);
+}
+
+// Read a drive of the settings. The extra drives are off while their folder
+// is empty, and drives whose letter is taken are skipped.
+static void loadVolume(const char *folderKey, const char *driveKey,
+                       const char *readOnlyKey, bool extra) {
+  SettingsConfigEntry *folder =
+      settings_find_entry(aconfig_getContext(), folderKey);
+  SettingsConfigEntry *letter =
+      settings_find_entry(aconfig_getContext(), driveKey);
+  SettingsConfigEntry *readOnly =
+      settings_find_entry(aconfig_getContext(), readOnlyKey);
+  if (extra && ((folder == NULL) || (folder->value[0] == '\0'))) return;
+
+  GemdriveVolume *volume = &volumes[volumeCount];
+  memset(volume, 0, sizeof(GemdriveVolume));
+  volume->letter = 'C';
+  if ((letter != NULL) && (letter->value[0] != '\0')) {
+    volume->letter = (char)toupper((unsigned char)letter->value[0]);
+  }
+  if ((volume->letter < 'C') || (volume->letter > 'Z') ||
+      (extra && (findVolume(volume->letter - 'A') != NULL))) {
+    DPRINTF("GEMDRIVE drive %c not valid or taken. Skipped.\n",
+            volume->letter);
+    if (extra) return;
+    volume->letter = 'C';
+  }
+  volume->number = (uint8_t)(volume->letter - 'A');
+  if (folder != NULL) {
+    strncpy(volume->folder, folder->value, sizeof(volume->folder) - 1);
+  } else {
+    DPRINTF("GEMDRIVE folder not found. Using default.\n");
+    strncpy(volume->folder, "/hd", sizeof(volume->folder) - 1);
+  }
+  volume->dpath[0] = '\\';  // Set the root folder as default
+  volume->readOnly = (readOnly != NULL) && isTrue(readOnly->value);
+  DPRINTF("GEMDRIVE drive %c: folder %s%s\n", volume->letter, volume->folder,
+          volume->readOnly ? ", read only" : "");
+  volumeCount++;
+}
+
 void __not_in_flash_func(gemdrive_init)() {
   FRESULT fr; /* FatFs function common result code */
 
   srand(time(0));
   DPRINTF("Initializing GEMDRIVE...\n");  // Print alwayse
 
-  dpathStr[0] = '\\';  // Set the root folder as default
-  dpathStr[1] = '\0';
-
   memorySharedAddress = (unsigned int)&__rom_in_ram_start__;
   if ((memorySharedAddress & 0x3u) != 0u) {
     DPRINTF("ERROR: GEMDRIVE shared memory base 0x%08lx is not 4-byte aligned\n",
@@ -741,38 +1203,34 @@ void __not_in_flash_func(gemdrive_init)() {
 
   initVariables(memorySharedAddress + GEMDRIVE_RANDOM_TOKEN_OFFSET);
 
-  SettingsConfigEntry *gemDriveLetter = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE);
-  drive = 'C';
-  if (gemDriveLetter != NULL) {
-    drive = gemDriveLetter->value[0];
+  // Read the drives from the settings. The first one is always there.
+  volumeCount = 0;
+  loadVolume(ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY, false);
+  loadVolume(ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_2,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_2,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_2, true);
+  loadVolume(ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_3,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_3,
+             ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_3, true);
+  uint32_t driveMask = 0;
+  for (uint8_t i = 0; i < volumeCount; i++) {
+    driveMask |= 1u << volumes[i].number;
   }
-  driveNum =
-      (uint8_t)toupper(drive) - 65;  // Convert the drive letter to a number.
-                                     // Add 1 because 0 is the current drive
-  DPRINTF("Drive letter: %c, Drive number: %u\n", drive, driveNum);
 
   // Mount drive. For testing purposes.
   fr = f_mount(&filesys, "0:", 1);
   bool sdMounted = (fr == FR_OK);
   DPRINTF("SD card mounted: %s\n", sdMounted ? "OK" : "Failed");
 
-  // Read the GEMDRIVE folder from the settings
-  SettingsConfigEntry *gemDriveFolder = settings_find_entry(
-      aconfig_getContext(), ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER);
-  if (gemDriveFolder != NULL) {
-    strncpy(hdFolder, gemDriveFolder->value, sizeof(hdFolder) - 1);
-    hdFolder[sizeof(hdFolder) - 1] = '\0';  // Ensure null-termination
-    DPRINTF("GEMDRIVE folder: %s\n", hdFolder);
-  } else {
-    DPRINTF("GEMDRIVE folder not found. Using default.\n");
-    strncpy(hdFolder, "/hd", sizeof(hdFolder) - 1);
-    hdFolder[sizeof(hdFolder) - 1] = '\0';  // Ensure null-termination
-  }
+  // The lists are empty here: every block goes back to its pool
+  slab_init(&filePool, "files", sizeof(FileDescriptors),
+            GEMDRIVE_FILE_POOL_SIZE);
+  slab_init(&dtaPool, "dta", sizeof(DTANode), GEMDRIVE_DTA_POOL_SIZE);
+  slab_init(&dirPool, "dir", sizeof(DIR), GEMDRIVE_DTA_POOL_SIZE);
   initializeDTAHashTable();
   DPRINTF("DTA table elements: %d\n", countDTA());
-  dpathStr[0] = '\\';  // Set the root folder as default
-  dpathStr[1] = '\0';
 
   // Enabled?
   bool gemDriveEnabled = false;
@@ -796,10 +1254,13 @@ void __not_in_flash_func(gemdrive_init)() {
   SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_FIRST_FILE_DESCRIPTOR,
                  FIRST_FILE_DESCRIPTOR, memorySharedAddress,
                  GEMDRIVE_SHARED_VARIABLES_OFFSET);
-  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_DRIVE_LETTER, drive,
+  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_DRIVE_LETTER, volumes[0].letter,
+                 memorySharedAddress, GEMDRIVE_SHARED_VARIABLES_OFFSET);
+  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_DRIVE_NUMBER, volumes[0].number,
                  memorySharedAddress, GEMDRIVE_SHARED_VARIABLES_OFFSET);
-  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_DRIVE_NUMBER, driveNum,
+  SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_DRIVE_MASK, driveMask,
                  memorySharedAddress, GEMDRIVE_SHARED_VARIABLES_OFFSET);
+  selectVolume(&volumes[0]);
   SET_SHARED_VAR(GEMDRIVE_BUFFER_TYPE, buffType, memorySharedAddress,
                  GEMDRIVE_SHARED_VARIABLES_OFFSET);
   SET_SHARED_VAR(GEMDRIVE_SHARED_VARIABLE_ENABLED,
@@ -817,11 +1278,26 @@ void __not_in_flash_func(gemdrive_init)() {
     TPROTO_SET_RANDOM_TOKEN(memoryRandomTokenSeedAddress, newRandomSeedToken);
   }
 
-  DPRINTF("GEMDRIVE initialized with Drive Letter: %c, Drive Number: %u\n",
-          drive, driveNum);
+  DPRINTF("GEMDRIVE initialized with %u drives. First drive: %c\n",
+          volumeCount, volumes[0].letter);
   DPRINTF("Waiting for commands...\n");
 }
 
+// Close every open file and search before the SD card is unmounted
+void gemdrive_release(void) {
+  // The Atari sees its open files and searches fail afterwards, as after a
+  // media change.
+  gemdrive_pexec_release();
+  cleanDTAHashTable();
+  cleanFileDescriptors(&fdescriptors);
+  statCacheFlush();
+}
+
+const SlabPool *gemdrive_getPool(uint8_t index) {
+  static const SlabPool *const pools[] = {&filePool, &dtaPool, &dirPool};
+  return (index < sizeof(pools) / sizeof(pools[0])) ? pools[index] : NULL;
+}
+
 // Invoke this function to process the commands from the active loop in the
 // main function
 void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
@@ -888,8 +1364,10 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
     case GEMDRVEMUL_RESET: {
       DPRINTF("Resetting GEMDRIVE\n");
       // Reset the shared variables
+      gemdrive_pexec_release();
       cleanDTAHashTable();
       cleanFileDescriptors(&fdescriptors);
+      statCacheFlush();
       // Set the continue to continue booting
       SEND_COMMAND_TO_DISPLAY(DISPLAY_COMMAND_START);
       break;
@@ -932,6 +1410,12 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       uint32_t sharedVarValue = TPROTO_GET_NEXT32_PAYLOAD_PARAM32(payloadPtr);
       SET_SHARED_VAR(sharedVarIdx, sharedVarValue, memorySharedAddress,
                      GEMDRIVE_SHARED_VARIABLES_OFFSET);
+      if (sharedVarIdx == GEMDRIVE_SHARED_VARIABLE_ACTIVE_DRIVE) {
+        // The current drive of the Atari moved to another GEMDRIVE drive
+        GemdriveVolume *volume = findVolume(sharedVarValue);
+        if (volume != NULL) activeVolume = volume;
+        DPRINTF("Active drive: %c\n", activeVolume->letter);
+      }
       break;
     }
     case GEMDRVEMUL_DGETDRV_CALL: {
@@ -952,13 +1436,16 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       uint16_t dfreeUnit = TPROTO_GET_PAYLOAD_PARAM16(payloadPtr);
       DPRINTF("DFREE unit: %x. (0=Default, 1=A, 2=B, 3=C, etc...)\n",
               dfreeUnit);
-      DPRINTF("Current drive: %c. Unit number: %u\n", drive, driveNum);
+      // The Atari sends the drive number, 0 is A
+      GemdriveVolume *volume = findVolume(dfreeUnit);
+      if (volume == NULL) volume = activeVolume;
+      DPRINTF("Drive: %c. Folder: %s\n", volume->letter, volume->folder);
       // Check the free space
       DWORD freeClusters;
       FATFS *fs;
       FRESULT fr;
       // Get free space
-      fr = f_getfree(hdFolder, &freeClusters, &fs);
+      fr = f_getfree(volume->folder, &freeClusters, &fs);
       if (fr != FR_OK) {
         WRITE_LONGWORD_RAW(memorySharedAddress, GEMDRIVE_DFREE_STATUS,
                            GEMDOS_ERROR);
@@ -984,13 +1471,15 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
     }
     case GEMDRVEMUL_DGETPATH_CALL: {
       uint16_t dpathDrive = TPROTO_GET_PAYLOAD_PARAM16(payloadPtr);
+      GemdriveVolume *volume = findVolume(dpathDrive);
+      if (volume == NULL) volume = activeVolume;
 
       DPRINTF("Dpath drive: %x\n", dpathDrive);
-      DPRINTF("Dpath string: %s\n", dpathStr);
+      DPRINTF("Dpath string: %s\n", volume->dpath);
 
       char tmpPath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
       // Copy default path safely and ensure null-termination
-      strncpy(tmpPath, dpathStr, sizeof(tmpPath) - 1);
+      strncpy(tmpPath, volume->dpath, sizeof(tmpPath) - 1);
       tmpPath[sizeof(tmpPath) - 1] = '\0';
       sdcard_forward2Backslash(tmpPath);
 
@@ -1022,22 +1511,23 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // Check if the directory exists
       char tmpPath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
 
-      // If path has drive prefix 'C:' remove it
-      if (dpathTmp[0] == drive && dpathTmp[1] == ':') {
-        DPRINTF("Drive letter found: %c. Removing it.\n", drive);
+      // The path of a drive prefix 'D:' is the one of that drive
+      GemdriveVolume *volume = findPathVolume(dpathTmp);
+      if (dpathTmp[1] == ':') {
+        DPRINTF("Drive letter found: %c. Removing it.\n", dpathTmp[0]);
         // Remove the drive letter and colon
         size_t rem = strlen(dpathTmp + 2);
         memmove(dpathTmp, dpathTmp + 2, rem + 1);
       }
 
-      DPRINTF("Dpath string: %s\n", dpathStr);
+      DPRINTF("Dpath string: %s\n", volume->dpath);
       DPRINTF("Dpath tmp: %s\n", dpathTmp);
 
       // Check if the path is relative or absolute
       if ((dpathTmp[0] != '\\') && (dpathTmp[0] != '/')) {
-        // Concatenate the path with the existing dpathStr
+        // Concatenate the path with the existing dpath of the drive
         char tmpPathConcat[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-        snprintf(tmpPathConcat, sizeof(tmpPathConcat), "%s/%s", dpathStr,
+        snprintf(tmpPathConcat, sizeof(tmpPathConcat), "%s/%s", volume->dpath,
                  dpathTmp);
         DPRINTF("Concatenated path: %s\n", tmpPathConcat);
         strncpy(dpathTmp, tmpPathConcat, sizeof(dpathTmp) - 1);
@@ -1052,21 +1542,21 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       sdcard_normalizePath(dpathTmp);
       DPRINTF("Normalized path: %s\n", dpathTmp);
 
-      // Concatenate the path with the hdFolder
-      snprintf(tmpPath, sizeof(tmpPath), "%s/%s", hdFolder, dpathTmp);
+      // Concatenate the path with the folder of the drive
+      snprintf(tmpPath, sizeof(tmpPath), "%s/%s", volume->folder, dpathTmp);
 
       // Remove duplicated forward slashes
       sdcard_removeDupSlashes(tmpPath);
       sdcard_removeDupSlashes(dpathTmp);
 
-      FILINFO fno;
-      FRESULT res = f_stat(tmpPath, &fno);
+      const GemdriveStatEntry *entry = NULL;
+      FRESULT res = statCacheGet(tmpPath, &entry);
 
-      if ((res == FR_OK && (fno.fattrib & AM_DIR))) {
+      if ((res == FR_OK && (entry->fattrib & AM_DIR))) {
         DPRINTF("Directory exists: %s\n", tmpPath);
-        // Copy dpathTmp to dpathStr
-        strcpy(dpathStr, dpathTmp);
-        DPRINTF("The new default path is: %s\n", dpathStr);
+        // Copy dpathTmp to the dpath of the drive
+        strcpy(volume->dpath, dpathTmp);
+        DPRINTF("The new default path is: %s\n", volume->dpath);
         WRITE_WORD(memorySharedAddress, GEMDRIVE_SET_DPATH_STATUS, GEMDOS_EOK);
       } else {
         DPRINTF("Directory does not exist: %s\n", tmpPath);
@@ -1084,14 +1574,16 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       TPROTO_NEXT32_PAYLOAD_PTR(payloadPtr);  // Skip d3, d4, d5
 
       char tmpPath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpPath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpPath);
       DPRINTF("Folder to create: %s\n", tmpPath);
 
       // Check if the folder exists. If not, return an error
       uint16_t dcreateCode = GEMDOS_ERROR;
       // Create the folder
-      FRESULT ferr = f_mkdir(tmpPath);
-      if (ferr != FR_OK) {
+      FRESULT ferr = volume->readOnly ? FR_WRITE_PROTECTED : f_mkdir(tmpPath);
+      if (ferr == FR_WRITE_PROTECTED) {
+        dcreateCode = GEMDOS_EWRPRO;
+      } else if (ferr != FR_OK) {
         DPRINTF("ERROR: Could not create folder (%d)\r\n", ferr);
         if (ferr == FR_NO_PATH) {
           dcreateCode = GEMDOS_EPTHNF;
@@ -1100,6 +1592,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
         }
       } else {
         DPRINTF("Folder created\n");
+        statCacheInvalidate(tmpPath);
         dcreateCode = GEMDOS_EOK;
       }
       WRITE_WORD(memorySharedAddress, GEMDRIVE_DCREATE_STATUS, dcreateCode);
@@ -1114,12 +1607,14 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       TPROTO_NEXT32_PAYLOAD_PTR(payloadPtr);  // Skip d3, d4, d5
 
       char tmpPath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpPath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpPath);
       DPRINTF("Folder to delete: %s\n", tmpPath);
 
       // Check if the folder exists. If not, return an error
       uint16_t ddeleteCode = GEMDOS_ERROR;
-      if (sdcard_dirExist(tmpPath) == 0) {
+      if (volume->readOnly) {
+        ddeleteCode = GEMDOS_EWRPRO;
+      } else if (sdcard_dirExist(tmpPath) == 0) {
         DPRINTF("ERROR: Folder does not exist\n");
         ddeleteCode = GEMDOS_EPTHNF;
       } else {
@@ -1139,6 +1634,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           }
         } else {
           DPRINTF("Folder deleted\n");
+          statCacheInvalidate(tmpPath);
           ddeleteCode = GEMDOS_EOK;
         }
       }
@@ -1199,6 +1695,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
 
       char pattern[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
       char internalPath[GEMDRIVE_FATFS_MAX_FOLDER_LENGTH] = {0};
+      GemdriveVolume *volume = activeVolume;
       {
         char fspecString[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
         char tmpString[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
@@ -1212,9 +1709,10 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
         sdcard_back2ForwardSlash(tmpString);
         DPRINTF("Fspec string backslash: %s\n", tmpString);
 
+        volume = findPathVolume(tmpString);
         if (tmpString[1] == ':') {
           // If the path has the drive letter, jump two positions
-          // and ignore the dpathStr
+          // and ignore the dpath
           snprintf(tmpString, GEMDRIVE_MAX_FOLDER_LENGTH, "%s", tmpString + 2);
           DPRINTF("New path_filename: %s\n", tmpString);
         }
@@ -1222,15 +1720,17 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           DPRINTF("Root folder found. Ignoring default path.\n");
           strcpy(fspecString, tmpString);
         } else {
-          DPRINTF("Need to concatenate the default path: %s\n", dpathStr);
-          snprintf(fspecString, sizeof(fspecString), "%s/%s", dpathStr,
+          DPRINTF("Need to concatenate the default path: %s\n",
+                  volume->dpath);
+          snprintf(fspecString, sizeof(fspecString), "%s/%s", volume->dpath,
                    tmpString);
           DPRINTF("Full fspecSTBufAddr string: %s\n", fspecString);
         }
 
         // Remove duplicated forward slashes
         sdcard_removeDupSlashes(fspecString);
-        searchPath2ST(fspecString, internalPath, pathForwardslash, pattern);
+        searchPath2ST(volume->folder, fspecString, internalPath,
+                      pathForwardslash, pattern);
         // Get the attributes string
         char attribsStr[7] = "";
         sdcard_getAttribsSTStr(attribsStr, attribs);
@@ -1283,11 +1783,38 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       }
       DPRINTF("DTA at %x added.\n", ndta);
 
-      if (!(attribs & FS_ST_LABEL)) {
-        attribs |= FS_ST_ARCH;
-      }
-
+      // The Atari leaves the drive of the search as its current drive, and
+      // Fsnext finds the drive in the DTA
+      selectVolume(volume);
+      currentDTANode->data.d_offset_drive = volume->number;
       currentDTANode->attribs = attribs;
+      gemdrive_match_compile(&currentDTANode->match, pattern, attribs);
+
+      // A search for a single file, as make tools do, is answered from its
+      // f_stat without reading the folder. The DTA gets no directory object,
+      // so Fsnext ends the search.
+      if ((pattern[0] != '\0') && (pattern[0] != '.') &&
+          (memchr(currentDTANode->match.mask, 0, GEMDRIVE_MATCH_NAME_SIZE) ==
+           NULL)) {
+        char filePath[GEMDRIVE_FATFS_MAX_FOLDER_LENGTH] = {0};
+        const GemdriveStatEntry *entry = NULL;
+        snprintf(filePath, sizeof(filePath), "%s/%s", internalPath, pattern);
+        sdcard_removeDupSlashes(filePath);
+        if ((statCacheGet(filePath, &entry) == FR_OK) &&
+            gemdrive_match_attribs(&currentDTANode->match,
+                                   sdcard_attribsFAT2ST(entry->fattrib)) &&
+            gemdrive_match_name(&currentDTANode->match, entry->name)) {
+          FILINFO fno = {0};
+          memcpy(fno.altname, entry->name, sizeof(fno.altname));
+          fno.fattrib = entry->fattrib;
+          fno.fdate = entry->fdate;
+          fno.ftime = entry->ftime;
+          fno.fsize = entry->fsize;
+          populateDTA(memorySharedAddress, ndta, GEMDOS_EFILNF, &fno);
+          DPRINTF("DTA at %x populated from the stat of %s\n", ndta, filePath);
+          break;
+        }
+      }
 
       if (currentDTANode->dj != NULL) {
         DPRINTF("DTA at %x already has a directory object. Freeing it\n", ndta);
@@ -1296,11 +1823,11 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
         // Defensive — this path should not normally fire because the
         // releaseDTA() call above already cleaned any prior node.
         (void)f_closedir(currentDTANode->dj);
-        free(currentDTANode->dj);
+        slab_free(&dirPool, currentDTANode->dj);
         currentDTANode->dj = NULL;
       }
       DPRINTF("Creating new directory object\n");
-      currentDTANode->dj = (DIR *)malloc(sizeof(DIR));
+      currentDTANode->dj = (DIR *)slab_alloc(&dirPool);
       if (currentDTANode->dj == NULL) {
         DPRINTF("FSFIRST Error: Could not allocate directory object for %x.\n",
                 ndta);
@@ -1314,78 +1841,25 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // FILINFO is an output structure
       FILINFO fno = {0};
 
-      size_t len = strlen(pattern) + 1;  // include terminator
-      char *buf = malloc(len);           // single allocation
-      if (!buf) {
-        DPRINTF("FSFIRST Error: Could not allocate pattern buffer for %x.\n",
-                ndta);
-        free(currentDTANode->dj);
-        currentDTANode->dj = NULL;
-        releaseDTA(ndta);
-        WRITE_WORD(memorySharedAddress, GEMDRIVE_DTA_F_FOUND, GEMDOS_ENSMEM);
-        nullifyDTA(memorySharedAddress);
-        break;
-      } else {
-        memcpy(buf, pattern, len);  // one copy
-        currentDTANode->pat = buf;
-        currentDTANode->dj->pat = buf;
-      }
-
       DPRINTF("Fsfirst Full internal path: %s, filename pattern: %s[%d]\n",
               internalPath, pattern, strlen(pattern));
 
-      // FRESULT fr = f_opendir(currentDTANode->dj, internalPath);
-      FRESULT fr = f_findfirst(currentDTANode->dj, &fno, internalPath,
-                               currentDTANode->pat);
-      while (fr == FR_OK && fno.fname[0] != '\0' &&
-             (!(attribs & sdcard_attribsFAT2ST(fno.fattrib)) ||
-              ((fno.fname[0] == '.') ||
-               (fno.fname[0] == '.' && fno.fname[1] == '_')))) {
-        fr = f_findnext(currentDTANode->dj, &fno);
-      }
+      FRESULT fr = f_opendir(currentDTANode->dj, internalPath);
+      if (fr == FR_OK) fr = findNextMatch(currentDTANode, &fno);
 
       DPRINTF("Fsfirst fr: %d and filename: %s\n", fr, fno.fname);
 
       if (fr == FR_OK && fno.fname[0]) {
-        if (fno.altname[0] == 0) {
-          // Copy the fname to altname. It's already a 8.3 file format
-          memcpy(fno.altname, fno.fname, sizeof(fno.altname));
-        }
-        uint8_t attribsConvST = sdcard_attribsFAT2ST(fno.fattrib);
         char attribsStr[7] = "";
-        sdcard_getAttribsSTStr(attribsStr, attribsConvST);
-        char shortenFname[14];
-        char upperFilename[14];
-        char filteredFilename[14];
-        sdcard_filterFname(fno.altname, filteredFilename);
-        sdcard_upperFname(filteredFilename, upperFilename);
-        sdcard_shortenFname(upperFilename, shortenFname);
-
-        memcpy(fno.altname, shortenFname, 13);
-
-        // Filter out elements that do not match the attributes
-        if (attribsConvST & attribs) {
-          DPRINTF("Found: %s, attr: %s\n", fno.altname, attribsStr);
-          populateDTA(memorySharedAddress, ndta, GEMDOS_EFILNF, &fno);
-          DPRINTF("DTA at %x populated with: %s\n", ndta, fno.altname);
-          DPRINTF("currentDTANode dj pat: %s\n", currentDTANode->dj->pat);
-          DPRINTF("currentDTANode dj: %x\n", currentDTANode->dj);
-        } else {
-          DPRINTF("Skipped: %s, attr: %s\n", fno.altname, attribsStr);
-          int16_t errorCode = GEMDOS_EFILNF;
-          DPRINTF("DTA at %x showing error code: %x\n", ndta, errorCode);
-          WRITE_WORD(memorySharedAddress, GEMDRIVE_DTA_F_FOUND, errorCode);
-          if (currentDTANode) {
-            releaseDTA(ndta);
-            DPRINTF("Existing DTA at %x released. DTA table elements: %d\n",
-                    ndta, countDTA());
-            nullifyDTA(memorySharedAddress);
-          }
-        }
+        sdcard_getAttribsSTStr(attribsStr, sdcard_attribsFAT2ST(fno.fattrib));
+        DPRINTF("Found: %s, attr: %s\n", fno.altname, attribsStr);
+        populateDTA(memorySharedAddress, ndta, GEMDOS_EFILNF, &fno);
+        DPRINTF("DTA at %x populated with: %s\n", ndta, fno.altname);
+        DPRINTF("currentDTANode dj: %x\n", currentDTANode->dj);
       } else {
         f_closedir(currentDTANode->dj);
         if (currentDTANode->dj != NULL) {
-          free(currentDTANode->dj);
+          slab_free(&dirPool, currentDTANode->dj);
           currentDTANode->dj = NULL;
         }
         DPRINTF("Nothing returned from Fsfirst\n");
@@ -1416,29 +1890,13 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       DPRINTF("DTA exists: %s\n", ndtaExists ? "TRUE" : "FALSE");
       DPRINTF("DTA node: %x\n", dtaNode);
       if (dtaNode) {
-        DPRINTF("DTA node pat: %s\n", dtaNode->pat);
         DPRINTF("DTA node attribs: %x\n", dtaNode->attribs);
         DPRINTF("DTA node dj: %x\n", dtaNode->dj);
       }
 
       if (dtaNode != NULL && dtaNode->dj != NULL && ndtaExists) {
-        uint32_t attribs = dtaNode->attribs;
-        if (!(attribs & FS_ST_LABEL)) {
-          attribs |= FS_ST_ARCH;
-        }
-
-        // We need to filter out the elements that does not make sense in
-        // the FsFat environment And in the Atari ST environment
-        fr = FR_OK;
         FILINFO fno = {0};
-
-        fr = f_findnext(dtaNode->dj, &fno);
-        while (fr == FR_OK && fno.fname[0] != '\0' &&
-               (!(attribs & sdcard_attribsFAT2ST(fno.fattrib)) ||
-                ((fno.fname[0] == '.') ||
-                 (fno.fname[0] == '.' && fno.fname[1] == '_')))) {
-          fr = f_findnext(dtaNode->dj, &fno);
-        }
+        fr = findNextMatch(dtaNode, &fno);
 
         if (fr != FR_OK) {
           DPRINTF("ERROR: Could not find next file (%d)\r\n", fr);
@@ -1446,33 +1904,15 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
         DPRINTF("Fsnext ndta: %x, fr: %d and filename: %s\n", ndta, fr,
                 fno.fname);
         if (fr == FR_OK && fno.fname[0]) {
-          if (fno.altname[0] == 0) {
-            // Copy the fname to altname. It's already a 8.3 file format
-            memcpy(fno.altname, fno.fname, sizeof(fno.altname));
-          }
-          DPRINTF("Found: %s\n", fno.altname);
-          char shortenFilename[14];
-          char upperFilename[14];
-          char filteredFilename[14];
-          sdcard_filterFname(fno.altname, filteredFilename);
-          sdcard_upperFname(filteredFilename, upperFilename);
-          sdcard_shortenFname(upperFilename, shortenFilename);
-          memcpy(fno.altname, shortenFilename, 13);
-
-          uint8_t attribs = fno.fattrib;
-          uint8_t attribsConvST = sdcard_attribsFAT2ST(attribs);
-          if (!(attribs & (FS_ST_LABEL))) {
-            attribs |= FS_ST_ARCH;
-          }
           char attribsStr[7] = "";
-          sdcard_getAttribsSTStr(attribsStr, attribsConvST);
+          sdcard_getAttribsSTStr(attribsStr, sdcard_attribsFAT2ST(fno.fattrib));
           DPRINTF("Found: %s, attr: %s\n", fno.altname, attribsStr);
           // Populate the DTA with the next file found
           populateDTA(memorySharedAddress, ndta, GEMDOS_ENMFIL, &fno);
         } else {
           f_closedir(dtaNode->dj);
           if (dtaNode->dj != NULL) {
-            free(dtaNode->dj);
+            slab_free(&dirPool, dtaNode->dj);
             dtaNode->dj = NULL;
           }
           DPRINTF("Nothing found\n");
@@ -1486,6 +1926,11 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           }
           nullifyDTA(memorySharedAddress);
         }
+      } else if (dtaNode != NULL) {
+        // The search was for a single file, already found by Fsfirst
+        WRITE_WORD(memorySharedAddress, GEMDRIVE_DTA_F_FOUND, GEMDOS_ENMFIL);
+        releaseDTA(ndta);
+        nullifyDTA(memorySharedAddress);
       } else {
         DPRINTF("FsFirst not initalized\n");
         int16_t errorCode = GEMDOS_EINTRN;
@@ -1507,7 +1952,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       TPROTO_NEXT32_PAYLOAD_PTR(payloadPtr);  // skip d5
 
       char tmpFilepath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpFilepath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpFilepath);
       DPRINTF("Opening file: %s with mode: %x\n", tmpFilepath, fopenMode);
       // Convert the fopenMode to FatFs mode
       DPRINTF("Fopen mode: %x\n", fopenMode);
@@ -1529,7 +1974,11 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           break;
       }
       DPRINTF("FatFs open mode: %x\n", FatFSOpenMode);
-      if (fopenMode <= 2) {
+      if ((fopenMode > 0) && (fopenMode <= 2) && volume->readOnly) {
+        DPRINTF("ERROR: Drive %c is read only\n", volume->letter);
+        WRITE_AND_SWAP_LONGWORD(memorySharedAddress, GEMDRIVE_FOPEN_HANDLE,
+                                GEMDOS_EWRPRO);
+      } else if (fopenMode <= 2) {
         // Open the file with FatFs
         FIL fobj;
         FRESULT fr = f_open(&fobj, tmpFilepath, FatFSOpenMode);
@@ -1541,9 +1990,9 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           // Add the file to the list of open files
           int fdCount = getFirstAvailableFD(fdescriptors);
           DPRINTF("Opening file with new file descriptor: %d\n", fdCount);
-          FileDescriptors *newFDescriptor = malloc(sizeof(FileDescriptors));
+          FileDescriptors *newFDescriptor = slab_alloc(&filePool);
           if (newFDescriptor == NULL) {
-            DPRINTF("Memory allocation failed for new FileDescriptors\n");
+            DPRINTF("No free file descriptor in the pool\n");
             DPRINTF("ERROR: Could not add file to the list of open files\n");
             FRESULT closeFr = f_close(&fobj);
             if (closeFr != FR_OK) {
@@ -1551,9 +2000,17 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
                       closeFr);
             }
             WRITE_AND_SWAP_LONGWORD(memorySharedAddress, GEMDRIVE_FOPEN_HANDLE,
-                                    GEMDOS_EINTRN);
+                                    GEMDOS_ENHNDL);
           } else {
             addFile(&fdescriptors, newFDescriptor, tmpFilepath, fobj, fdCount);
+            const GemdriveStatEntry *entry = NULL;
+            if (fopenMode != 0) {
+              bootcache_note_write_path(tmpFilepath);
+            } else if (statCacheGet(tmpFilepath, &entry) == FR_OK) {
+              newFDescriptor->cacheSource = bootcache_open_source(
+                  tmpFilepath, entry->fsize, entry->fdate, entry->ftime,
+                  BOOTCACHE_UNIT_BYTE);
+            }
 
             DPRINTF("File opened with file descriptor: %d\n", fdCount);
             // Return the file descriptor
@@ -1570,6 +2027,8 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // Obtain the file descriptor
       FileDescriptors *file = getFileByFD(fdescriptors, fcloseFD);
       uint16_t exitCode = GEMDOS_EOK;
+      // A program load never outlives its file
+      gemdrive_pexec_release();
       if (file == NULL) {
         DPRINTF("ERROR: File descriptor not found\n");
         exitCode = GEMDOS_EIHNDL;
@@ -1583,6 +2042,8 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           DPRINTF("ERROR: Could not close file (%d)\r\n", ferr);
           exitCode = GEMDOS_EINTRN;
         } else {
+          // Its size and date may have changed
+          statCacheInvalidate(file->fpath);
           // Remove the file from the list of open files
           deleteFileByFD(&fdescriptors, fcloseFD);
           DPRINTF("File closed\n");
@@ -1602,7 +2063,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // Obtain the fname string and keep it in memory
       // concatenated path and filename
       char tmpFilepath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpFilepath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpFilepath);
       DPRINTF("Creating file: %s with mode: %x\n", tmpFilepath, fCreateMode);
 
       // CREATE ALWAYS MODE
@@ -1611,18 +2072,25 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
 
       // Open the file with FatFs
       FIL fObj;
-      FRESULT ferr = f_open(&fObj, tmpFilepath, fatFSCreateMode);
+      FRESULT ferr = volume->readOnly
+                         ? FR_WRITE_PROTECTED
+                         : f_open(&fObj, tmpFilepath, fatFSCreateMode);
       uint16_t errorCode = GEMDOS_EOK;
-      if (ferr != FR_OK) {
+      if (ferr == FR_WRITE_PROTECTED) {
+        DPRINTF("ERROR: Drive %c is read only\n", volume->letter);
+        errorCode = GEMDOS_EWRPRO;
+      } else if (ferr != FR_OK) {
         DPRINTF("ERROR: Could not create file (%d)\r\n", ferr);
         errorCode = GEMDOS_EPTHNF;
       } else {
+        statCacheInvalidate(tmpFilepath);
+        bootcache_note_write_path(tmpFilepath);
         // Add the file to the list of open files
         int fdCounter = getFirstAvailableFD(fdescriptors);
         DPRINTF("File created with file descriptor: %d\n", fdCounter);
-        FileDescriptors *newFDescriptor = malloc(sizeof(FileDescriptors));
+        FileDescriptors *newFDescriptor = slab_alloc(&filePool);
         if (newFDescriptor == NULL) {
-          DPRINTF("Memory allocation failed for new FileDescriptors\n");
+          DPRINTF("No free file descriptor in the pool\n");
           DPRINTF("ERROR: Could not add file to the list of open files\n");
           FRESULT closeFr = f_close(&fObj);
           if (closeFr != FR_OK) {
@@ -1630,7 +2098,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
                 "ERROR: Could not close created file after allocation failure (%d)\n",
                 closeFr);
           }
-          errorCode = GEMDOS_EINTRN;
+          errorCode = GEMDOS_ENHNDL;
         } else {
           addFile(&fdescriptors, newFDescriptor, tmpFilepath, fObj, fdCounter);
 
@@ -1660,11 +2128,14 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // Obtain the fname string and keep it in memory
       // concatenated path and filename
       char tmpFilePath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpFilePath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpFilePath);
       uint32_t status = GEMDOS_EOK;
       // Check first if the file is open. If so, cancel the operation
       FileDescriptors *file = getFileByPath(fdescriptors, tmpFilePath);
-      if (file != NULL) {
+      if (volume->readOnly) {
+        DPRINTF("ERROR: Drive %c is read only\n", volume->letter);
+        status = GEMDOS_EWRPRO;
+      } else if (file != NULL) {
         DPRINTF("File is open. Access denied. Cancelling operation\n");
         status = GEMDOS_EACCDN;
       }
@@ -1692,6 +2163,8 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           }
         } else {
           DPRINTF("File deleted\n");
+          statCacheInvalidate(tmpFilePath);
+          bootcache_note_write_path(tmpFilePath);
           status = GEMDOS_EOK;
         }
       }
@@ -1783,25 +2256,32 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // Obtain the fname string and keep it in memory
       // concatenated path and filename
       char tmpFPath[GEMDRIVE_MAX_FOLDER_LENGTH] = {0};
-      getLocalFullPathname(payloadPtr, tmpFPath);
+      GemdriveVolume *volume = getLocalFullPathname(payloadPtr, tmpFPath);
       DPRINTF("Fattrib flag: %x, new attributes: %x\n", fattrFlag, fattrNew);
       DPRINTF("Getting attributes of file: %s\n", tmpFPath);
 
       // Get the attributes of the file
-      FILINFO fno;
-      FRESULT fr = f_stat(tmpFPath, &fno);
+      const GemdriveStatEntry *entry = NULL;
+      FRESULT fr = statCacheGet(tmpFPath, &entry);
       uint32_t errorCode = GEMDOS_EOK;
       if (fr != FR_OK) {
         DPRINTF("ERROR: Could not get file attributes (%d)\r\n", fr);
         errorCode = GEMDOS_EFILNF;
 
       } else {
-        uint32_t fattrST = sdcard_attribsFAT2ST(fno.fattrib);
+        uint32_t fattrST = sdcard_attribsFAT2ST(entry->fattrib);
         errorCode = fattrST;
         char fattrSTStr[7] = "";
         sdcard_getAttribsSTStr(fattrSTStr, fattrST);
         if (fattrFlag == FATTRIB_INQUIRE) {
           DPRINTF("File attributes: %s\n", fattrSTStr);
+          // The reply is already swapped
+          WRITE_LONGWORD_RAW(memorySharedAddress, GEMDRIVE_FATTRIB_STATUS,
+                             entry->attribReply);
+          break;
+        } else if (volume->readOnly) {
+          DPRINTF("ERROR: Drive %c is read only\n", volume->letter);
+          errorCode = GEMDOS_EWRPRO;
         } else {
           // WE will assume here FATTRIB_SET
           // Set the attributes of the file
@@ -1809,6 +2289,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           sdcard_getAttribsSTStr(fattrSTStr, fattrNew);
           DPRINTF("New file attributes: %s\n", fattrSTStr);
           BYTE fattrFatFSNew = (BYTE)sdcard_attribsST2FAT(fattrNew);
+          statCacheInvalidate(tmpFPath);
           fr = f_chmod(tmpFPath, fattrFatFSNew, AM_RDO | AM_HID | AM_SYS);
           if (fr != FR_OK) {
             DPRINTF("ERROR: Could not set file attributes (%d)\r\n", fr);
@@ -1859,19 +2340,37 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       if (strcasecmp(drive_src, drive_dst) != 0) {
         DPRINTF("ERROR: Different drives\n");
 
-        statusCode = GEMDOS_EPTHNF;
+        statusCode = GEMDOS_ENSAME;
       } else {
         DPRINTF("Renaming file: %s to %s\n", frename_fname_src,
                 frename_fname_dst);
-        getLocalFullPathname(payloadPtr, frename_fname_src);
+        GemdriveVolume *volume =
+            getLocalFullPathname(payloadPtr, frename_fname_src);
         payloadPtr += GEMDRIVE_MAX_FOLDER_LENGTH /
                       2;  // GEMDRIVE_MAX_FOLDER_LENGTH * 2 bytes per uint16_t
-        getLocalFullPathname(payloadPtr, frename_fname_dst);
+        GemdriveVolume *dstVolume =
+            getLocalFullPathname(payloadPtr, frename_fname_dst);
         DPRINTF("Renaming file: %s to %s\n", frename_fname_src,
                 frename_fname_dst);
-        // Rename the file
-        FRESULT fr = f_rename(frename_fname_src, frename_fname_dst);
-        if (fr != FR_OK) {
+        // Rename the file. Two drives can't share a rename even if their
+        // folders are on the same card: GEMDOS has no move.
+        FRESULT fr = FR_OK;
+        if (volume->readOnly || dstVolume->readOnly) {
+          fr = FR_WRITE_PROTECTED;
+        } else if (dstVolume != volume) {
+          fr = FR_INVALID_DRIVE;
+        } else {
+          fr = f_rename(frename_fname_src, frename_fname_dst);
+        }
+        if (fr == FR_WRITE_PROTECTED) {
+          DPRINTF("ERROR: Drive %c or %c is read only\n", volume->letter,
+                  dstVolume->letter);
+          statusCode = GEMDOS_EWRPRO;
+        } else if (fr == FR_INVALID_DRIVE) {
+          DPRINTF("ERROR: Rename from drive %c to %c\n", volume->letter,
+                  dstVolume->letter);
+          statusCode = GEMDOS_ENSAME;
+        } else if (fr != FR_OK) {
           DPRINTF("ERROR: Could not rename file (%d)\r\n", fr);
           if (fr == FR_DENIED) {
             DPRINTF("ERROR: Not enough premissions to rename file\n");
@@ -1891,6 +2390,10 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           }
         } else {
           DPRINTF("File renamed\n");
+          // A folder takes the paths of its files along
+          statCacheFlush();
+          bootcache_note_write_path(frename_fname_src);
+          bootcache_note_write_path(frename_fname_dst);
           statusCode = GEMDOS_EOK;
         }
       }
@@ -1923,31 +2426,31 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
         if (fdatetimeFlag == FDATETIME_INQUIRE) {
           DPRINTF("Inquire file date and time: %s fd: %d\n", fDes->fpath,
                   fdatetimeFD);
-          FILINFO fno;
-          FRESULT ferr;
-          ferr = f_stat(fDes->fpath, &fno);
+          const GemdriveStatEntry *entry = NULL;
+          FRESULT ferr = statCacheGet(fDes->fpath, &entry);
           if (ferr == FR_OK) {
-            // File information is now in fno
+            // File information is now in entry
 #if defined(_DEBUG) && (_DEBUG != 0)
             // Save some memory and cycles if not in debug mode
             // Convert the date and time
-            unsigned int year = (fno.fdate >> 9);
-            unsigned int month = (fno.fdate >> 5) & 0x0F;
-            unsigned int day = fno.fdate & 0x1F;
+            unsigned int year = (entry->fdate >> 9);
+            unsigned int month = (entry->fdate >> 5) & 0x0F;
+            unsigned int day = entry->fdate & 0x1F;
 
-            unsigned int hour = fno.ftime >> 11;
-            unsigned int minute = (fno.ftime >> 5) & 0x3F;
-            unsigned int second = (fno.ftime & 0x1F);
+            unsigned int hour = entry->ftime >> 11;
+            unsigned int minute = (entry->ftime >> 5) & 0x3F;
+            unsigned int second = (entry->ftime & 0x1F);
 
             DPRINTF("Get file date and time: %02d:%02d:%02d %02d/%02d/%02d\n",
                     hour, minute, second * 2, day, month, year + 1980);
 #endif
             WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
                                     GEMDRIVE_FDATETIME_STATUS, GEMDOS_EOK);
-            WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
-                                    GEMDRIVE_FDATETIME_DATE, fno.fdate);
-            WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
-                                    GEMDRIVE_FDATETIME_TIME, fno.ftime);
+            // The replies are already swapped
+            WRITE_LONGWORD_RAW(memorySharedAddress, GEMDRIVE_FDATETIME_DATE,
+                               entry->dateReply);
+            WRITE_LONGWORD_RAW(memorySharedAddress, GEMDRIVE_FDATETIME_TIME,
+                               entry->timeReply);
           } else {
             DPRINTF(
                 "ERROR: Could not get file date and time from file %s "
@@ -1982,7 +2485,12 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           FILINFO fno;
           fno.fdate = DOSDate;
           fno.ftime = DOSTime;
-          FRESULT ferr = f_utime(fDes->fpath, &fno);
+          GemdriveVolume *volume = findLocalVolume(fDes->fpath);
+          FRESULT ferr = FR_WRITE_PROTECTED;
+          if ((volume == NULL) || !volume->readOnly) {
+            statCacheInvalidate(fDes->fpath);
+            ferr = f_utime(fDes->fpath, &fno);
+          }
           if (ferr == FR_OK) {
             // File exists and date and time set
             // So now we can return the status
@@ -2001,8 +2509,9 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
                 "ERROR: Could not set file date and time to file %s "
                 "(%d)\r\n",
                 fDes->fpath, ferr);
-            WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
-                                    GEMDRIVE_FDATETIME_STATUS, GEMDOS_EFILNF);
+            WRITE_AND_SWAP_LONGWORD(
+                memorySharedAddress, GEMDRIVE_FDATETIME_STATUS,
+                (ferr == FR_WRITE_PROTECTED) ? GEMDOS_EWRPRO : GEMDOS_EFILNF);
             WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
                                     GEMDRIVE_FDATETIME_DATE, 0);
             WRITE_AND_SWAP_LONGWORD(memorySharedAddress,
@@ -2056,9 +2565,10 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
       // memset((void *)(memorySharedAddress + GEMDRIVE_READ_BUFF), 0,
       //        DEFAULT_FOPEN_READ_BUFFER_SIZE);
       UINT bytesRead = 0;
-      res = f_read(&file->fobject,
-                   (void *)(memorySharedAddress + GEMDRIVE_READ_BUFF), toRead,
-                   &bytesRead);
+      res = bootcache_f_read(
+          file->cacheSource, &file->fobject,
+          (void *)(memorySharedAddress + GEMDRIVE_READ_BUFF), toRead,
+          &bytesRead);
       if (res != FR_OK) {
         DPRINTF("ERROR: f_read failed (%d)\n", res);
         WRITE_AND_SWAP_LONGWORD(memorySharedAddress, GEMDRIVE_READ_BYTES,
@@ -2121,6 +2631,7 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
           // Write the bytes
           DPRINTF("Write x%x bytes from the file at offset x%x\n", buff_size,
                   writebuff_offset);
+          detachLinkMapIfGrowing(file, (FSIZE_t)writebuff_offset + buff_size);
           ferr =
               f_write(&file->fobject, (void *)target, buff_size, &bytes_write);
           if (ferr != FR_OK) {
@@ -2211,6 +2722,48 @@ void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *lastProtocol,
 
       break;
     }
+    case GEMDRVEMUL_PEXEC_LOAD_START: {
+      uint16_t fd = TPROTO_GET_PAYLOAD_PARAM16(payloadPtr);  // d3 register
+      uint32_t textBase =
+          TPROTO_GET_NEXT32_PAYLOAD_PARAM32(payloadPtr);  // d4 register
+      DPRINTF("Pexec load FD=%u, TEXT at 0x%08x\n", fd, textBase);
+      FileDescriptors *file = getFileByFD(fdescriptors, fd);
+      int32_t status = GEMDOS_EIHNDL;
+      if (file != NULL) {
+        status = GEMDOS_EINTRN;
+        if (syncFileOffsetIfNeeded(file) == FR_OK) {
+          status = gemdrive_pexec_start(&file->fobject, file->fpath, textBase,
+                                        file->cacheSource);
+          file->offset = f_tell(&file->fobject);
+        }
+      }
+      // Negative: the Atari loads and relocates the program itself
+      WRITE_AND_SWAP_LONGWORD(memorySharedAddress, GEMDRIVE_READ_BYTES,
+                              status);
+      break;
+    }
+    case GEMDRVEMUL_PEXEC_LOAD_NEXT: {
+      uint16_t fd = TPROTO_GET_PAYLOAD_PARAM16(payloadPtr);  // d3 register
+      FileDescriptors *file = getFileByFD(fdescriptors, fd);
+      int32_t bytes = GEMDOS_EIHNDL;
+      if (file == NULL) {
+        DPRINTF("ERROR: FD %u not found\n", fd);
+        gemdrive_pexec_release();
+      } else {
+        uint8_t *readBuff =
+            (uint8_t *)(memorySharedAddress + GEMDRIVE_READ_BUFF);
+        bytes = gemdrive_pexec_next(&file->fobject, readBuff,
+                                    DEFAULT_FOPEN_READ_BUFFER_SIZE);
+        file->offset = f_tell(&file->fobject);
+      }
+      if (bytes > 0) {
+        CHANGE_ENDIANESS_BLOCK16(memorySharedAddress + GEMDRIVE_READ_BUFF,
+                                 bytes + (bytes & 1));
+      }
+      // Same as a read: relocated bytes, 0 at the end or a GEMDOS error
+      WRITE_AND_SWAP_LONGWORD(memorySharedAddress, GEMDRIVE_READ_BYTES, bytes);
+      break;
+    }
     case GEMDRVEMUL_SAVE_BASEPAGE: {
       TPROTO_NEXT32_PAYLOAD_PTR(payloadPtr);  // skip d3
       TPROTO_NEXT32_PAYLOAD_PTR(payloadPtr);  // skip d4
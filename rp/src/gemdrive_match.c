@@ -0,0 +1,82 @@
+/**
+ * File: gemdrive_match.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Fsfirst/Fsnext matcher of GEMDRIVE. Same rules as the
+ * builds() and match() functions of GEMDOS.
+ */
+
+#include "gemdrive_match.h"
+
+#include <string.h>
+
+#define MATCH_NAME_LEN 8
+#define MATCH_EXT_LEN 3
+
+// GEMDOS attributes, same as FS_ST_* in sdcard.h
+#define MATCH_ATTR_HIDDEN 0x02
+#define MATCH_ATTR_SYSTEM 0x04
+#define MATCH_ATTR_LABEL 0x08
+#define MATCH_ATTR_FOLDER 0x10
+#define MATCH_ATTR_SPECIAL                                       \
+  (MATCH_ATTR_HIDDEN | MATCH_ATTR_SYSTEM | MATCH_ATTR_LABEL | \
+   MATCH_ATTR_FOLDER)
+
+static inline uint8_t matchUpper(char c) {
+  return (c >= 'a' && c <= 'z') ? (uint8_t)(c - 'a' + 'A') : (uint8_t)c;
+}
+
+// Copy one part of the filespec to the matcher. '*' is not consumed: it
+// fills the rest of the part.
+static const char *compilePart(GemdriveMatch *match, const char *pattern,
+                               int first, int len, bool isName) {
+  int i = 0;
+  for (; i < len && *pattern && !(isName && *pattern == '.'); i++) {
+    uint8_t c = (uint8_t)'?';
+    if (*pattern != '*') c = matchUpper(*pattern++);
+    match->value[first + i] = (c == '?') ? 0 : c;
+    match->mask[first + i] = (c == '?') ? 0 : 0xFF;
+  }
+  for (; i < len; i++) {
+    match->value[first + i] = ' ';
+    match->mask[first + i] = 0xFF;
+  }
+  return pattern;
+}
+
+void gemdrive_match_compile(GemdriveMatch *match, const char *pattern,
+                            uint8_t attribs) {
+  pattern = compilePart(match, pattern, 0, MATCH_NAME_LEN, true);
+  // Skip the rest of a long name
+  while (*pattern && *pattern != '.') pattern++;
+  if (*pattern == '.') pattern++;
+  compilePart(match, pattern, MATCH_NAME_LEN, MATCH_EXT_LEN, false);
+  match->attribs = attribs;
+}
+
+bool gemdrive_match_name(const GemdriveMatch *match, const char *name) {
+  uint8_t entry[GEMDRIVE_MATCH_NAME_SIZE];
+  memset(entry, ' ', sizeof(entry));
+  int i = 0;
+  for (; *name && *name != '.'; name++) {
+    if (i < MATCH_NAME_LEN) entry[i++] = matchUpper(*name);
+  }
+  if (*name == '.') name++;
+  for (i = MATCH_NAME_LEN; *name && i < GEMDRIVE_MATCH_NAME_SIZE; name++) {
+    entry[i++] = matchUpper(*name);
+  }
+
+  for (i = 0; i < GEMDRIVE_MATCH_NAME_SIZE; i++) {
+    if ((entry[i] & match->mask[i]) != match->value[i]) return false;
+  }
+  return true;
+}
+
+bool gemdrive_match_attribs(const GemdriveMatch *match, uint8_t attribs) {
+  if (match->attribs == MATCH_ATTR_LABEL) {
+    return (attribs & MATCH_ATTR_LABEL) != 0;
+  }
+  // Every special bit of the entry must be in the search
+  return (attribs & MATCH_ATTR_SPECIAL & ~match->attribs) == 0;
+}
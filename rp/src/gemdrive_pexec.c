@@ -0,0 +1,232 @@
+/**
+ * File: gemdrive_pexec.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: GEMDRIVE program loader. Relocates the TEXT and DATA
+ * segments of a PRG file on the RP2040 while they are read from the card.
+ */
+
+#include "gemdrive_pexec.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bootcache.h"
+#include "debug.h"
+#include "gemdrive.h"
+
+#define PEXEC_MAGIC 0x601Au
+#define PEXEC_NO_FIXUP 0xFFFFFFFFu
+
+// A fixup patches a longword. The 3 bytes after a block are read with it,
+// so a longword across two blocks is patched at once.
+#define PEXEC_FIXUP_SIZE 4u
+
+typedef struct {
+  int16_t cacheSource;
+  FIL relocFile;
+  bool relocOpen;
+  uint8_t relocData[GEMDRIVE_PEXEC_RELOC_BUFFER_SIZE];
+  uint32_t relocPos;
+  uint32_t relocLen;
+
+  uint32_t textBase;
+  uint32_t segmentSize;  // TEXT + DATA
+  uint32_t nextFixup;    // Offset from the start of TEXT
+
+  uint32_t blockStart;  // Offset of block[0] from the start of TEXT
+  uint32_t blockLen;    // Bytes read into block
+  uint32_t blockReady;  // Of them, relocated and ready to send
+  uint32_t sent;        // Bytes handed out
+  uint8_t block[GEMDRIVE_PEXEC_BLOCK_SIZE + PEXEC_FIXUP_SIZE - 1];
+} PexecLoader;
+
+static PexecLoader *loader = NULL;
+
+static inline uint32_t readBe32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+         ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void writeBe32(uint8_t *p, uint32_t value) {
+  p[0] = (uint8_t)(value >> 24);
+  p[1] = (uint8_t)(value >> 16);
+  p[2] = (uint8_t)(value >> 8);
+  p[3] = (uint8_t)value;
+}
+
+static bool relocNextByte(uint8_t *value) {
+  if (loader->relocPos == loader->relocLen) {
+    UINT br = 0;
+    if (bootcache_f_read(loader->cacheSource, &loader->relocFile,
+                         loader->relocData, sizeof(loader->relocData),
+                         &br) != FR_OK) {
+      return false;
+    }
+    loader->relocPos = 0;
+    loader->relocLen = br;
+    if (br == 0) {
+      // Table without its end mark: nothing else to fix
+      *value = 0;
+      return true;
+    }
+  }
+  *value = loader->relocData[loader->relocPos++];
+  return true;
+}
+
+// Walk the relocation table to the next fixup: 0 ends the table, 1 skips
+// 254 bytes and any other value is the distance to the next fixup
+static bool relocAdvance(void) {
+  for (;;) {
+    uint8_t step;
+    if (!relocNextByte(&step)) return false;
+    if (step == 0) {
+      loader->nextFixup = PEXEC_NO_FIXUP;
+      return true;
+    }
+    if (step == 1) {
+      loader->nextFixup += 254;
+      continue;
+    }
+    loader->nextFixup += step;
+    return true;
+  }
+}
+
+static int32_t __not_in_flash_func(loadBlock)(FIL *file) {
+  // The bytes after the ready ones may have been patched already
+  uint32_t carry = loader->blockLen - loader->blockReady;
+  if (carry > 0) {
+    memmove(loader->block, loader->block + loader->blockReady, carry);
+  }
+  loader->blockStart += loader->blockReady;
+  loader->blockLen = carry;
+  loader->blockReady = 0;
+
+  uint32_t wanted = sizeof(loader->block);
+  uint32_t pending = loader->segmentSize - loader->blockStart;
+  if (wanted > pending) wanted = pending;
+  UINT br = 0;
+  FRESULT res = bootcache_f_read(loader->cacheSource, file,
+                                 loader->block + carry, wanted - carry, &br);
+  if (res != FR_OK || br != wanted - carry) {
+    DPRINTF("ERROR: Could not read the program (%d)\n", res);
+    return GEMDOS_EREADF;
+  }
+  loader->blockLen = wanted;
+  loader->blockReady =
+      (wanted == pending) ? wanted : GEMDRIVE_PEXEC_BLOCK_SIZE;
+
+  uint32_t limit = loader->blockStart + loader->blockReady;
+  while (loader->nextFixup < limit) {
+    if (loader->segmentSize - loader->nextFixup < PEXEC_FIXUP_SIZE) {
+      DPRINTF("ERROR: Fixup out of the program at 0x%x\n", loader->nextFixup);
+      return GEMDOS_EPLFMT;
+    }
+    uint8_t *p = loader->block + (loader->nextFixup - loader->blockStart);
+    writeBe32(p, readBe32(p) + loader->textBase);
+    if (!relocAdvance()) return GEMDOS_EREADF;
+  }
+  return GEMDOS_EOK;
+}
+
+int32_t gemdrive_pexec_start(FIL *file, const char *fpath, uint32_t textBase,
+                             int16_t cacheSource) {
+  gemdrive_pexec_release();
+
+  FSIZE_t position = f_tell(file);
+  uint8_t header[GEMDRIVE_PEXEC_HEADER_SIZE] = {0};
+  UINT br = 0;
+  int32_t status = GEMDOS_EOK;
+  FRESULT res = f_lseek(file, 0);
+  if (res == FR_OK) {
+    res = bootcache_f_read(cacheSource, file, header, sizeof(header), &br);
+  }
+  if (res != FR_OK || br != sizeof(header)) {
+    status = GEMDOS_EREADF;
+  } else if (((header[0] << 8) | header[1]) != PEXEC_MAGIC) {
+    status = GEMDOS_EPLFMT;
+  }
+
+  uint32_t text = readBe32(header + 2);
+  uint32_t data = readBe32(header + 6);
+  uint32_t syms = readBe32(header + 14);
+  bool relocatable = ((header[26] << 8) | header[27]) == 0;
+  uint64_t segmentEnd = (uint64_t)GEMDRIVE_PEXEC_HEADER_SIZE + text + data;
+  if (status == GEMDOS_EOK && segmentEnd > f_size(file)) {
+    status = GEMDOS_EPLFMT;
+  }
+  if (status == GEMDOS_EOK) {
+    loader = malloc(sizeof(PexecLoader));
+    if (loader == NULL) status = GEMDOS_ENSMEM;
+  }
+  if (status == GEMDOS_EOK) {
+    memset(loader, 0, offsetof(PexecLoader, block));
+    loader->cacheSource = cacheSource;
+    loader->textBase = textBase;
+    loader->segmentSize = text + data;
+    loader->nextFixup = PEXEC_NO_FIXUP;
+    if (relocatable) {
+      // The table follows the symbols. First a longword with the offset of
+      // the first fixup, 0 if there are none.
+      res = f_open(&loader->relocFile, fpath, FA_READ);
+      if (res == FR_OK) {
+        loader->relocOpen = true;
+        res = f_lseek(&loader->relocFile, segmentEnd + syms);
+      }
+      uint8_t first[4];
+      if (res == FR_OK) {
+        res = bootcache_f_read(cacheSource, &loader->relocFile, first, 4, &br);
+      }
+      if (res != FR_OK) {
+        status = GEMDOS_EREADF;
+      } else if (br == sizeof(first) && readBe32(first) != 0) {
+        loader->nextFixup = readBe32(first);
+      }
+    }
+  }
+
+  if (status != GEMDOS_EOK) {
+    DPRINTF("Program not loaded by the RP2040: %d\n", status);
+    gemdrive_pexec_release();
+    (void)f_lseek(file, position);
+    return status;
+  }
+  // The file is now at the start of TEXT
+  DPRINTF("Loading program: TEXT+DATA 0x%x bytes at 0x%x, fixups: %s\n",
+          loader->segmentSize, textBase,
+          loader->nextFixup == PEXEC_NO_FIXUP ? "no" : "yes");
+  return GEMDOS_EOK;
+}
+
+int32_t __not_in_flash_func(gemdrive_pexec_next)(FIL *file, uint8_t *buffer,
+                                                 uint32_t size) {
+  if (loader == NULL) return GEMDOS_EINTRN;
+  if (loader->sent == loader->segmentSize) {
+    gemdrive_pexec_release();
+    return 0;
+  }
+  if (loader->sent == loader->blockStart + loader->blockReady) {
+    int32_t status = loadBlock(file);
+    if (status != GEMDOS_EOK) {
+      gemdrive_pexec_release();
+      return status;
+    }
+  }
+
+  uint32_t count = loader->blockStart + loader->blockReady - loader->sent;
+  if (count > size) count = size;
+  memcpy(buffer, loader->block + (loader->sent - loader->blockStart), count);
+  loader->sent += count;
+  return (int32_t)count;
+}
+
+void gemdrive_pexec_release(void) {
+  if (loader == NULL) return;
+  if (loader->relocOpen) f_close(&loader->relocFile);
+  free(loader);
+  loader = NULL;
+}
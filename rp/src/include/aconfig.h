@@ -29,6 +29,14 @@
 #define ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER "GEMDRIVE_FOLDER"
 #define ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE "GEMDRIVE_DRIVE"
 #define ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY "GEMDRIVE_READONLY"
+// Extra drive letters, each rooted at its own folder. Empty folder to leave
+// the drive off.
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_2 "GEMDRIVE_FOLDER_2"
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_2 "GEMDRIVE_DRIVE_2"
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_2 "GEMDRIVE_READONLY_2"
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_3 "GEMDRIVE_FOLDER_3"
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_3 "GEMDRIVE_DRIVE_3"
+#define ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_3 "GEMDRIVE_READONLY_3"
 
 // ACSI configuration
 #define ACONFIG_PARAM_DRIVES_ACSI_ENABLED "ACSI_ENABLED"
@@ -38,6 +46,13 @@
 // with a real ACSI driver that already owns C:/D:/...
 #define ACONFIG_PARAM_DRIVES_ACSI_DRIVE "ACSI_DRIVE"
 #define ACONFIG_PARAM_DRIVES_ACSI_IMAGE "ACSI_IMAGE"
+// Extra images on their own ACSI IDs. Empty to leave the target off.
+#define ACONFIG_PARAM_DRIVES_ACSI_IMAGE_2 "ACSI_IMAGE_2"
+#define ACONFIG_PARAM_DRIVES_ACSI_ID_2 "ACSI_ID_2"
+#define ACONFIG_PARAM_DRIVES_ACSI_IMAGE_3 "ACSI_IMAGE_3"
+#define ACONFIG_PARAM_DRIVES_ACSI_ID_3 "ACSI_ID_3"
+// Prefetch file reads along their FAT16 cluster chain (8 KB of RAM)
+#define ACONFIG_PARAM_DRIVES_ACSI_READAHEAD "ACSI_READAHEAD"
 
 // FLOPPY configuration
 #define ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED "FLOPPY_ENABLED"
@@ -56,6 +71,20 @@
 #define ACONFIG_PARAM_DRIVES_FLOPPY_BOOT_ENABLED "FLOPPY_BOOT"
 #define ACONFIG_PARAM_DRIVES_FLOPPY_XBIOS_ENABLED "FLOPPY_XBIOS"
 
+// USB mass storage while the emulation runs
+#define ACONFIG_PARAM_DRIVES_USB_RUNTIME "USB_RUNTIME"
+#define ACONFIG_PARAM_DRIVES_USB_RUNTIME_RW "USB_RUNTIME_RW"
+
+// Keep the sectors and files read during a boot in flash for the next one
+#define ACONFIG_PARAM_DRIVES_BOOT_CACHE "BOOT_CACHE"
+
+// Diagnostics
+#define ACONFIG_PARAM_DRIVES_ROM3_CAPTURE "ROM3_CAPTURE"
+
+// Clock and voltage profile of each boot mode (see perfprofile.h)
+#define ACONFIG_PARAM_PERF_PROFILE "PERF_PROFILE"
+#define ACONFIG_PARAM_PERF_PROFILE_SETUP "PERF_PROFILE_SETUP"
+
 #define ACONFIG_SUCCESS 0
 #define ACONFIG_INIT_ERROR -1
 #define ACONFIG_MISMATCHED_APP -2
@@ -70,6 +99,7 @@
 
 enum {
   ACONFIG_BUFFER_SIZE = 4096,
+  ACONFIG_OVERFLOW_SIZE = 4096,  // APP_CONFIG_OVERFLOW_FLASH in memmap_rp.ld
   ACONFIG_MAGIC_NUMBER = 0x1234,
   ACONFIG_VERSION_NUMBER = 0x0001
 };
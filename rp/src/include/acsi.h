@@ -16,6 +16,7 @@
 #include <stdio.h>
 
 #include "aconfig.h"
+#include "acsi_sparse.h"
 #include "chandler.h"
 #include "constants.h"
 #include "debug.h"
@@ -151,10 +152,16 @@ _Static_assert(ACSIEMUL_IMAGE_BUFFER_SIZE >= 512u,
 // is allocated per open context and holds (count, cluster) pairs plus a
 // terminator. Contiguous images need ~3 entries; fragmented ones need
 // 2*fragment_count+1. Cap the allocation so a pathologically fragmented
-// image falls back to linear lseek instead of exhausting the heap.
+// image falls back to linear lseek instead of exhausting the heap. The cap
+// is shared by the configured targets: each image gets an equal slice.
 #define ACSI_IMAGE_CLTBL_INITIAL 32u
 #define ACSI_IMAGE_CLTBL_MAX 512u
 
+// Images served at once, each on its own ACSI ID (ACSI_IMAGE/ACSI_ID, then
+// ACSI_IMAGE_2/ACSI_ID_2 and so on). Their partitions take consecutive
+// drive letters from ACSI_DRIVE on.
+#define ACSI_MAX_TARGETS 3u
+
 typedef struct {
   FIL file;
   char imagePath[MAX_FILENAME_LENGTH + 1];
@@ -164,6 +171,8 @@ typedef struct {
   bool readOnly;
   DWORD *cltbl;           // NULL when fastseek is unavailable for this image
   size_t cltblEntries;    // allocated size in DWORDs (0 when cltbl is NULL)
+  AcsiSparse *sparse;     // NULL for a plain image
+  int16_t cacheSource;    // Boot snapshot handle of the image
 } AcsiImageContext;
 
 typedef struct {
@@ -225,6 +234,10 @@ void acsi_preInit(void);
 void __not_in_flash_func(acsi_loop)(TransmissionProtocol *lastProtocol,
                                     uint16_t *payloadPtr);
 void __not_in_flash_func(acsi_tick)(void);
+// Flush and close the image before the SD card is unmounted, and report a
+// media change on all the ACSI drives once it is back.
+void acsi_release(void);
+void acsi_resume(void);
 
 // Boot-time summary callback signature. Called with user-visible lines
 // describing the loaded ACSI image and its detected partitions, so the
@@ -237,4 +250,9 @@ typedef void (*AcsiBootInfoPrint)(const char *message);
 // when ACSI is disabled — it will just print a one-line notice.
 void acsi_printBootInfo(AcsiBootInfoPrint print);
 
+// Check the partition tables and FAT16 volumes of the configured images
+// and report them line by line. Run on request from the setup terminal,
+// never on the boot path. The SD card must be mounted.
+void acsi_runImageTests(AcsiBootInfoPrint print);
+
 #endif  // ACSI_H
@@ -0,0 +1,74 @@
+/**
+ * File: acsi_index.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the ACSI FAT16 read-ahead index. Keeps a
+ * lazily built RAM index of the directories and cluster chains the Atari
+ * touches so reads can be prefetched along each file's own FAT chain.
+ */
+
+#ifndef ACSI_INDEX_H
+#define ACSI_INDEX_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "acsi.h"
+#include "debug.h"
+#include "ff.h"
+#include "pico/stdlib.h"
+
+// Directory entries kept in the index, shared by all the drives. Entries
+// are recorded as the Atari reads directory sectors, so only the root and
+// the subdirectories actually visited are indexed. When the table is full
+// the oldest entries are overwritten.
+#define ACSI_INDEX_FILES 64u
+
+// Files with a cluster chain in RAM (least recently used is replaced)
+#define ACSI_INDEX_CHAINS 4u
+
+// Contiguous runs kept per chain window, and clusters walked per window.
+// A window slides forward along the FAT when the reads reach its end.
+#define ACSI_INDEX_CHAIN_RUNS 32u
+#define ACSI_INDEX_WINDOW_CLUSTERS 256u
+
+// Physical (512-byte) sectors held by the read-ahead buffer. 8 KB covers
+// one logical sector of the largest supported size.
+#define ACSI_READAHEAD_SECTORS 16u
+
+// Reset the runtime state and allocate the read-ahead buffer. The drive
+// geometries registered with acsi_index_set_drive are kept. When enabled is
+// false (or the buffer cannot be allocated) every call below is a no-op and
+// reads go straight to the image.
+void acsi_index_init(AcsiImageContext *context, bool enabled);
+
+// Forget every drive geometry and all the indexed data.
+void acsi_index_clear_drives(void);
+
+// Register the DOS view FAT16 geometry of an announced drive. ratio is the
+// logical to physical sector ratio of the partition.
+void acsi_index_set_drive(uint16_t driveNumber,
+                          const AcsiFat16Geometry *geometry, uint16_t ratio);
+
+// Read physical sectors for a drive. Sectors already prefetched are copied
+// from RAM, the rest are read from the image. A successful read also feeds
+// the index: the entries of directory sectors are recorded, and a read of
+// an indexed file schedules the prefetch of the next sectors of its chain.
+FRESULT acsi_index_read_sectors(AcsiImageContext *context,
+                                uint16_t driveNumber, uint32_t lba,
+                                uint16_t sectorCount, void *buffer,
+                                size_t bufferSize);
+
+// Must be called before writing physical sectors of a drive. Drops the
+// prefetched copies of the sectors and, when the write touches the FAT or a
+// directory, the indexed data of that drive.
+void acsi_index_note_write(uint16_t driveNumber, uint32_t lba,
+                           uint16_t sectorCount);
+
+// Idle work: build the next chain window or prefetch the next sectors of
+// the file being read. At most one SD access burst per call.
+void acsi_index_tick(void);
+
+#endif  // ACSI_INDEX_H
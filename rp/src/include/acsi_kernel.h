@@ -0,0 +1,52 @@
+/**
+ * File: acsi_kernel.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the ACSI sector kernels. There is one
+ * kernel per logical sector size (512 to 8192 bytes). Each drive gets its
+ * kernel when it is mounted. Every read and write then maps its sectors
+ * with shifts and byte swaps them with a loop sized for that sector.
+ */
+
+#ifndef ACSI_KERNEL_H
+#define ACSI_KERNEL_H
+
+#include <inttypes.h>
+#include <stddef.h>
+
+// Physical sectors of the images are always 512 bytes
+#define ACSI_KERNEL_PHYSICAL_SHIFT 9u
+
+// Sizes with a kernel, from 512 to 8192 bytes: the largest logical sector
+// the BCB rebind pool of the Atari driver can hold
+#define ACSI_KERNEL_COUNT 5u
+
+// Byte swap of the 16-bit words of whole logical sectors, in place. The
+// buffer must be 4-byte aligned.
+typedef void (*AcsiKernelSwapFn)(void *buffer, uint32_t sectors);
+
+typedef struct {
+  uint16_t sectorSize;    // Logical sector in bytes
+  uint8_t sectorShift;    // log2(sectorSize)
+  uint8_t ratioShift;     // log2(physical sectors per logical sector)
+  AcsiKernelSwapFn swap;  // Sized for sectorSize
+} AcsiSectorKernel;
+
+// Kernel of a logical sector size, NULL when the size is not supported
+const AcsiSectorKernel *acsi_kernel_get(uint32_t logicalSectorSize);
+
+// Kernel by index, for the benchmarks. NULL past the last one.
+const AcsiSectorKernel *acsi_kernel_at(uint8_t index);
+
+static inline uint32_t acsi_kernel_bytes(const AcsiSectorKernel *kernel,
+                                         uint32_t sectors) {
+  return sectors << kernel->sectorShift;
+}
+
+static inline uint32_t acsi_kernel_physical(const AcsiSectorKernel *kernel,
+                                            uint32_t sectors) {
+  return sectors << kernel->ratioShift;
+}
+
+#endif  // ACSI_KERNEL_H
@@ -0,0 +1,80 @@
+/**
+ * File: acsi_scancache.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the ACSI partition scan cache. The drives,
+ * BPBs and FAT16 geometries found in the configured images are kept in a
+ * flash sector, so the next boot with the same images skips the scan.
+ */
+
+#ifndef ACSI_SCANCACHE_H
+#define ACSI_SCANCACHE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Size of the ACSI_SCAN_FLASH region in memmap_rp.ld
+#define ACSI_SCANCACHE_FLASH_SIZE 4096u
+
+// How long a flash write waits for core 1 to stop
+#define ACSI_SCANCACHE_FLASH_TIMEOUT_MS 100u
+
+// The last page of the sector is cleared when the cached scan goes stale,
+// without erasing the sector
+#define ACSI_SCANCACHE_REVOKE_OFFSET (ACSI_SCANCACHE_FLASH_SIZE - 256u)
+
+#define ACSI_SCANCACHE_MAGIC 0x4E435341u  // "ASCN"
+#define ACSI_SCANCACHE_VERSION 1u
+
+// Sector ranges read by the scan. A write to one of them makes the cached
+// scan stale. If the reads do not fit, any write does.
+#define ACSI_SCANCACHE_MAX_RANGES 64u
+#define ACSI_SCANCACHE_ALL_SECTORS 0xFFFFu
+
+typedef struct {
+  uint32_t lba;
+  uint16_t sectors;
+  uint8_t target;
+  uint8_t reserved;
+} AcsiScanRange;
+
+// The results of the scan, as given by acsi.c, follow the header
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t checksum;  // Of the fields below and the results
+  uint32_t key;
+  uint16_t resultsSize;
+  uint16_t rangeCount;  // Or ACSI_SCANCACHE_ALL_SECTORS
+  AcsiScanRange ranges[ACSI_SCANCACHE_MAX_RANGES];
+} AcsiScanCacheHeader;
+
+// FNV-1a step, to build the key of the configured images
+uint32_t acsi_scancache_hash(uint32_t hash, const void *data, size_t size);
+#define ACSI_SCANCACHE_HASH_SEED 2166136261u
+
+// With enabled false nothing is read from or written to the flash, and
+// every scan runs in full.
+void acsi_scancache_init(bool enabled);
+
+// Copy the cached results when their key and size match and no write made
+// them stale. The sectors read by that scan are watched from then on.
+bool acsi_scancache_load(uint32_t key, void *results, size_t size);
+
+// Trace the sectors read by a full scan. The target is the image the next
+// reads come from.
+void acsi_scancache_trace_start(void);
+void acsi_scancache_trace_target(uint8_t target);
+void acsi_scancache_trace_read(uint32_t lba, uint16_t sectors);
+
+// Write the results of the traced scan to the flash, and watch its sectors
+void acsi_scancache_store(uint32_t key, const void *results, size_t size);
+
+// A target is about to write sectors. The cached scan is revoked if it
+// read any of them.
+void acsi_scancache_note_write(uint8_t target, uint32_t lba,
+                               uint16_t sectors);
+
+#endif  // ACSI_SCANCACHE_H
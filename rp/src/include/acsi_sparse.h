@@ -0,0 +1,72 @@
+/**
+ * File: acsi_sparse.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the sparse ACSI image container. Only the
+ * blocks with data are stored in the file, so a fresh 2 GB image takes a
+ * few KB on the SD card. Blocks never written read as zeros without SD
+ * access, and zero sectors written to them are dropped. Plain images are
+ * converted with scripts/atari-hd/acsi_sparse.py.
+ */
+
+#ifndef ACSI_SPARSE_H
+#define ACSI_SPARSE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "ff.h"
+
+// Layout of the container, all fields little endian:
+//   sector 0: header
+//   sector 1: map, one uint32_t per block of the image. 0 is a hole, n is
+//             the n-th data block of the file.
+//   dataSector: data blocks, in the order they were allocated
+#define ACSI_SPARSE_MAGIC "SDSPARSE"
+#define ACSI_SPARSE_MAGIC_SIZE 8
+#define ACSI_SPARSE_VERSION 1u
+#define ACSI_SPARSE_MAP_SECTOR 1u
+
+// Bitmap of allocated blocks held in RAM. 131072 blocks of 32 KB cover a
+// 4 GB image with a 16 KB bitmap.
+#define ACSI_SPARSE_MAX_BLOCKS 131072u
+
+typedef struct {
+  char magic[ACSI_SPARSE_MAGIC_SIZE];
+  uint16_t version;
+  uint16_t sectorSize;    // Always 512
+  uint32_t blockSectors;  // Power of two
+  uint32_t totalSectors;  // Size of the image the Atari sees
+  uint32_t blockCount;
+  uint32_t mapSector;
+  uint32_t dataSector;  // Multiple of blockSectors
+} AcsiSparseHeader;
+
+typedef struct AcsiSparse AcsiSparse;
+
+// Check the header of an open image. Returns FR_OK with *sparseOut set to
+// NULL for a plain image, or with the container ready and *totalSectorsOut
+// set to its size. FR_NOT_ENOUGH_CORE if the bitmap does not fit.
+FRESULT acsi_sparse_open(FIL *file, AcsiSparse **sparseOut,
+                         uint32_t *totalSectorsOut);
+
+void acsi_sparse_close(AcsiSparse *sparse);
+
+// Read and write 512-byte sectors of the image. The caller checks the
+// range.
+FRESULT acsi_sparse_read(AcsiSparse *sparse, FIL *file, uint32_t lba,
+                         uint16_t sectorCount, void *buffer);
+FRESULT acsi_sparse_write(AcsiSparse *sparse, FIL *file, uint32_t lba,
+                          uint16_t sectorCount, const void *buffer);
+
+// Growing the file turns the fastseek link map of the FIL off. true until
+// acsi_sparse_linkmap_rebuilt is called, once the map is built again.
+bool acsi_sparse_linkmap_stale(const AcsiSparse *sparse);
+void acsi_sparse_linkmap_rebuilt(AcsiSparse *sparse);
+
+// Blocks with data and blocks of the image, for the boot summary
+uint32_t acsi_sparse_allocated_blocks(const AcsiSparse *sparse);
+uint32_t acsi_sparse_block_count(const AcsiSparse *sparse);
+
+#endif  // ACSI_SPARSE_H
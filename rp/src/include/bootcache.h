@@ -0,0 +1,115 @@
+/**
+ * File: bootcache.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the boot snapshot. The sectors of the ACSI
+ * images and the chunks of the GEMDRIVE files read during a boot are
+ * recorded, written to a spare region of the flash once the Atari is idle,
+ * and served from XIP flash on the next boot, as long as the image or file
+ * keeps its size and date.
+ */
+
+#ifndef BOOTCACHE_H
+#define BOOTCACHE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "ff.h"
+
+// Size of the BOOT_CACHE_FLASH region in memmap_rp.ld. The first 4 KB
+// sector holds the index, the rest the data.
+#define BOOTCACHE_FLASH_SIZE (64u * 1024u)
+#define BOOTCACHE_SECTOR_SIZE 4096u
+#define BOOTCACHE_DATA_SIZE (BOOTCACHE_FLASH_SIZE - BOOTCACHE_SECTOR_SIZE)
+
+// The last page of the index sector marks the sources written since the
+// snapshot was taken, one byte each, without erasing the sector
+#define BOOTCACHE_REVOKE_OFFSET (BOOTCACHE_SECTOR_SIZE - 256u)
+
+#define BOOTCACHE_MAGIC 0x48435442u  // "BTCH"
+#define BOOTCACHE_VERSION 1u
+
+// Images and files, and ranges of them, in a snapshot
+#define BOOTCACHE_MAX_SOURCES 16u
+#define BOOTCACHE_MAX_CHUNKS 192u
+
+// Longest path of a source that can be recorded
+#define BOOTCACHE_PATH_SIZE 128u
+
+// The recording stops this long after the first read, or when the data
+// area is full. The snapshot is written once no read came for
+// BOOTCACHE_IDLE_MS.
+#define BOOTCACHE_RECORD_MS 30000u
+#define BOOTCACHE_IDLE_MS 2000u
+
+// How long a flash write waits for core 1 to stop
+#define BOOTCACHE_FLASH_TIMEOUT_MS 100u
+
+#define BOOTCACHE_NO_SOURCE (-1)
+
+// Units of the ranges of a source: sectors for images, bytes for files
+#define BOOTCACHE_UNIT_SECTOR 9u
+#define BOOTCACHE_UNIT_BYTE 0u
+
+typedef struct {
+  uint32_t hash;   // Of the path, not case sensitive
+  uint32_t mtime;  // FAT date in the high word, time in the low one
+  uint64_t size;   // Of the file
+  uint8_t unitShift;
+  uint8_t reserved[7];
+} BootcacheSourceInfo;
+
+typedef struct {
+  uint32_t start;       // In units of the source
+  uint32_t length;      // Bytes
+  uint32_t dataOffset;  // From the start of the data area
+  uint8_t source;
+  uint8_t reserved[3];
+} BootcacheChunk;
+
+// Index sector. Chunks are sorted by source and start.
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t checksum;  // Of the fields below
+  uint16_t sourceCount;
+  uint16_t chunkCount;
+  uint32_t dataBytes;
+  BootcacheSourceInfo sources[BOOTCACHE_MAX_SOURCES];
+  BootcacheChunk chunks[BOOTCACHE_MAX_CHUNKS];
+} BootcacheIndex;
+
+// Validate the snapshot in flash and start recording. With enabled false
+// every call below is a no-op.
+void bootcache_init(bool enabled);
+
+// Register an image or file about to be read. Returns the handle to pass
+// to the calls below, or BOOTCACHE_NO_SOURCE.
+int16_t bootcache_open_source(const char *path, FSIZE_t size, WORD fdate,
+                              WORD ftime, uint8_t unitShift);
+
+// Copy bytes at start from the snapshot. false if they are not in it; the
+// caller reads them and calls bootcache_record.
+bool bootcache_read(int16_t source, uint32_t start, uint32_t bytes,
+                    void *buffer);
+
+// Note bytes at start read from the card, for the next snapshot
+void bootcache_record(int16_t source, uint32_t start, uint32_t bytes);
+
+// f_read of a source file, from the snapshot when possible. The file
+// position moves as with f_read.
+FRESULT bootcache_f_read(int16_t source, FIL *fp, void *buff, UINT btr,
+                         UINT *br);
+
+// A source, or the file at path, is about to change. It is not served
+// again until a new snapshot is taken.
+void bootcache_note_write(int16_t source);
+void bootcache_note_write_path(const char *path);
+
+// Idle work: close the recording and write the snapshot, one flash sector
+// per call
+void bootcache_tick(void);
+
+#endif  // BOOTCACHE_H
@@ -61,16 +61,27 @@
 typedef void (*CommandCallback)(TransmissionProtocol *protocol,
                                 uint16_t *payloadPtr);
 
+// Callbacks registered at once. Their nodes are static: registering never
+// touches the heap.
+#define CHANDLER_MAX_CALLBACKS 8
+
 // Node for linked list of callbacks
 typedef struct CommandCallbackNode {
   CommandCallback cb;
   struct CommandCallbackNode *next;
 } CommandCallbackNode;
 
+// Bit of an app ID in the chandler_setSuspendedApps mask
+#define CHANDLER_APP_BIT(appId) (1u << ((appId) & 0x1Fu))
+
 // Function Prototypes
 void chandler_init();
 void __not_in_flash_func(chandler_loop)();
 
 void __not_in_flash_func(chandler_addCB)(CommandCallback cb);
 
+// Drop the commands of the apps in the mask without answering them, e.g.
+// while the SD card is lent to the USB host. 0 resumes all the apps.
+void chandler_setSuspendedApps(uint32_t appMask);
+
 #endif  // CHANDLER_H
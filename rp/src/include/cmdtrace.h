@@ -0,0 +1,113 @@
+/**
+ * File: cmdtrace.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the command trace ring. Records every
+ * protocol dispatched by the command handler so hangs and slow loads can be
+ * reconstructed afterwards from a dump on the SD card.
+ */
+
+#ifndef CMDTRACE_H
+#define CMDTRACE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "constants.h"
+#include "debug.h"
+#include "ff.h"
+#include "pico/stdlib.h"
+
+// Must be a power of two: the write index is masked, never divided.
+#define CMDTRACE_ENTRIES_BITS 8
+#define CMDTRACE_ENTRIES (1u << CMDTRACE_ENTRIES_BITS)
+#define CMDTRACE_ENTRIES_MASK (CMDTRACE_ENTRIES - 1u)
+
+// Number of 32-bit payload parameters stored per entry (after the token)
+#define CMDTRACE_PARAMS 4
+
+#define CMDTRACE_MAGIC 0x54524143u  // "TRAC"
+#define CMDTRACE_VERSION 2u
+
+#define CMDTRACE_DUMP_PATH "/cmdtrace.bin"
+
+// Result value recorded when the handler does not report one
+#define CMDTRACE_RESULT_NONE 0
+
+// 36 bytes per entry. The layout is mirrored by scripts/cmdtrace/cmdtrace.py
+// (little endian, as stored in the RP2040 RAM).
+typedef struct {
+  uint32_t timestampUs;  // time_us_32() when the handler started
+  uint16_t commandId;    // Protocol command ID (APP_xxx << 8 | cmd)
+  uint16_t payloadSize;  // Payload size in bytes, random token included
+  uint32_t params[CMDTRACE_PARAMS];  // First payload params after the token
+  uint32_t durationUs;               // Time spent in the callbacks
+  uint32_t waitUs;  // At most this long received before the dispatch
+  int16_t result;                    // Result reported by the handler
+  uint16_t session;                  // Boot session that recorded the entry
+} CmdTraceEntry;
+
+// 16 bytes header written before the entries in the dump file
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entrySize;
+  uint32_t count;    // Valid entries in the dump, oldest first
+  uint32_t dropped;  // Entries overwritten before the dump
+} CmdTraceFileHeader;
+
+/**
+ * @brief Initializes the trace ring.
+ *
+ * The ring lives in uninitialized RAM so the trace of a hung session
+ * survives the watchdog reset back to the setup terminal. When the magic is
+ * valid the old entries are kept and a new session number is started.
+ */
+void cmdtrace_init(void);
+
+/**
+ * @brief Opens a new trace entry for the protocol about to be dispatched.
+ *
+ * @param commandId The protocol command ID.
+ * @param payloadSize The payload size in bytes.
+ * @param payloadPtr Pointer to the first parameter after the random token.
+ * @param waitUs Time the main loop was away from the ROM3 bus before the
+ * command was seen, the most it could have waited.
+ */
+void __not_in_flash_func(cmdtrace_begin)(uint16_t commandId,
+                                         uint16_t payloadSize,
+                                         const uint16_t *payloadPtr,
+                                         uint32_t waitUs);
+
+/**
+ * @brief Records the result code of the command being dispatched.
+ *
+ * Handlers that publish a status to the ST call it. The last call before
+ * cmdtrace_end wins.
+ *
+ * @param result The result code.
+ */
+void __not_in_flash_func(cmdtrace_setResult)(int32_t result);
+
+/**
+ * @brief Closes the current trace entry and stores the handler duration.
+ */
+void __not_in_flash_func(cmdtrace_end)(void);
+
+/**
+ * @brief Returns the number of valid entries in the ring.
+ */
+uint32_t cmdtrace_getCount(void);
+
+/**
+ * @brief Writes the ring to a binary file, oldest entry first.
+ *
+ * @param path Destination path on the SD card.
+ * @param count Optional output with the number of entries written.
+ * @return FR_OK on success, or the FatFS error.
+ */
+FRESULT cmdtrace_dumpToFile(const char *path, uint32_t *count);
+
+#endif  // CMDTRACE_H
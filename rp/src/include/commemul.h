@@ -12,11 +12,90 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "ff.h"
 #include "pico/stdlib.h"
 
+// ROM3 capture file. Decoded by scripts/rom3replay on the host.
+#define COMMEMUL_CAPTURE_PATH "/rom3cap.bin"
+#define COMMEMUL_CAPTURE_MAGIC 0x50433352u  // "R3CP"
+#define COMMEMUL_CAPTURE_VERSION 2u
+
+// Records per half buffer. Two halves of 4 bytes records: 16 KB, allocated
+// only while a capture is running.
+#define COMMEMUL_CAPTURE_HALF_RECORDS 2048u
+
+// A record is {raw sample, microseconds since the previous record}. Deltas
+// saturate at COMMEMUL_CAPTURE_DELTA_MAX, still far above the 10 ms parser
+// restart. COMMEMUL_CAPTURE_DELTA_GAP marks lost samples: the sample field
+// then holds how many were dropped (saturated at 0xFFFF).
+#define COMMEMUL_CAPTURE_DELTA_MAX 0xFFFEu
+#define COMMEMUL_CAPTURE_DELTA_GAP 0xFFFFu
+
+typedef struct {
+  uint16_t sample;
+  uint16_t deltaUs;
+} CommEmulCaptureRecord;
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t pioDivider256;  // Divider of the sampling PIO, in 1/256 units
+  uint32_t sysClockKhz;    // System clock when the capture started
+} CommEmulCaptureHeader;
+
 typedef void (*CommEmulSampleCallback)(uint16_t sample);
 
 void commemul_init(void);
 void __not_in_flash_func(commemul_poll)(CommEmulSampleCallback callback);
 
+/**
+ * @brief Tells whether the DMA ring holds samples not consumed yet.
+ *
+ * @return true if the Atari sent something since the last commemul_poll.
+ */
+bool __not_in_flash_func(commemul_hasPendingSamples)(void);
+
+/**
+ * @brief Returns time_us_32() of the last commemul_poll that consumed
+ * samples. Used to find the quiet gaps between Atari commands.
+ */
+uint32_t __not_in_flash_func(commemul_getLastSampleUs)(void);
+
+/**
+ * @brief Starts logging every ROM3 sample consumed by commemul_poll.
+ *
+ * Samples are stored raw, as read from the DMA ring, with the time elapsed
+ * since the previous one. Only meant for diagnostics: it costs 16 KB of heap
+ * and SD card writes while the emulation runs.
+ *
+ * @param path Destination file on the SD card. Overwritten.
+ * @return FR_OK on success, or the FatFS error.
+ */
+FRESULT commemul_captureStart(const char *path);
+
+/**
+ * @brief Starts the capture again after the SD card comes back from the USB
+ * host.
+ *
+ * The records go after the ones already in the file. A file that is not a
+ * capture of this version is overwritten, as in commemul_captureStart.
+ *
+ * @param path Destination file on the SD card.
+ * @return FR_OK on success, or the FatFS error.
+ */
+FRESULT commemul_captureResume(const char *path);
+
+/**
+ * @brief Writes the full capture half buffers to the SD card.
+ *
+ * Call it from the main loop, never from commemul_poll callbacks.
+ */
+void commemul_captureTick(void);
+
+/**
+ * @brief Flushes the pending records and closes the capture file.
+ */
+void commemul_captureStop(void);
+
 #endif  // COMMEMUL_H
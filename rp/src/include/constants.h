@@ -126,6 +126,9 @@
 // NOLINTBEGIN(readability-identifier-naming)
 extern unsigned int __flash_binary_start;
 extern unsigned int _rom_temp_start;
+extern unsigned int _app_config_overflow_flash_start;
+extern unsigned int _acsi_scan_flash_start;
+extern unsigned int _boot_cache_flash_start;
 extern unsigned int _booster_app_flash_start;
 extern unsigned int _config_flash_start;
 extern unsigned int _global_lookup_flash_start;
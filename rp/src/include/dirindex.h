@@ -0,0 +1,68 @@
+/**
+ * File: dirindex.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the sorted folder index of the setup browser.
+ * The entries of a folder are sorted once into an index file on the SD card
+ * and then read a page at a time, so folders with thousands of images open
+ * at once. The index is built again when the names in the folder change.
+ * While a USB host has the card, nothing is written: up to
+ * DIRINDEX_RUN_ENTRIES entries are sorted in RAM instead.
+ */
+
+#ifndef DIRINDEX_H
+#define DIRINDEX_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "ff.h"
+#include "sdcard.h"
+
+// Hidden folder of the SD card with the index files
+#define DIRINDEX_FOLDER "/.dirindex"
+
+// Entries sorted in RAM at once while building an index, and runs merged at
+// once. Both share the same buffer.
+#define DIRINDEX_RUN_ENTRIES 256
+#define DIRINDEX_MERGE_WAYS 32
+
+#define DIRINDEX_NOT_FOUND 0xFFFFFFFFu
+
+typedef struct {
+  FIL file;
+  char (*ram)[MAX_FILENAME_LENGTH + 1];  // Entries sorted in RAM, or NULL
+  bool open;
+  bool parent;     // ".." shown before the entries
+  uint32_t count;  // Entries in the index, ".." not included
+  uint32_t dirs;   // Of them, folders. They go first.
+} DirIndex;
+
+// Open the index of the folder at path, building it if the folder changed.
+// The folder is read once to check it, which is much faster than sorting it.
+// dirs_only and filter_fn select the entries, and tag names the filter so
+// each one gets its own index. Folder names end with "/". With parent, ".."
+// is the first entry. With ram_only the card is not written, for when a USB
+// host has it mounted: the first DIRINDEX_RUN_ENTRIES entries of the folder
+// are sorted in RAM.
+FRESULT dirindex_open(DirIndex *index, const char *path, bool dirs_only,
+                      EntryFilterFn filter_fn, const char *tag, bool parent,
+                      bool ram_only);
+
+// Entries shown, ".." included
+uint32_t dirindex_count(const DirIndex *index);
+
+// Read up to count entries from position first. Returns the entries read.
+uint32_t dirindex_read(DirIndex *index, uint32_t first,
+                       char entries[][MAX_FILENAME_LENGTH + 1],
+                       uint32_t count);
+
+// Position of the first entry at or after from whose name starts with
+// prefix (not case sensitive), wrapping around. Folders come before files.
+// Returns DIRINDEX_NOT_FOUND if no entry starts with prefix.
+uint32_t dirindex_find(DirIndex *index, const char *prefix, uint32_t from);
+
+void dirindex_close(DirIndex *index);
+
+#endif  // DIRINDEX_H
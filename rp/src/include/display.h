@@ -66,6 +66,17 @@
 // Commands offset. BUFFER_OFFSET + ADDRESS_OFFSET
 #define DISPLAY_COMMAND_ADDRESS_OFFSET 8000
 
+// Refresh generation, after the command. Bumped by every refresh that changed
+// the buffer, so the remote computer can skip the copy when it did not move.
+#define DISPLAY_GENERATION_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 4)
+
+// Generation of the last change of each row of tiles, after the generation.
+// The remote computer only copies the rows newer than the last one it copied.
+#define DISPLAY_ROW_GENERATION_OFFSET (DISPLAY_COMMAND_ADDRESS_OFFSET + 8)
+
+// Bytes of the buffer in a row of tiles
+#define DISPLAY_TILE_ROW_BYTES (DISPLAY_BUFFER_SIZE / DISPLAY_TILES_HEIGHT)
+
 // Highres translate table offset: BUFFER_OFFSET + TRANSTABLE_OFFSET
 #define DISPLAY_HIGHRES_TRANSTABLE_OFFSET 0x0800
 
@@ -114,9 +125,14 @@ void display_setupU8g2();
 /**
  * @brief Refreshes the display.
  *
- * Copies the contents of the u8g2 buffer into the display's memory-mapped
- * buffer using a DMA transfer with 16-bit swapping, ensuring the on-screen
- * content is updated.
+ * Finds the rows of tiles that changed since the last refresh by comparing
+ * their checksums. Without the framebuffer bypass, only those rows are copied
+ * into the display's memory-mapped buffer using a DMA transfer with 16-bit
+ * swapping. The generation of the refresh is then written next to the changed
+ * rows and next to the command, so the remote computer only copies the rows
+ * that changed, and nothing when the buffer did not change. With the bypass,
+ * u8g2 draws in the shared buffer itself and a row may be copied half drawn:
+ * the remote computer also copies every row now and then.
  */
 void display_refresh();
 
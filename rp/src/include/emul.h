@@ -18,6 +18,7 @@
 #include "chandler.h"
 #include "constants.h"
 #include "debug.h"
+#include "dirindex.h"
 #include "ff.h"
 #include "floppy.h"
 #include "gemdrive.h"
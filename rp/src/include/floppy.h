@@ -59,14 +59,17 @@
 //        │ FLOPPYEMUL_SVAR_ENABLED                    │
 //        │   size 4 bytes                             │
 // 0x9A18 ├────────────────────────────────────────────┤
-//        │ FLOPPYEMUL_SVAR_MEDIA_CHANGED_A            │
+//        │ FLOPPYEMUL_SVAR_MEDIA_GEN_A                │
 //        │   size 4 bytes                             │
 // 0x9A1C ├────────────────────────────────────────────┤
-//        │ FLOPPYEMUL_SVAR_MEDIA_CHANGED_B            │
+//        │ FLOPPYEMUL_SVAR_MEDIA_GEN_B                │
 //        │   size 4 bytes                             │
 // 0x9A20 ├────────────────────────────────────────────┤
-//        │ Empty space...                             │
-//        ...
+//        │ FLOPPYEMUL_SVAR_MEDIA_SEEN_A               │
+//        │   size 4 bytes                             │
+// 0x9A24 ├────────────────────────────────────────────┤
+//        │ FLOPPYEMUL_SVAR_MEDIA_SEEN_B               │
+//        │   size 4 bytes                             │
 // 0x9A28 ├────────────────────────────────────────────┤
 //        │ FLOPPYEMUL_VARIABLES_OFFSET.               │
 //        ├────────────────────────────────────────────┤
@@ -84,8 +87,13 @@
 #define FLOPPYEMUL_SVAR_EMULATION_MODE (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 2)
 #define FLOPPYEMUL_SVAR_ENABLED \
   (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 3)  // enabled flag
-#define FLOPPYEMUL_SVAR_MEDIA_CHANGED_A (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 4)
-#define FLOPPYEMUL_SVAR_MEDIA_CHANGED_B (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 5)
+// Media generation of each drive, bumped by the RP when a new image is
+// mounted. The Atari writes the generation it gave TOS the BPB of to
+// MEDIA_SEEN, and answers Mediach locally by comparing both.
+#define FLOPPYEMUL_SVAR_MEDIA_GEN_A (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 4)
+#define FLOPPYEMUL_SVAR_MEDIA_GEN_B (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 5)
+#define FLOPPYEMUL_SVAR_MEDIA_SEEN_A (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 6)
+#define FLOPPYEMUL_SVAR_MEDIA_SEEN_B (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 7)
 
 #define FLOPPY_MEDIA_NOCHANGE 0
 #define FLOPPY_MEDIA_UNKNOWN 1
@@ -231,11 +239,19 @@ void __not_in_flash_func(floppy_dma_irq_handler_lookup)(void);
 // needs a different window from the ACSI path.
 #define FLOPPY_FLUSH_INTERVAL_MS DRIVES_FLUSH_INTERVAL_MS
 
+// Drive A quiet time before floppy_tick() opens the image of the next slot,
+// so the swap does not have to wait for the card
+#define FLOPPY_PRELOAD_IDLE_MS 500u
+
 // Function Prototypes
 void __not_in_flash_func(floppy_init)();
 void __not_in_flash_func(floppy_loop)();
 void __not_in_flash_func(floppy_tick)(void);
 bool floppy_canCycleDriveA(void);
 FRESULT floppy_cycleDriveA(uint8_t *newSlotIndex);
+// Close the mounted images before the SD card is unmounted, and reopen
+// them (reporting a media change) once it is back.
+void floppy_release(void);
+void floppy_resume(void);
 
 #endif  // FLOPPY_H
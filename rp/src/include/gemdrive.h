@@ -16,11 +16,15 @@
 
 #include "../../build/romemul.pio.h"
 #include "aconfig.h"
+#include "bootcache.h"
 #include "chandler.h"
 #include "constants.h"
 #include "debug.h"
+#include "diskio.h"
 #include "display.h"
 #include "f_util.h"
+#include "gemdrive_match.h"
+#include "gemdrive_pexec.h"
 #include "hardware/dma.h"
 #include "hardware/pio.h"
 #include "hardware/rtc.h"
@@ -29,6 +33,7 @@
 #include "pico/cyw43_arch.h"
 #include "pico/stdlib.h"
 #include "sdcard.h"
+#include "slab.h"
 #include "time.h"
 #include "tprotocol.h"
 #define ADDRESS_HIGH_BIT 0x8000          // High bit of the address
@@ -49,6 +54,41 @@
 #define GEMDRIVE_FATFS_MAX_FOLDER_LENGTH \
   192  // Max length of the folder name in FATFS
 
+// Drive letters mounted at once, each rooted at its own folder
+#define GEMDRIVE_MAX_DRIVES 3
+
+// Recent f_stat results kept for Fattrib, Fdatime and Fsfirst
+#define GEMDRIVE_STAT_CACHE_ENTRIES 8
+
+// Blocks of the pools taken at init for the open files, the DTAs of the
+// searches and their directory objects. With every DTA in use, Fsfirst
+// reuses the oldest one: programs often leave a search unfinished.
+#define GEMDRIVE_FILE_POOL_SIZE 12
+#define GEMDRIVE_DTA_POOL_SIZE 24
+
+// FatFS file locks (FF_FS_LOCK) are shared by everything on the card: each
+// open file and each open folder other than a root takes one. GEMDRIVE
+// may hold its whole file pool and one folder per DTA. The other holders
+// are the ACSI images (3), the floppies in A and B and the standby one
+// (3), the ROM3 capture (1) and the short-lived files of the boot cache,
+// the folder index, Pexec, the USB card check and the traces (7).
+#define GEMDRIVE_FS_LOCK_OTHERS 14
+#define GEMDRIVE_FS_LOCK_BUDGET \
+  (GEMDRIVE_FILE_POOL_SIZE + GEMDRIVE_DTA_POOL_SIZE + GEMDRIVE_FS_LOCK_OTHERS)
+
+// Files from this size get a fast seek link map (FF_USE_FASTSEEK) on their
+// first seek, so seeking costs the same at any offset instead of walking
+// the FAT chain. The map holds the length, two DWORDs per fragment and the
+// end mark: files in more fragments keep the plain seek.
+#define GEMDRIVE_FASTSEEK_MIN_SIZE (64 * 1024)
+#define GEMDRIVE_FASTSEEK_TABLE_LEN 32
+
+enum {
+  GEMDRIVE_FASTSEEK_NONE = 0,  // No map yet, tried again on the next seek
+  GEMDRIVE_FASTSEEK_ON,        // fobject.cltbl points to the map
+  GEMDRIVE_FASTSEEK_OFF,       // Cached or too fragmented
+};
+
 // 0x8248 ├────────────────────────────────────────────┤
 //        │ GEMDRIVE_SHARED_VARIABLE_FIRST_FILE_DES    │
 //        │   size 4 bytes                             │
@@ -65,6 +105,15 @@
 //        │ GEMDRIVE_SHARED_VARIABLE_FAKE_FLOPPY       │
 //        │   size 4 bytes                             │
 // 0x825C ├────────────────────────────────────────────┤
+//        │ GEMDRIVE_SHARED_VARIABLE_ENABLED           │
+//        │   size 4 bytes                             │
+// 0x8260 ├────────────────────────────────────────────┤
+//        │ GEMDRIVE_SHARED_VARIABLE_DRIVE_MASK        │
+//        │   size 4 bytes                             │
+// 0x8264 ├────────────────────────────────────────────┤
+//        │ GEMDRIVE_SHARED_VARIABLE_ACTIVE_DRIVE      │
+//        │   size 4 bytes                             │
+// 0x8268 ├────────────────────────────────────────────┤
 //        │ Empty space...                             │
 //        ...
 // 0x8300 ├────────────────────────────────────────────┤
@@ -103,6 +152,14 @@
   (GEMDRIVE_SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 4)
 #define GEMDRIVE_SHARED_VARIABLE_ENABLED \
   (GEMDRIVE_SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 5)  // enabled flag
+// Bit n set when drive n (0 is A) is a GEMDRIVE drive. The trap handler
+// tests the drive of each call against it, so other drives go to TOS at once.
+#define GEMDRIVE_SHARED_VARIABLE_DRIVE_MASK \
+  (GEMDRIVE_SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 6)
+// GEMDRIVE drive that paths without a drive letter refer to. The Atari sets
+// it when the current drive moves to another GEMDRIVE drive.
+#define GEMDRIVE_SHARED_VARIABLE_ACTIVE_DRIVE \
+  (GEMDRIVE_SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 7)
 
 #define GEMDRIVE_VARIABLES_OFFSET \
   (GEMDRIVE_RANDOM_TOKEN_OFFSET + \
@@ -311,6 +368,10 @@ GEMDRIVE_ASSERT_ALIGNED_4(GEMDRIVE_PEXEC_STACK_ADDR);
   (APP_GEMDRVEMUL << 8 | 0x8A)  // Check if the DTA exists in the rp2040 memory
 #define GEMDRVEMUL_DTA_RELEASE_CALL \
   (APP_GEMDRVEMUL << 8 | 0x8B)  // Release the DTA from the rp2040 memory
+#define GEMDRVEMUL_PEXEC_LOAD_START \
+  (APP_GEMDRVEMUL << 8 | 0x8C)  // Start loading and relocating a program
+#define GEMDRVEMUL_PEXEC_LOAD_NEXT \
+  (APP_GEMDRVEMUL << 8 | 0x8D)  // Next relocated chunk of the program
 
 // Atari ST FATTRIB flag
 #define FATTRIB_INQUIRE 0x00
@@ -392,17 +453,17 @@ typedef struct __attribute__((aligned(4))) DTANode {
   TCHAR fname[14];
   DTA data;
   DIR *dj;
-  TCHAR *pat; /* Pointer to name matching pattern. Hack for dir_findfirst(). */
+  GemdriveMatch match; /* Fsfirst filespec and attributes */
   struct DTANode *next;
 } DTANode;
 
 /*
  * Ownership contract for DTANode resources:
- * - DTANode is the sole owner of 'dj' (DIR*) and 'pat' (allocated pattern).
- * - Callers must NOT free 'dj' or 'pat'. To release a DTA, call releaseDTA()
+ * - DTANode is the sole owner of 'dj' (DIR*).
+ * - Callers must NOT free 'dj'. To release a DTA, call releaseDTA()
  *   (or cleanDTAHashTable()) which will perform the full teardown.
- * - If a caller stops using 'dj' or 'pat' temporarily, it may set the fields
- *   to NULL but must not free them. Teardown is centralized in dta_node_free().
+ * - If a caller stops using 'dj' temporarily, it may set the field
+ *   to NULL but must not free it. Teardown is centralized in dta_node_free().
  */
 
 typedef struct __attribute__((aligned(4))) FileDescriptors {
@@ -410,10 +471,38 @@ typedef struct __attribute__((aligned(4))) FileDescriptors {
   int fd;
   uint32_t offset;
   bool seek_dirty;
+  int16_t cacheSource;  // Boot snapshot handle, read only files
+  uint8_t fastseek;     // GEMDRIVE_FASTSEEK_*
   FIL fobject;
+  DWORD cltbl[GEMDRIVE_FASTSEEK_TABLE_LEN];  // Link map of fobject
   struct FileDescriptors *next;
 } FileDescriptors;
 
+// A drive letter of GEMDRIVE
+typedef struct {
+  char folder[GEMDRIVE_MAX_FOLDER_LENGTH];  // Root folder on the SD card
+  char dpath[GEMDRIVE_MAX_FOLDER_LENGTH];   // Default path of Dsetpath
+  char letter;
+  uint8_t number;  // 0 is A, 2 is C...
+  bool readOnly;
+} GemdriveVolume;
+
+// A cached f_stat result. The replies to the Atari are kept swapped, ready
+// for the shared memory.
+typedef struct {
+  uint32_t hash;     // Of the path, 0 when the entry is free
+  uint32_t lastUse;  // For the LRU replacement
+  char path[GEMDRIVE_MAX_FOLDER_LENGTH];
+  TCHAR name[FF_SFN_BUF + 1];  // Name the Atari sees
+  BYTE fattrib;
+  WORD fdate;
+  WORD ftime;
+  FSIZE_t fsize;
+  uint32_t attribReply;  // Atari attributes
+  uint32_t dateReply;    // DOS date
+  uint32_t timeReply;    // DOS time
+} GemdriveStatEntry;
+
 typedef struct _pd PD;
 struct _pd {
   /* 0x00 */
@@ -473,4 +562,10 @@ typedef struct ExecHeader {
 void __not_in_flash_func(gemdrive_init)();
 void __not_in_flash_func(gemdrive_loop)(TransmissionProtocol *protocol,
                                         uint16_t *payloadPtr);
+// Close every open file and search before the SD card is unmounted
+void gemdrive_release(void);
+
+// Pools of the open files, DTAs and directory objects, for diagnostics.
+// NULL past the last one.
+const SlabPool *gemdrive_getPool(uint8_t index);
 #endif  // GEMDRIVE_H
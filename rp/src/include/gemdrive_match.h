@@ -0,0 +1,43 @@
+/**
+ * File: gemdrive_match.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the Fsfirst/Fsnext matcher of GEMDRIVE. The
+ * GEMDOS filespec and attributes are compiled once per DTA and then checked
+ * against each directory entry with a few byte compares, following the TOS
+ * rules. No dependencies, so scripts/fsmatch can test it on a computer.
+ */
+
+#ifndef GEMDRIVE_MATCH_H
+#define GEMDRIVE_MATCH_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Name and extension of a directory entry, padded with spaces
+#define GEMDRIVE_MATCH_NAME_SIZE 11
+
+typedef struct {
+  uint8_t value[GEMDRIVE_MATCH_NAME_SIZE];  // Upper case, 0 where '?'
+  uint8_t mask[GEMDRIVE_MATCH_NAME_SIZE];   // 0 where '?', 0xFF elsewhere
+  uint8_t attribs;                          // Fsfirst attributes
+} GemdriveMatch;
+
+// Compile the file name part of a filespec ("*.PRG", "GAME????.DAT", "*.*")
+// and the Fsfirst attributes. As in TOS, '*' fills the rest of the name or
+// the extension with '?' and the characters after the 8th of the name or
+// the 3rd of the extension are ignored.
+void gemdrive_match_compile(GemdriveMatch *match, const char *pattern,
+                            uint8_t attribs);
+
+// Name as the Atari sees it, "NAME.EXT". Not case sensitive.
+bool gemdrive_match_name(const GemdriveMatch *match, const char *name);
+
+// GEMDOS attributes of the entry. Entries that are only read-only or
+// archived are normal files, always found unless the search is for the
+// volume label alone. Hidden, system, folder and label entries are found
+// when all their bits are in the search attributes.
+bool gemdrive_match_attribs(const GemdriveMatch *match, uint8_t attribs);
+
+#endif  // GEMDRIVE_MATCH_H
@@ -0,0 +1,46 @@
+/**
+ * File: gemdrive_pexec.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the GEMDRIVE program loader. Reads the TEXT
+ * and DATA segments of a PRG file, applies its relocation table on the
+ * RP2040 and hands them out relocated, so the Atari only copies them in
+ * place and clears the BSS.
+ */
+
+#ifndef GEMDRIVE_PEXEC_H
+#define GEMDRIVE_PEXEC_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "ff.h"
+
+// Size of the PRG header
+#define GEMDRIVE_PEXEC_HEADER_SIZE 28u
+
+// TEXT and DATA bytes read from the card and relocated at once. The Atari
+// gets them in smaller chunks through the read buffer.
+#define GEMDRIVE_PEXEC_BLOCK_SIZE 16384u
+
+// Relocation table bytes read from the card at once
+#define GEMDRIVE_PEXEC_RELOC_BUFFER_SIZE 256u
+
+// Start loading the program open in file, placing its TEXT segment at
+// textBase in the Atari memory. The header is read again from the file.
+// cacheSource is the boot snapshot handle of the file. Returns GEMDOS_EOK,
+// or a negative GEMDOS error with the file position unchanged so the Atari
+// can load the program itself.
+int32_t gemdrive_pexec_start(FIL *file, const char *fpath, uint32_t textBase,
+                             int16_t cacheSource);
+
+// Copy the next relocated bytes of TEXT and DATA to buffer, up to size.
+// Returns the number of bytes, 0 when the segments are complete (the loader
+// is released), or a negative GEMDOS error.
+int32_t gemdrive_pexec_next(FIL *file, uint8_t *buffer, uint32_t size);
+
+// Close the relocation table and free the buffers
+void gemdrive_pexec_release(void);
+
+#endif  // GEMDRIVE_PEXEC_H
@@ -0,0 +1,119 @@
+/**
+ * File: perfprofile.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the named performance profiles: system clock,
+ * core voltage, flash and SD card SPI clocks, chosen per boot mode.
+ */
+
+#ifndef PERFPROFILE_H
+#define PERFPROFILE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "constants.h"
+#include "debug.h"
+#include "hardware/clocks.h"
+#include "hardware/vreg.h"
+
+#define PERFPROFILE_STANDARD "standard"
+
+// The PIO read programs wait a fixed number of cycles for the address bus
+// to settle, and the command loops were timed at this clock. Slower clocks
+// miss the 68000 bus cycle, faster ones slow the PIO down to keep the wait.
+#define PERFPROFILE_BUS_CLOCK_KHZ RP2040_CLOCK_FREQ_KHZ
+#define PERFPROFILE_MAX_CLOCK_KHZ 300000
+
+// W25Q16JV fast read limit
+#define PERFPROFILE_FLASH_MAX_KHZ 133000
+
+// flashClkDiv that keeps the divider set by boot2
+#define PERFPROFILE_FLASH_BOOT_DIV 0
+
+// Time for the regulator to reach a higher voltage before the clock goes up
+#define PERFPROFILE_VREG_SETTLE_US 1000
+
+typedef struct {
+  const char *name;
+  uint32_t sysClockKhz;       // clk_sys, and clk_peri with it
+  enum vreg_voltage voltage;  // Core voltage
+  uint8_t flashClkDiv;        // XIP SSI divider, even: flash = clk_sys / div
+  uint32_t sdSpiMaxKhz;       // Cap on the SD_BAUD_RATE_KB setting
+} PerfProfile;
+
+// Measured with the active profile by perfprofile_selfTest
+typedef struct {
+  uint32_t ramKBPerS;       // memcpy in SRAM
+  uint32_t flashKBPerS;     // Sequential XIP reads, cache bypassed
+  uint32_t flashLatencyNs;  // One uncached XIP read at a random address
+} PerfSelfTest;
+
+/**
+ * @brief Returns the profile with that name, or NULL.
+ */
+const PerfProfile *perfprofile_find(const char *name);
+
+/**
+ * @brief Returns the profile at index, or NULL past the end of the table.
+ */
+const PerfProfile *perfprofile_at(uint8_t index);
+
+/**
+ * @brief Checks a profile against the limits of the board and the bus.
+ *
+ * @param profile The profile to check.
+ * @param why Filled with the reason when the profile is not valid. Can be
+ * NULL.
+ * @return true if the profile can be applied.
+ */
+bool perfprofile_validate(const PerfProfile *profile, const char **why);
+
+/**
+ * @brief Validates the named profile and applies it, or the standard one.
+ *
+ * Changes the core voltage, the system clock and the flash divider. It must
+ * run before the ROM emulation and core 1 start: while the system PLL
+ * locks again clk_sys runs at 48 MHz, too slow for the cartridge bus.
+ *
+ * @param name Name of the profile. NULL or unknown names get the standard
+ * profile.
+ * @return The profile applied.
+ */
+const PerfProfile *perfprofile_apply(const char *name);
+
+/**
+ * @brief Returns the profile applied at boot.
+ */
+const PerfProfile *perfprofile_getActive(void);
+
+/**
+ * @brief Returns the XIP SSI divider in use: flash clock = clk_sys / div.
+ */
+uint8_t perfprofile_getFlashDivider(void);
+
+/**
+ * @brief Returns the PIO clock divider that keeps the bus timing of the
+ * standard clock at the current system clock.
+ */
+float perfprofile_getPioDivider(void);
+
+/**
+ * @brief Returns the SPI clock the SDK sets for a requested baud rate.
+ *
+ * spi_set_baudrate divides clk_peri by an even prescaler and a postdivider:
+ * the clock can be well below the request.
+ *
+ * @param baudRateKhz Requested SPI clock in KHz.
+ * @return The SPI clock in KHz at the current clk_peri.
+ */
+uint32_t perfprofile_getSpiKhz(uint32_t baudRateKhz);
+
+/**
+ * @brief Measures the RAM and flash throughput and the flash latency with
+ * the active profile. Takes a few milliseconds.
+ */
+void perfprofile_selfTest(PerfSelfTest *result);
+
+#endif  // PERFPROFILE_H
@@ -24,7 +24,6 @@
 #define SDCARD_MEGABYTE 1048576
 
 // File/dir entry list browsable
-#define MAX_ENTRIES_DIR 256
 #define MAX_FILENAME_LENGTH \
   (SETTINGS_MAX_VALUE_LENGTH - 1)  // Max length of a filename
 
@@ -42,11 +41,6 @@ typedef enum {
   SDCARD_CREATE_FOLDER_ERROR = -3
 } sdcard_status_t;
 
-typedef struct {
-  char name[MAX_FILENAME_LENGTH + 1];
-  bool is_dir;
-} DirEntry;
-
 /**
  * @brief Mount filesystem using FatFS library.
  *
@@ -130,35 +124,6 @@ void sdcard_getInfo(FATFS *fsPtr, uint32_t *totalSizeMb, uint32_t *freeSpaceMb);
 // skip
 typedef bool (*EntryFilterFn)(const char *name, BYTE attr);
 
-/**
- * @brief Load entries from an SD card directory.
- *
- * This function reads the contents of the directory specified by @c path and
- * populates an array with the names of the entries found. It supports filtering
- * entries using an optional filter function and can be configured to load only
- * directories.
- *
- * @param path The path to the directory to be loaded.
- * @param entries_arr A 2D character array where the directory entry names will
- * be stored. Each entry should have a maximum length of @c MAX_FILENAME_LENGTH
- * characters, plus a null terminator.
- * @param entry_count Pointer to a uint16_t where the number of entries found
- * will be stored.
- * @param selected Pointer to a uint16_t representing the initially selected
- * entry's index.
- * @param page Pointer to a uint16_t representing the current page of entries
- * (for pagination purposes).
- * @param dirs_only If set to true, only directory entries will be loaded.
- * @param filter_fn Optional pointer to a function used to filter entries; only
- * entries for which this function returns true will be included.
- *
- * @return FRESULT Return code indicating the status of the operation.
- */
-FRESULT __not_in_flash_func(sdcard_loadDirectory)(
-    const char *path, char entries_arr[][MAX_FILENAME_LENGTH + 1],
-    uint16_t *entry_count, uint16_t *selected, uint16_t *page, bool dirs_only,
-    EntryFilterFn filter_fn, char top_dir[MAX_FILENAME_LENGTH + 1]);
-
 /**
  * @brief Splits a full path into its drive letter, folder path, and file
  * pattern components.
@@ -11,6 +11,7 @@
 
 #include "constants.h"
 #include "debug.h"
+#include "pico/flash.h"
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
 
@@ -18,7 +19,8 @@
 
 #define SELECT_DEBOUNCE_MS 30  // 30 ms stable level before accepting a change
 
-#define SELECT_LONG_RESET 10000  // 10 seconds
+#define SELECT_MEDIUM_PRESS 3000  // 3 seconds
+#define SELECT_LONG_RESET 10000   // 10 seconds
 
 // Define a callback typdef for the reset function
 typedef void (*reset_callback_t)();
@@ -98,4 +100,18 @@ void select_setResetCallback(reset_callback_t reset);
  */
 void select_setLongResetCallback(reset_callback_t resetLong);
 
+/**
+ * @brief Registers the medium press callback.
+ *
+ * Associates a function that will be invoked when the SELECT button is
+ * released after being held at least SELECT_MEDIUM_PRESS ms, but before the
+ * long press fires. Without it, a medium press behaves as a short press.
+ *
+ * @param medium Callback function for a medium press action.
+ */
+void select_setMediumPressCallback(reset_callback_t medium);
+// Work for core 1 while it polls the SELECT button (e.g. the USB device
+// task). Called in a loop, so it must return quickly.
+void select_setIdleCallback(reset_callback_t idle);
+
 #endif  // SELECT_H
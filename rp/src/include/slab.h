@@ -0,0 +1,73 @@
+/**
+ * File: slab.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the fixed-block pools. Each pool takes its
+ * blocks from one allocation made at init, and hands them out and back in
+ * constant time, so long sessions never fragment the heap.
+ */
+
+#ifndef SLAB_H
+#define SLAB_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+  const char *name;
+  uint8_t *memory;  // capacity blocks of blockSize bytes
+  void *freeList;   // A free block keeps the next free one in its first word
+  uint16_t blockSize;
+  uint16_t capacity;
+  uint16_t inUse;
+  uint16_t peak;       // Highest inUse since init
+  uint32_t exhausted;  // Allocations refused because the pool was full
+} SlabPool;
+
+// Allocate the blocks of the pool. Called again with the same block size
+// and capacity, the memory is kept and every block is given back. Returns
+// false when there is no memory: the pool then refuses every allocation.
+bool slab_init(SlabPool *pool, const char *name, size_t blockSize,
+               uint16_t capacity);
+
+// Give every block back to the pool. The blocks in use must not be used
+// anymore.
+void slab_reset(SlabPool *pool);
+
+// Free the memory of the pool
+void slab_deinit(SlabPool *pool);
+
+static inline bool slab_owns(const SlabPool *pool, const void *block) {
+  const uint8_t *p = (const uint8_t *)block;
+  return pool->memory != NULL && p >= pool->memory &&
+         p < pool->memory + (size_t)pool->blockSize * pool->capacity &&
+         (size_t)(p - pool->memory) % pool->blockSize == 0;
+}
+
+// A block of the pool, not cleared, or NULL when the pool is full
+static inline void *slab_alloc(SlabPool *pool) {
+  void *block = pool->freeList;
+  if (block == NULL) {
+    pool->exhausted++;
+    return NULL;
+  }
+  pool->freeList = *(void **)block;
+  if (++pool->inUse > pool->peak) {
+    pool->peak = pool->inUse;
+  }
+  return block;
+}
+
+// Give a block back. NULL and blocks of other pools are ignored.
+static inline void slab_free(SlabPool *pool, void *block) {
+  if (block == NULL || !slab_owns(pool, block)) {
+    return;
+  }
+  *(void **)block = pool->freeList;
+  pool->freeList = block;
+  pool->inUse--;
+}
+
+#endif  // SLAB_H
@@ -0,0 +1,32 @@
+/**
+ * File: sramstat.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header file for the SRAM usage figures at run time: static
+ * RAM and heap against the budget of memmap_budget.ld, and the heap high
+ * water mark since boot.
+ */
+
+#ifndef SRAMSTAT_H
+#define SRAMSTAT_H
+
+#include <inttypes.h>
+#include <stddef.h>
+
+typedef struct {
+  size_t staticBytes;   // .data, .bss and .uninitialized_data, with padding
+  size_t staticBudget;  // Sum of the static budgets
+  size_t heapBudget;    // What the budget leaves to the heap
+  size_t heapInUse;     // Allocated now
+  size_t heapSize;      // Taken from the system now (current break)
+  size_t heapPeak;      // Highest break since boot
+} SramStat;
+
+// Fill the figures. Cheap enough to call from the setup terminal.
+void sramstat_get(SramStat *stat);
+
+// Print the figures with DPRINTF
+void sramstat_print(void);
+
+#endif  // SRAMSTAT_H
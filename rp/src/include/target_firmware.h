@@ -1,60 +1,60 @@
 const uint16_t target_firmware[] = {
-    0xABCD, 0xEF42, 0x00FA, 0x05FC, 0x08FA, 0x001E, 0x0000, 0x0000, 0x94A2, 0x5C92, 0x0000, 0x05D9, 0x5445, 0x524D, 0x0000, 0x4879,
-    0x00FA, 0x05D4, 0x3F3C, 0x0009, 0x4E41, 0x5C8F, 0x2F07, 0x3E3C, 0x0032, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F,
-    0x2F07, 0x3E3C, 0x0032, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F, 0x4EB9, 0x00FA, 0x0368, 0x3F3C, 0x0002, 0x4E4E,
-    0x548F, 0x2440, 0x45EA, 0xF000, 0x264A, 0x2C3C, 0x0000, 0x0575, 0x43F9, 0x00FA, 0x0082, 0xE44E, 0x5346, 0x24D9, 0x51CE, 0xFFFC,
-    0x4ED3, 0x2C40, 0x0038, 0x0008, 0x0484, 0x7200, 0x303C, 0x0400, 0x6100, 0x0310, 0x4A40, 0x6718, 0x2F07, 0x3E3C, 0x0032, 0x3F3C,
-    0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F, 0x6000, 0x01C2, 0x3F3C, 0x0004, 0x4E4E, 0x548F, 0xB07C, 0x0002, 0x6700, 0x00B2,
-    0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x204E, 0x227C, 0x00FA, 0x8000, 0x203C, 0x0000, 0x0F9F, 0x3219, 0xE159, 0x3401, 0x4842, 0x3401,
-    0x20C2, 0x20C2, 0x51C8, 0xFFF0, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x015A, 0xBCBC, 0x0000, 0x0002, 0x6700,
-    0x016E, 0xBCBC, 0x0000, 0x0004, 0x6700, 0x0166, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054, 0x3F3C, 0x0008, 0x4E41,
-    0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001, 0x6100, 0x0266, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x0244,
-    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFF52, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x224E, 0x244E, 0x45EA, 0x0050,
-    0x207C, 0x00FA, 0x8000, 0x267C, 0x00FA, 0x0800, 0x203C, 0x0000, 0x00C7, 0x223C, 0x0000, 0x0013, 0x3418, 0xE15A, 0x3602, 0xC67C,
-    0xFF00, 0xEE4B, 0x3833, 0x3000, 0x4844, 0xC47C, 0x00FF, 0xD442, 0x3833, 0x2000, 0x22C4, 0x24C4, 0x51C9, 0xFFDE, 0x43E9, 0x0050,
-    0x45EA, 0x0050, 0x51C8, 0xFFCC, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x007A, 0xBCBC, 0x0000, 0x0002, 0x6700,
-    0x008E, 0xBCBC, 0x0000, 0x0004, 0x6700, 0x0086, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054, 0x3F3C, 0x0008, 0x4E41,
-    0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001, 0x6100, 0x0186, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x0164,
-    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFF22, 0x2C3C, 0x000F, 0xFFFF, 0x5386, 0x66FC, 0x42B8, 0x0420, 0x42B8,
-    0x043A, 0x42B8, 0x051A, 0x2078, 0x0004, 0x4ED0, 0x4E71, 0x4E75, 0x0CB9, 0xFFFF, 0xFFFF, 0x00FA, 0xA408, 0x6726, 0x2038, 0x0432,
-    0x90BC, 0x0000, 0x8800, 0x2040, 0x0C90, 0xAC51, 0x4BCB, 0x6612, 0x42B8, 0x0420, 0x42B8, 0x043A, 0x42B8, 0x051A, 0x2078, 0x0004,
-    0x4ED0, 0x4EB9, 0x00FA, 0x1000, 0x4EB9, 0x00FA, 0x2800, 0x4EB9, 0x00FA, 0x5400, 0x4EF9, 0x00FA, 0x3400, 0x2038, 0x05A0, 0x6700,
-    0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C,
-    0x0000, 0x0000, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0001, 0x6100, 0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C, 0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC,
-    0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0, 0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000,
-    0x0001, 0x2800, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0001, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704,
-    0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010, 0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21,
-    0x4E75, 0x2439, 0x00FA, 0xF004, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x0482, 0xE24F, 0x5347,
-    0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30,
-    0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002,
-    0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700,
-    0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700, 0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E,
-    0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30,
-    0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000,
-    0x4ED3, 0x4842, 0x2E3C, 0x0000, 0x6FFF, 0x7000, 0xB491, 0x6706, 0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0xF004, 0x2478,
-    0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x05BE, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC, 0x0000,
-    0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA, 0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C,
-    0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30,
-    0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45,
-    0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07, 0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x280C,
-    0x0804, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30, 0x4000,
-    0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x280C, 0x0804, 0x0000, 0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30,
-    0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0x601E, 0x5345, 0x670E, 0x5345, 0x381C,
-    0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3, 0x4842,
-    0x2C3C, 0x0000, 0x6FFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8, 0x5380, 0x4E75, 0x5374, 0x6172, 0x7469, 0x6E67, 0x204D, 0x756C,
-    0x7469, 0x2D64, 0x7269, 0x7665, 0x2065, 0x6D75, 0x6C61, 0x746F, 0x722E, 0x2E2E, 0x0D0A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x04FA, 0x0618, 0x0000, 0x0000, 0x94A2, 0x5C92, 0x0000, 0x0040, 0x4143, 0x5349, 0x5245, 0x5300, 0x0CB9, 0xDEAD, 0x0000, 0x00FA,
-    0xA408, 0x6732, 0x2038, 0x0432, 0x672C, 0x2238, 0x0436, 0x9280, 0xB2BC, 0x0001, 0x8800, 0x631E, 0xD0BC, 0x0000, 0x0003, 0xC0BC,
-    0xFFFF, 0xFFFC, 0x2040, 0x20BC, 0xAC51, 0x4BCB, 0xD0BC, 0x0000, 0x8800, 0x21C0, 0x0432, 0x4E75, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xABCD, 0xEF42, 0x00FA, 0x068C, 0x08FA, 0x001E, 0x0000, 0x0000, 0xBBC0, 0x5D52, 0x0000, 0x0669, 0x5445, 0x524D, 0x0000, 0x4879,
+    0x00FA, 0x0664, 0x3F3C, 0x0009, 0x4E41, 0x5C8F, 0x2F07, 0x3E3C, 0x0032, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F,
+    0x2F07, 0x3E3C, 0x0032, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F, 0x4EB9, 0x00FA, 0x03F8, 0x3F3C, 0x0002, 0x4E4E,
+    0x548F, 0x2440, 0x45EA, 0xF000, 0x264A, 0x2C3C, 0x0000, 0x0605, 0x43F9, 0x00FA, 0x0082, 0xE44E, 0x5346, 0x24D9, 0x51CE, 0xFFFC,
+    0x4ED3, 0x2C40, 0x0038, 0x0008, 0x0484, 0x7200, 0x303C, 0x0400, 0x6100, 0x03A0, 0x4A40, 0x6718, 0x2F07, 0x3E3C, 0x0032, 0x3F3C,
+    0x0025, 0x4E4E, 0x548F, 0x51CF, 0xFFF6, 0x2E1F, 0x6000, 0x0252, 0x9BCD, 0x3F3C, 0x0004, 0x4E4E, 0x548F, 0xB07C, 0x0002, 0x6700,
+    0x00F6, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x41FA, 0x0212, 0x5350, 0x660E, 0x30BC, 0x0032, 0x2C39, 0x00FA, 0x9F44, 0x9BCD, 0x6010,
+    0x2C39, 0x00FA, 0x9F44, 0xBC8D, 0x6700, 0x0044, 0x6202, 0x9BCD, 0x204E, 0x227C, 0x00FA, 0x8000, 0x287C, 0x00FA, 0x9F48, 0x7A18,
+    0x261C, 0x968D, 0x6F1A, 0x203C, 0x0000, 0x009F, 0x3219, 0xE159, 0x3401, 0x4842, 0x3401, 0x20C2, 0x20C2, 0x51C8, 0xFFF0, 0x6008,
+    0x43E9, 0x0140, 0x41E8, 0x0500, 0x51CD, 0xFFD6, 0x2A46, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000, 0x0001, 0x6700, 0x01A4, 0xBCBC,
+    0x0000, 0x0002, 0x6700, 0x01B8, 0xBCBC, 0x0000, 0x0004, 0x6700, 0x01B0, 0x3F3C, 0x000B, 0x4E41, 0x548F, 0x4A80, 0x6700, 0x0054,
+    0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0001,
+    0x6100, 0x02B0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7200, 0x303C,
+    0x0000, 0x6100, 0x028E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFF0E, 0x3F3C, 0x0025, 0x4E4E, 0x548F, 0x41FA,
+    0x011E, 0x5350, 0x660E, 0x30BC, 0x0032, 0x2C39, 0x00FA, 0x9F44, 0x9BCD, 0x6010, 0x2C39, 0x00FA, 0x9F44, 0xBC8D, 0x6700, 0x0078,
+    0x6202, 0x9BCD, 0x224E, 0x244E, 0x45EA, 0x0050, 0x207C, 0x00FA, 0x8000, 0x267C, 0x00FA, 0x0800, 0x287C, 0x00FA, 0x9F48, 0x7A18,
+    0x261C, 0x968D, 0x6F3E, 0x203C, 0x0000, 0x0007, 0x223C, 0x0000, 0x0013, 0x3418, 0xE15A, 0x3602, 0xC67C, 0xFF00, 0xEE4B, 0x3833,
+    0x3000, 0x4844, 0xC47C, 0x00FF, 0xD442, 0x3833, 0x2000, 0x22C4, 0x24C4, 0x51C9, 0xFFDE, 0x43E9, 0x0050, 0x45EA, 0x0050, 0x51C8,
+    0xFFCC, 0x600C, 0x41E8, 0x0140, 0x43E9, 0x0500, 0x45EA, 0x0500, 0x51CD, 0xFFAE, 0x2A46, 0x2C39, 0x00FA, 0x9F40, 0xBCBC, 0x0000,
+    0x0001, 0x6700, 0x007C, 0xBCBC, 0x0000, 0x0002, 0x6700, 0x0090, 0xBCBC, 0x0000, 0x0004, 0x6700, 0x0088, 0x3F3C, 0x000B, 0x4E41,
+    0x548F, 0x4A80, 0x6700, 0x0054, 0x3F3C, 0x0008, 0x4E41, 0x548F, 0xB03C, 0x001B, 0x6700, 0x0026, 0x2600, 0x3E3C, 0x0003, 0x48E7,
+    0x7F00, 0x7204, 0x303C, 0x0001, 0x6100, 0x0188, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0x0020, 0x3E3C, 0x0003,
+    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0000, 0x6100, 0x0166, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFEDA, 0x0032,
+    0x2C3C, 0x000F, 0xFFFF, 0x5386, 0x66FC, 0x42B8, 0x0420, 0x42B8, 0x043A, 0x42B8, 0x051A, 0x2078, 0x0004, 0x4ED0, 0x4E71, 0x4E75,
+    0x0CB9, 0xFFFF, 0xFFFF, 0x00FA, 0xA408, 0x6726, 0x2038, 0x0432, 0x90BC, 0x0000, 0x8800, 0x2040, 0x0C90, 0xAC51, 0x4BCB, 0x6612,
+    0x42B8, 0x0420, 0x42B8, 0x043A, 0x42B8, 0x051A, 0x2078, 0x0004, 0x4ED0, 0x4EB9, 0x00FA, 0x1000, 0x4EB9, 0x00FA, 0x3000, 0x4EB9,
+    0x00FA, 0x5400, 0x4EF9, 0x00FA, 0x3C00, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348,
+    0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C,
+    0x0001, 0x6100, 0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C,
+    0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0,
+    0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0003, 0x48E7, 0x7F00, 0x7208, 0x303C,
+    0x0001, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A,
+    0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010,
+    0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA, 0xF004, 0x2478, 0x04C6, 0x2678, 0x04C6,
+    0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x0512, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0xF000, 0x207C,
+    0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000,
+    0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004,
+    0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700,
+    0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45,
+    0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C,
+    0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4ED3, 0x4842, 0x2E3C, 0x0000, 0x6FFF, 0x7000, 0xB491, 0x6706,
+    0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0xF004, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA,
+    0x064E, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA,
+    0xF000, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41,
+    0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000,
+    0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07,
+    0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x280C, 0x0804, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000,
+    0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x280C, 0x0804, 0x0000,
+    0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00,
+    0xDE44, 0x4A30, 0x4000, 0x601E, 0x5345, 0x670E, 0x5345, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00,
+    0xDE44, 0x4A30, 0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3, 0x4842, 0x2C3C, 0x0000, 0x6FFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8,
+    0x5380, 0x4E75, 0x5374, 0x6172, 0x7469, 0x6E67, 0x204D, 0x756C, 0x7469, 0x2D64, 0x7269, 0x7665, 0x2065, 0x6D75, 0x6C61, 0x746F,
+    0x722E, 0x2E2E, 0x0D0A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04FA, 0x06A8, 0x0000, 0x0000, 0xBBC0, 0x5D52, 0x0000, 0x0040,
+    0x4143, 0x5349, 0x5245, 0x5300, 0x0CB9, 0xDEAD, 0x0000, 0x00FA, 0xA408, 0x6732, 0x2038, 0x0432, 0x672C, 0x2238, 0x0436, 0x9280,
+    0xB2BC, 0x0001, 0x8800, 0x631E, 0xD0BC, 0x0000, 0x0003, 0xC0BC, 0xFFFF, 0xFFFC, 0x2040, 0x20BC, 0xAC51, 0x4BCB, 0xD0BC, 0x0000,
+    0x8800, 0x21C0, 0x0432, 0x4E75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
@@ -127,13 +127,13 @@ const uint16_t target_firmware[] = {
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x4AB9, 0x00FA, 0x825C, 0x6700, 0x0036, 0x4EB9, 0x00FA, 0x2454, 0x6100, 0x1394, 0x6100, 0x13E4, 0x6100, 0x0026, 0x3E3C, 0x0005,
-    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1462, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6100, 0x0054, 0x4E75,
-    0x4A78, 0x04A6, 0x660E, 0x21FC, 0x0000, 0x0001, 0x04C2, 0x31FC, 0x0001, 0x04A6, 0x2039, 0x00FA, 0x8250, 0x7201, 0xE1A9, 0x83B8,
-    0x04C2, 0xB07C, 0x0002, 0x6604, 0x31C0, 0x0446, 0xB07C, 0x0002, 0x6618, 0x3F00, 0x3F3C, 0x000E, 0x4E41, 0x588F, 0x4879, 0x00FA,
-    0x108C, 0x3F3C, 0x003B, 0x4E41, 0x5C8F, 0x4E75, 0x5C00, 0x4E75, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6708, 0x2F3C, 0x00FA,
-    0x1118, 0x6006, 0x2F3C, 0x00FA, 0x10EC, 0x3F3C, 0x0021, 0x3F3C, 0x0005, 0x4E4D, 0x508F, 0x2600, 0x283C, 0x00FA, 0x10E8, 0x3E3C,
-    0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0401, 0x6100, 0x13C0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x4E75,
+    0x4AB9, 0x00FA, 0x825C, 0x6700, 0x0036, 0x4EB9, 0x00FA, 0x29C2, 0x6100, 0x1902, 0x6100, 0x1952, 0x6100, 0x0026, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x19D0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6100, 0x0052, 0x4E75,
+    0x4A78, 0x04A6, 0x660E, 0x21FC, 0x0000, 0x0001, 0x04C2, 0x31FC, 0x0001, 0x04A6, 0x2039, 0x00FA, 0x8260, 0x81B8, 0x04C2, 0x0800,
+    0x0002, 0x6706, 0x31FC, 0x0002, 0x0446, 0xB07C, 0x0002, 0x6618, 0x3F00, 0x3F3C, 0x000E, 0x4E41, 0x588F, 0x4879, 0x00FA, 0x108A,
+    0x3F3C, 0x003B, 0x4E41, 0x5C8F, 0x4E75, 0x5C00, 0x4E75, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6708, 0x2F3C, 0x00FA, 0x1118,
+    0x6006, 0x2F3C, 0x00FA, 0x10EC, 0x3F3C, 0x0021, 0x3F3C, 0x0005, 0x4E4D, 0x508F, 0x2600, 0x283C, 0x00FA, 0x10E8, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7208, 0x303C, 0x0401, 0x6100, 0x1930, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x4E75, 0x0000,
     0x5842, 0x5241, 0x5344, 0x4744, 0x0000, 0x0000, 0x1238, 0x8E21, 0x0238, 0x0001, 0x8E21, 0x0839, 0x0000, 0x00FA, 0x8300, 0x672A,
     0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x2F39, 0x00FA, 0x10E8, 0x4E75, 0x0839, 0x0000, 0x00FA, 0x8300,
     0x6708, 0x2F39, 0x00FA, 0x10E8, 0x4E75, 0x0817, 0x0005, 0x6704, 0x204F, 0x6004, 0x4E68, 0x5D88, 0x4A79, 0x0000, 0x059E, 0x6702,
@@ -145,171 +145,235 @@ const uint16_t target_firmware[] = {
     0x1162, 0x00FA, 0x1162, 0x00FA, 0x12DE, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA,
     0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA,
     0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA,
-    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x135C, 0x00FA, 0x1162, 0x00FA,
-    0x1162, 0x00FA, 0x140E, 0x00FA, 0x14C0, 0x00FA, 0x1572, 0x00FA, 0x177E, 0x00FA, 0x167A, 0x00FA, 0x172E, 0x00FA, 0x1BB2, 0x00FA,
-    0x1CF2, 0x00FA, 0x1834, 0x00FA, 0x19BA, 0x00FA, 0x1A0A, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x160E, 0x00FA,
-    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1FE4, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1D72, 0x00FA, 0x1F64, 0x00FA,
-    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x18E6, 0x00FA, 0x1AC2, 0x2628,
-    0x0008, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x119C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
-    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1174, 0x4CDF, 0x00FE,
-    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xFE2A, 0x3E3C, 0x0005, 0x48E7,
-    0x7F00, 0x7204, 0x303C, 0x041A, 0x6100, 0x1144, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFE08, 0x4283, 0x2828,
-    0x0008, 0x3628, 0x000C, 0x4A43, 0x664A, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x1114, 0x4CDF, 0x00FE,
-    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404,
-    0x6100, 0x10EC, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x261F, 0x5283, 0x5383, 0xB6B9, 0x00FA, 0x8250, 0x6600, 0xFDA4,
-    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x0436, 0x6100, 0x10BE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039,
-    0x00FA, 0x9424, 0x4A80, 0x6610, 0x4BF9, 0x00FA, 0x9428, 0x2844, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
-    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA,
-    0x824F, 0x6600, 0xFD3E, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x1056, 0x4CDF, 0x00FE, 0x4A40,
+    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1394, 0x00FA, 0x1162, 0x00FA,
+    0x1162, 0x00FA, 0x1452, 0x00FA, 0x1552, 0x00FA, 0x1652, 0x00FA, 0x1966, 0x00FA, 0x1814, 0x00FA, 0x1916, 0x00FA, 0x1F20, 0x00FA,
+    0x2060, 0x00FA, 0x1A6A, 0x00FA, 0x1C8C, 0x00FA, 0x1CDC, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1752, 0x00FA,
+    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x23AA, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x20E0, 0x00FA, 0x231E, 0x00FA,
+    0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1162, 0x00FA, 0x1B6A, 0x00FA, 0x1DE2, 0x2628,
+    0x0008, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x170A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x16E2, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFE28, 0xB0B9, 0x00FA,
+    0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
+    0x169C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x041A,
+    0x6100, 0x167A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFDD0, 0x4283, 0x2828, 0x0008, 0x3628, 0x000C, 0x4A43,
+    0x664A, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x164A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1622, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x261F, 0x5283, 0x5383, 0xB6BC, 0x0000, 0x001F, 0x6200, 0xFD6C, 0x2239, 0x00FA, 0x8260, 0x0701,
+    0x6700, 0xFD60, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x0436, 0x6100, 0x15E8, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
+    0xFFE8, 0x2039, 0x00FA, 0x9424, 0x4A80, 0x6610, 0x4BF9, 0x00FA, 0x9428, 0x2844, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x4CDF, 0x7CFE,
+    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000,
+    0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xFCF2, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFCE6, 0x6000,
+    0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x156A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1542, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFC88, 0xB0B9, 0x00FA,
+    0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
+    0x14FC, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0439, 0x2C3C,
+    0x0000, 0x0100, 0x6100, 0x15CC, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x93DC, 0x48C0, 0x4CDF, 0x7CFE,
+    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000,
+    0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xFBF2, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFBE6, 0x6000,
+    0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x146A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1442, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFB88, 0xB0B9, 0x00FA,
+    0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
+    0x13FC, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043A, 0x2C3C,
+    0x0000, 0x0100, 0x6100, 0x14CC, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x93E0, 0x48C0, 0x4CDF, 0x7CFE,
+    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000,
+    0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xFAF2, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFAE6, 0x6000,
+    0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x136A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1342, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xFA88, 0xB0B9, 0x00FA,
+    0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
+    0x12FC, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043B, 0x2C3C,
+    0x0000, 0x0100, 0x6100, 0x13CC, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x83C0, 0x48C0, 0x4CDF, 0x7CFE,
+    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x4283, 0x2868, 0x0008, 0x3628, 0x000C, 0x4A43, 0x664A,
+    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x128C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C,
+    0x0019, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x1264, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x261F, 0x5283, 0x5383, 0xB6BC, 0x0000, 0x001F, 0x6200, 0xF9AE, 0x2239, 0x00FA, 0x8260, 0x0701, 0x6700,
+    0xF9A2, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x0447, 0x6100, 0x122A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x303C, 0x007F, 0x4BF9, 0x00FA, 0x8308, 0x4A15, 0x6706, 0x18DD, 0x51C8, 0xFFF8, 0x18BC, 0x0000, 0x303C, 0x0000, 0x48C0, 0x4CDF,
+    0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x3628, 0x000C, 0x0C2C, 0x003A,
+    0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xF92C, 0x2239, 0x00FA, 0x8260, 0x0101,
+    0x6700, 0xF920, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x11A4, 0x4CDF, 0x00FE, 0x4A40,
     0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100,
-    0x102E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xFCE4,
-    0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0439, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x10F0, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE,
-    0xFFE4, 0x3039, 0x00FA, 0x93DC, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73,
-    0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xFC8C, 0x6058, 0x3E3C, 0x0005, 0x48E7,
-    0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0FA4, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F,
-    0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0F7C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
-    0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xFC32, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043A, 0x2C3C,
-    0x0000, 0x0100, 0x6100, 0x103E, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x93E0, 0x48C0, 0x4CDF, 0x7CFE,
-    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200,
-    0x303C, 0x0403, 0x6100, 0x0F08, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C,
-    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0EE0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC,
-    0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xFB96, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043B, 0x2C3C, 0x0000, 0x0100,
-    0x6100, 0x0FA2, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x83C0, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
-    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x4283, 0x2868, 0x0008, 0x3628, 0x000C, 0x4A43, 0x670C, 0x5383, 0xB6B9,
-    0x00FA, 0x8250, 0x6600, 0xFB3C, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x0447, 0x6100, 0x0E56, 0x4CDF, 0x00FE, 0x4A40,
-    0x6704, 0x51CF, 0xFFE8, 0x303C, 0x007F, 0x4BF9, 0x00FA, 0x8308, 0x4A15, 0x6706, 0x18DD, 0x51C8, 0xFFF8, 0x18BC, 0x0000, 0x303C,
-    0x0000, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x3628,
-    0x000C, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xFACE, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
-    0x7200, 0x303C, 0x0403, 0x6100, 0x0DE6, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00,
-    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0DBE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F,
-    0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xFA74, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043D, 0x2C3C, 0x0000,
-    0x0100, 0x6100, 0x0E80, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2039, 0x00FA, 0x83C4, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
-    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x3628, 0x0008, 0xC6BC, 0x0000, 0xFFFF, 0xB679, 0x00FA, 0x824A, 0x6D00,
-    0xFA22, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x0D3C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
-    0x3039, 0x00FA, 0x93D8, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868,
-    0x0008, 0x3628, 0x000C, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xF9CA, 0x6058, 0x3E3C, 0x0005,
-    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0CE2, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41,
-    0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0CBA, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xF970, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043C,
-    0x2C3C, 0x0000, 0x0100, 0x6100, 0x0D7C, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x9404, 0x48C0, 0x4CDF,
-    0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x660E,
-    0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xF918, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0C30,
-    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200,
-    0x303C, 0x0404, 0x6100, 0x0C08, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA,
-    0x8250, 0x6600, 0xF8BE, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0441, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x0CCA, 0x4CDF, 0x107E,
-    0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x9408, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604,
-    0x11C1, 0x8E21, 0x4E73, 0x2A68, 0x000A, 0x2C68, 0x000E, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600,
-    0xF862, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0B7A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0B52, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xF808, 0x4FEF, 0xFF00,
-    0x284F, 0x363C, 0x007F, 0x18DD, 0x51CB, 0xFFFC, 0x363C, 0x007F, 0x18DE, 0x51CB, 0xFFFC, 0x284F, 0x3C3C, 0x0005, 0x48E7, 0x7E08,
-    0x303C, 0x0456, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x0BF8, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x4FEF, 0x0100, 0x2039,
-    0x00FA, 0x9414, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2828, 0x0008, 0x3628,
-    0x000C, 0x3A28, 0x000E, 0xB679, 0x00FA, 0x824A, 0x6D00, 0xF794, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0442, 0x6100,
-    0x0AAE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA, 0x940C, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA,
-    0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x3628, 0x000C, 0x3828, 0x000E, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014,
-    0xB039, 0x00FA, 0x824F, 0x6600, 0xF73A, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0A52, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C,
-    0x0404, 0x6100, 0x0A2A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250,
-    0x6600, 0xF6E0, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0443, 0x2C3C, 0x0000, 0x0080, 0x6100, 0x0AEC, 0x4CDF, 0x107E, 0x4A40,
+    0x117C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700,
+    0xF8C2, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208,
+    0x303C, 0x0487, 0x6100, 0x1136, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08,
+    0x303C, 0x043D, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x1206, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2039, 0x00FA, 0x83C4,
+    0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x3628, 0x0008, 0xC6BC, 0x0000, 0xFFFF,
+    0xB679, 0x00FA, 0x824A, 0x6D00, 0xF83A, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x10C2, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039, 0x00FA, 0x93D8, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604,
+    0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x3628, 0x000C, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C,
+    0x0041, 0xB03C, 0x0019, 0x6200, 0xF7DA, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF7CE, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7,
+    0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x1052, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F,
+    0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x102A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF770, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800,
+    0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x0FE4, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043C, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x10B4,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x9404, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA,
+    0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C,
+    0x0041, 0xB03C, 0x0019, 0x6200, 0xF6DA, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF6CE, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7,
+    0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0F52, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F,
+    0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0F2A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF670, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800,
+    0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x0EE4, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0441, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x0FB4,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3039, 0x00FA, 0x9408, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA,
+    0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2A68, 0x000A, 0x2C68, 0x000E, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C,
+    0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xF5D6, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF5CA, 0x6000, 0x0092, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0E4E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019,
+    0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0E26, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF56C, 0xB0B9, 0x00FA, 0x8264, 0x672E,
+    0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x0DE0, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x4FEF, 0xFF00, 0x284F, 0x363C, 0x007F, 0x18DD, 0x51CB, 0xFFFC, 0x363C,
+    0x007F, 0x18DE, 0x51CB, 0xFFFC, 0x284F, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0456, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x0E94,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x4FEF, 0x0100, 0x2039, 0x00FA, 0x9414, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010,
+    0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2828, 0x0008, 0x3628, 0x000C, 0x3A28, 0x000E, 0xB679, 0x00FA, 0x824A, 0x6D00,
+    0xF4C2, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0442, 0x6100, 0x0D4A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x2039, 0x00FA, 0x940C, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2868, 0x0008,
+    0x3628, 0x000C, 0x3828, 0x000E, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019,
+    0x6200, 0xF460, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF454, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C,
+    0x0403, 0x6100, 0x0CD8, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0CB0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000,
+    0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF3F6, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017,
+    0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x0C6A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0443, 0x2C3C, 0x0000, 0x0080, 0x6100, 0x0D3A, 0x4CDF, 0x107E, 0x4A40,
     0x6704, 0x51CE, 0xFFE4, 0x2039, 0x00FA, 0x9410, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21,
     0x4E73, 0x2868, 0x0008, 0x3828, 0x000C, 0x3628, 0x000E, 0x2A2C, 0x0000, 0x2C2C, 0x0004, 0xC6BC, 0x0000, 0xFFFF, 0xC8BC, 0x0000,
-    0xFFFF, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xF66E, 0x6058, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
-    0x7200, 0x303C, 0x0403, 0x6100, 0x0986, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00,
-    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x095E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F,
-    0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xF614, 0x2F0C, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7210, 0x303C, 0x0457,
-    0x6100, 0x092C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x285F, 0x4DF9, 0x00FA, 0x941C, 0x196E, 0x0002, 0x0000, 0x196E,
-    0x0003, 0x0001, 0x4DF9, 0x00FA, 0x9418, 0x196E, 0x0002, 0x0002, 0x196E, 0x0003, 0x0003, 0x2039, 0x00FA, 0x9420, 0x4CDF, 0x7CFE,
-    0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x3628, 0x0008, 0x2828, 0x000A, 0x2868, 0x000E, 0xB679,
-    0x00FA, 0x824A, 0x6D00, 0xF59C, 0x6116, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73,
-    0x2A04, 0x4286, 0x2A79, 0x0000, 0x04C6, 0x48ED, 0x00F8, 0x0100, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0481, 0x6100,
-    0x088E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2A79, 0x0000, 0x04C6, 0x4CED, 0x00F8, 0x0100, 0x4A40, 0x6706, 0x70A3,
-    0x6000, 0x00CE, 0x2039, 0x00FA, 0x83C8, 0x6B00, 0x00C4, 0x4A80, 0x6700, 0x00BC, 0x2A79, 0x0000, 0x04C6, 0x48ED, 0x00C0, 0x0100,
-    0x4BF9, 0x00FA, 0x83CC, 0x2E0C, 0x0807, 0x0000, 0x670E, 0x2E00, 0x5387, 0x18DD, 0x51CF, 0xFFFC, 0x6000, 0x0078, 0x2E00, 0xE28F,
-    0x0807, 0x0000, 0x6712, 0x5387, 0x38DD, 0x51CF, 0xFFFC, 0x0800, 0x0000, 0x675E, 0x18DD, 0x605A, 0xE28F, 0x4A87, 0x674E, 0x5387,
-    0xBEBC, 0x0000, 0x0008, 0x6D32, 0x2C07, 0xE68E, 0xCEBC, 0x0000, 0x0007, 0x5386, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD,
-    0x28DD, 0x28DD, 0x51CE, 0xFFEE, 0xBEBC, 0x0000, 0x0004, 0x6D0A, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x5987, 0x28DD, 0x51CF, 0xFFFC,
-    0x2E00, 0xCEBC, 0x0000, 0x0003, 0x6708, 0x5387, 0x18DD, 0x51CF, 0xFFFC, 0x2A79, 0x0000, 0x04C6, 0x4CED, 0x00C0, 0x0100, 0xDC80,
-    0xB0BC, 0x0000, 0x1000, 0x6606, 0x9A80, 0x6E00, 0xFEF8, 0x2006, 0x4E75, 0x3628, 0x0008, 0x2828, 0x000A, 0x2868, 0x000E, 0xB679,
-    0x00FA, 0x824A, 0x6D00, 0xF45C, 0x6116, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73,
-    0x4A84, 0x6604, 0x7000, 0x4E75, 0x4286, 0x2A04, 0xBABC, 0x0000, 0x0400, 0x6F06, 0x2A3C, 0x0000, 0x0400, 0x3E3C, 0x0005, 0x48E7,
-    0x7F08, 0x303C, 0x0488, 0x2C05, 0x6100, 0x083A, 0x4CDF, 0x10FE, 0x4A40, 0x6708, 0x51CF, 0xFFE8, 0x70A4, 0x4E75, 0x2439, 0x00FA,
-    0x93CC, 0xD9C2, 0xDC82, 0x9882, 0x6704, 0x6A00, 0xFFBE, 0x2006, 0x4E75, 0x2868, 0x0008, 0x3828, 0x000C, 0x0C2C, 0x003A, 0x0001,
-    0x6600, 0x0010, 0x1014, 0xB039, 0x00FA, 0x824F, 0x675C, 0x6000, 0xF3D2, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403,
-    0x6100, 0x06EC, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7,
-    0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x06C4, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF,
-    0xB0B9, 0x00FA, 0x8250, 0x6600, 0xF37A, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0694, 0x4CDF, 0x00FE,
-    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x002F, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404,
-    0x6100, 0x066C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2617, 0x2A0C, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x044E,
-    0x2C3C, 0x0000, 0x00C0, 0x6100, 0x073C, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2A5F, 0x3039, 0x00FA, 0x8388, 0x4A40,
-    0x6672, 0x49F9, 0x00FA, 0x838C, 0x742B, 0x1ADC, 0x51CA, 0xFFFC, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100,
-    0x060E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA, 0x8250, 0x3F00, 0x3F3C, 0x000E, 0x4E41, 0x588F, 0x3E3C,
-    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x05E0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x7000, 0x4CDF,
-    0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2F00, 0x260D, 0x742B, 0x421D, 0x51CA, 0xFFFC,
-    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x048B, 0x6100, 0x059E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3E3C,
-    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0580, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA,
-    0x8250, 0x3F00, 0x3F3C, 0x000E, 0x4E41, 0x588F, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0552, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x201F, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1,
-    0x8E21, 0x4E73, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x051A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x3F3C, 0x002F, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x04F2, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2057, 0x2028, 0x000C, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0x0026, 0x2617, 0x3E3C, 0x0005,
-    0x48E7, 0x7F00, 0x7204, 0x303C, 0x044F, 0x6100, 0x04C2, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x6000, 0xFE7A, 0x201F,
-    0x6000, 0xF180, 0x2608, 0x2848, 0x0C2C, 0x003A, 0x0001, 0x660E, 0x1014, 0xB039, 0x00FA, 0x824F, 0x6600, 0xF168, 0x6058, 0x3E3C,
-    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0480, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019,
-    0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0458, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
-    0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0xB0B9, 0x00FA, 0x8250, 0x6600, 0xF10E, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C,
-    0x044B, 0x2C3C, 0x0000, 0x0020, 0x6100, 0x051A, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x0C79, 0x0000, 0x00FA, 0x9448,
-    0x670C, 0x0C79, 0x0003, 0x00FA, 0x9448, 0x6600, 0xF0D6, 0x2879, 0x00FA, 0x9450, 0x4243, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C,
-    0x043D, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x04DA, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2039, 0x00FA, 0x83C4, 0x6B00,
-    0x0296, 0x3600, 0x283C, 0x0000, 0x001C, 0x2879, 0x0000, 0x04C6, 0x49EC, 0x0200, 0x6100, 0xFB0A, 0x2879, 0x0000, 0x04C6, 0x49EC,
-    0x0200, 0xB0BC, 0x0000, 0x001C, 0x6600, 0x0282, 0x0C6C, 0x601A, 0x0000, 0x6600, 0x0278, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C,
-    0x0484, 0x2C3C, 0x0000, 0x001C, 0x6100, 0x047A, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
-    0x7200, 0x303C, 0x0403, 0x6100, 0x0366, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2F39, 0x00FA, 0x9458, 0x2F39, 0x00FA,
-    0x9454, 0x42A7, 0x3F3C, 0x0005, 0x3F3C, 0x004B, 0x4E41, 0x4FEF, 0x0010, 0x2840, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C,
-    0x0404, 0x6100, 0x032A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4BF9, 0x00FA, 0x93E4, 0x262D, 0x0002, 0x282D, 0x0006,
-    0x2A2D, 0x000A, 0x2C2D, 0x000E, 0x2E0C, 0xDEBC, 0x0000, 0x0100, 0x2947, 0x0008, 0x2943, 0x000C, 0xDE83, 0x2947, 0x0010, 0x2944,
-    0x0014, 0xDE84, 0x2947, 0x0018, 0x2945, 0x001C, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0483, 0x2C3C, 0x0000, 0x0100, 0x6100,
-    0x03C4, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x4BF9, 0x00FA, 0x93E4, 0x49F9, 0x00FA, 0x945C, 0x286C, 0x0008, 0x282D,
-    0x0002, 0xD8AD, 0x0006, 0xD8AD, 0x000E, 0xD8BC, 0x0000, 0xFFFF, 0x2639, 0x00FA, 0x83C4, 0x6100, 0xF9E8, 0x2639, 0x00FA, 0x83C4,
-    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x027E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039,
-    0x00FA, 0x93D8, 0x48C0, 0x6B00, 0x012E, 0x4BF9, 0x00FA, 0x945C, 0x2A6D, 0x0008, 0x220D, 0x2C4D, 0x49F9, 0x00FA, 0x93E4, 0xDBEC,
-    0x0002, 0xDBEC, 0x0006, 0xDBEC, 0x000E, 0x4A95, 0x671A, 0x7000, 0xDDDD, 0xD396, 0x101D, 0x6710, 0xB03C, 0x0001, 0x6606, 0xDCFC,
-    0x00FE, 0x60F0, 0xDCC0, 0x60EA, 0x2879, 0x00FA, 0x945C, 0x2A6C, 0x0018, 0x2A2C, 0x001C, 0x6100, 0x0122, 0x0C79, 0x0003, 0x00FA,
-    0x9448, 0x6700, 0x00CC, 0x2079, 0x00FA, 0x944C, 0x317C, 0x0006, 0x0008, 0x2039, 0x00FA, 0x820C, 0xC0BC, 0x0000, 0xFFFF, 0xB07C,
-    0x1500, 0x643C, 0x263C, 0x0000, 0x0013, 0x282F, 0x0032, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x01D0,
-    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2F7C, 0x00FA, 0x22F4, 0x0032, 0x2079, 0x00FA, 0x944C, 0x317C, 0x0004, 0x0008,
-    0x42A8, 0x000A, 0x2179, 0x00FA, 0x945C, 0x000E, 0x42A8, 0x0012, 0x6000, 0xEE70, 0x48E7, 0x7FFE, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
-    0x7200, 0x303C, 0x0403, 0x6100, 0x0186, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2F39, 0x00FA, 0x945C, 0x3F3C, 0x0049,
-    0x4E41, 0x5C8F, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x015A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
-    0xFFE8, 0x48C0, 0x4CDF, 0x7FFE, 0x2F39, 0x00FA, 0x8254, 0x4E75, 0x2039, 0x00FA, 0x945C, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010,
-    0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E,
-    0x6100, 0x010C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039, 0x00FA, 0x93D8, 0x48C0, 0x60BC, 0x4A85, 0x6706, 0x421D,
-    0x5385, 0x66FA, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848,
-    0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
-    0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C, 0x0030, 0x4E41,
-    0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0, 0x0002, 0xC2BC,
-    0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100,
-    0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018,
-    0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010, 0x6702, 0x4E75,
-    0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000,
-    0x001A, 0x43F9, 0x00FA, 0x256E, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000,
-    0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700,
-    0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A,
-    0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700, 0x004C, 0xDE44,
-    0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000,
-    0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708,
-    0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4ED3, 0x4842, 0x2E3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5387, 0x66F8,
-    0x5380, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x26AA, 0xE24F,
-    0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA, 0x8200, 0x207C,
-    0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000,
-    0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30,
-    0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07, 0x4287, 0x0805,
-    0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x280C, 0x0804, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD,
-    0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x280C, 0x0804, 0x0000, 0x6726, 0x5345,
-    0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00, 0xDE44, 0x4A30,
-    0x4000, 0x601E, 0x5345, 0x670E, 0x5345, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00, 0xDE44, 0x4A30,
-    0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3, 0x4842, 0x2C3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8, 0x5380, 0x4E75,
-    0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xFFFF, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019, 0x6200, 0xF346, 0x2239,
+    0x00FA, 0x8260, 0x0101, 0x6700, 0xF33A, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0BBE,
+    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200,
+    0x303C, 0x0404, 0x6100, 0x0B96, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA,
+    0x8260, 0x0101, 0x6700, 0xF2DC, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x0B50, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x2F0C,
+    0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7210, 0x303C, 0x0457, 0x6100, 0x0B2C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x285F,
+    0x4DF9, 0x00FA, 0x941C, 0x196E, 0x0002, 0x0000, 0x196E, 0x0003, 0x0001, 0x4DF9, 0x00FA, 0x9418, 0x196E, 0x0002, 0x0002, 0x196E,
+    0x0003, 0x0003, 0x2039, 0x00FA, 0x9420, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73,
+    0x3628, 0x0008, 0x2828, 0x000A, 0x2868, 0x000E, 0xB679, 0x00FA, 0x824A, 0x6D00, 0xF22E, 0x6116, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
+    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2A04, 0x4286, 0x2A79, 0x0000, 0x04C6, 0x48ED, 0x00F8, 0x0100, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0481, 0x6100, 0x0A8E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2A79, 0x0000,
+    0x04C6, 0x4CED, 0x00F8, 0x0100, 0x4A40, 0x6706, 0x70A3, 0x6000, 0x00CE, 0x2039, 0x00FA, 0x83C8, 0x6B00, 0x00C4, 0x4A80, 0x6700,
+    0x00BC, 0x2A79, 0x0000, 0x04C6, 0x48ED, 0x00C0, 0x0100, 0x4BF9, 0x00FA, 0x83CC, 0x2E0C, 0x0807, 0x0000, 0x670E, 0x2E00, 0x5387,
+    0x18DD, 0x51CF, 0xFFFC, 0x6000, 0x0078, 0x2E00, 0xE28F, 0x0807, 0x0000, 0x6712, 0x5387, 0x38DD, 0x51CF, 0xFFFC, 0x0800, 0x0000,
+    0x675E, 0x18DD, 0x605A, 0xE28F, 0x4A87, 0x674E, 0x5387, 0xBEBC, 0x0000, 0x0008, 0x6D32, 0x2C07, 0xE68E, 0xCEBC, 0x0000, 0x0007,
+    0x5386, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x51CE, 0xFFEE, 0xBEBC, 0x0000, 0x0004, 0x6D0A, 0x28DD,
+    0x28DD, 0x28DD, 0x28DD, 0x5987, 0x28DD, 0x51CF, 0xFFFC, 0x2E00, 0xCEBC, 0x0000, 0x0003, 0x6708, 0x5387, 0x18DD, 0x51CF, 0xFFFC,
+    0x2A79, 0x0000, 0x04C6, 0x4CED, 0x00C0, 0x0100, 0xDC80, 0xB0BC, 0x0000, 0x1000, 0x6606, 0x9A80, 0x6E00, 0xFEF8, 0x2006, 0x4E75,
+    0x3628, 0x0008, 0x2828, 0x000A, 0x2868, 0x000E, 0xB679, 0x00FA, 0x824A, 0x6D00, 0xF0EE, 0x6116, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
+    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x4A84, 0x6604, 0x7000, 0x4E75, 0x4286, 0x2A04, 0xBABC, 0x0000, 0x0400,
+    0x6F06, 0x2A3C, 0x0000, 0x0400, 0x3E3C, 0x0005, 0x48E7, 0x7F08, 0x303C, 0x0488, 0x2C05, 0x6100, 0x0A3A, 0x4CDF, 0x10FE, 0x4A40,
+    0x6708, 0x51CF, 0xFFE8, 0x70A4, 0x4E75, 0x2439, 0x00FA, 0x93CC, 0xD9C2, 0xDC82, 0x9882, 0x6704, 0x6A00, 0xFFBE, 0x2006, 0x4E75,
+    0x2868, 0x0008, 0x3828, 0x000C, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C, 0x0041, 0xB03C, 0x0019,
+    0x6200, 0xF060, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xF054, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C,
+    0x0403, 0x6100, 0x08D8, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F, 0x3F00, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x08B0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x301F, 0xC0BC, 0x0000,
+    0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xEFF6, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800, 0x263C, 0x0000, 0x0017,
+    0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x086A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x4CDF, 0x0018, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0848, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF,
+    0xFFE8, 0x3F3C, 0x002F, 0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0820, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2617, 0x2A0C, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x044E, 0x2C3C, 0x0000, 0x00C0,
+    0x6100, 0x08F0, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2A5F, 0x3039, 0x00FA, 0x8388, 0x4A40, 0x6672, 0x49F9, 0x00FA,
+    0x838C, 0x742B, 0x1ADC, 0x51CA, 0xFFFC, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x07C2, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA, 0x8264, 0x3F00, 0x3F3C, 0x000E, 0x4E41, 0x588F, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
+    0x7200, 0x303C, 0x0404, 0x6100, 0x0794, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x7000, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001,
+    0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2F00, 0x260D, 0x742B, 0x421D, 0x51CA, 0xFFFC, 0x3E3C, 0x0005, 0x48E7,
+    0x7F00, 0x7204, 0x303C, 0x048B, 0x6100, 0x0752, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
+    0x7200, 0x303C, 0x0403, 0x6100, 0x0734, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA, 0x8264, 0x3F00, 0x3F3C,
+    0x000E, 0x4E41, 0x588F, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0706, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x51CF, 0xFFE8, 0x201F, 0x48C0, 0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x06CE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x002F,
+    0x4E41, 0x548F, 0x2F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x06A6, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x51CF, 0xFFE8, 0x2057, 0x2028, 0x000C, 0xB0BC, 0x0000, 0x001F, 0x6200, 0x0032, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0x0026,
+    0x2617, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x044F, 0x6100, 0x066A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x6000, 0xFE6E, 0x201F, 0x6000, 0xEDBA, 0x2608, 0x2848, 0x0C2C, 0x003A, 0x0001, 0x6624, 0x7000, 0x1014, 0xC03C, 0x00DF, 0x903C,
+    0x0041, 0xB03C, 0x0019, 0x6200, 0xED9A, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xED8E, 0x6000, 0x0092, 0x3E3C, 0x0005, 0x48E7,
+    0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0612, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3F3C, 0x0019, 0x4E41, 0x548F,
+    0x3F00, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x05EA, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x301F, 0xC0BC, 0x0000, 0xFFFF, 0x2239, 0x00FA, 0x8260, 0x0101, 0x6700, 0xED30, 0xB0B9, 0x00FA, 0x8264, 0x672E, 0x48E7, 0x1800,
+    0x263C, 0x0000, 0x0017, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x05A4, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0018, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x044B, 0x2C3C, 0x0000, 0x0020, 0x6100, 0x0674,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x0C79, 0x0000, 0x00FA, 0x9448, 0x670C, 0x0C79, 0x0003, 0x00FA, 0x9448, 0x6600,
+    0xECC2, 0x2879, 0x00FA, 0x9450, 0x4243, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x043D, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x0634,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x2039, 0x00FA, 0x83C4, 0x6B00, 0x03CC, 0x3600, 0x283C, 0x0000, 0x001C, 0x2879,
+    0x0000, 0x04C6, 0x49EC, 0x0200, 0x6100, 0xFA64, 0x2879, 0x0000, 0x04C6, 0x49EC, 0x0200, 0xB0BC, 0x0000, 0x001C, 0x6600, 0x03B8,
+    0x0C6C, 0x601A, 0x0000, 0x6600, 0x03AE, 0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0484, 0x2C3C, 0x0000, 0x001C, 0x6100, 0x05D4,
+    0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE, 0xFFE4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x04C0, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2F39, 0x00FA, 0x9458, 0x2F39, 0x00FA, 0x9454, 0x42A7, 0x3F3C, 0x0005, 0x3F3C, 0x004B,
+    0x4E41, 0x4FEF, 0x0010, 0x2840, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x0484, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x4BF9, 0x00FA, 0x93E4, 0x262D, 0x0002, 0x282D, 0x0006, 0x2A2D, 0x000A, 0x2C2D, 0x000E, 0x2E0C, 0xDEBC,
+    0x0000, 0x0100, 0x2947, 0x0008, 0x2943, 0x000C, 0xDE83, 0x2947, 0x0010, 0x2944, 0x0014, 0xDE84, 0x2947, 0x0018, 0x2945, 0x001C,
+    0x3C3C, 0x0005, 0x48E7, 0x7E08, 0x303C, 0x0483, 0x2C3C, 0x0000, 0x0100, 0x6100, 0x051E, 0x4CDF, 0x107E, 0x4A40, 0x6704, 0x51CE,
+    0xFFE4, 0x49F9, 0x00FA, 0x945C, 0x282C, 0x0008, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x048C,
+    0x6100, 0x03FA, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4AB9, 0x00FA, 0x83C8, 0x6B00, 0x0100, 0x2844, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7204, 0x303C, 0x048D, 0x6100, 0x03D0, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2039, 0x00FA, 0x83C8,
+    0x6B00, 0x0060, 0x6728, 0x4BF9, 0x00FA, 0x83CC, 0x2E00, 0xE88F, 0x670E, 0x5347, 0x28DD, 0x28DD, 0x28DD, 0x28DD, 0x51CF, 0xFFF6,
+    0xC07C, 0x000F, 0x6002, 0x18DD, 0x51C8, 0xFFFC, 0x60AE, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C,
+    0x043E, 0x6100, 0x0378, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039, 0x00FA, 0x93D8, 0x48C0, 0x6B00, 0x0204, 0x6000,
+    0x0112, 0x2C00, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x0342, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x0324, 0x4CDF, 0x00FE, 0x4A40,
+    0x6704, 0x51CF, 0xFFE8, 0x2F39, 0x00FA, 0x945C, 0x3F3C, 0x0049, 0x4E41, 0x5C8F, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C,
+    0x0404, 0x6100, 0x02F8, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2006, 0x6000, 0x018A, 0x4BF9, 0x00FA, 0x93E4, 0x49F9,
+    0x00FA, 0x945C, 0x286C, 0x0008, 0x282D, 0x0002, 0xD8AD, 0x0006, 0xD8AD, 0x000E, 0xD8BC, 0x0000, 0xFFFF, 0x2639, 0x00FA, 0x83C4,
+    0x6100, 0xF80C, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x02A2, 0x4CDF, 0x00FE,
+    0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039, 0x00FA, 0x93D8, 0x48C0, 0x6B00, 0x012E, 0x4BF9, 0x00FA, 0x945C, 0x2A6D, 0x0008, 0x220D,
+    0x2C4D, 0x49F9, 0x00FA, 0x93E4, 0xDBEC, 0x0002, 0xDBEC, 0x0006, 0xDBEC, 0x000E, 0x4A95, 0x671A, 0x7000, 0xDDDD, 0xD396, 0x101D,
+    0x6710, 0xB03C, 0x0001, 0x6606, 0xDCFC, 0x00FE, 0x60F0, 0xDCC0, 0x60EA, 0x2879, 0x00FA, 0x945C, 0x2A6C, 0x0018, 0x2A2C, 0x001C,
+    0x6100, 0x0122, 0x0C79, 0x0003, 0x00FA, 0x9448, 0x6700, 0x00CC, 0x2079, 0x00FA, 0x944C, 0x317C, 0x0006, 0x0008, 0x2039, 0x00FA,
+    0x820C, 0xC0BC, 0x0000, 0xFFFF, 0xB07C, 0x1500, 0x643C, 0x263C, 0x0000, 0x0013, 0x282F, 0x0032, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
+    0x7208, 0x303C, 0x0487, 0x6100, 0x01F4, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x2F7C, 0x00FA, 0x283E, 0x0032, 0x2079,
+    0x00FA, 0x944C, 0x317C, 0x0004, 0x0008, 0x42A8, 0x000A, 0x2179, 0x00FA, 0x945C, 0x000E, 0x42A8, 0x0012, 0x6000, 0xE926, 0x48E7,
+    0x7FFE, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0403, 0x6100, 0x01AA, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8,
+    0x2F39, 0x00FA, 0x945C, 0x3F3C, 0x0049, 0x4E41, 0x5C8F, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7200, 0x303C, 0x0404, 0x6100, 0x017E,
+    0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x48C0, 0x4CDF, 0x7FFE, 0x2F39, 0x00FA, 0x8254, 0x4E75, 0x2039, 0x00FA, 0x945C,
+    0x4CDF, 0x7CFE, 0x0CB9, 0x0001, 0x0010, 0x00FA, 0x8208, 0x6604, 0x11C1, 0x8E21, 0x4E73, 0x2639, 0x00FA, 0x83C4, 0x3E3C, 0x0005,
+    0x48E7, 0x7F00, 0x7202, 0x303C, 0x043E, 0x6100, 0x0130, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x3039, 0x00FA, 0x93D8,
+    0x48C0, 0x60BC, 0x4A85, 0x672A, 0x200D, 0x0800, 0x0000, 0x661C, 0x7000, 0x2205, 0xE889, 0x670C, 0x2AC0, 0x2AC0, 0x2AC0, 0x2AC0,
+    0x5381, 0x66F4, 0xCABC, 0x0000, 0x000F, 0x6706, 0x421D, 0x5385, 0x66FA, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018,
+    0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604,
+    0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C, 0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239,
+    0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0, 0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0487, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8,
+    0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818,
+    0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010, 0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA,
+    0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x2ADC, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC,
+    0x5841, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40,
+    0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842,
+    0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43,
+    0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700, 0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30,
+    0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010,
+    0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4ED3, 0x4842, 0x2E3C,
+    0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6,
+    0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x2C18, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286,
+    0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000,
+    0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30,
+    0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845,
+    0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07, 0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x280C, 0x0804, 0x0000, 0x6712,
+    0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x6050,
+    0x5285, 0xE24D, 0x280C, 0x0804, 0x0000, 0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD,
+    0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0x601E, 0x5345, 0x670E, 0x5345, 0x381C, 0xDE44, 0x4A30, 0x4000,
+    0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3, 0x4842, 0x2C3C, 0x0006, 0xFFFF,
+    0x7000, 0xB491, 0x6706, 0x5386, 0x66F8, 0x5380, 0x4E75, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71,
+    0x4E71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
@@ -319,18 +383,18 @@ const uint16_t target_firmware[] = {
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x4AB9, 0x00FA, 0x9A14, 0x6700, 0x001C, 0x4EB9, 0x00FA, 0x2D58, 0x6100, 0x0148, 0x6100, 0x04E8, 0x6100, 0x000C, 0x6100, 0x0056,
-    0x6000, 0x0086, 0x4E75, 0x2F3C, 0x00FA, 0x2A86, 0x3F3C, 0x002D, 0x3F3C, 0x0005, 0x4E4D, 0x508F, 0x2600, 0x283C, 0x00FA, 0x2870,
-    0x2A3C, 0x00FA, 0x2A86, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0207, 0x6100, 0x053C, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x4AB9, 0x00FA, 0x9A14, 0x6700, 0x001C, 0x4EB9, 0x00FA, 0x35EA, 0x6100, 0x0148, 0x6100, 0x057A, 0x6100, 0x000C, 0x6100, 0x0056,
+    0x6000, 0x0086, 0x4E75, 0x2F3C, 0x00FA, 0x3286, 0x3F3C, 0x002D, 0x3F3C, 0x0005, 0x4E4D, 0x508F, 0x2600, 0x283C, 0x00FA, 0x3070,
+    0x2A3C, 0x00FA, 0x3286, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0207, 0x6100, 0x05CE, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
     0x51CF, 0xFFE8, 0x4A40, 0x4E75, 0x5842, 0x5241, 0x5344, 0x4645, 0x0000, 0x0000, 0x2638, 0x00B8, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
-    0x7204, 0x303C, 0x0200, 0x6100, 0x050A, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4AB9, 0x00FA, 0x9A08, 0x6708, 0x21FC,
-    0x00FA, 0x298C, 0x00B8, 0x4E75, 0x0839, 0x0000, 0x0000, 0x04A7, 0x670C, 0x4278, 0x0446, 0x00B8, 0x0000, 0x0003, 0x04C2, 0x4278,
+    0x7204, 0x303C, 0x0200, 0x6100, 0x059C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4AB9, 0x00FA, 0x9A08, 0x6708, 0x21FC,
+    0x00FA, 0x318C, 0x00B8, 0x4E75, 0x0839, 0x0000, 0x0000, 0x04A7, 0x670C, 0x4278, 0x0446, 0x00B8, 0x0000, 0x0003, 0x04C2, 0x4278,
     0x0446, 0x31FC, 0x0002, 0x04A6, 0x0838, 0x0000, 0x04C5, 0x6708, 0x00B8, 0x0000, 0x0001, 0x04C2, 0x0839, 0x0000, 0x00FA, 0x9A13,
     0x6708, 0x00B8, 0x0000, 0x0001, 0x04C2, 0x0838, 0x0001, 0x04C5, 0x6708, 0x00B8, 0x0000, 0x0002, 0x04C2, 0x0839, 0x0001, 0x00FA,
     0x9A13, 0x6708, 0x00B8, 0x0000, 0x0002, 0x04C2, 0x0838, 0x0000, 0x04C5, 0x6700, 0x0044, 0x0839, 0x0000, 0x00FA, 0x9A13, 0x6700,
-    0x0038, 0x4AB9, 0x00FA, 0x9A0C, 0x672E, 0x7C00, 0x2800, 0x2400, 0x3439, 0x00FA, 0x9A24, 0x2878, 0x0432, 0x6100, 0x02D4, 0x2278,
-    0x0432, 0x2049, 0x323C, 0x00FF, 0x4282, 0xD459, 0x51C9, 0xFFFC, 0xB47C, 0x1234, 0x6602, 0x4ED0, 0x4E75, 0x6100, 0x034E, 0x2600,
-    0x283C, 0x00FA, 0x2BCE, 0x2A3C, 0x00FA, 0x2BEA, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0204, 0x6100, 0x0416, 0x4CDF,
+    0x0038, 0x4AB9, 0x00FA, 0x9A0C, 0x672E, 0x7C00, 0x2800, 0x2400, 0x3439, 0x00FA, 0x9A24, 0x2878, 0x0432, 0x6100, 0x0366, 0x2278,
+    0x0432, 0x2049, 0x323C, 0x00FF, 0x4282, 0xD459, 0x51C9, 0xFFFC, 0xB47C, 0x1234, 0x6602, 0x4ED0, 0x4E75, 0x6100, 0x03E0, 0x2600,
+    0x283C, 0x00FA, 0x3460, 0x2A3C, 0x00FA, 0x347C, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x720C, 0x303C, 0x0204, 0x6100, 0x04A8, 0x4CDF,
     0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4E75, 0x0817, 0x0005, 0x6704, 0x204F, 0x6004, 0x4E68, 0x5D88, 0x4A79, 0x0000, 0x059E,
     0x6702, 0x5448, 0x0C68, 0x0008, 0x0006, 0x6700, 0x006E, 0x0C68, 0x0009, 0x0006, 0x6700, 0x005A, 0x0C68, 0x000D, 0x0006, 0x6710,
     0x0C68, 0x000A, 0x0006, 0x6724, 0x2F39, 0x00FA, 0x9A20, 0x4E75, 0x0C68, 0x0001, 0x0010, 0x660C, 0x4268, 0x0010, 0x2F39, 0x00FA,
@@ -338,51 +402,55 @@ const uint16_t target_firmware[] = {
     0x2F39, 0x00FA, 0x9A20, 0x4E75, 0x70FF, 0x42A8, 0x0008, 0x4E73, 0x7001, 0x4A68, 0x0010, 0x672E, 0x6008, 0x7000, 0x4A68, 0x0010,
     0x6724, 0x48E7, 0x1F1E, 0x3439, 0x00FA, 0x9A46, 0x7801, 0x7C00, 0x3C28, 0x0014, 0xCCF9, 0x00FA, 0x9A5C, 0x3828, 0x0016, 0xC8F9,
     0x00FA, 0x9A5E, 0x6022, 0x48E7, 0x1F1E, 0x3439, 0x00FA, 0x9A24, 0x7800, 0x7C00, 0x3C28, 0x0014, 0xCCF9, 0x00FA, 0x9A3A, 0x3828,
-    0x0016, 0xC8F9, 0x00FA, 0x9A3C, 0xDC84, 0xDC68, 0x0012, 0x5346, 0x3228, 0x0018, 0x2868, 0x0008, 0x2A00, 0x6100, 0x0152, 0x4CDF,
+    0x0016, 0xC8F9, 0x00FA, 0x9A3C, 0xDC84, 0xDC68, 0x0012, 0x5346, 0x3228, 0x0018, 0x2868, 0x0008, 0x2A00, 0x6100, 0x01E4, 0x4CDF,
     0x78F8, 0x4280, 0x4E73, 0x0817, 0x0005, 0x6704, 0x204F, 0x6004, 0x4E68, 0x5D88, 0x4A79, 0x0000, 0x059E, 0x6702, 0x5448, 0x0C68,
-    0x0007, 0x0006, 0x671A, 0x0C68, 0x0009, 0x0006, 0x674E, 0x0C68, 0x0004, 0x0006, 0x6700, 0x0082, 0x2F39, 0x00FA, 0x2870, 0x4E75,
-    0x0C68, 0x0000, 0x0008, 0x6710, 0x0C68, 0x0001, 0x0008, 0x671A, 0x2F39, 0x00FA, 0x2870, 0x4E75, 0x0839, 0x0000, 0x00FA, 0x9A13,
-    0x67EE, 0x203C, 0x00FA, 0x9A24, 0x4E73, 0x0839, 0x0001, 0x00FA, 0x9A13, 0x67DC, 0x203C, 0x00FA, 0x9A46, 0x4E73, 0x0C68, 0x0000,
-    0x0008, 0x6710, 0x0C68, 0x0001, 0x0008, 0x671A, 0x2F39, 0x00FA, 0x2870, 0x4E75, 0x0839, 0x0000, 0x00FA, 0x9A13, 0x67EE, 0x2039,
-    0x00FA, 0x9A18, 0x4E73, 0x0839, 0x0001, 0x00FA, 0x9A13, 0x67DC, 0x2039, 0x00FA, 0x9A1C, 0x4E73, 0x0C68, 0x0000, 0x0012, 0x6710,
-    0x0C68, 0x0001, 0x0012, 0x6746, 0x2F39, 0x00FA, 0x2870, 0x4E75, 0x0839, 0x0000, 0x00FA, 0x9A13, 0x67EE, 0x4AA8, 0x000A, 0x6604,
-    0x7000, 0x4E73, 0x48E7, 0x1F1E, 0x7800, 0x3439, 0x00FA, 0x9A24, 0x3C28, 0x0010, 0x3228, 0x000E, 0x2868, 0x000A, 0x3A28, 0x0008,
-    0xCABC, 0x0000, 0x0001, 0x6146, 0x4CDF, 0x78F8, 0x4E73, 0x0839, 0x0001, 0x00FA, 0x9A13, 0x67B0, 0x4AA8, 0x000A, 0x6604, 0x7000,
-    0x4E73, 0x48E7, 0x1F1E, 0x7801, 0x3439, 0x00FA, 0x9A46, 0x3C28, 0x0010, 0x3228, 0x000E, 0x2868, 0x000A, 0x3A28, 0x0008, 0xCABC,
-    0x0000, 0x0001, 0x6108, 0x4CDF, 0x78F8, 0x4280, 0x4E73, 0x1F38, 0x8E21, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4A45,
-    0x6600, 0x0006, 0x610A, 0x6002, 0x6116, 0x11DF, 0x8E21, 0x4E75, 0x5341, 0x611C, 0x4A40, 0x6606, 0x5246, 0x51C9, 0xFFF6, 0x4E75,
-    0x5341, 0x616E, 0x4A40, 0x6606, 0x5246, 0x51C9, 0xFFF6, 0x4E75, 0x3A3C, 0x0005, 0x48E7, 0x6000, 0x3606, 0x4843, 0x3602, 0x7208,
-    0x203C, 0x0000, 0x0201, 0x6100, 0x016A, 0x4843, 0x4844, 0x4CDF, 0x0006, 0x4A40, 0x6704, 0x51CD, 0xFFDC, 0x4A40, 0x6620, 0x4280,
-    0x3A02, 0x227C, 0x00FA, 0x9B20, 0xE44D, 0x5345, 0x260C, 0x0803, 0x0000, 0x660E, 0x28D9, 0x51CD, 0xFFFC, 0x7000, 0x4E75, 0x70FF,
-    0x4E75, 0x18D9, 0x18D9, 0x18D9, 0x18D9, 0x51CD, 0xFFF6, 0x7000, 0x4E75, 0x3A3C, 0x0005, 0x48E7, 0x7E08, 0x3606, 0x4843, 0x3602,
-    0x2A0C, 0x7C00, 0x3C02, 0x203C, 0x0000, 0x0202, 0x6100, 0x01FA, 0x4CDF, 0x107E, 0x4A40, 0x6706, 0x51CD, 0xFFDC, 0x4E75, 0x4280,
-    0xC4BC, 0x0000, 0xFFFF, 0xD9C2, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348,
-    0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04, 0x263C, 0x0000, 0x0000, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C,
-    0x0205, 0x6100, 0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C,
-    0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78, 0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0,
-    0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C,
-    0x0205, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A,
-    0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010,
-    0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6,
-    0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x2E72, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0x8200, 0x207C,
-    0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000,
-    0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004,
-    0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006, 0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700,
-    0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45,
-    0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C,
-    0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30, 0x7000, 0x4ED3, 0x4842, 0x2E3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706,
-    0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA,
-    0x2FAE, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA,
-    0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41,
-    0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000,
-    0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07,
-    0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345, 0x280C, 0x0804, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000,
-    0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x280C, 0x0804, 0x0000,
-    0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00,
-    0xDE44, 0x4A30, 0x4000, 0x601E, 0x5345, 0x670E, 0x5345, 0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00,
-    0xDE44, 0x4A30, 0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3, 0x4842, 0x2C3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8,
-    0x5380, 0x4E75, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0007, 0x0006, 0x671C, 0x0C68, 0x0009, 0x0006, 0x6700, 0x00C8, 0x0C68, 0x0004, 0x0006, 0x6700, 0x0112, 0x2F39, 0x00FA, 0x3070,
+    0x4E75, 0x0C68, 0x0000, 0x0008, 0x6710, 0x0C68, 0x0001, 0x0008, 0x6756, 0x2F39, 0x00FA, 0x3070, 0x4E75, 0x0839, 0x0000, 0x00FA,
+    0x9A13, 0x67EE, 0x2039, 0x00FA, 0x9A18, 0xB0B9, 0x00FA, 0x9A20, 0x672E, 0x48E7, 0x7FFE, 0x263C, 0x0000, 0x0606, 0x2800, 0x3E3C,
+    0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0205, 0x6100, 0x0316, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x7FFE,
+    0x203C, 0x00FA, 0x9A24, 0x4E73, 0x0839, 0x0001, 0x00FA, 0x9A13, 0x67A0, 0x2039, 0x00FA, 0x9A1C, 0xB0B9, 0x00FA, 0x9A24, 0x672E,
+    0x48E7, 0x7FFE, 0x263C, 0x0000, 0x0607, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0205, 0x6100, 0x02C8, 0x4CDF,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x7FFE, 0x203C, 0x00FA, 0x9A46, 0x4E73, 0x0C68, 0x0000, 0x0008, 0x6710, 0x0C68,
+    0x0001, 0x0008, 0x6724, 0x2F39, 0x00FA, 0x3070, 0x4E75, 0x0839, 0x0000, 0x00FA, 0x9A13, 0x67EE, 0x2039, 0x00FA, 0x9A18, 0xB0B9,
+    0x00FA, 0x9A20, 0x6620, 0x7000, 0x4E73, 0x0839, 0x0001, 0x00FA, 0x9A13, 0x67D2, 0x2039, 0x00FA, 0x9A1C, 0xB0B9, 0x00FA, 0x9A24,
+    0x6604, 0x7000, 0x4E73, 0x7002, 0x4E73, 0x0C68, 0x0000, 0x0012, 0x6710, 0x0C68, 0x0001, 0x0012, 0x6746, 0x2F39, 0x00FA, 0x3070,
+    0x4E75, 0x0839, 0x0000, 0x00FA, 0x9A13, 0x67EE, 0x4AA8, 0x000A, 0x6604, 0x7000, 0x4E73, 0x48E7, 0x1F1E, 0x7800, 0x3439, 0x00FA,
+    0x9A24, 0x3C28, 0x0010, 0x3228, 0x000E, 0x2868, 0x000A, 0x3A28, 0x0008, 0xCABC, 0x0000, 0x0001, 0x6146, 0x4CDF, 0x78F8, 0x4E73,
+    0x0839, 0x0001, 0x00FA, 0x9A13, 0x67B0, 0x4AA8, 0x000A, 0x6604, 0x7000, 0x4E73, 0x48E7, 0x1F1E, 0x7801, 0x3439, 0x00FA, 0x9A46,
+    0x3C28, 0x0010, 0x3228, 0x000E, 0x2868, 0x000A, 0x3A28, 0x0008, 0xCABC, 0x0000, 0x0001, 0x6108, 0x4CDF, 0x78F8, 0x4280, 0x4E73,
+    0x1F38, 0x8E21, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000, 0x8E21, 0x4A45, 0x6600, 0x0006, 0x610A, 0x6002, 0x6116, 0x11DF, 0x8E21,
+    0x4E75, 0x5341, 0x611C, 0x4A40, 0x6606, 0x5246, 0x51C9, 0xFFF6, 0x4E75, 0x5341, 0x616E, 0x4A40, 0x6606, 0x5246, 0x51C9, 0xFFF6,
+    0x4E75, 0x3A3C, 0x0005, 0x48E7, 0x6000, 0x3606, 0x4843, 0x3602, 0x7208, 0x203C, 0x0000, 0x0201, 0x6100, 0x016A, 0x4843, 0x4844,
+    0x4CDF, 0x0006, 0x4A40, 0x6704, 0x51CD, 0xFFDC, 0x4A40, 0x6620, 0x4280, 0x3A02, 0x227C, 0x00FA, 0x9B20, 0xE44D, 0x5345, 0x260C,
+    0x0803, 0x0000, 0x660E, 0x28D9, 0x51CD, 0xFFFC, 0x7000, 0x4E75, 0x70FF, 0x4E75, 0x18D9, 0x18D9, 0x18D9, 0x18D9, 0x51CD, 0xFFF6,
+    0x7000, 0x4E75, 0x3A3C, 0x0005, 0x48E7, 0x7E08, 0x3606, 0x4843, 0x3602, 0x2A0C, 0x7C00, 0x3C02, 0x203C, 0x0000, 0x0202, 0x6100,
+    0x01FA, 0x4CDF, 0x107E, 0x4A40, 0x6706, 0x51CD, 0xFFDC, 0x4E75, 0x4280, 0xC4BC, 0x0000, 0xFFFF, 0xD9C2, 0x4E75, 0x2038, 0x05A0,
+    0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0x2F04,
+    0x263C, 0x0000, 0x0000, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0205, 0x6100, 0x00AE, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x51CF, 0xFFE8, 0x4A40, 0x6604, 0x201F, 0x4E75, 0x281F, 0x60CE, 0x3F3C, 0x0030, 0x4E41, 0x548F, 0xC0BC, 0x0000, 0xFFFF, 0x0C78,
+    0x00FC, 0x0004, 0x6608, 0x3239, 0x00FC, 0x0002, 0x6006, 0x3239, 0x00E0, 0x0002, 0xC2BC, 0x0000, 0xFFFF, 0x4841, 0x8081, 0x263C,
+    0x0000, 0x0001, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0205, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40, 0x6704,
+    0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D, 0x4348,
+    0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010, 0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8, 0x0000,
+    0x8E21, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x3704, 0xE24F,
+    0x5347, 0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C, 0xABCD,
+    0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000, 0xB27C,
+    0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0006,
+    0x6700, 0x005C, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xB27C, 0x0008, 0x6700, 0x004C, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000A, 0x6700,
+    0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845, 0xDE45,
+    0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000, 0x4A30,
+    0x7000, 0x4ED3, 0x4842, 0x2E3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA, 0x8204,
+    0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x3840, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0xCCBC,
+    0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000,
+    0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842, 0xDE42,
+    0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30, 0x4000,
+    0xDE45, 0x4A30, 0x5000, 0x4845, 0xDE45, 0x4A30, 0x5000, 0x2A06, 0x2C07, 0x4287, 0x0805, 0x0000, 0x662E, 0x5285, 0xE24D, 0x5345,
+    0x280C, 0x0804, 0x0000, 0x6712, 0x161C, 0xE14B, 0x161C, 0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x605E, 0x381C, 0xDE44, 0x4A30,
+    0x4000, 0x51CD, 0xFFF6, 0x6050, 0x5285, 0xE24D, 0x280C, 0x0804, 0x0000, 0x6726, 0x5345, 0x6712, 0x5345, 0x161C, 0xE14B, 0x161C,
+    0x4A30, 0x3000, 0xDE43, 0x51CD, 0xFFF2, 0x181C, 0xE14C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0x601E, 0x5345, 0x670E, 0x5345,
+    0x381C, 0xDE44, 0x4A30, 0x4000, 0x51CD, 0xFFF6, 0x381C, 0xC87C, 0xFF00, 0xDE44, 0x4A30, 0x4000, 0xDC47, 0x4A30, 0x6000, 0x4ED3,
+    0x4842, 0x2C3C, 0x0006, 0xFFFF, 0x7000, 0xB491, 0x6706, 0x5386, 0x66F8, 0x5380, 0x4E75, 0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71,
+    0x4E71, 0x4E71, 0x4E71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
@@ -411,21 +479,17 @@ const uint16_t target_firmware[] = {
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x4AB9, 0x00FA, 0xA208, 0x6700, 0x0088, 0x4EB9, 0x00FA, 0x366C, 0x6100, 0x01AC, 0x6100, 0x01FC, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
+    0x4AB9, 0x00FA, 0xA208, 0x6700, 0x0088, 0x4EB9, 0x00FA, 0x3E6C, 0x6100, 0x01AC, 0x6100, 0x01FC, 0x3E3C, 0x0005, 0x48E7, 0x7F00,
     0x7200, 0x303C, 0x0301, 0x6100, 0x027E, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x6600, 0x0058, 0x4AB9, 0x00FA,
     0xA234, 0x670A, 0x6100, 0x0062, 0x4A40, 0x6600, 0x0046, 0x4879, 0x00FA, 0xA220, 0x3F3C, 0x0006, 0x3F3C, 0x0019, 0x4E4E, 0x508F,
     0x2039, 0x00FA, 0xA228, 0x6100, 0x0102, 0x4A40, 0x6600, 0x0024, 0x3F3C, 0x0017, 0x4E4E, 0x548F, 0x4AB9, 0x00FA, 0xA234, 0x6706,
-    0xD0BC, 0x3C00, 0x0000, 0x2F00, 0x3F3C, 0x0016, 0x4E4E, 0x5C8F, 0x4E75, 0x4879, 0x00FA, 0x3594, 0x3F3C, 0x0009, 0x4E41, 0x3F3C,
+    0xD0BC, 0x3C00, 0x0000, 0x2F00, 0x3F3C, 0x0016, 0x4E4E, 0x5C8F, 0x4E75, 0x4879, 0x00FA, 0x3D94, 0x3F3C, 0x0009, 0x4E41, 0x3F3C,
     0x0007, 0x4E41, 0x508F, 0x4E75, 0x2638, 0x00B8, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7204, 0x303C, 0x0302, 0x6100, 0x01EA, 0x4CDF,
-    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x660A, 0x21FC, 0x00FA, 0x34DC, 0x00B8, 0x4E75, 0x70FF, 0x4E75, 0x0817, 0x0005,
+    0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x660A, 0x21FC, 0x00FA, 0x3CDC, 0x00B8, 0x4E75, 0x70FF, 0x4E75, 0x0817, 0x0005,
     0x6704, 0x204F, 0x6004, 0x4E68, 0x5D88, 0x4A79, 0x0000, 0x059E, 0x6702, 0x5448, 0x0C68, 0x0017, 0x0006, 0x6710, 0x0C68, 0x0016,
     0x0006, 0x6756, 0x2F39, 0x00FA, 0xA230, 0x4E75, 0x48E7, 0x1880, 0x263C, 0x0000, 0x0801, 0x2828, 0x0002, 0x3E3C, 0x0005, 0x48E7,
     0x7F00, 0x7208, 0x303C, 0x0303, 0x6100, 0x017C, 0x4CDF, 0x00FE, 0x4A40, 0x6704, 0x51CF, 0xFFE8, 0x4CDF, 0x0118, 0x217C, 0x00FA,
-    0x354C, 0x0002, 0x2F39, 0x00FA, 0xA230, 0x4E75, 0xD0BC, 0x3C00, 0x0000, 0x2079, 0x00FA, 0xA20C, 0x4ED0, 0x04A8, 0x3C00, 0x0000,
+    0x3D4C, 0x0002, 0x2F39, 0x00FA, 0xA230, 0x4E75, 0xD0BC, 0x3C00, 0x0000, 0x2079, 0x00FA, 0xA20C, 0x4ED0, 0x04A8, 0x3C00, 0x0000,
     0x0008, 0x2F39, 0x00FA, 0xA230, 0x4E75, 0x2E00, 0x4847, 0x3F07, 0x3F3C, 0x002D, 0x4E41, 0x588F, 0x4A40, 0x6614, 0x4847, 0x3F07,
     0x3F3C, 0x002B, 0x4E41, 0x588F, 0x4A40, 0x6604, 0x7000, 0x4E75, 0x70FF, 0x4E75, 0x0D0A, 0x436F, 0x6D6D, 0x756E, 0x6963, 0x6174,
     0x696F, 0x6E20, 0x6572, 0x726F, 0x722E, 0x2050, 0x7265, 0x7373, 0x2072, 0x6573, 0x6574, 0x2E0D, 0x0A00, 0xFFFF, 0xFFFF, 0x2038,
@@ -436,7 +500,7 @@ const uint16_t target_firmware[] = {
     0x263C, 0x0000, 0x0001, 0x2800, 0x3E3C, 0x0005, 0x48E7, 0x7F00, 0x7208, 0x303C, 0x0303, 0x6100, 0x004E, 0x4CDF, 0x00FE, 0x4A40,
     0x6704, 0x51CF, 0xFFE8, 0x4A40, 0x66A8, 0x4E75, 0x2038, 0x05A0, 0x6700, 0x001A, 0x2040, 0x2018, 0x6700, 0x0012, 0xB0BC, 0x5F4D,
     0x4348, 0x6704, 0x5848, 0x60EE, 0x2818, 0x6002, 0x4284, 0xB8BC, 0x0001, 0x0010, 0x6702, 0x4E75, 0x0238, 0x0001, 0x8E21, 0x08B8,
-    0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x3786,
+    0x0000, 0x8E21, 0x4E75, 0x2439, 0x00FA, 0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x3F86,
     0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC, 0x5841, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000, 0x8000, 0x3E3C,
     0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0x4A41, 0x6700, 0x0088, 0xDE42, 0x4A30, 0x2000,
     0xB27C, 0x0002, 0x6700, 0x007A, 0x4842, 0xDE42, 0x4A30, 0x2000, 0xB27C, 0x0004, 0x6700, 0x006A, 0xDE43, 0x4A30, 0x3000, 0xB27C,
@@ -444,7 +508,7 @@ const uint16_t target_firmware[] = {
     0x6700, 0x003E, 0x4844, 0xDE44, 0x4A30, 0x4000, 0xB27C, 0x000C, 0x672E, 0xDE45, 0x4A30, 0x5000, 0xB27C, 0x000E, 0x6722, 0x4845,
     0xDE45, 0x4A30, 0x5000, 0xB27C, 0x0010, 0x6714, 0xDE46, 0x4A30, 0x6000, 0xB27C, 0x0012, 0x6708, 0x4846, 0xDE46, 0x4A30, 0x6000,
     0x4A30, 0x7000, 0x4ED3, 0x4842, 0x2E3C, 0x0000, 0x0FFF, 0x7000, 0xB491, 0x6706, 0x5387, 0x66F8, 0x5380, 0x4E75, 0x2439, 0x00FA,
-    0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x38C2, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC,
+    0x8204, 0x2478, 0x04C6, 0x2678, 0x04C6, 0x2E3C, 0x0000, 0x001A, 0x43F9, 0x00FA, 0x40C2, 0xE24F, 0x5347, 0x34D9, 0x51CF, 0xFFFC,
     0xCCBC, 0x0000, 0xFFFF, 0x7210, 0xD286, 0x5281, 0xE289, 0xE389, 0x43F9, 0x00FA, 0x8200, 0x207C, 0x00FB, 0x0000, 0xD1FC, 0x0000,
     0x8000, 0x3E3C, 0xABCD, 0x4A30, 0x7000, 0x4287, 0xDE40, 0x4A30, 0x0000, 0xDE41, 0x4A30, 0x1000, 0xDE42, 0x4A30, 0x2000, 0x4842,
     0xDE42, 0x4A30, 0x2000, 0xDE43, 0x4A30, 0x3000, 0x4843, 0xDE43, 0x4A30, 0x3000, 0xDE44, 0x4A30, 0x4000, 0x4844, 0xDE44, 0x4A30,
@@ -607,70 +671,6 @@ const uint16_t target_firmware[] = {
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
     0x0CB9, 0xFFFF, 0xFFFF, 0x00FA, 0xA408, 0x6600, 0x0016, 0x2039, 0x00FA, 0xA430, 0x6704, 0x21C0, 0x0516, 0x6100, 0x0342, 0x6100,
     0x0004, 0x4E75, 0x2038, 0x046A, 0xB0BC, 0x00FA, 0x55B2, 0x665C, 0x2038, 0x0472, 0xB0BC, 0x00FA, 0x59CA, 0x6650, 0x2038, 0x0476,
     0xB0BC, 0x00FA, 0x5B70, 0x6644, 0x2038, 0x047A, 0xB0BC, 0x00FA, 0x5E2E, 0x6638, 0x2038, 0x047E, 0xB0BC, 0x00FA, 0x5E70, 0x662C,
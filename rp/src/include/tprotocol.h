@@ -202,6 +202,12 @@ static inline void __not_in_flash_func(tprotocol_parse)(
       break;
 
     case PAYLOAD_SIZE_READ:
+      if (data > MAX_PROTOCOL_PAYLOAD_SIZE) {
+        // A garbled size would write past the payload buffer. Resync.
+        last_header_found = 0;
+        nextTPstep = HEADER_DETECTION;
+        break;
+      }
       transmission.payload_size = data;
     case PAYLOAD_READ_START:
       transmission.bytes_read = 0;
@@ -212,10 +218,15 @@ static inline void __not_in_flash_func(tprotocol_parse)(
       break;
     case PAYLOAD_READ_INPROGRESS:
       // Store the 16-bit chunk into the payload array
+#if defined(__arm__)
       asm("strh %0, [%1]"
           :
           : "r"(data), "r"(&transmission.payload[(transmission.bytes_read / 2)])
           : "memory");
+#else
+      // Host builds (scripts/rom3replay) replay captures through this parser
+      transmission.payload[transmission.bytes_read / 2] = data;
+#endif
       // *((uint16_t *)(&transmission.payload[transmission.bytes_read])) =
       // data;
       transmission.bytes_read += 2;
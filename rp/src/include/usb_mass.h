@@ -15,13 +15,17 @@
 #include <string.h>
 
 #include "blink.h"
+#include "commemul.h"
 #include "constants.h"
 #include "debug.h"
 #include "diskio.h" /* Declarations of disk functions */
 #include "f_util.h"
 #include "ff.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "sd_card.h"
 #include "tusb.h"
+#include "usb_mass_cache.h"
 
 // For resetting the USB controller
 #include "hardware/resets.h"
@@ -29,9 +33,44 @@
 #define USBDRIVE_READ_ONLY false
 #define USBDRIVE_MASS_STORE true
 
+// Not in the TinyUSB SCSI command list
+#define USB_MASS_SCSI_SYNCHRONIZE_CACHE10 0x35
+
+// Runtime mode. The SD card stays on core 0 and is only read or written
+// for the host after the ROM3 bus has been quiet this long.
+#define USB_MASS_RUNTIME_QUIET_US 500
+// Buffer of the mailbox between the cores: one endpoint buffer, plus one
+// sector when it doesn't start on a sector boundary.
+#define USB_MASS_RUNTIME_SECTORS ((CFG_TUD_MSC_EP_BUFSIZE / FF_MAX_SS) + 1)
+// Time off the bus so the host enumerates again with the new settings
+#define USB_MASS_RECONNECT_MS 250
+#define USB_MASS_STATS_PATH "/usbmsc.txt"
+
+typedef struct {
+  uint32_t slices;          // SD card accesses done for the host
+  uint32_t sectorsRead;     // Sectors read for the host
+  uint32_t sectorsWritten;  // Sectors written for the host
+  uint32_t maxSliceUs;      // Longest SD card access
+  uint32_t collisions;      // Accesses the Atari had to wait for
+  uint32_t maxCollisionUs;  // Longest of them
+} UsbMassRuntimeStats;
+
 // Init USB Mass storage device
 bool usb_mass_init(void);
 bool usb_mass_start(void);
 bool usb_mass_get_mounted(void);
 
+// Keep the device connected while the emulation runs. From now on the
+// device task runs on core 1 (usb_mass_runtimeTask) and core 0 must call
+// usb_mass_runtimeService() from its main loop. Read only unless writable,
+// then the host asks for the card with usb_mass_runtimeHostWantsCard().
+bool usb_mass_runtimeStart(bool writable);
+void __not_in_flash_func(usb_mass_runtimeTask)(void);
+void __not_in_flash_func(usb_mass_runtimeService)(void);
+bool usb_mass_runtimeHostWantsCard(void);
+bool usb_mass_runtimeHostOwnsCard(void);
+void usb_mass_runtimeSetHostOwnsCard(bool owned);
+void usb_mass_runtimeGetStats(UsbMassRuntimeStats *stats);
+FRESULT usb_mass_runtimeDumpStats(const char *path);
+
 #endif  // USB_MASS_H
@@ -0,0 +1,80 @@
+/**
+ * File: usb_mass_cache.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Header for the sector cache of the USB Mass storage device.
+ * Keeps the FAT and directory sectors the host re-reads, reads ahead on
+ * sequential reads and merges the sectors of a WRITE10 command into
+ * multi-sector writes. Only depends on diskio.h so scripts/usbmsc can run
+ * it on a computer.
+ */
+
+#ifndef USB_MASS_CACHE_H
+#define USB_MASS_CACHE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "diskio.h"
+#include "ff.h"
+
+// Sector size of the USB device. Same as the FatFS one.
+#define USB_MASS_CACHE_SECTOR_SIZE FF_MAX_SS
+
+// Metadata sectors (partition table, FAT, root directory) kept in RAM. The
+// least recently used one is replaced.
+#define USB_MASS_CACHE_SLOTS 16u
+
+// Metadata areas of the volume, e.g. everything before the data area and
+// the first cluster of a FAT32 or exFAT root directory.
+#define USB_MASS_CACHE_RANGES 2u
+
+// Sectors read at once when the host reads sequentially
+#define USB_MASS_READAHEAD_SECTORS 8u
+
+// Sectors merged into one disk_write
+#define USB_MASS_WRITE_SECTORS 8u
+
+typedef struct {
+  uint32_t sectorsRead;      // Sectors the host read
+  uint32_t sectorsHit;       // Of them, served from RAM
+  uint32_t diskReads;        // disk_read calls
+  uint32_t diskReadSectors;  // Sectors read from the card
+  uint32_t sectorsWritten;   // Sectors the host wrote
+  uint32_t diskWrites;       // disk_write calls
+} UsbMassCacheStats;
+
+// Allocate the buffers (16 KB). Returns false if there is not enough
+// memory: callers then go straight to disk_read/disk_write.
+bool usb_mass_cache_init(uint32_t sectorCount);
+
+// Write the pending sectors and free the buffers
+void usb_mass_cache_release(void);
+
+bool usb_mass_cache_isReady(void);
+
+// Mark [start, start + count) as metadata. Up to USB_MASS_CACHE_RANGES.
+void usb_mass_cache_addMetadataRange(uint32_t start, uint32_t count);
+
+// Forget every cached sector. The pending writes are kept.
+void usb_mass_cache_invalidate(void);
+
+// READ10/WRITE10 callbacks: lba of the command, byte offset in the command
+// and a chunk of its data. Return bufsize, or -1 if the card failed.
+int32_t usb_mass_cache_read(uint32_t lba, uint32_t offset, uint8_t *buffer,
+                            uint32_t bufsize);
+int32_t usb_mass_cache_write(uint32_t lba, uint32_t offset,
+                             const uint8_t *buffer, uint32_t bufsize);
+
+// Write the merged sectors. Call it when a WRITE10 command ends and on
+// SYNCHRONIZE CACHE. Returns false if the card failed.
+bool usb_mass_cache_flush(void);
+
+// A flush without a command to report it to (e.g. the end of a WRITE10)
+// failed. Returns the error once so the next command can report it.
+bool usb_mass_cache_takeWriteError(void);
+
+void usb_mass_cache_getStats(UsbMassCacheStats *stats);
+
+#endif  // USB_MASS_CACHE_H
@@ -7,11 +7,15 @@
  */
 
 #include "aconfig.h"
+#include "acsi_scancache.h"
+#include "bootcache.h"
 #include "constants.h"
 #include "debug.h"
 #include "emul.h"
 #include "gconfig.h"
+#include "perfprofile.h"
 #include "reset.h"
+#include "sramstat.h"
 
 // This is the main.c file for the app or microfirmware. It is the entry point
 // for the application. It is the first file that is executed when the
@@ -31,16 +35,11 @@
 // should be modified when adding new features to the application.
 
 int main() {
-  // Set the clock frequency. Keep in mind that if you are managing remote
-  // commands you should overclock the CPU to >=225MHz
-  set_sys_clock_khz(RP2040_CLOCK_FREQ_KHZ, true);
-
-  // Set the voltage. Be cautios with this. I don't think it's possible to
-  // damage the hardware, but it's possible to make the hardware unstable.
-  vreg_set_voltage(RP2040_VOLTAGE);
-
-#undef PICO_FLASH_SPI_CLKDIV
-#define PICO_FLASH_SPI_CLKDIV 4
+  // Set the clock frequency, the voltage and the flash divider of the
+  // standard profile. Keep in mind that if you are managing remote commands
+  // you should overclock the CPU to >=225MHz. The profile chosen in the
+  // settings is applied once they are loaded.
+  perfprofile_apply(PERFPROFILE_STANDARD);
 
   // A note about outputting debug information through the UART. It's not
   // recommended to output debug information through the UART in a production
@@ -62,12 +61,6 @@ int main() {
   DPRINTF("\n\nApp. %s (%s). %s mode.\n\n", RELEASE_VERSION, RELEASE_DATE,
           _DEBUG ? "DEBUG" : "RELEASE");
 
-  // Show information about the frequency and voltage
-  int currentClockFrequencyKhz = RP2040_CLOCK_FREQ_KHZ;
-  const char *currentVoltage = VOLTAGE_VALUES[RP2040_VOLTAGE];
-  DPRINTF("Clock frequency: %i KHz\n", currentClockFrequencyKhz);
-  DPRINTF("Voltage: %s\n", currentVoltage);
-  DPRINTF("FLASH SPI CLKDIV: %i\n", PICO_FLASH_SPI_CLKDIV);
   DPRINTF("PICO_FLASH_SIZE_BYTES: %i\n", PICO_FLASH_SIZE_BYTES);
   DPRINTF("Enable XIP cache: %s\n", DISABLE_XIP_CACHE ? "NO" : "YES");
   DPRINTF("DMA priority over CPU: %s\n", PRIORITY_DMA ? "YES" : "NO");
@@ -86,6 +79,13 @@ int main() {
 
   DPRINTF("Flash start: 0x%X, length: %u bytes\n",
           (unsigned int)&__flash_binary_start, flashLength);
+  DPRINTF("App config overflow start: 0x%X, length: %u bytes\n",
+          (unsigned int)&_app_config_overflow_flash_start,
+          ACONFIG_OVERFLOW_SIZE);
+  DPRINTF("ACSI scan cache start: 0x%X, length: %u bytes\n",
+          (unsigned int)&_acsi_scan_flash_start, ACSI_SCANCACHE_FLASH_SIZE);
+  DPRINTF("Boot cache start: 0x%X, length: %u bytes\n",
+          (unsigned int)&_boot_cache_flash_start, BOOTCACHE_FLASH_SIZE);
   DPRINTF("ROM Temp start: 0x%X, length: %u bytes\n",
           (unsigned int)&_rom_temp_start, romTempLength);
   DPRINTF("Booster Flash start: 0x%X, length: %u bytes\n",
@@ -98,6 +98,7 @@ int main() {
           (unsigned int)&_global_config_flash_start, globalConfigFlashLength);
   DPRINTF("ROM in RAM start: 0x%X, length: %u bytes\n",
           (unsigned int)&__rom_in_ram_start__, romInRamLength);
+  sramstat_print();
 
 #endif
 
@@ -139,6 +140,28 @@ int main() {
       break;
   }
 
+  // Apply the performance profile of the boot mode. The system PLL can't
+  // change once the ROM emulation runs, so a setup session that exits to
+  // the emulation keeps the setup profile until the next boot.
+  SettingsConfigEntry *mode =
+      settings_find_entry(aconfig_getContext(), ACONFIG_PARAM_MODE);
+  bool setupMode = (mode == NULL) || (atoi(mode->value) == APP_MODE_SETUP);
+  SettingsConfigEntry *profileName = settings_find_entry(
+      aconfig_getContext(), setupMode ? ACONFIG_PARAM_PERF_PROFILE_SETUP
+                                      : ACONFIG_PARAM_PERF_PROFILE);
+  const PerfProfile *profile =
+      perfprofile_apply(profileName ? profileName->value : NULL);
+
+#if defined(_DEBUG) && (_DEBUG != 0)
+  // Re init uart now that clk_peri may have changed
+  setup_default_uart();
+#endif
+  DPRINTF("Performance profile: %s (%s mode)\n", profile->name,
+          setupMode ? "setup" : "emulation");
+  DPRINTF("Clock frequency: %lu KHz\n", clock_get_hz(clk_sys) / 1000);
+  DPRINTF("Voltage: %s\n", VOLTAGE_VALUES[profile->voltage]);
+  DPRINTF("FLASH SPI CLKDIV: %u\n", perfprofile_getFlashDivider());
+
   // Start the application
   emul_start();
 }
@@ -0,0 +1,231 @@
+/**
+ * File: perfprofile.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Named performance profiles: system clock, core voltage, flash
+ * and SD card SPI clocks, validated and applied at boot.
+ */
+
+#include "perfprofile.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/structs/ssi.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include "sdcard.h"
+
+// The first entry is the fallback. Its clocks are the ones every release
+// used before the profiles: the flash keeps the divider of boot2.
+static const PerfProfile profiles[] = {
+    {PERFPROFILE_STANDARD, 225000, VREG_VOLTAGE_1_10,
+     PERFPROFILE_FLASH_BOOT_DIV, SDCARD_MAX_KHZ},
+    // More CPU for GEMDRIVE and ACSI transfers, warmer chip
+    {"fast", 250000, VREG_VOLTAGE_1_15, PERFPROFILE_FLASH_BOOT_DIV,
+     SDCARD_MAX_KHZ},
+    {"turbo", 266000, VREG_VOLTAGE_1_20, PERFPROFILE_FLASH_BOOT_DIV,
+     SDCARD_MAX_KHZ},
+    // Slower flash and SD card SPI clocks, for marginal cards and wiring
+    {"safe", 225000, VREG_VOLTAGE_1_10, 4, 12500},
+};
+
+#define PROFILE_COUNT (sizeof(profiles) / sizeof(profiles[0]))
+
+#define SELFTEST_BLOCK_BYTES 4096
+#define SELFTEST_RAM_ROUNDS 64
+#define SELFTEST_FLASH_BYTES (64 * 1024)
+#define SELFTEST_LATENCY_READS 1024
+
+static const PerfProfile *activeProfile = &profiles[0];
+static enum vreg_voltage activeVoltage = VREG_VOLTAGE_DEFAULT;
+// XIP SSI divider set by boot2 from PICO_FLASH_SPI_CLKDIV of the board,
+// read before the first change
+static uint8_t bootFlashDiv = 0;
+
+// Lowest core voltage for a system clock, with some margin over what most
+// boards need
+static enum vreg_voltage minVoltage(uint32_t sysClockKhz) {
+  if (sysClockKhz <= 225000) return VREG_VOLTAGE_1_10;
+  if (sysClockKhz <= 250000) return VREG_VOLTAGE_1_15;
+  return VREG_VOLTAGE_1_20;
+}
+
+static uint8_t flashDivider(const PerfProfile *profile) {
+  if (profile->flashClkDiv != PERFPROFILE_FLASH_BOOT_DIV) {
+    return profile->flashClkDiv;
+  }
+  if (bootFlashDiv == 0) bootFlashDiv = (uint8_t)ssi_hw->baudr;
+  return bootFlashDiv;
+}
+
+// The XIP SSI can't be touched while the code runs from flash, and no
+// interrupt handler in flash may run while it is disabled. Core 1 is not
+// running yet.
+static void __no_inline_not_in_flash_func(setFlashDivider)(uint8_t div) {
+  if (ssi_hw->baudr == div) return;
+  uint32_t ints = save_and_disable_interrupts();
+  while (ssi_hw->sr & SSI_SR_BUSY_BITS) {
+  }
+  ssi_hw->ssienr = 0;
+  ssi_hw->baudr = div;
+  ssi_hw->ssienr = 1;
+  restore_interrupts(ints);
+}
+
+const PerfProfile *perfprofile_find(const char *name) {
+  if (name == NULL) return NULL;
+  for (size_t i = 0; i < PROFILE_COUNT; i++) {
+    if (strcmp(profiles[i].name, name) == 0) return &profiles[i];
+  }
+  return NULL;
+}
+
+const PerfProfile *perfprofile_at(uint8_t index) {
+  return (index < PROFILE_COUNT) ? &profiles[index] : NULL;
+}
+
+bool perfprofile_validate(const PerfProfile *profile, const char **why) {
+  const char *reason = NULL;
+  uint vco;
+  uint postDiv1;
+  uint postDiv2;
+  if (profile->sysClockKhz < PERFPROFILE_BUS_CLOCK_KHZ) {
+    reason = "clock too slow for the cartridge bus";
+  } else if (profile->sysClockKhz > PERFPROFILE_MAX_CLOCK_KHZ) {
+    reason = "clock too fast";
+  } else if (!check_sys_clock_khz(profile->sysClockKhz, &vco, &postDiv1,
+                                  &postDiv2)) {
+    reason = "the PLL can't make the clock";
+  } else if (profile->voltage < minVoltage(profile->sysClockKhz)) {
+    reason = "voltage too low for the clock";
+  } else if (profile->voltage > VREG_VOLTAGE_MAX) {
+    reason = "voltage too high";
+  } else if ((flashDivider(profile) < 2) || (flashDivider(profile) & 1)) {
+    reason = "flash divider must be even";
+  } else if (profile->sysClockKhz / flashDivider(profile) >
+             PERFPROFILE_FLASH_MAX_KHZ) {
+    reason = "flash clock too fast";
+  } else if ((profile->sdSpiMaxKhz < SDCARD_MIN_KHZ) ||
+             (profile->sdSpiMaxKhz > SDCARD_MAX_KHZ) ||
+             (profile->sdSpiMaxKhz > profile->sysClockKhz / 2)) {
+    reason = "SD card SPI clock out of range";
+  }
+  if (why != NULL) *why = reason;
+  return reason == NULL;
+}
+
+const PerfProfile *perfprofile_apply(const char *name) {
+  static bool tableChecked = false;
+  for (size_t i = 0; !tableChecked && (i < PROFILE_COUNT); i++) {
+    const char *why;
+    if (!perfprofile_validate(&profiles[i], &why)) {
+      DPRINTF("Profile %s not valid: %s\n", profiles[i].name, why);
+    }
+  }
+  tableChecked = true;
+
+  const PerfProfile *profile = perfprofile_find(name);
+  const char *why = NULL;
+  if (profile == NULL) {
+    DPRINTF("Unknown profile %s. Using %s\n", name ? name : "(none)",
+            PERFPROFILE_STANDARD);
+    profile = &profiles[0];
+  } else if (!perfprofile_validate(profile, &why)) {
+    DPRINTF("Profile %s not valid (%s). Using %s\n", profile->name, why,
+            PERFPROFILE_STANDARD);
+    profile = &profiles[0];
+  }
+
+  // The voltage goes up before the clock, and down after it
+  if (profile->voltage > activeVoltage) {
+    vreg_set_voltage(profile->voltage);
+    sleep_us(PERFPROFILE_VREG_SETTLE_US);
+  }
+  if (clock_get_hz(clk_sys) != profile->sysClockKhz * 1000u) {
+    set_sys_clock_khz(profile->sysClockKhz, true);
+  }
+  if (profile->voltage < activeVoltage) {
+    vreg_set_voltage(profile->voltage);
+  }
+  activeVoltage = profile->voltage;
+  setFlashDivider(flashDivider(profile));
+  activeProfile = profile;
+  return profile;
+}
+
+const PerfProfile *perfprofile_getActive(void) { return activeProfile; }
+
+uint8_t perfprofile_getFlashDivider(void) { return (uint8_t)ssi_hw->baudr; }
+
+float perfprofile_getPioDivider(void) {
+  // Rounded up to the 1/256 steps of the PIO divider: the waits never get
+  // shorter than at the standard clock
+  float div = SAMPLE_DIV_FREQ * (float)clock_get_hz(clk_sys) /
+              (PERFPROFILE_BUS_CLOCK_KHZ * 1000.f);
+  div = ceilf(div * 256.f) / 256.f;
+  return (div < SAMPLE_DIV_FREQ) ? SAMPLE_DIV_FREQ : div;
+}
+
+uint32_t perfprofile_getSpiKhz(uint32_t baudRateKhz) {
+  // Same search as spi_set_baudrate in the Pico SDK
+  uint32_t freqIn = clock_get_hz(clk_peri);
+  uint32_t baudrate = baudRateKhz * 1000u;
+  uint32_t prescale;
+  uint32_t postdiv;
+  if (baudrate == 0) return 0;
+  for (prescale = 2; prescale <= 254; prescale += 2) {
+    if (freqIn < (prescale + 2) * 256 * (uint64_t)baudrate) break;
+  }
+  if (prescale > 254) return 0;
+  for (postdiv = 256; postdiv > 1; --postdiv) {
+    if (freqIn / (prescale * (postdiv - 1)) > baudrate) break;
+  }
+  return freqIn / (prescale * postdiv) / 1000u;
+}
+
+static uint32_t kbPerSecond(uint64_t bytes, uint64_t us) {
+  return (us == 0) ? 0 : (uint32_t)((bytes * 1000000ull) / (us * 1024ull));
+}
+
+void __not_in_flash_func(perfprofile_selfTest)(PerfSelfTest *result) {
+  memset(result, 0, sizeof(*result));
+
+  uint8_t *src = malloc(SELFTEST_BLOCK_BYTES * 2);
+  if (src != NULL) {
+    uint8_t *dst = src + SELFTEST_BLOCK_BYTES;
+    memset(src, 0x5A, SELFTEST_BLOCK_BYTES);
+    uint64_t start = time_us_64();
+    for (int i = 0; i < SELFTEST_RAM_ROUNDS; i++) {
+      memcpy(dst, src, SELFTEST_BLOCK_BYTES);
+      src[i] = dst[SELFTEST_BLOCK_BYTES - 1 - i];  // Keep the copies
+    }
+    result->ramKBPerS =
+        kbPerSecond((uint64_t)SELFTEST_BLOCK_BYTES * SELFTEST_RAM_ROUNDS,
+                    time_us_64() - start);
+    free(src);
+  }
+
+  // Through the uncached alias: every read goes to the flash chip
+  const volatile uint32_t *flash =
+      (const volatile uint32_t *)XIP_NOCACHE_NOALLOC_BASE;
+  uint32_t sum = 0;
+  uint64_t start = time_us_64();
+  for (uint32_t i = 0; i < SELFTEST_FLASH_BYTES / 4; i++) {
+    sum += flash[i];
+  }
+  result->flashKBPerS =
+      kbPerSecond(SELFTEST_FLASH_BYTES, time_us_64() - start);
+
+  uint32_t index = 1;
+  start = time_us_64();
+  for (uint32_t i = 0; i < SELFTEST_LATENCY_READS; i++) {
+    index = index * 1664525u + 1013904223u;
+    sum += flash[(index >> 8) % (PICO_FLASH_SIZE_BYTES / 4)];
+  }
+  result->flashLatencyNs =
+      (uint32_t)((time_us_64() - start) * 1000u / SELFTEST_LATENCY_READS);
+  DPRINTF("Self test checksum: %08x\n", sum);
+}
@@ -8,6 +8,8 @@
 
 #include "romemul.h"
 
+#include "perfprofile.h"
+
 // Global variables to access them in the IRQ handlers
 static int readAddrRomDmaChannel = -1;
 static int lookupDataRomDmaChannel = -1;
@@ -55,7 +57,7 @@ static int initRomEmulator(PIO pio) {
   // Start the state machine, executing the PIO read program
   romemul_read_program_init(pio, smReadROM, offsetReadROM, READ_ADDR_GPIO_BASE,
                             READ_ADDR_PIN_COUNT, READ_SIGNAL_GPIO_BASE,
-                            SAMPLE_DIV_FREQ);
+                            perfprofile_getPioDivider());
 
   // Need to clear _input shift counter_, as well as FIFO, because there may be
   // partial ISR contents left over from a previous run. sm_restart does this.
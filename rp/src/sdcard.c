@@ -1,5 +1,7 @@
 #include "sdcard.h"
 
+#include "perfprofile.h"
+
 static sdcard_status_t sdcardInit() {
   DPRINTF("Initializing SD card...\n");
   // Initialize the SD card
@@ -33,19 +35,6 @@ static void sanitizeDOSName(char *name) {
   }
 }
 
-// Comparison function for qsort
-static int dirFirstCmp(const void *a, const void *b) {
-  const DirEntry *e1 = (const DirEntry *)a;
-  const DirEntry *e2 = (const DirEntry *)b;
-
-  // Directories first
-  if (e1->is_dir && !e2->is_dir) return -1;
-  if (!e1->is_dir && e2->is_dir) return 1;
-
-  // Both same type: lexicographic compare
-  return strcasecmp(e1->name, e2->name);
-}
-
 FRESULT sdcard_mountFilesystem(FATFS *fsys, const char *drive) {
   // Mount the drive
   FRESULT fres = f_mount(fsys, drive, 1);
@@ -147,7 +136,16 @@ void sdcard_setSpiSpeedSettings() {
     baudRate = SDCARD_MIN_KHZ;
   }
 
+  // And to the cap of the performance profile
+  const PerfProfile *profile = perfprofile_getActive();
+  if ((uint32_t)baudRate > profile->sdSpiMaxKhz) {
+    DPRINTF("Baud rate capped by profile %s to %lu KHz\n", profile->name,
+            profile->sdSpiMaxKhz);
+    baudRate = (int)profile->sdSpiMaxKhz;
+  }
+
   sdcard_changeSpiSpeed(baudRate);
+  DPRINTF("SD card SPI clock: %lu KHz\n", perfprofile_getSpiKhz(baudRate));
 }
 
 void sdcard_getInfo(FATFS *fsPtr, uint32_t *totalSizeMb,
@@ -179,64 +177,6 @@ void sdcard_getInfo(FATFS *fsPtr, uint32_t *totalSizeMb,
   *freeSpaceMb = freeSpaceBytes / SDCARD_MEGABYTE;
 }
 
-FRESULT __not_in_flash_func(sdcard_loadDirectory)(
-    const char *path, char entries_arr[][MAX_FILENAME_LENGTH + 1],
-    uint16_t *entry_count, uint16_t *selected, uint16_t *page, bool dirs_only,
-    EntryFilterFn filter_fn, char top_dir[MAX_FILENAME_LENGTH + 1]) {
-  FILINFO fno;
-  DIR dir;
-  FRESULT res;
-  *entry_count = 0;
-
-  DirEntry temp_entries[MAX_ENTRIES_DIR];
-  uint16_t temp_count = 0;
-  bool has_parent = false;
-
-  // Add ".." if not at root or top_dir
-  if ((strcmp(path, "/") != 0) &&
-      (strlen(top_dir) > 0 && strcmp(path, top_dir) != 0)) {
-    snprintf(entries_arr[*entry_count], MAX_FILENAME_LENGTH + 1, "..");
-    (*entry_count)++;
-    has_parent = true;
-  }
-
-  res = f_opendir(&dir, path);
-  if (res != FR_OK) {
-    DPRINTF("Error opening directory: %d\n", res);
-    return res;
-  }
-
-  while ((res = f_readdir(&dir, &fno)) == FR_OK && fno.fname[0]) {
-    if (dirs_only && !(fno.fattrib & AM_DIR)) continue;
-    if (filter_fn && !filter_fn(fno.fname, fno.fattrib)) continue;
-    if (temp_count >= MAX_ENTRIES_DIR) break;
-
-    snprintf(temp_entries[temp_count].name, MAX_FILENAME_LENGTH + 1, "%s%s",
-             fno.fname, (fno.fattrib & AM_DIR) ? "/" : "");
-    temp_entries[temp_count].is_dir = (fno.fattrib & AM_DIR) != 0;
-    temp_count++;
-  }
-
-  f_closedir(&dir);
-
-  // Sort temporary list: directories first, then files, both alphabetically
-  qsort(temp_entries, temp_count, sizeof(DirEntry), dirFirstCmp);
-
-  // Copy sorted names into output array
-  for (uint16_t i = 0; i < temp_count; i++) {
-    strncpy(entries_arr[*entry_count], temp_entries[i].name,
-            MAX_FILENAME_LENGTH);
-    entries_arr[*entry_count][MAX_FILENAME_LENGTH] =
-        '\0';  // ensure null-terminated
-    (*entry_count)++;
-  }
-
-  *page = 0;
-  *selected = 0;
-
-  DPRINTF("Loaded %d entries\n", *entry_count);
-  return FR_OK;
-}
 void sdcard_splitFullpath(const char *fullPath, char *drive, char *folders,
                           char *filePattern) {
   const char *driveEnd;
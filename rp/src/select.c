@@ -2,6 +2,23 @@
 
 static reset_callback_t __not_in_flash_func(reset_cb) = NULL;
 static reset_callback_t __not_in_flash_func(reset_long_cb) = NULL;
+static reset_callback_t __not_in_flash_func(medium_cb) = NULL;
+static reset_callback_t __not_in_flash_func(idle_cb) = NULL;
+
+// Wait SELECT_LOOP_DELAY ms. With an idle callback set, core 1 keeps
+// running it for the whole delay instead of sleeping.
+static void __not_in_flash_func(select_loopDelay)(void) {
+  reset_callback_t idle = idle_cb;
+  if (idle == NULL) {
+    sleep_ms(SELECT_LOOP_DELAY);
+    return;
+  }
+
+  uint32_t start_us = time_us_32();
+  do {
+    idle();
+  } while ((time_us_32() - start_us) < (SELECT_LOOP_DELAY * 1000u));
+}
 
 static bool __not_in_flash_func(select_is_stable_state)(bool pressed_state) {
   uint32_t stable_ms = 0;
@@ -12,7 +29,7 @@ static bool __not_in_flash_func(select_is_stable_state)(bool pressed_state) {
     }
 
     tight_loop_contents();
-    sleep_ms(SELECT_LOOP_DELAY);
+    select_loopDelay();
     stable_ms += SELECT_LOOP_DELAY;
   }
 
@@ -20,11 +37,14 @@ static bool __not_in_flash_func(select_is_stable_state)(bool pressed_state) {
 }
 
 static void __not_in_flash_func(select_wait_for_press_loop)(void) {
+  // The boot cache and the ACSI scan cache write the flash while this loop
+  // runs: let flash_safe_execute park core 1 in RAM meanwhile
+  flash_safe_execute_core_init();
   while (true) {
     DPRINTF("Waiting for SELECT button to be pushed\n");
     while (!select_detectPush()) {
       tight_loop_contents();
-      sleep_ms(SELECT_LOOP_DELAY);
+      select_loopDelay();
     }
 
     if (!select_is_stable_state(true)) {
@@ -44,7 +64,7 @@ void __not_in_flash_func(select_waitPush)() {
 
   while (true) {
     tight_loop_contents();
-    sleep_ms(SELECT_LOOP_DELAY);
+    select_loopDelay();
 
     if (select_detectPush()) {
       if (!long_press_handled &&
@@ -65,7 +85,12 @@ void __not_in_flash_func(select_waitPush)() {
 
     DPRINTF("SELECT button released after %llu ms\n",
             (unsigned long long)((time_us_64() - press_start_us) / 1000ULL));
-    if (!long_press_handled && reset_cb != NULL) {
+    uint64_t held_us = time_us_64() - press_start_us;
+    if (!long_press_handled && medium_cb != NULL &&
+        held_us >= ((uint64_t)SELECT_MEDIUM_PRESS * 1000ULL)) {
+      DPRINTF("Medium press detected. Executing medium press callback\n");
+      medium_cb();
+    } else if (!long_press_handled && reset_cb != NULL) {
       DPRINTF("Short press detected. Executing reset callback\n");
       reset_cb();
     }
@@ -111,3 +136,7 @@ void select_setResetCallback(reset_callback_t reset) { reset_cb = reset; }
 void select_setLongResetCallback(reset_callback_t resetLong) {
   reset_long_cb = resetLong;
 }
+void select_setMediumPressCallback(reset_callback_t medium) {
+  medium_cb = medium;
+}
+void select_setIdleCallback(reset_callback_t idle) { idle_cb = idle; }
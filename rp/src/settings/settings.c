@@ -49,6 +49,160 @@ static int checkTypeFormat(SettingsDataType type) {
   return 0;
 }
 
+/**
+ * @brief Check if an entry holds the default value of its key.
+ */
+static bool settingsIsDefault(const SettingsContext *ctx,
+                              const SettingsConfigEntry *entry) {
+  for (uint16_t i = 0; i < ctx->defaultNumEntries; i++) {
+    const SettingsConfigEntry *def = &ctx->defaultEntries[i];
+    if (strncmp(def->key, entry->key, SETTINGS_MAX_KEY_LENGTH) == 0) {
+      return def->dataType == entry->dataType &&
+             strncmp(def->value, entry->value, SETTINGS_MAX_VALUE_LENGTH) == 0;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief FNV-1a of the main region, kept in the first overflow entry.
+ */
+static uint32_t settingsRegionSum(const uint8_t *region, size_t size) {
+  uint32_t sum = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    sum = (sum ^ region[i]) * 16777619u;
+  }
+  return sum;
+}
+
+/**
+ * @brief Entries of the overflow region that continue the main region.
+ *
+ * Zero without an overflow region, or when its checksum is not the one of
+ * the main region: it was written with another main region.
+ */
+static size_t settingsOverflowEntries(const SettingsContext *ctx,
+                                      const uint8_t **firstEntry) {
+  if (ctx->flashOverflowSize < 2 * sizeof(SettingsConfigEntry)) {
+    return 0;
+  }
+  const uint8_t *overflowAddress =
+      (const uint8_t *)(ctx->flashOverflowOffset + XIP_BASE);
+  SettingsConfigEntry header;
+  memcpy(&header, overflowAddress, sizeof(header));
+  header.value[SETTINGS_MAX_VALUE_LENGTH - 1] = '\0';
+  if (strncmp(header.key, SETTINGS_OVERFLOW_KEY, SETTINGS_MAX_KEY_LENGTH) !=
+      0) {
+    return 0;
+  }
+  uint32_t sum =
+      settingsRegionSum((const uint8_t *)(ctx->flashSettingsOffset + XIP_BASE),
+                        ctx->flashSettingsSize);
+  if ((uint32_t)strtoul(header.value, NULL, SETTINGS_BASE_10) != sum) {
+    DPRINTF("Overflow region of another main region. Ignored.\n");
+    return 0;
+  }
+  *firstEntry = overflowAddress + sizeof(SettingsConfigEntry);
+  return ctx->flashOverflowSize / sizeof(SettingsConfigEntry) - 1;
+}
+
+/**
+ * @brief Parse the value of an entry once, for the typed getters.
+ */
+static void settingsParseValue(const SettingsConfigEntry *entry,
+                               SettingsParsedValue *parsed) {
+  const char *value = entry->value;
+  char *end = NULL;
+  long number = strtol(value, &end, SETTINGS_BASE_10);
+  parsed->isInt = (end != value) && (*end == '\0');
+  parsed->intValue = parsed->isInt ? (int32_t)number : 0;
+  parsed->boolValue = (value[0] == 't') || (value[0] == 'T') ||
+                      (value[0] == 'y') || (value[0] == 'Y') ||
+                      (value[0] == '1');
+}
+
+static void settingsFreeIndex(SettingsContext *ctx) {
+  free(ctx->sortedIndex);
+  ctx->sortedIndex = NULL;
+  free(ctx->parsed);
+  ctx->parsed = NULL;
+}
+
+/**
+ * @brief Sort the entries by key and parse their values.
+ *
+ * The set of keys is fixed once loaded, so the order is only built here.
+ * Without it the lookups fall back to a linear scan.
+ */
+static void settingsBuildIndex(SettingsContext *ctx) {
+  settingsFreeIndex(ctx);
+  size_t count = ctx->configData.count;
+  if (count == 0) {
+    return;
+  }
+
+  ctx->sortedIndex = (uint16_t *)malloc(count * sizeof(uint16_t));
+  ctx->parsed =
+      (SettingsParsedValue *)malloc(count * sizeof(SettingsParsedValue));
+  if (!ctx->sortedIndex || !ctx->parsed) {
+    DPRINTF("Error: Unable to allocate memory for the settings index.\n");
+    settingsFreeIndex(ctx);
+    return;
+  }
+
+  // Insertion sort: a few dozen keys, and it keeps duplicates in order
+  const SettingsConfigEntry *entries = ctx->configData.entries;
+  for (size_t i = 0; i < count; i++) {
+    settingsParseValue(&entries[i], &ctx->parsed[i]);
+    size_t pos = i;
+    while (pos > 0 && strncmp(entries[ctx->sortedIndex[pos - 1]].key,
+                              entries[i].key, SETTINGS_MAX_KEY_LENGTH) > 0) {
+      ctx->sortedIndex[pos] = ctx->sortedIndex[pos - 1];
+      pos--;
+    }
+    ctx->sortedIndex[pos] = (uint16_t)i;
+  }
+}
+
+/**
+ * @brief Position of a key in configData.entries, or -1 if not found.
+ */
+static int settingsFindIndex(const SettingsContext *ctx, const char *key) {
+  const SettingsConfigEntry *entries = ctx->configData.entries;
+  if (!entries || !key) {
+    return -1;
+  }
+
+  if (!ctx->sortedIndex) {
+    for (size_t i = 0; i < ctx->configData.count; i++) {
+      if (strncmp(entries[i].key, key, SETTINGS_MAX_KEY_LENGTH) == 0) {
+        return (int)i;
+      }
+    }
+    return -1;
+  }
+
+  size_t low = 0;
+  size_t high = ctx->configData.count;
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    int cmp = strncmp(entries[ctx->sortedIndex[mid]].key, key,
+                      SETTINGS_MAX_KEY_LENGTH);
+    if (cmp < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < ctx->configData.count &&
+      strncmp(entries[ctx->sortedIndex[low]].key, key,
+              SETTINGS_MAX_KEY_LENGTH) == 0) {
+    // The lower bound: the first of duplicated keys, as the linear scan
+    return ctx->sortedIndex[low];
+  }
+  return -1;
+}
+
 /**
  * @brief Load the default entries into memory as the initial config.
  *
@@ -160,9 +314,17 @@ static int settingsLoadAllEntries(SettingsContext *ctx,
           storedMagic);
 
   // Now read each entry in a loop
-  // We'll simply read as many entries as we can, up to numEntries
-  uint16_t count = 0;
-  while (count < numEntries) {
+  // We'll simply read as many entries as the flash region holds, and go on
+  // in the overflow region when the main one is full
+  size_t mainEntries = ctx->flashSettingsSize / sizeof(SettingsConfigEntry);
+  const uint8_t *overflowAddress = NULL;
+  size_t flashEntries =
+      mainEntries + settingsOverflowEntries(ctx, &overflowAddress);
+  size_t count = 0;
+  while (count < flashEntries) {
+    if (count == mainEntries) {
+      currentAddress = (uint8_t *)overflowAddress;
+    }
     SettingsConfigEntry entry = {0};
     memcpy(&entry, currentAddress, sizeof(SettingsConfigEntry));
     currentAddress += sizeof(SettingsConfigEntry);
@@ -194,6 +356,8 @@ static int settingsLoadAllEntries(SettingsContext *ctx,
       if (strncmp(ctx->configData.entries[i].key, entry.key,
                   SETTINGS_MAX_KEY_LENGTH) == 0) {
         ctx->configData.entries[i] = entry;
+        // Stored once: saved again even if it holds the default
+        ctx->pinned[i] = true;
         break;  // Found the match, updated, done
       }
     }
@@ -223,17 +387,20 @@ int settings_init(SettingsContext *ctx,
   DPRINTF("Flash settings offset: 0x%lx\n",
           (unsigned long)ctx->flashSettingsOffset);
 
-  // 2) Allocate memory for all possible entries
-  size_t maxEntries = ctx->flashSettingsSize / sizeof(SettingsConfigEntry);
+  // 2) Allocate memory for all possible entries. Only the entries that
+  // differ from their defaults go to flash, so RAM holds all the defaults
+  // (plus the magic entry) even when they would not fit in the region.
+  size_t maxEntries = (size_t)defaultNumEntries + 1u;
   DPRINTF("Max entries count: %zu\n", maxEntries);
-
-  assert(defaultNumEntries <= maxEntries);
   DPRINTF("Default entries count: %d\n", defaultNumEntries);
+  ctx->defaultEntries = defaultEntries;
+  ctx->defaultNumEntries = defaultNumEntries;
 
   // 3) Prepare the configData structure
   ctx->configData.entries =
-      (SettingsConfigEntry *)malloc(ctx->flashSettingsSize);
-  if (!ctx->configData.entries) {
+      (SettingsConfigEntry *)malloc(maxEntries * sizeof(SettingsConfigEntry));
+  ctx->pinned = (bool *)calloc(maxEntries, sizeof(bool));
+  if (!ctx->configData.entries || !ctx->pinned) {
     DPRINTF("Error: Unable to allocate memory for config entries.\n");
     return -1;
   }
@@ -276,6 +443,9 @@ int settings_init(SettingsContext *ctx,
 
   free(defaultEntriesWithMagic);
 
+  // 7) Sort the keys and parse the values for the lookups
+  settingsBuildIndex(ctx);
+
   // Return the number of entries loaded, or error
   return (error == 0 ? (int)ctx->configData.count : error);
 }
@@ -289,40 +459,117 @@ int settings_deinit(SettingsContext *ctx) {
     ctx->configData.entries = NULL;
   }
   ctx->configData.count = 0;
+  settingsFreeIndex(ctx);
+  free(ctx->pinned);
+  ctx->pinned = NULL;
   ctx->flashSettingsSize = SETTINGS_DEFAULT_FLASH_SIZE;
   ctx->flashSettingsOffset = 0;
+  ctx->flashOverflowSize = 0;
+  ctx->flashOverflowOffset = 0;
 
   return 0;
 }
 
+void settings_set_overflow(SettingsContext *ctx, uint32_t flashOffset,
+                           uint32_t flashSize) {
+  assert(flashSize % SETTINGS_FLASH_PAGE_SIZE == 0);
+  assert(flashOffset % SETTINGS_FLASH_PAGE_SIZE == 0);
+  ctx->flashOverflowSize = flashSize;
+  ctx->flashOverflowOffset = flashOffset;
+}
+
+/**
+ * @brief Erase and program a region, unless it already holds the image.
+ */
+static bool settingsWriteRegion(uint32_t flashOffset, const uint8_t *image,
+                                uint32_t size) {
+  if (memcmp((const uint8_t *)(flashOffset + XIP_BASE), image, size) == 0) {
+    return false;
+  }
+  flash_range_erase(flashOffset, size);
+  flash_range_program(flashOffset, image, size);
+  return true;
+}
+
 int settings_save(SettingsContext *ctx, bool disable_interrupts) {
-  if (!ctx) return -1;
+  if (!ctx || !ctx->configData.entries || !ctx->pinned ||
+      ctx->configData.count == 0) {
+    return -1;
+  }
 
-  // Check if we don't exceed the reserved space
-  size_t totalUsed = ctx->configData.count * sizeof(SettingsConfigEntry);
-  if (totalUsed > ctx->flashSettingsSize) {
-    DPRINTF("Error: config size %zu exceeds reserved space %u.\n", totalUsed,
-            ctx->flashSettingsSize);
+  // The main region, then the overflow region
+  size_t imageSize = ctx->flashSettingsSize + ctx->flashOverflowSize;
+  uint8_t *image = (uint8_t *)calloc(1, imageSize);
+  if (!image) {
+    DPRINTF("Error: Unable to allocate memory for the flash image.\n");
     return -1;
   }
+  SettingsConfigEntry *blob = (SettingsConfigEntry *)image;
+  SettingsConfigEntry *overflow =
+      (SettingsConfigEntry *)(image + ctx->flashSettingsSize);
+
+  // The magic entry always goes first. The loader stops at the first empty
+  // key, and the entries left out keep their default value.
+  size_t mainEntries = ctx->flashSettingsSize / sizeof(SettingsConfigEntry);
+  size_t maxEntries =
+      SETTINGS_FLASH_ENTRIES(ctx->flashSettingsSize, ctx->flashOverflowSize);
+  size_t stored = 0;
+  for (size_t i = 0; i < ctx->configData.count; i++) {
+    if (i > 0 && !ctx->pinned[i] &&
+        settingsIsDefault(ctx, &ctx->configData.entries[i])) {
+      continue;
+    }
+    if (stored == maxEntries) {
+      DPRINTF("Error: more than %zu entries to save, space is %u + %u.\n",
+              maxEntries, ctx->flashSettingsSize, ctx->flashOverflowSize);
+      free(image);
+      return -1;
+    }
+    // The first overflow entry is its checksum
+    SettingsConfigEntry *slot = (stored < mainEntries)
+                                    ? &blob[stored]
+                                    : &overflow[stored - mainEntries + 1];
+    memcpy(slot, &ctx->configData.entries[i], sizeof(SettingsConfigEntry));
+    stored++;
+  }
 
-  DPRINTF("Writing %zu entries to FLASH (size=%zu bytes).\n",
-          ctx->configData.count, totalUsed);
+  // A full main region names the overflow that continues it. Otherwise the
+  // overflow is not read, and not written.
+  bool overflowUsed = ctx->flashOverflowSize > 0 && stored >= mainEntries;
+  if (overflowUsed) {
+    strncpy(overflow[0].key, SETTINGS_OVERFLOW_KEY, SETTINGS_MAX_KEY_LENGTH);
+    overflow[0].dataType = SETTINGS_TYPE_INT;
+    snprintf(overflow[0].value, SETTINGS_MAX_VALUE_LENGTH, "%lu",
+             (unsigned long)settingsRegionSum(image, ctx->flashSettingsSize));
+  }
+
+  DPRINTF("Saving %zu of %zu entries to FLASH (size=%zu bytes).\n", stored,
+          ctx->configData.count, stored * sizeof(SettingsConfigEntry));
 
   uint32_t ints = 0;
   if (disable_interrupts) {
     ints = save_and_disable_interrupts();
   }
 
-  flash_range_erase(ctx->flashSettingsOffset, ctx->flashSettingsSize);
-  flash_range_program(ctx->flashSettingsOffset,
-                      (uint8_t *)ctx->configData.entries,
-                      ctx->flashSettingsSize);
+  // Nothing changed since the last save: spare the erase cycle
+  bool written =
+      settingsWriteRegion(ctx->flashSettingsOffset, image,
+                          ctx->flashSettingsSize);
+  if (overflowUsed &&
+      settingsWriteRegion(ctx->flashOverflowOffset,
+                          image + ctx->flashSettingsSize,
+                          ctx->flashOverflowSize)) {
+    written = true;
+  }
 
   if (disable_interrupts) {
     restore_interrupts(ints);
   }
 
+  if (!written) {
+    DPRINTF("Settings unchanged, FLASH not written.\n");
+  }
+  free(image);
   return 0;
 }
 
@@ -332,6 +579,9 @@ int settings_erase(SettingsContext *ctx) {
   // Erase the flash region
   uint32_t ints = save_and_disable_interrupts();
   flash_range_erase(ctx->flashSettingsOffset, ctx->flashSettingsSize);
+  if (ctx->flashOverflowSize > 0) {
+    flash_range_erase(ctx->flashOverflowOffset, ctx->flashOverflowSize);
+  }
   restore_interrupts(ints);
 
   // Free and reset
@@ -340,6 +590,9 @@ int settings_erase(SettingsContext *ctx) {
     ctx->configData.entries = NULL;
   }
   ctx->configData.count = 0;
+  settingsFreeIndex(ctx);
+  free(ctx->pinned);
+  ctx->pinned = NULL;
 
   return 0;
 }
@@ -347,19 +600,45 @@ int settings_erase(SettingsContext *ctx) {
 SettingsConfigEntry *settings_find_entry(SettingsContext *ctx,
                                          const char *key) {
   if (!ctx) return NULL;
-  if (checkKeyFormat(key) != 0) {
-    DPRINTF("Invalid key format for key %s.\n", key);
+
+  // Every stored key passed checkKeyFormat, so a malformed key is simply
+  // not found
+  int index = settingsFindIndex(ctx, key);
+  if (index < 0) {
+    DPRINTF("Key %s not found.\n", key);
     return NULL;
   }
+  return &ctx->configData.entries[index];
+}
 
-  for (size_t i = 0; i < ctx->configData.count; i++) {
-    if (strncmp(ctx->configData.entries[i].key, key, SETTINGS_MAX_KEY_LENGTH) ==
-        0) {
-      return &ctx->configData.entries[i];
-    }
+bool settings_get_bool(SettingsContext *ctx, const char *key,
+                       bool defaultValue) {
+  if (!ctx) return defaultValue;
+  int index = settingsFindIndex(ctx, key);
+  if (index < 0) {
+    return defaultValue;
+  }
+  if (!ctx->parsed) {
+    SettingsParsedValue parsed;
+    settingsParseValue(&ctx->configData.entries[index], &parsed);
+    return parsed.boolValue;
+  }
+  return ctx->parsed[index].boolValue;
+}
+
+int settings_get_int(SettingsContext *ctx, const char *key, int defaultValue) {
+  if (!ctx) return defaultValue;
+  int index = settingsFindIndex(ctx, key);
+  if (index < 0) {
+    return defaultValue;
+  }
+  SettingsParsedValue parsed;
+  if (!ctx->parsed) {
+    settingsParseValue(&ctx->configData.entries[index], &parsed);
+  } else {
+    parsed = ctx->parsed[index];
   }
-  DPRINTF("Key %s not found.\n", key);
-  return NULL;
+  return parsed.isInt ? (int)parsed.intValue : defaultValue;
 }
 
 /**
@@ -376,19 +655,23 @@ static int settingsUpdateEntry(SettingsContext *ctx, const char *key,
     return -1;
   }
 
-  for (size_t i = 0; i < ctx->configData.count; i++) {
-    if (strncmp(ctx->configData.entries[i].key, key, SETTINGS_MAX_KEY_LENGTH) ==
-        0) {
-      // Key found, update
-      ctx->configData.entries[i].dataType = dataType;
-      strncpy(ctx->configData.entries[i].value, value,
-              SETTINGS_MAX_VALUE_LENGTH - 1);
-      ctx->configData.entries[i].value[SETTINGS_MAX_VALUE_LENGTH - 1] = '\0';
-      return 0;
-    }
+  int index = settingsFindIndex(ctx, key);
+  if (index < 0) {
+    DPRINTF("Key %s not found (cannot update).\n", key);
+    return -1;
   }
-  DPRINTF("Key %s not found (cannot update).\n", key);
-  return -1;
+
+  SettingsConfigEntry *entry = &ctx->configData.entries[index];
+  entry->dataType = dataType;
+  strncpy(entry->value, value, SETTINGS_MAX_VALUE_LENGTH - 1);
+  entry->value[SETTINGS_MAX_VALUE_LENGTH - 1] = '\0';
+  if (ctx->parsed) {
+    settingsParseValue(entry, &ctx->parsed[index]);
+  }
+  if (ctx->pinned) {
+    ctx->pinned[index] = true;
+  }
+  return 0;
 }
 
 int settings_put_bool(SettingsContext *ctx, const char *key, bool value) {
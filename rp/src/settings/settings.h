@@ -70,6 +70,22 @@
   * @brief Key for the magic and version settings.
   */
  #define SETTINGS_MAGICVERSION_KEY "MAGICVERSION"
+
+ /**
+  * @brief Key of the first entry of the overflow region. Its value is the
+  * checksum of the main region the overflow continues.
+  */
+ #define SETTINGS_OVERFLOW_KEY "OVERFLOWSUM"
+
+ /**
+  * @brief Entries stored in a main region and an overflow region of these
+  * sizes: the overflow spends one entry on its checksum.
+  */
+ #define SETTINGS_FLASH_ENTRIES(mainSize, overflowSize)            \
+   ((mainSize) / sizeof(SettingsConfigEntry) +                      \
+    ((overflowSize) / sizeof(SettingsConfigEntry) > 0               \
+         ? (overflowSize) / sizeof(SettingsConfigEntry) - 1         \
+         : 0))
  
  #define SETTINGS_FLASH_PAGE_SIZE 4096
  #define SETTINGS_DEFAULT_FLASH_SIZE 4096
@@ -95,6 +111,15 @@
    char value[SETTINGS_MAX_VALUE_LENGTH];  ///< The value of the setting (string)
  } SettingsConfigEntry;
  
+ /**
+  * @brief Value of an entry parsed once, when it is loaded or updated.
+  */
+ typedef struct {
+   int32_t intValue;  ///< Decimal value, 0 if the value is not a number
+   bool isInt;        ///< The whole value is a decimal number
+   bool boolValue;    ///< Starts with 't', 'T', 'y', 'Y' or '1'
+ } SettingsParsedValue;
+
  /**
   * @brief Structure representing the overall configuration data.
   */
@@ -112,6 +137,13 @@
    ConfigData configData;
    uint32_t flashSettingsSize;
    uint32_t flashSettingsOffset;
+   uint32_t flashOverflowSize;    ///< 0 without an overflow region
+   uint32_t flashOverflowOffset;
+   const SettingsConfigEntry *defaultEntries;  ///< Defaults given to init
+   uint16_t defaultNumEntries;
+   uint16_t *sortedIndex;        ///< Entries in key order, for the lookups
+   SettingsParsedValue *parsed;  ///< Parsed value of each entry
+   bool *pinned;  ///< Put or loaded from flash: saved even at its default
  } SettingsContext;
  
  /**
@@ -137,6 +169,21 @@
                    uint16_t defaultNumEntries, uint32_t flashOffset,
                    uint32_t flashSize, uint16_t magic, uint16_t version);
  
+ /**
+  * @brief Give the context a second flash region for the entries that do not
+  * fit in the first one.
+  *
+  * Call it before settings_init(). The region is only read when the main
+  * region is full, and only if its checksum entry matches the main region,
+  * so a stale overflow is never loaded. settings_deinit() forgets it.
+  *
+  * @param ctx         Pointer to the SettingsContext.
+  * @param flashOffset Offset in flash of the region, sector aligned.
+  * @param flashSize   Size of the region, a multiple of 4096.
+  */
+ void settings_set_overflow(SettingsContext *ctx, uint32_t flashOffset,
+                            uint32_t flashSize);
+
  /**
   * @brief Deinitializes the settings module (for one context).
   *
@@ -150,9 +197,18 @@
  /**
   * @brief Save the current configuration settings to flash (for one context).
   *
+  * The entries that differ from their defaults are written, and so are the
+  * entries put since settings_init() or loaded from flash, even when they
+  * hold their default: a value the user chose does not follow a new default
+  * of a later version. The entries never set are left out and take the
+  * default of the firmware that loads them. What does not fit in the main
+  * region goes to the overflow region. A region is not erased when the
+  * flash already holds the same image.
+  *
   * @param ctx               Pointer to the SettingsContext.
   * @param disable_interrupts If true, interrupts will be disabled while writing.
-  * @return int             0 on success, non-zero on failure.
+  * @return int             0 on success, non-zero on failure: the entries to
+  *                         store do not fit, and nothing was written.
   */
  int settings_save(SettingsContext *ctx, bool disable_interrupts);
  
@@ -180,12 +236,37 @@
  /**
   * @brief Find a configuration entry by its key.
   *
+  * Binary search over the keys, sorted once by settings_init().
+  *
   * @param ctx Pointer to the SettingsContext.
   * @param key The key of the configuration entry to find.
   * @return Pointer to the found entry, or NULL if not found or invalid key.
   */
  SettingsConfigEntry *settings_find_entry(
      SettingsContext *ctx, const char *key);
+
+ /**
+  * @brief Get the boolean value of an entry, parsed when it was set.
+  *
+  * @param ctx          Pointer to the SettingsContext.
+  * @param key          The key of the entry.
+  * @param defaultValue Returned when the key is not found.
+  * @return bool        true if the value starts with 't', 'y' or '1'.
+  */
+ bool settings_get_bool(SettingsContext *ctx, const char *key,
+                        bool defaultValue);
+
+ /**
+  * @brief Get the integer value of an entry, parsed when it was set.
+  *
+  * @param ctx          Pointer to the SettingsContext.
+  * @param key          The key of the entry.
+  * @param defaultValue Returned when the key is not found or its value is
+  *                     not a decimal number.
+  * @return int         The value of the entry.
+  */
+ int settings_get_int(SettingsContext *ctx, const char *key,
+                      int defaultValue);
  
  /**
   * @brief Update a boolean configuration entry.
@@ -0,0 +1,59 @@
+/**
+ * File: slab.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Fixed-block pools for the runtime objects of the emulators.
+ */
+
+#include "slab.h"
+
+#include <stdlib.h>
+
+// Blocks hold the free list link and keep the alignment of their objects
+#define SLAB_ALIGN 4u
+
+bool slab_init(SlabPool *pool, const char *name, size_t blockSize,
+               uint16_t capacity) {
+  if (blockSize < sizeof(void *)) {
+    blockSize = sizeof(void *);
+  }
+  blockSize = (blockSize + SLAB_ALIGN - 1u) & ~(size_t)(SLAB_ALIGN - 1u);
+
+  if (pool->memory != NULL &&
+      (pool->blockSize != blockSize || pool->capacity != capacity)) {
+    slab_deinit(pool);
+  }
+  pool->name = name;
+  if (pool->memory == NULL) {
+    pool->memory = (blockSize <= UINT16_MAX && capacity > 0)
+                       ? malloc(blockSize * capacity)
+                       : NULL;
+    pool->blockSize = (uint16_t)blockSize;
+    pool->capacity = (pool->memory != NULL) ? capacity : 0;
+  }
+  pool->peak = 0;
+  pool->exhausted = 0;
+  slab_reset(pool);
+  return pool->memory != NULL;
+}
+
+void slab_reset(SlabPool *pool) {
+  // Linked in address order, so the blocks are handed out in the same order
+  // after every reset
+  pool->freeList = NULL;
+  for (uint16_t i = pool->capacity; i > 0; i--) {
+    void *block = pool->memory + (size_t)(i - 1u) * pool->blockSize;
+    *(void **)block = pool->freeList;
+    pool->freeList = block;
+  }
+  pool->inUse = 0;
+}
+
+void slab_deinit(SlabPool *pool) {
+  free(pool->memory);
+  pool->memory = NULL;
+  pool->freeList = NULL;
+  pool->capacity = 0;
+  pool->inUse = 0;
+}
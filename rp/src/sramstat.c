@@ -0,0 +1,55 @@
+/**
+ * File: sramstat.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: SRAM usage at run time and the heap high water mark.
+ */
+
+#include "sramstat.h"
+
+#include <malloc.h>
+
+#include "debug.h"
+#include "pico/stdlib.h"
+
+// Symbols from the linker script (memmap_rp.ld and memmap_budget.ld)
+extern char __bss_end__;
+extern char __end__;
+extern char __sram_budget_static;
+extern char __sram_budget_heap;
+
+// Highest break handed out by _sbrk since boot
+static char *heapTop = NULL;
+
+// newlib grows the heap through _sbrk. The call is wrapped at link time
+// (-Wl,--wrap=_sbrk) to keep the high water mark, at no cost to malloc.
+void *__real__sbrk(int incr);
+
+void *__wrap__sbrk(int incr) {
+  char *previous = __real__sbrk(incr);
+  if (previous != (char *)-1 && previous + incr > heapTop) {
+    heapTop = previous + incr;
+  }
+  return previous;
+}
+
+void sramstat_get(SramStat *stat) {
+  struct mallinfo info = mallinfo();
+  stat->staticBytes = (size_t)(&__bss_end__ - (char *)SRAM_BASE);
+  stat->staticBudget = (size_t)(uintptr_t)&__sram_budget_static;
+  stat->heapBudget = (size_t)(uintptr_t)&__sram_budget_heap;
+  stat->heapInUse = info.uordblks;
+  stat->heapSize = info.arena;
+  stat->heapPeak = (heapTop != NULL) ? (size_t)(heapTop - &__end__) : 0;
+}
+
+void sramstat_print(void) {
+  SramStat stat;
+  sramstat_get(&stat);
+  DPRINTF("Static RAM: %u of %u bytes budgeted\n",
+          (unsigned int)stat.staticBytes, (unsigned int)stat.staticBudget);
+  DPRINTF("Heap: %u in use, %u taken, %u peak, %u bytes budgeted\n",
+          (unsigned int)stat.heapInUse, (unsigned int)stat.heapSize,
+          (unsigned int)stat.heapPeak, (unsigned int)stat.heapBudget);
+}
@@ -15,18 +15,52 @@ static BYTE msc_sector_buf[FF_MAX_SS];
 static bool ejected = false;
 static bool mounted = false;
 
+// Runtime mode: core 1 runs the USB device task while the emulation runs.
+// Core 0 keeps the SD card: the READ10/WRITE10 callbacks post the request
+// in a mailbox and answer "busy" until usb_mass_runtimeService() served it.
+typedef enum {
+  USB_MASS_REQ_IDLE = 0,
+  USB_MASS_REQ_PENDING,
+  USB_MASS_REQ_DONE,
+  USB_MASS_REQ_FAILED,
+} UsbMassRequestState;
+
+static bool runtimeActive = false;
+static bool runtimeWritable = false;
+static bool runtimeIrqOnCore1 = false;
+static volatile bool hostWantsCard = false;
+static volatile bool hostOwnsCard = false;
+
+static volatile uint32_t reqState = USB_MASS_REQ_IDLE;
+static bool reqWrite = false;
+static uint32_t reqLba = 0;
+static uint32_t reqOffset = 0;  // Byte offset in the first sector
+static uint32_t reqBytes = 0;
+static uint8_t reqBuffer[USB_MASS_RUNTIME_SECTORS * FF_MAX_SS]
+    __attribute__((aligned(4)));
+
+static UsbMassRuntimeStats runtimeStats = {0};
+
 static void usb_mass_activity_begin(void) {
+  // The Pico W LED is behind the CYW43, not safe to drive from core 1
+  if (runtimeActive) return;
 #ifdef BLINK_H
   blink_off();
 #endif
 }
 
 static void usb_mass_activity_end(void) {
+  if (runtimeActive) return;
 #ifdef BLINK_H
   blink_on();
 #endif
 }
 
+static void usb_mass_setHostWantsCard(bool wants) {
+  // Only a writable host gets the card for itself
+  if (runtimeActive && runtimeWritable) hostWantsCard = wants;
+}
+
 static bool usb_mass_range_valid(uint32_t lba, uint32_t offset,
                                  uint32_t bufsize) {
   if (sz_sect == 0) return false;
@@ -176,6 +210,335 @@ static int32_t usb_mass_write_chunked(uint8_t lun, uint32_t lba,
   return (int32_t)bufsize;
 }
 
+// Write merged sectors left over. A failure is reported to the host on
+// its next command.
+static void usb_mass_flush(void) {
+  if (!usb_mass_cache_isReady()) return;
+  usb_mass_activity_begin();
+  if (!usb_mass_cache_flush()) {
+    DPRINTF("USB sector cache: write failed\n");
+  }
+  usb_mass_activity_end();
+}
+
+static int32_t usb_mass_read_cached(uint8_t lun, uint32_t lba, uint32_t offset,
+                                    void *buffer, uint32_t bufsize) {
+  if (bufsize == 0) return 0;
+  if (usb_mass_cache_takeWriteError()) {
+    tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+    return -1;
+  }
+  if (!usb_mass_range_valid(lba, offset, bufsize)) {
+    tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x21, 0x00);
+    return -1;
+  }
+
+  usb_mass_activity_begin();
+  int32_t res = usb_mass_cache_read(lba, offset, (uint8_t *)buffer, bufsize);
+  usb_mass_activity_end();
+  if (res < 0) {
+    tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x11, 0x00);
+  }
+  return res;
+}
+
+static int32_t usb_mass_write_cached(uint8_t lun, uint32_t lba,
+                                     uint32_t offset, uint8_t *buffer,
+                                     uint32_t bufsize) {
+  if (bufsize == 0) return 0;
+  if (usb_mass_cache_takeWriteError()) {
+    tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+    return -1;
+  }
+  if (!usb_mass_range_valid(lba, offset, bufsize)) {
+    tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x21, 0x00);
+    return -1;
+  }
+
+  usb_mass_activity_begin();
+  int32_t res = usb_mass_cache_write(lba, offset, buffer, bufsize);
+  usb_mass_activity_end();
+  if (res < 0) {
+    tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+  }
+  return res;
+}
+
+static bool usb_mass_requestMatches(bool write, uint32_t lba,
+                                    uint32_t offset, uint32_t bytes) {
+  return (reqWrite == write) && (reqLba == lba) && (reqOffset == offset) &&
+         (reqBytes == bytes);
+}
+
+// Core 1. Returns the bytes copied, 0 while core 0 has not served the
+// request yet (TinyUSB calls again), or -1 on error.
+static int32_t __not_in_flash_func(usb_mass_runtimeRead)(uint8_t lun,
+                                                         uint32_t lba,
+                                                         uint32_t offset,
+                                                         void *buffer,
+                                                         uint32_t bufsize) {
+  if (bufsize == 0) return 0;
+  if (!usb_mass_range_valid(lba, offset, bufsize) ||
+      bufsize > CFG_TUD_MSC_EP_BUFSIZE) {
+    tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x21, 0x00);
+    return -1;
+  }
+  // Writable mode: wait until the drives have let the card go
+  if (runtimeWritable && !hostOwnsCard) return 0;
+
+  uint32_t startLba = lba + (offset / sz_sect);
+  uint32_t sectorOffset = offset % sz_sect;
+  uint32_t state = reqState;
+  if (state == USB_MASS_REQ_DONE || state == USB_MASS_REQ_FAILED) {
+    bool matches =
+        usb_mass_requestMatches(false, startLba, sectorOffset, bufsize);
+    if (matches && state == USB_MASS_REQ_DONE) {
+      __dmb();
+      memcpy(buffer, reqBuffer + sectorOffset, bufsize);
+    }
+    reqState = USB_MASS_REQ_IDLE;
+    if (matches) {
+      if (state == USB_MASS_REQ_FAILED) {
+        tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x11, 0x00);
+        return -1;
+      }
+      return (int32_t)bufsize;
+    }
+    // Answer to a request the host aborted: drop it and post this one
+  }
+
+  if (reqState == USB_MASS_REQ_IDLE) {
+    reqWrite = false;
+    reqLba = startLba;
+    reqOffset = sectorOffset;
+    reqBytes = bufsize;
+    __dmb();
+    reqState = USB_MASS_REQ_PENDING;
+  }
+  return 0;
+}
+
+static int32_t __not_in_flash_func(usb_mass_runtimeWrite)(uint8_t lun,
+                                                          uint32_t lba,
+                                                          uint32_t offset,
+                                                          uint8_t *buffer,
+                                                          uint32_t bufsize) {
+  if (!runtimeWritable) {
+    tud_msc_set_sense(lun, SCSI_SENSE_DATA_PROTECT, 0x27, 0x00);
+    return -1;
+  }
+  if (bufsize == 0) return 0;
+  if (!usb_mass_range_valid(lba, offset, bufsize) ||
+      bufsize > CFG_TUD_MSC_EP_BUFSIZE) {
+    tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x21, 0x00);
+    return -1;
+  }
+  if (!hostOwnsCard) return 0;
+
+  uint32_t startLba = lba + (offset / sz_sect);
+  uint32_t sectorOffset = offset % sz_sect;
+  uint32_t state = reqState;
+  if (state == USB_MASS_REQ_DONE || state == USB_MASS_REQ_FAILED) {
+    bool matches =
+        usb_mass_requestMatches(true, startLba, sectorOffset, bufsize);
+    reqState = USB_MASS_REQ_IDLE;
+    if (matches) {
+      if (state == USB_MASS_REQ_FAILED) {
+        tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+        return -1;
+      }
+      return (int32_t)bufsize;
+    }
+  }
+
+  if (reqState == USB_MASS_REQ_IDLE) {
+    reqWrite = true;
+    reqLba = startLba;
+    reqOffset = sectorOffset;
+    reqBytes = bufsize;
+    memcpy(reqBuffer + sectorOffset, buffer, bufsize);
+    __dmb();
+    reqState = USB_MASS_REQ_PENDING;
+  }
+  return 0;
+}
+
+// Core 0. Partial sectors at both ends of a write are merged with the
+// data on the card.
+static DRESULT usb_mass_runtimeWriteSectors(uint32_t sectors) {
+  DRESULT res;
+  if (reqOffset != 0) {
+    res = disk_read(0, msc_sector_buf, reqLba, 1);
+    if (res != RES_OK) return res;
+    memcpy(reqBuffer, msc_sector_buf, reqOffset);
+  }
+  uint32_t end = reqOffset + reqBytes;
+  if ((end % sz_sect) != 0) {
+    res = disk_read(0, msc_sector_buf, reqLba + sectors - 1, 1);
+    if (res != RES_OK) return res;
+    uint32_t tail = end % sz_sect;
+    memcpy(reqBuffer + end, msc_sector_buf + tail, sz_sect - tail);
+  }
+  return disk_write(0, reqBuffer, reqLba, sectors);
+}
+
+void __not_in_flash_func(usb_mass_runtimeTask)(void) {
+  if (!runtimeIrqOnCore1) {
+    // The USB interrupt runs on the core that enables it
+    runtimeIrqOnCore1 = true;
+    irq_set_enabled(USBCTRL_IRQ, true);
+  }
+  tud_task();
+}
+
+bool usb_mass_runtimeStart(bool writable) {
+  DRESULT dr = disk_ioctl(0, GET_SECTOR_COUNT, &sz_drv);
+  if (dr != RES_OK) {
+    DPRINTF("disk_ioctl GET_SECTOR_COUNT failed: %d\n", dr);
+    return false;
+  }
+#if FF_MAX_SS != FF_MIN_SS
+  dr = disk_ioctl(0, GET_SECTOR_SIZE, &sz_sect);
+  if (dr != RES_OK) {
+    DPRINTF("disk_ioctl GET_SECTOR_SIZE failed: %d\n", dr);
+    return false;
+  }
+#else
+  sz_sect = FF_MAX_SS;
+#endif
+
+  // Core 1 takes over the device task and its interrupt from here on
+  irq_set_enabled(USBCTRL_IRQ, false);
+  // The emulation needs the memory, and the Atari writes behind its back
+  usb_mass_cache_release();
+  memset(&runtimeStats, 0, sizeof(runtimeStats));
+  reqState = USB_MASS_REQ_IDLE;
+  hostOwnsCard = false;
+  hostWantsCard = false;
+  runtimeWritable = writable;
+  runtimeIrqOnCore1 = false;
+  runtimeActive = true;
+  ejected = false;
+
+  if (mounted) {
+    // Make the host enumerate again so it sees the new write protection
+    tud_disconnect();
+    sleep_ms(USB_MASS_RECONNECT_MS);
+    mounted = false;
+    tud_connect();
+  }
+  DPRINTF("USB runtime mode started (%s)\n",
+          writable ? "read/write" : "read only");
+  return true;
+}
+
+void __not_in_flash_func(usb_mass_runtimeService)(void) {
+  if (!runtimeActive || reqState != USB_MASS_REQ_PENDING) return;
+  if (runtimeWritable && !hostOwnsCard) return;
+  // Atari commands first: only touch the card in the gaps between them
+  if (commemul_hasPendingSamples() ||
+      (time_us_32() - commemul_getLastSampleUs()) < USB_MASS_RUNTIME_QUIET_US) {
+    return;
+  }
+  __dmb();
+
+  uint32_t sectors = (reqOffset + reqBytes + sz_sect - 1) / sz_sect;
+  uint32_t start = time_us_32();
+  DRESULT res = reqWrite ? usb_mass_runtimeWriteSectors(sectors)
+                         : disk_read(0, reqBuffer, reqLba, sectors);
+  uint32_t elapsed = time_us_32() - start;
+
+  runtimeStats.slices++;
+  if (reqWrite) {
+    runtimeStats.sectorsWritten += sectors;
+  } else {
+    runtimeStats.sectorsRead += sectors;
+  }
+  if (elapsed > runtimeStats.maxSliceUs) runtimeStats.maxSliceUs = elapsed;
+  if (commemul_hasPendingSamples()) {
+    // The Atari started a command during the slice and waited for it
+    runtimeStats.collisions++;
+    if (elapsed > runtimeStats.maxCollisionUs) {
+      runtimeStats.maxCollisionUs = elapsed;
+    }
+  }
+
+  __dmb();
+  reqState = (res == RES_OK) ? USB_MASS_REQ_DONE : USB_MASS_REQ_FAILED;
+}
+
+bool usb_mass_runtimeHostWantsCard(void) {
+  return runtimeActive && hostWantsCard;
+}
+
+bool usb_mass_runtimeHostOwnsCard(void) { return hostOwnsCard; }
+
+void usb_mass_runtimeSetHostOwnsCard(bool owned) {
+  // Forget a request posted before the card changed hands
+  reqState = USB_MASS_REQ_IDLE;
+  __dmb();
+  hostOwnsCard = owned;
+}
+
+void usb_mass_runtimeGetStats(UsbMassRuntimeStats *stats) {
+  if (stats != NULL) *stats = runtimeStats;
+}
+
+FRESULT usb_mass_runtimeDumpStats(const char *path) {
+  FIL file;
+  FRESULT fr = f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS);
+  if (fr != FR_OK) return fr;
+
+  char line[96];
+  UsbMassRuntimeStats stats = runtimeStats;
+  int len = snprintf(line, sizeof(line),
+                     "mode=%s slices=%lu read=%lu written=%lu\n",
+                     runtimeWritable ? "rw" : "ro",
+                     (unsigned long)stats.slices,
+                     (unsigned long)stats.sectorsRead,
+                     (unsigned long)stats.sectorsWritten);
+  UINT written = 0;
+  fr = f_write(&file, line, (UINT)len, &written);
+  if (fr == FR_OK) {
+    len = snprintf(line, sizeof(line),
+                   "max_slice_us=%lu collisions=%lu max_delay_us=%lu\n",
+                   (unsigned long)stats.maxSliceUs,
+                   (unsigned long)stats.collisions,
+                   (unsigned long)stats.maxCollisionUs);
+    fr = f_write(&file, line, (UINT)len, &written);
+  }
+  FRESULT closeFr = f_close(&file);
+  return (fr != FR_OK) ? fr : closeFr;
+}
+
+// Metadata the hosts keep reading: the partition table, the reserved
+// sectors and FATs (and the FAT12/16 root directory) before the data area,
+// and the first cluster of a FAT32/exFAT root directory.
+static void usb_mass_cache_setup(void) {
+  DWORD sectors = 0;
+  if (disk_ioctl(0, GET_SECTOR_COUNT, &sectors) != RES_OK ||
+      !usb_mass_cache_init(sectors)) {
+    DPRINTF("USB sector cache disabled\n");
+    return;
+  }
+
+  FATFS *fs = NULL;
+  DWORD freeClusters = 0;
+  if (f_getfree("0:", &freeClusters, &fs) != FR_OK || fs == NULL) {
+    // Not a volume FatFS knows: cache the partition table only
+    usb_mass_cache_addMetadataRange(0, 1);
+    return;
+  }
+  usb_mass_cache_addMetadataRange(0, (uint32_t)fs->database);
+  if (fs->fs_type == FS_FAT32 || fs->fs_type == FS_EXFAT) {
+    uint32_t rootLba =
+        (uint32_t)fs->database + ((uint32_t)fs->dirbase - 2u) * fs->csize;
+    usb_mass_cache_addMetadataRange(rootLba, fs->csize);
+  }
+  DPRINTF("USB sector cache: metadata below %lu\n",
+          (unsigned long)fs->database);
+}
+
 bool usb_mass_get_mounted(void) { return mounted; }
 
 bool usb_mass_init() {
@@ -195,6 +558,8 @@ bool usb_mass_start(void) {
     return false;
   }
 
+  usb_mass_cache_setup();
+
   // Turn on the LED
 #ifdef BLINK_H
   blink_on();
@@ -211,12 +576,15 @@ bool usb_mass_start(void) {
 void tud_mount_cb(void) {
   DPRINTF("Device mounted\n");
   mounted = true;
+  usb_mass_setHostWantsCard(true);
 }
 
 // Invoked when device is unmounted
 void tud_umount_cb(void) {
   DPRINTF("Device unmounted\n");
   mounted = false;
+  usb_mass_flush();
+  usb_mass_setHostWantsCard(false);
 }
 
 // Invoked when usb bus is suspended
@@ -226,6 +594,8 @@ void tud_suspend_cb(bool remote_wakeup_en) {
   (void)remote_wakeup_en;
   DPRINTF("Device suspended\n");
   mounted = false;
+  usb_mass_flush();
+  usb_mass_setHostWantsCard(false);
   //  blink_interval_ms = BLINK_SUSPENDED;
 }
 
@@ -233,6 +603,7 @@ void tud_suspend_cb(bool remote_wakeup_en) {
 void tud_resume_cb(void) {
   DPRINTF("Device resumed\n");
   mounted = true;
+  usb_mass_setHostWantsCard(!ejected);
   //  blink_interval_ms = BLINK_MOUNTED;
 }
 
@@ -278,6 +649,12 @@ void __not_in_flash_func(tud_msc_capacity_cb)(uint8_t lun,
   (void)lun;
 
   DPRINTF("Capacity\n");
+  if (runtimeActive) {
+    // Measured by core 0 in usb_mass_runtimeStart, the card belongs to it
+    *block_count = sz_drv;
+    *block_size = sz_sect;
+    return;
+  }
   BYTE pdrv = 0;
   DRESULT dr = disk_ioctl(pdrv, GET_SECTOR_COUNT, &sz_drv);
   if (dr != RES_OK) {
@@ -318,7 +695,9 @@ bool __not_in_flash_func(tud_msc_start_stop_cb)(uint8_t lun,
     } else {
       // unload disk storage
       DPRINTF("UNLOAD DISK STORAGE\n");
+      usb_mass_flush();
       ejected = true;
+      usb_mass_setHostWantsCard(false);
     }
   }
 
@@ -329,19 +708,40 @@ bool __not_in_flash_func(tud_msc_start_stop_cb)(uint8_t lun,
 // Copy disk's data to buffer (up to bufsize) and return number of copied bytes.
 int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset,
                           void *buffer, uint32_t bufsize) {
+  if (runtimeActive) {
+    return usb_mass_runtimeRead(lun, lba, offset, buffer, bufsize);
+  }
+  if (usb_mass_cache_isReady()) {
+    return usb_mass_read_cached(lun, lba, offset, buffer, bufsize);
+  }
   return usb_mass_read_chunked(lun, lba, offset, buffer, bufsize);
 }
 
 bool tud_msc_is_writable_cb(uint8_t lun) {
   (void)lun;
+  if (runtimeActive) return runtimeWritable;
   return !USBDRIVE_READ_ONLY;
 }
 
 int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset,
                            uint8_t *buffer, uint32_t bufsize) {
+  if (runtimeActive) {
+    return usb_mass_runtimeWrite(lun, lba, offset, buffer, bufsize);
+  }
+  if (usb_mass_cache_isReady()) {
+    return usb_mass_write_cached(lun, lba, offset, buffer, bufsize);
+  }
   return usb_mass_write_chunked(lun, lba, offset, buffer, bufsize);
 }
 
+// Invoked when the last chunk of a WRITE10 command has been received.
+// The merged sectors go to the card before the next command.
+void tud_msc_write10_complete_cb(uint8_t lun) {
+  (void)lun;
+  if (runtimeActive) return;
+  usb_mass_flush();
+}
+
 // Callback invoked when received an SCSI command not in built-in list below
 // - READ_CAPACITY10, READ_FORMAT_CAPACITY, INQUIRY, MODE_SENSE6, REQUEST_SENSE
 // - READ10 and WRITE10 has their own callbacks
@@ -362,6 +762,14 @@ int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer,
       // Host is about to read/write etc ... better not to disconnect disk
       resplen = 0;
       break;
+    case USB_MASS_SCSI_SYNCHRONIZE_CACHE10:
+      resplen = 0;
+      if (!runtimeActive && usb_mass_cache_isReady() &&
+          (!usb_mass_cache_flush() || usb_mass_cache_takeWriteError())) {
+        tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x0C, 0x00);
+        resplen = -1;
+      }
+      break;
     default:
       // Set Sense = Invalid Command Operation
       tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -0,0 +1,288 @@
+/**
+ * File: usb_mass_cache.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Sector cache of the USB Mass storage device: LRU of the
+ * metadata sectors, read-ahead of sequential reads and write merging.
+ */
+
+#include "usb_mass_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CACHE_SS USB_MASS_CACHE_SECTOR_SIZE
+#define CACHE_NO_LBA 0xFFFFFFFFu
+
+typedef struct {
+  bool valid;
+  uint32_t lba;
+  uint32_t lastUse;
+} CacheSlot;
+
+typedef struct {
+  uint32_t start;
+  uint32_t count;
+} CacheRange;
+
+// One allocation: metadata slots, read-ahead window and write buffer
+static uint8_t *cacheMemory = NULL;
+static uint8_t *slotData = NULL;
+static uint8_t *readAheadData = NULL;
+static uint8_t *writeData = NULL;
+
+static CacheSlot slots[USB_MASS_CACHE_SLOTS];
+static uint32_t useCounter = 0;
+static CacheRange ranges[USB_MASS_CACHE_RANGES];
+static uint32_t rangeCount = 0;
+static uint32_t diskSectors = 0;
+
+static uint32_t readAheadLba = 0;
+static uint32_t readAheadCount = 0;
+static uint32_t nextSequentialLba = CACHE_NO_LBA;
+
+static uint32_t writeLba = 0;
+static uint32_t writeCount = 0;
+static bool writeError = false;
+
+static UsbMassCacheStats cacheStats = {0};
+
+static bool cacheIsMetadata(uint32_t lba) {
+  for (uint32_t i = 0; i < rangeCount; ++i) {
+    if ((lba - ranges[i].start) < ranges[i].count) return true;
+  }
+  return false;
+}
+
+static DRESULT cacheDiskRead(uint8_t *buffer, uint32_t lba, uint32_t count) {
+  cacheStats.diskReads++;
+  cacheStats.diskReadSectors += count;
+  return disk_read(0, buffer, lba, count);
+}
+
+// Sector already in RAM: pending write first, it is the newest copy
+static uint8_t *cacheFindSector(uint32_t lba) {
+  if (writeCount > 0 && (lba - writeLba) < writeCount) {
+    return writeData + (lba - writeLba) * CACHE_SS;
+  }
+  for (uint32_t i = 0; i < USB_MASS_CACHE_SLOTS; ++i) {
+    if (slots[i].valid && slots[i].lba == lba) {
+      slots[i].lastUse = ++useCounter;
+      return slotData + i * CACHE_SS;
+    }
+  }
+  if (readAheadCount > 0 && (lba - readAheadLba) < readAheadCount) {
+    return readAheadData + (lba - readAheadLba) * CACHE_SS;
+  }
+  return NULL;
+}
+
+static uint8_t *cacheLoadSector(uint32_t lba) {
+  uint8_t *data = cacheFindSector(lba);
+  if (data != NULL) return data;
+  // Nothing read from the card may be older than what is waiting for it
+  if (!usb_mass_cache_flush()) return NULL;
+
+  if (cacheIsMetadata(lba)) {
+    uint32_t victim = 0;
+    for (uint32_t i = 0; i < USB_MASS_CACHE_SLOTS; ++i) {
+      if (!slots[i].valid) {
+        victim = i;
+        break;
+      }
+      if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    CacheSlot *slot = &slots[victim];
+    uint8_t *slotBuffer = slotData + victim * CACHE_SS;
+    slot->valid = false;
+    if (cacheDiskRead(slotBuffer, lba, 1) != RES_OK) return NULL;
+    slot->valid = true;
+    slot->lba = lba;
+    slot->lastUse = ++useCounter;
+    return slotBuffer;
+  }
+
+  // File data: read ahead only when the host reads sequentially, a lone
+  // sector is not worth the extra transfer
+  uint32_t count = 1;
+  if (lba == nextSequentialLba) {
+    count = USB_MASS_READAHEAD_SECTORS;
+    if (count > diskSectors - lba) count = diskSectors - lba;
+  }
+  readAheadCount = 0;
+  if (cacheDiskRead(readAheadData, lba, count) != RES_OK) return NULL;
+  readAheadLba = lba;
+  readAheadCount = count;
+  return readAheadData;
+}
+
+// Keep the cached copies of a written sector up to date
+static void cacheUpdateCopies(uint32_t lba, const uint8_t *data) {
+  for (uint32_t i = 0; i < USB_MASS_CACHE_SLOTS; ++i) {
+    if (slots[i].valid && slots[i].lba == lba) {
+      uint8_t *copy = slotData + i * CACHE_SS;
+      if (copy != data) memcpy(copy, data, CACHE_SS);
+    }
+  }
+  if (readAheadCount > 0 && (lba - readAheadLba) < readAheadCount) {
+    uint8_t *copy = readAheadData + (lba - readAheadLba) * CACHE_SS;
+    if (copy != data) memcpy(copy, data, CACHE_SS);
+  }
+}
+
+static bool cacheAppendWrite(uint32_t lba, const uint8_t *data) {
+  cacheStats.sectorsWritten++;
+  if (writeCount > 0 && (lba - writeLba) < writeCount) {
+    // Sector already waiting: replace it
+    uint8_t *pending = writeData + (lba - writeLba) * CACHE_SS;
+    if (pending != data) memcpy(pending, data, CACHE_SS);
+    cacheUpdateCopies(lba, data);
+    return true;
+  }
+  if (writeCount > 0 && lba != writeLba + writeCount) {
+    if (!usb_mass_cache_flush()) return false;
+  }
+  if (writeCount == 0) writeLba = lba;
+  memcpy(writeData + writeCount * CACHE_SS, data, CACHE_SS);
+  writeCount++;
+  cacheUpdateCopies(lba, data);
+
+  if (writeCount == USB_MASS_WRITE_SECTORS) return usb_mass_cache_flush();
+  return true;
+}
+
+bool usb_mass_cache_init(uint32_t sectorCount) {
+  if (cacheMemory == NULL) {
+    cacheMemory = malloc((USB_MASS_CACHE_SLOTS + USB_MASS_READAHEAD_SECTORS +
+                          USB_MASS_WRITE_SECTORS) *
+                         CACHE_SS);
+    if (cacheMemory == NULL) return false;
+  }
+  slotData = cacheMemory;
+  readAheadData = slotData + USB_MASS_CACHE_SLOTS * CACHE_SS;
+  writeData = readAheadData + USB_MASS_READAHEAD_SECTORS * CACHE_SS;
+
+  diskSectors = sectorCount;
+  rangeCount = 0;
+  writeCount = 0;
+  writeError = false;
+  memset(&cacheStats, 0, sizeof(cacheStats));
+  usb_mass_cache_invalidate();
+  return true;
+}
+
+void usb_mass_cache_release(void) {
+  if (cacheMemory == NULL) return;
+  (void)usb_mass_cache_flush();
+  free(cacheMemory);
+  cacheMemory = NULL;
+  slotData = NULL;
+  readAheadData = NULL;
+  writeData = NULL;
+}
+
+bool usb_mass_cache_isReady(void) { return cacheMemory != NULL; }
+
+void usb_mass_cache_addMetadataRange(uint32_t start, uint32_t count) {
+  if (rangeCount >= USB_MASS_CACHE_RANGES || count == 0) return;
+  ranges[rangeCount].start = start;
+  ranges[rangeCount].count = count;
+  rangeCount++;
+}
+
+void usb_mass_cache_invalidate(void) {
+  memset(slots, 0, sizeof(slots));
+  useCounter = 0;
+  readAheadCount = 0;
+  nextSequentialLba = CACHE_NO_LBA;
+}
+
+int32_t usb_mass_cache_read(uint32_t lba, uint32_t offset, uint8_t *buffer,
+                            uint32_t bufsize) {
+  uint32_t sector = lba + offset / CACHE_SS;
+  uint32_t sectorOffset = offset % CACHE_SS;
+  uint32_t remaining = bufsize;
+
+  while (remaining > 0) {
+    uint32_t chunk = CACHE_SS - sectorOffset;
+    if (chunk > remaining) chunk = remaining;
+    uint8_t *data = cacheFindSector(sector);
+    if (data != NULL) {
+      cacheStats.sectorsHit++;
+    } else {
+      data = cacheLoadSector(sector);
+      if (data == NULL) return -1;
+    }
+    memcpy(buffer, data + sectorOffset, chunk);
+    cacheStats.sectorsRead++;
+
+    buffer += chunk;
+    remaining -= chunk;
+    sector++;
+    sectorOffset = 0;
+    nextSequentialLba = sector;
+  }
+  return (int32_t)bufsize;
+}
+
+int32_t usb_mass_cache_write(uint32_t lba, uint32_t offset,
+                             const uint8_t *buffer, uint32_t bufsize) {
+  uint32_t sector = lba + offset / CACHE_SS;
+  uint32_t sectorOffset = offset % CACHE_SS;
+  uint32_t remaining = bufsize;
+
+  while (remaining > 0) {
+    uint32_t chunk = CACHE_SS - sectorOffset;
+    if (chunk > remaining) chunk = remaining;
+    bool ok;
+    if (chunk < CACHE_SS) {
+      // Partial sector: merge it with the one on the card
+      uint8_t *data = cacheLoadSector(sector);
+      if (data == NULL) {
+        (void)usb_mass_cache_takeWriteError();
+        return -1;
+      }
+      memcpy(data + sectorOffset, buffer, chunk);
+      ok = cacheAppendWrite(sector, data);
+    } else {
+      ok = cacheAppendWrite(sector, buffer);
+    }
+    if (!ok) {
+      // Reported now, not on the next command
+      (void)usb_mass_cache_takeWriteError();
+      return -1;
+    }
+
+    buffer += chunk;
+    remaining -= chunk;
+    sector++;
+    sectorOffset = 0;
+  }
+  return (int32_t)bufsize;
+}
+
+bool usb_mass_cache_flush(void) {
+  if (writeCount == 0) return true;
+
+  cacheStats.diskWrites++;
+  DRESULT res = disk_write(0, writeData, writeLba, writeCount);
+  writeCount = 0;
+  if (res != RES_OK) {
+    // The sectors are lost. Don't trust the copies either.
+    writeError = true;
+    usb_mass_cache_invalidate();
+    return false;
+  }
+  return true;
+}
+
+bool usb_mass_cache_takeWriteError(void) {
+  bool error = writeError;
+  writeError = false;
+  return error;
+}
+
+void usb_mass_cache_getStats(UsbMassCacheStats *stats) {
+  if (stats != NULL) *stats = cacheStats;
+}
@@ -0,0 +1,294 @@
+/**
+ * File: acsikernel.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host checks and benchmarks of the ACSI sector kernels
+ * (rp/src/acsi_kernel.c, compiled as is). Each kernel must map and swap
+ * exactly like the generic code it replaces. The benchmark then runs the
+ * per-request work of ACSIEMUL_READ_SECTOR_BATCH and WRITE_SECTOR_BATCH
+ * both ways for every logical sector size.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "acsi_kernel.h"
+#include "check.h"
+
+// Largest batch, about the size of ACSIEMUL_IMAGE_BUFFER_SIZE
+#define BATCH_BYTES 32768u
+#define DEFAULT_REQUESTS 20000u
+#define DRIVES 4u
+
+static uint32_t rngState = 1u;
+static uint32_t rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+// The per-drive tables of acsi.c before the kernels, read at run time
+static volatile uint16_t logicalSectorSizes[DRIVES];
+static volatile uint16_t logicalToPhysicalRatios[DRIVES];
+static volatile uint32_t startSectors[DRIVES];
+static const AcsiSectorKernel *driveKernels[DRIVES];
+
+// CHANGE_ENDIANESS_BLOCK16 of memfunc.h
+static void genericSwap(void *buffer, uint32_t bytes) {
+  uint16_t *word_ptr = (uint16_t *)buffer;
+  for (uint16_t j = 0; j < bytes / 2; ++j) {
+    word_ptr[j] = (word_ptr[j] << 8) | (word_ptr[j] >> 8);
+  }
+}
+
+typedef struct {
+  uint32_t lba;
+  uint32_t physical;
+  uint32_t bytes;
+} Mapping;
+
+static bool genericRead(uint16_t drive, uint32_t sector, uint16_t count,
+                        uint8_t *buffer, Mapping *out) {
+  uint32_t recsize = logicalSectorSizes[drive];
+  uint32_t physicalSectorCount = logicalToPhysicalRatios[drive];
+  uint32_t totalBytes = (uint32_t)count * recsize;
+  uint32_t totalPhysical = (uint32_t)count * physicalSectorCount;
+  if (totalBytes > BATCH_BYTES) return false;
+  uint64_t physicalSector =
+      (uint64_t)startSectors[drive] +
+      ((uint64_t)sector * (uint64_t)physicalSectorCount);
+  if ((physicalSector + totalPhysical) > 0xFFFFFFFFu) return false;
+  genericSwap(buffer, totalBytes);
+  out->lba = (uint32_t)physicalSector;
+  out->physical = totalPhysical;
+  out->bytes = totalBytes;
+  return true;
+}
+
+static bool kernelRead(uint16_t drive, uint32_t sector, uint16_t count,
+                       uint8_t *buffer, Mapping *out) {
+  const AcsiSectorKernel *kernel = driveKernels[drive];
+  uint32_t totalBytes = acsi_kernel_bytes(kernel, count);
+  if (totalBytes > BATCH_BYTES) return false;
+  kernel->swap(buffer, count);
+  out->lba = startSectors[drive] + acsi_kernel_physical(kernel, sector);
+  out->physical = acsi_kernel_physical(kernel, count);
+  out->bytes = totalBytes;
+  return true;
+}
+
+static bool genericWrite(uint16_t drive, uint32_t sector, uint32_t totalBytes,
+                         uint8_t *buffer, Mapping *out) {
+  uint32_t recsize = logicalSectorSizes[drive];
+  if (totalBytes == 0u || (totalBytes % recsize) != 0u ||
+      totalBytes > BATCH_BYTES) {
+    return false;
+  }
+  genericSwap(buffer, totalBytes);
+  uint32_t logicalSectorCount = totalBytes / recsize;
+  uint32_t physicalSectorCount = logicalToPhysicalRatios[drive];
+  uint64_t physicalSector =
+      (uint64_t)startSectors[drive] +
+      ((uint64_t)sector * (uint64_t)physicalSectorCount);
+  uint64_t totalPhysical =
+      (uint64_t)logicalSectorCount * (uint64_t)physicalSectorCount;
+  if ((physicalSector + totalPhysical) > 0xFFFFFFFFu ||
+      totalPhysical > 0xFFFFu) {
+    return false;
+  }
+  out->lba = (uint32_t)physicalSector;
+  out->physical = (uint32_t)totalPhysical;
+  out->bytes = totalBytes;
+  return true;
+}
+
+static bool kernelWrite(uint16_t drive, uint32_t sector, uint32_t totalBytes,
+                        uint8_t *buffer, Mapping *out) {
+  const AcsiSectorKernel *kernel = driveKernels[drive];
+  uint32_t recsize = kernel->sectorSize;
+  if (totalBytes == 0u || (totalBytes & (recsize - 1u)) != 0u ||
+      totalBytes > BATCH_BYTES) {
+    return false;
+  }
+  uint32_t logicalSectorCount = totalBytes >> kernel->sectorShift;
+  kernel->swap(buffer, logicalSectorCount);
+  out->lba = startSectors[drive] + acsi_kernel_physical(kernel, sector);
+  out->physical = acsi_kernel_physical(kernel, logicalSectorCount);
+  out->bytes = totalBytes;
+  return true;
+}
+
+static void setDrive(uint16_t drive, const AcsiSectorKernel *kernel,
+                     uint32_t start) {
+  logicalSectorSizes[drive] = kernel->sectorSize;
+  logicalToPhysicalRatios[drive] = (uint16_t)(1u << kernel->ratioShift);
+  startSectors[drive] = start;
+  driveKernels[drive] = kernel;
+}
+
+static void testKernelTable(void) {
+  uint32_t size = 512u;
+  for (uint8_t i = 0; i < ACSI_KERNEL_COUNT; ++i, size <<= 1) {
+    const AcsiSectorKernel *kernel = acsi_kernel_at(i);
+    CHECK(kernel != NULL, "no kernel %u", i);
+    if (kernel == NULL) continue;
+    CHECK(kernel->sectorSize == size, "kernel %u size %u", i,
+          kernel->sectorSize);
+    CHECK((1u << kernel->sectorShift) == size, "kernel %u shift %u", i,
+          kernel->sectorShift);
+    CHECK((512u << kernel->ratioShift) == size, "kernel %u ratio shift %u",
+          i, kernel->ratioShift);
+    CHECK(acsi_kernel_get(size) == kernel, "lookup of %u", size);
+  }
+  CHECK(acsi_kernel_at(ACSI_KERNEL_COUNT) == NULL, "kernel past the end");
+  CHECK(acsi_kernel_get(0u) == NULL, "kernel for 0");
+  CHECK(acsi_kernel_get(256u) == NULL, "kernel for 256");
+  CHECK(acsi_kernel_get(1536u) == NULL, "kernel for 1536");
+  CHECK(acsi_kernel_get(16384u) == NULL, "kernel for 16384");
+}
+
+// Random requests: both paths must accept the same ones and give the same
+// mapping and the same bytes
+static void testSameResults(const AcsiSectorKernel *kernel) {
+  static uint8_t generic[BATCH_BYTES];
+  static uint8_t specialised[BATCH_BYTES];
+  uint32_t maxCount = BATCH_BYTES / kernel->sectorSize;
+  setDrive(0, kernel, 0xFFFFFFFFu - (maxCount << kernel->ratioShift) * 4096u);
+
+  for (unsigned int n = 0; n < 2000u; ++n) {
+    uint32_t sector = rng() % 4096u;
+    uint16_t count = (uint16_t)(1u + rng() % (maxCount + 2u));
+    for (uint32_t i = 0; i < BATCH_BYTES; ++i) {
+      generic[i] = specialised[i] = (uint8_t)rng();
+    }
+    Mapping a = {0};
+    Mapping b = {0};
+    bool okA = genericRead(0, sector, count, generic, &a);
+    bool okB = kernelRead(0, sector, count, specialised, &b);
+    CHECK(okA == okB, "%u: read accepted %d and %d", kernel->sectorSize,
+          okA, okB);
+    if (okA && okB) {
+      CHECK(a.lba == b.lba && a.physical == b.physical && a.bytes == b.bytes,
+            "%u: read mapping %" PRIu32 "/%" PRIu32 " and %" PRIu32
+            "/%" PRIu32,
+            kernel->sectorSize, a.lba, a.physical, b.lba, b.physical);
+      CHECK(memcmp(generic, specialised, BATCH_BYTES) == 0,
+            "%u: read bytes differ", kernel->sectorSize);
+    }
+
+    uint32_t totalBytes = (rng() % 4u == 0)
+                              ? rng() % (BATCH_BYTES + 1024u)
+                              : (uint32_t)count * kernel->sectorSize;
+    okA = genericWrite(0, sector, totalBytes, generic, &a);
+    okB = kernelWrite(0, sector, totalBytes, specialised, &b);
+    CHECK(okA == okB, "%u: write of %" PRIu32 " accepted %d and %d",
+          kernel->sectorSize, totalBytes, okA, okB);
+    if (okA && okB) {
+      CHECK(a.lba == b.lba && a.physical == b.physical && a.bytes == b.bytes,
+            "%u: write mapping differs", kernel->sectorSize);
+      CHECK(memcmp(generic, specialised, BATCH_BYTES) == 0,
+            "%u: write bytes differ", kernel->sectorSize);
+    }
+  }
+}
+
+static double nowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+typedef bool (*ReadPath)(uint16_t, uint32_t, uint16_t, uint8_t *, Mapping *);
+typedef bool (*WritePath)(uint16_t, uint32_t, uint32_t, uint8_t *,
+                          Mapping *);
+
+static uint32_t benchSink = 0;
+
+static double benchRead(ReadPath path, uint16_t count, unsigned int requests,
+                        uint8_t *buffer) {
+  Mapping m;
+  double start = nowNs();
+  for (unsigned int n = 0; n < requests; ++n) {
+    if (path((uint16_t)(n % DRIVES), n & 0xFFFu, count, buffer, &m)) {
+      benchSink += m.lba + m.physical;
+    }
+  }
+  return (nowNs() - start) / requests;
+}
+
+static double benchWrite(WritePath path, uint32_t totalBytes,
+                         unsigned int requests, uint8_t *buffer) {
+  Mapping m;
+  double start = nowNs();
+  for (unsigned int n = 0; n < requests; ++n) {
+    if (path((uint16_t)(n % DRIVES), n & 0xFFFu, totalBytes, buffer, &m)) {
+      benchSink += m.lba + m.physical;
+    }
+  }
+  return (nowNs() - start) / requests;
+}
+
+// One logical sector and a full batch per request, reads and writes
+static void benchmark(const AcsiSectorKernel *kernel, unsigned int requests) {
+  static uint8_t buffer[BATCH_BYTES];
+  for (uint32_t i = 0; i < BATCH_BYTES; ++i) buffer[i] = (uint8_t)rng();
+  for (uint16_t drive = 0; drive < DRIVES; ++drive) {
+    setDrive(drive, kernel, 64u + drive * 0x100000u);
+  }
+
+  uint16_t counts[2] = {1u, (uint16_t)(BATCH_BYTES / kernel->sectorSize)};
+  for (int i = 0; i < 2; ++i) {
+    uint16_t count = counts[i];
+    uint32_t bytes = (uint32_t)count * kernel->sectorSize;
+    double genericReadNs = benchRead(genericRead, count, requests, buffer);
+    double kernelReadNs = benchRead(kernelRead, count, requests, buffer);
+    double genericWriteNs = benchWrite(genericWrite, bytes, requests, buffer);
+    double kernelWriteNs = benchWrite(kernelWrite, bytes, requests, buffer);
+    printf("%5u %6u  %9.1f %9.1f %5.2fx  %9.1f %9.1f %5.2fx  %8.1f\n",
+           kernel->sectorSize, (unsigned int)bytes, genericReadNs,
+           kernelReadNs, genericReadNs / kernelReadNs, genericWriteNs,
+           kernelWriteNs, genericWriteNs / kernelWriteNs,
+           (double)bytes / kernelReadNs * 1e9 / (1024.0 * 1024.0));
+  }
+}
+
+int main(int argc, char **argv) {
+  unsigned int requests = DEFAULT_REQUESTS;
+  bool bench = true;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--requests") == 0 && i + 1 < argc) {
+      requests = (unsigned int)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--check") == 0) {
+      bench = false;
+    } else {
+      fprintf(stderr, "Usage: %s [--requests N] [--check]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (requests == 0u) requests = 1u;
+
+  testKernelTable();
+  for (uint8_t i = 0; i < ACSI_KERNEL_COUNT; ++i) {
+    testSameResults(acsi_kernel_at(i));
+  }
+  int status = check_report();
+
+  if (bench && status == 0) {
+    printf("\nns per request, generic path and kernel, %u requests each\n",
+           requests);
+    printf("%5s %6s  %9s %9s %6s  %9s %9s %6s  %8s\n", "size", "bytes",
+           "read", "kernel", "", "write", "kernel", "", "MB/s");
+    for (uint8_t i = 0; i < ACSI_KERNEL_COUNT; ++i) {
+      benchmark(acsi_kernel_at(i), requests);
+    }
+    if (benchSink == 0xFFFFFFFFu) printf("\n");
+  }
+  return status;
+}
@@ -0,0 +1,15 @@
+/**
+ * File: stdlib.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK header. Functions stay where
+ * the host compiler puts them.
+ */
+
+#ifndef ACSIKERNEL_PICO_STDLIB_H
+#define ACSIKERNEL_PICO_STDLIB_H
+
+#define __not_in_flash_func(func_name) func_name
+
+#endif  // ACSIKERNEL_PICO_STDLIB_H
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""acsi_sparse.py - convert Atari hard disk images to and from the sparse
+container of the SidecarTridge Multi-device drives emulator.
+
+A sparse image only stores the blocks that hold data. The emulator reads
+the blocks never written as zeros without touching the SD card, and drops
+zero sectors written to them, so fresh images take a few KB and format in
+seconds.
+
+Usage:
+  acsi_sparse.py pack IMAGE SPARSE [--block-kb N]
+  acsi_sparse.py unpack SPARSE IMAGE
+  acsi_sparse.py info SPARSE
+
+Container layout (all fields little endian, see rp/src/include/acsi_sparse.h):
+  sector 0          header
+  sector 1..        map, one uint32 per block: 0 is a hole, n the n-th
+                    data block of the file
+  data_sector..     data blocks, in the order they were allocated
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+SECTOR_SIZE = 512
+MAGIC = b"SDSPARSE"
+VERSION = 1
+MAP_SECTOR = 1
+DEFAULT_BLOCK_KB = 32
+# Same limit as ACSI_SPARSE_MAX_BLOCKS in the firmware: the allocation
+# bitmap must fit in RAM
+MAX_BLOCKS = 131072
+
+HEADER = struct.Struct("<8sHHIIIII")
+
+
+def die(message):
+    print(f"error: {message}", file=sys.stderr)
+    sys.exit(1)
+
+
+def read_header(f):
+    raw = f.read(HEADER.size)
+    if len(raw) != HEADER.size:
+        return None
+    magic, version, sector_size, block_sectors, total_sectors, block_count, \
+        map_sector, data_sector = HEADER.unpack(raw)
+    if magic != MAGIC:
+        return None
+    if version != VERSION or sector_size != SECTOR_SIZE:
+        die(f"unsupported sparse image (version {version}, "
+            f"sector size {sector_size})")
+    return {
+        "block_sectors": block_sectors,
+        "total_sectors": total_sectors,
+        "block_count": block_count,
+        "map_sector": map_sector,
+        "data_sector": data_sector,
+    }
+
+
+def read_map(f, header):
+    f.seek(header["map_sector"] * SECTOR_SIZE)
+    raw = f.read(header["block_count"] * 4)
+    if len(raw) != header["block_count"] * 4:
+        die("truncated block map")
+    return struct.unpack(f"<{header['block_count']}I", raw)
+
+
+def pack(image_path, sparse_path, block_kb):
+    block_bytes = block_kb * 1024
+    block_sectors = block_bytes // SECTOR_SIZE
+    if block_sectors < 1 or block_sectors & (block_sectors - 1):
+        die("the block size must be a power of two of at least 1 KB")
+
+    size = os.path.getsize(image_path)
+    if size < SECTOR_SIZE or size % SECTOR_SIZE:
+        die(f"{image_path}: size is not a multiple of {SECTOR_SIZE} bytes")
+    total_sectors = size // SECTOR_SIZE
+    if total_sectors > 0xFFFFFFFF:
+        die(f"{image_path}: image too large")
+    block_count = (total_sectors + block_sectors - 1) // block_sectors
+    if block_count > MAX_BLOCKS:
+        die(f"{block_count} blocks, the emulator handles {MAX_BLOCKS}; "
+            f"use a larger --block-kb")
+
+    map_sectors = (block_count * 4 + SECTOR_SIZE - 1) // SECTOR_SIZE
+    data_sector = MAP_SECTOR + map_sectors
+    data_sector = (data_sector + block_sectors - 1) // block_sectors \
+        * block_sectors
+
+    block_map = [0] * block_count
+    zero_block = bytes(block_bytes)
+    with open(image_path, "rb") as src, open(sparse_path, "wb") as dst:
+        dst.seek(data_sector * SECTOR_SIZE)
+        used = 0
+        for block in range(block_count):
+            data = src.read(block_bytes)
+            if data.count(0) == len(data):
+                continue
+            # The last block of an odd sized image is padded with zeros
+            dst.write(data + zero_block[len(data):])
+            used += 1
+            block_map[block] = used
+
+        dst.seek(0)
+        header = HEADER.pack(MAGIC, VERSION, SECTOR_SIZE, block_sectors,
+                             total_sectors, block_count, MAP_SECTOR,
+                             data_sector)
+        dst.write(header.ljust(SECTOR_SIZE, b"\0"))
+        raw_map = struct.pack(f"<{block_count}I", *block_map)
+        dst.write(raw_map.ljust(map_sectors * SECTOR_SIZE, b"\0"))
+        # Pad the map up to the first data block
+        dst.write(bytes((data_sector - MAP_SECTOR - map_sectors)
+                        * SECTOR_SIZE))
+
+    print(f"{sparse_path}: {used} of {block_count} blocks of {block_kb} KB "
+          f"stored ({os.path.getsize(sparse_path)} of {size} bytes)")
+
+
+def unpack(sparse_path, image_path):
+    with open(sparse_path, "rb") as src:
+        header = read_header(src)
+        if header is None:
+            die(f"{sparse_path}: not a sparse image")
+        block_map = read_map(src, header)
+        block_bytes = header["block_sectors"] * SECTOR_SIZE
+        remaining = header["total_sectors"] * SECTOR_SIZE
+        zero_block = bytes(block_bytes)
+        with open(image_path, "wb") as dst:
+            for data_block in block_map:
+                if remaining <= 0:
+                    break
+                length = min(block_bytes, remaining)
+                if data_block == 0:
+                    dst.write(zero_block[:length])
+                else:
+                    src.seek(header["data_sector"] * SECTOR_SIZE
+                             + (data_block - 1) * block_bytes)
+                    data = src.read(length)
+                    if len(data) != length:
+                        die(f"{sparse_path}: data block {data_block} is "
+                            f"truncated")
+                    dst.write(data)
+                remaining -= length
+    print(f"{image_path}: {header['total_sectors'] * SECTOR_SIZE} bytes")
+
+
+def info(sparse_path):
+    with open(sparse_path, "rb") as src:
+        header = read_header(src)
+        if header is None:
+            die(f"{sparse_path}: not a sparse image")
+        block_map = read_map(src, header)
+    used = sum(1 for entry in block_map if entry)
+    print(f"Image size:   {header['total_sectors'] * SECTOR_SIZE} bytes")
+    print(f"Block size:   {header['block_sectors'] * SECTOR_SIZE // 1024} KB")
+    print(f"Blocks:       {used} of {header['block_count']} stored")
+    print(f"File size:    {os.path.getsize(sparse_path)} bytes")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert ACSI hard disk images to and from the sparse "
+                    "container of the drives emulator.")
+    commands = parser.add_subparsers(dest="command", required=True)
+    pack_parser = commands.add_parser("pack", help="plain image to sparse")
+    pack_parser.add_argument("image")
+    pack_parser.add_argument("sparse")
+    pack_parser.add_argument("--block-kb", type=int, default=DEFAULT_BLOCK_KB,
+                             help="block size in KB, a power of two "
+                                  f"(default {DEFAULT_BLOCK_KB})")
+    unpack_parser = commands.add_parser("unpack", help="sparse to plain image")
+    unpack_parser.add_argument("sparse")
+    unpack_parser.add_argument("image")
+    info_parser = commands.add_parser("info", help="show a sparse image")
+    info_parser.add_argument("sparse")
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        pack(args.image, args.sparse, args.block_kb)
+    elif args.command == "unpack":
+        unpack(args.sparse, args.image)
+    else:
+        info(args.sparse)
+
+
+if __name__ == "__main__":
+    main()
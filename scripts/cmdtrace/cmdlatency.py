@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""cmdlatency.py - compare the command latency of two command trace dumps.
+
+Used to check that the USB runtime mode (USB_RUNTIME) does not slow down
+the Atari. Record one cmdtrace.bin with no computer on the USB port and one
+while a computer reads or copies files from the card, running the same
+program on the Atari both times. The latency of a command is the time it
+waited before the dispatch plus the time spent in the handlers, as seen by
+the Atari.
+
+For every command found in both dumps the script prints the p50 / p95 /
+max latency of each dump and the difference, and the same for all of them
+together. It exits with 1 when the p95 of a command grows by more than
+--budget-us.
+
+Usage:
+  scripts/cmdtrace/cmdlatency.py idle.bin usb.bin [--usbmsc usbmsc.txt]
+                                 [--budget-us N] [--min-count N]
+                                 [--headers DIR]
+"""
+
+import argparse
+import os
+import sys
+from collections import defaultdict
+from typing import Dict, List, Optional, Tuple
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from cmdtrace import (DEFAULT_HEADERS_DIR, TraceEntry,  # noqa: E402
+                      command_name, load_command_names, load_trace)
+
+DEFAULT_BUDGET_US = 100
+DEFAULT_MIN_COUNT = 5
+
+ALL_COMMANDS = -1
+
+
+def latencies(entries: List[TraceEntry]) -> Dict[int, List[int]]:
+    """Return command id -> sorted latencies, plus ALL_COMMANDS."""
+    by_command: Dict[int, List[int]] = defaultdict(list)
+    for e in entries:
+        latency = e.wait_us + e.duration_us
+        by_command[e.command_id].append(latency)
+        by_command[ALL_COMMANDS].append(latency)
+    for values in by_command.values():
+        values.sort()
+    return by_command
+
+
+def percentiles(values: List[int]) -> Tuple[int, int, int]:
+    p50 = values[len(values) // 2]
+    p95 = values[min(len(values) - 1, (len(values) * 95) // 100)]
+    return p50, p95, values[-1]
+
+
+def load(path: str) -> Optional[List[TraceEntry]]:
+    try:
+        _, entries = load_trace(path)
+    except (OSError, ValueError) as e:
+        print(f"error: {path}: {e}", file=sys.stderr)
+        return None
+    if entries and all(e.wait_us == 0 for e in entries):
+        print(f"warning: {path} has no wait times, only the handler "
+              f"durations are compared", file=sys.stderr)
+    return entries
+
+
+def print_usbmsc(path: str) -> None:
+    """Print the USB accesses written next to the trace (/usbmsc.txt)."""
+    try:
+        with open(path, "r", encoding="utf-8", errors="replace") as f:
+            fields = dict(item.split("=", 1) for item in f.read().split()
+                          if "=" in item)
+    except OSError as e:
+        print(f"warning: {path}: {e}", file=sys.stderr)
+        return
+    print(f"USB host: mode {fields.get('mode', '?')}, "
+          f"{fields.get('slices', '?')} accesses, "
+          f"longest {fields.get('max_slice_us', '?')} us, "
+          f"{fields.get('collisions', '?')} waited for by the Atari, "
+          f"longest wait {fields.get('max_delay_us', '?')} us")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Compare the command latency of two trace dumps.")
+    parser.add_argument("baseline", help="cmdtrace.bin without a USB host")
+    parser.add_argument("usb", help="cmdtrace.bin with a USB host")
+    parser.add_argument("--usbmsc",
+                        help="usbmsc.txt written with the second dump")
+    parser.add_argument("--budget-us", type=int, default=DEFAULT_BUDGET_US,
+                        help="largest p95 growth accepted per command")
+    parser.add_argument("--min-count", type=int, default=DEFAULT_MIN_COUNT,
+                        help="skip the commands seen fewer times in a dump")
+    parser.add_argument("--headers", default=DEFAULT_HEADERS_DIR,
+                        help="firmware include folder used to name commands")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    usb = load(args.usb)
+    if baseline is None or usb is None:
+        return 1
+    if not baseline or not usb:
+        print("error: a dump holds no commands", file=sys.stderr)
+        return 1
+
+    names = load_command_names(args.headers)
+    names[ALL_COMMANDS] = "all commands"
+    before = latencies(baseline)
+    after = latencies(usb)
+
+    if args.usbmsc:
+        print_usbmsc(args.usbmsc)
+    print(f"{len(baseline)} commands without USB host, {len(usb)} with it")
+    print()
+    print(f"{'command':<32} {'n':>5} {'p50':>7} {'p95':>7} {'max':>7}  "
+          f"{'n':>5} {'p50':>7} {'p95':>7} {'max':>7}  {'p95 +us':>7}")
+
+    over_budget = []
+    common = [c for c in before if c in after]
+    # All commands first, then the slowest at p95 with the USB host
+    common.sort(key=lambda c: (c != ALL_COMMANDS,
+                               -percentiles(after[c])[1]))
+    for command_id in common:
+        a, b = before[command_id], after[command_id]
+        if command_id != ALL_COMMANDS and (len(a) < args.min_count or
+                                           len(b) < args.min_count):
+            continue
+        pa, pb = percentiles(a), percentiles(b)
+        growth = pb[1] - pa[1]
+        mark = ""
+        if command_id != ALL_COMMANDS and growth > args.budget_us:
+            mark = "  over budget"
+            over_budget.append(command_id)
+        print(f"{command_name(names, command_id):<32} {len(a):5d} "
+              f"{pa[0]:7d} {pa[1]:7d} {pa[2]:7d}  {len(b):5d} "
+              f"{pb[0]:7d} {pb[1]:7d} {pb[2]:7d}  {growth:+7d}{mark}")
+
+    print()
+    if over_budget:
+        print(f"{len(over_budget)} commands over the {args.budget_us} us "
+              f"budget")
+        return 1
+    print(f"No command over the {args.budget_us} us budget")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
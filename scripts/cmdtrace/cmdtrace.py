@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""cmdtrace.py - decode the command trace dumped by the SidecarTridge
+Multi-device drives emulator.
+
+The firmware keeps a RAM ring with the last commands dispatched by the
+command handler (GEMDRIVE, ACSI, floppy, RTC). The ring can be written to
+the microSD card as /cmdtrace.bin with the `trace` setup terminal command
+or with a medium (3 s) SELECT press during runtime.
+
+This script prints the timeline of the dump and a latency histogram per
+command. Command names are taken from the firmware headers so new commands
+show up without touching this file.
+
+Usage:
+  scripts/cmdtrace/cmdtrace.py cmdtrace.bin [--headers DIR] [--last N]
+                                            [--no-timeline] [--no-histogram]
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+from collections import defaultdict
+from dataclasses import dataclass
+from typing import Dict, List, Tuple
+
+# --------------------------------------------------------------------------
+# File format (mirrors rp/src/include/cmdtrace.h, little endian)
+# --------------------------------------------------------------------------
+
+TRACE_MAGIC = 0x54524143  # "TRAC"
+
+HEADER_FMT = "<IHHII"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+
+# Entry layout per trace version. Version 1 has no wait time.
+ENTRY_FMTS = {1: "<IHH4IIhH", 2: "<IHH4IIIhH"}
+
+# Histogram bucket upper bounds, in microseconds. The last one is open.
+HISTOGRAM_BUCKETS_US = (10, 50, 100, 500, 1000, 5000, 10000, 50000, 100000)
+HISTOGRAM_BAR_WIDTH = 30
+
+DEFAULT_HEADERS_DIR = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), "..", "..", "rp", "src",
+    "include")
+
+RE_APP_ID = re.compile(r"#define\s+(APP_\w+)\s+(0x[0-9A-Fa-f]+|\d+)\b")
+RE_COMMAND = re.compile(
+    r"#define\s+(\w+)\s*(?:\\\s*)?\(\s*(APP_\w+)\s*<<\s*8\s*\|\s*"
+    r"(0x[0-9A-Fa-f]+|\d+)\s*\)")
+
+
+@dataclass
+class TraceEntry:
+    timestamp_us: int
+    command_id: int
+    payload_size: int
+    params: Tuple[int, int, int, int]
+    duration_us: int
+    wait_us: int
+    result: int
+    session: int
+
+
+# --------------------------------------------------------------------------
+# Parsing
+# --------------------------------------------------------------------------
+
+def load_command_names(headers_dir: str) -> Dict[int, str]:
+    """Build a command id -> name map from the firmware headers."""
+    text = ""
+    for path in sorted(glob.glob(os.path.join(headers_dir, "*.h"))):
+        with open(path, "r", encoding="utf-8", errors="replace") as f:
+            text += f.read() + "\n"
+
+    apps = {name: int(value, 0) for name, value in RE_APP_ID.findall(text)}
+    names = {}
+    for name, app, value in RE_COMMAND.findall(text):
+        if app in apps:
+            names.setdefault((apps[app] << 8) | int(value, 0), name)
+    return names
+
+
+def load_trace(path: str) -> Tuple[int, List[TraceEntry]]:
+    """Return (dropped, entries) from a cmdtrace.bin dump."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER_SIZE:
+        raise ValueError("file too short for a trace header")
+
+    magic, version, entry_size, count, dropped = struct.unpack_from(
+        HEADER_FMT, data, 0)
+    if magic != TRACE_MAGIC:
+        raise ValueError(f"bad magic 0x{magic:08X}")
+    if version not in ENTRY_FMTS:
+        raise ValueError(f"unsupported trace version {version}")
+    entry_fmt = ENTRY_FMTS[version]
+    if entry_size != struct.calcsize(entry_fmt):
+        raise ValueError(f"unexpected entry size {entry_size}")
+
+    available = (len(data) - HEADER_SIZE) // entry_size
+    if available < count:
+        print(f"warning: header says {count} entries, file holds "
+              f"{available}", file=sys.stderr)
+        count = available
+
+    entries = []
+    for i in range(count):
+        fields = struct.unpack_from(entry_fmt, data,
+                                    HEADER_SIZE + i * entry_size)
+        if version == 1:
+            fields = fields[:8] + (0,) + fields[8:]
+        entries.append(TraceEntry(
+            timestamp_us=fields[0],
+            command_id=fields[1],
+            payload_size=fields[2],
+            params=tuple(fields[3:7]),
+            duration_us=fields[7],
+            wait_us=fields[8],
+            result=fields[9],
+            session=fields[10],
+        ))
+    return dropped, entries
+
+
+# --------------------------------------------------------------------------
+# Output
+# --------------------------------------------------------------------------
+
+def command_name(names: Dict[int, str], command_id: int) -> str:
+    return names.get(command_id, f"CMD_{command_id:04X}")
+
+
+def print_timeline(entries: List[TraceEntry], names: Dict[int, str]) -> None:
+    print(f"{'#':>5} {'ses':>4} {'time ms':>12} {'delta us':>10} "
+          f"{'wait us':>8} {'dur us':>8} {'result':>6}  command")
+    prev_ts = None
+    prev_session = None
+    for i, e in enumerate(entries):
+        # time_us_32 wraps every ~71 minutes; deltas are mod 2^32.
+        if prev_ts is None or e.session != prev_session:
+            delta = "-"
+        else:
+            delta = str((e.timestamp_us - prev_ts) & 0xFFFFFFFF)
+        params = " ".join(f"{p:08X}" for p in e.params)
+        print(f"{i:5d} {e.session:4d} {e.timestamp_us / 1000.0:12.3f} "
+              f"{delta:>10} {e.wait_us:8d} {e.duration_us:8d} {e.result:6d}  "
+              f"{command_name(names, e.command_id):<32} "
+              f"[{e.payload_size:4d}] {params}")
+        prev_ts = e.timestamp_us
+        prev_session = e.session
+
+
+def bucket_label(index: int) -> str:
+    if index == 0:
+        return f"< {HISTOGRAM_BUCKETS_US[0]} us"
+    if index == len(HISTOGRAM_BUCKETS_US):
+        return f">= {HISTOGRAM_BUCKETS_US[-1]} us"
+    return f"< {HISTOGRAM_BUCKETS_US[index]} us"
+
+
+def print_histograms(entries: List[TraceEntry],
+                     names: Dict[int, str]) -> None:
+    by_command: Dict[int, List[int]] = defaultdict(list)
+    for e in entries:
+        by_command[e.command_id].append(e.duration_us)
+
+    # Slowest commands (by total time) first: that's where a hang hides.
+    ordered = sorted(by_command.items(), key=lambda kv: -sum(kv[1]))
+    for command_id, durations in ordered:
+        durations.sort()
+        total = sum(durations)
+        p50 = durations[len(durations) // 2]
+        p95 = durations[min(len(durations) - 1, (len(durations) * 95) // 100)]
+        print(f"\n{command_name(names, command_id)} (0x{command_id:04X}): "
+              f"n={len(durations)} total={total} us min={durations[0]} "
+              f"p50={p50} p95={p95} max={durations[-1]}")
+
+        buckets = [0] * (len(HISTOGRAM_BUCKETS_US) + 1)
+        for d in durations:
+            index = len(HISTOGRAM_BUCKETS_US)
+            for b, limit in enumerate(HISTOGRAM_BUCKETS_US):
+                if d < limit:
+                    index = b
+                    break
+            buckets[index] += 1
+        peak = max(buckets)
+        for index, n in enumerate(buckets):
+            if n == 0:
+                continue
+            bar = "#" * max(1, (n * HISTOGRAM_BAR_WIDTH) // peak)
+            print(f"  {bucket_label(index):>12} {n:6d} {bar}")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Decode a drives emulator command trace dump.")
+    parser.add_argument("trace", help="cmdtrace.bin copied from the microSD")
+    parser.add_argument("--headers", default=DEFAULT_HEADERS_DIR,
+                        help="firmware include folder used to name commands")
+    parser.add_argument("--last", type=int, default=0,
+                        help="only show the last N entries")
+    parser.add_argument("--no-timeline", action="store_true",
+                        help="skip the timeline")
+    parser.add_argument("--no-histogram", action="store_true",
+                        help="skip the latency histograms")
+    args = parser.parse_args()
+
+    try:
+        dropped, entries = load_trace(args.trace)
+    except (OSError, ValueError) as e:
+        print(f"error: {args.trace}: {e}", file=sys.stderr)
+        return 1
+
+    names = load_command_names(args.headers)
+    if not names:
+        print(f"warning: no command names found in {args.headers}",
+              file=sys.stderr)
+
+    if args.last > 0:
+        entries = entries[-args.last:]
+
+    sessions = sorted({e.session for e in entries})
+    print(f"{len(entries)} entries, {dropped} older entries overwritten, "
+          f"sessions {', '.join(str(s) for s in sessions) or '-'}")
+
+    if not args.no_timeline:
+        print()
+        print_timeline(entries, names)
+    if not args.no_histogram:
+        print_histograms(entries, names)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
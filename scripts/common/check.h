@@ -0,0 +1,36 @@
+/**
+ * File: check.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Checks shared by the host test harnesses in scripts/. Every
+ * harness is a single source file that includes this header once.
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static unsigned int checks = 0;
+static unsigned int failures = 0;
+
+// Counts the check, prints the message when it fails and goes on
+#define CHECK(cond, ...)                             \
+  do {                                               \
+    checks++;                                        \
+    if (!(cond)) {                                   \
+      failures++;                                    \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);    \
+      printf(__VA_ARGS__);                           \
+      printf("\n");                                  \
+    }                                                \
+  } while (0)
+
+// Prints the totals. Returns the exit status of the harness.
+static inline int check_report(void) {
+  printf("%u checks, %u failed\n", checks, failures);
+  return failures ? 1 : 0;
+}
+
+#endif  // CHECK_H
@@ -0,0 +1,153 @@
+/**
+ * File: fsmatch.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host conformance tests for the GEMDRIVE Fsfirst/Fsnext
+ * matcher. Runs rp/src/gemdrive_match.c against the name and attribute
+ * rules of GEMDOS: the filespec is expanded to an 11 character name as
+ * builds() does, and the attributes are checked as match() does.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "gemdrive_match.h"
+
+#define FA_READONLY 0x01
+#define FA_HIDDEN 0x02
+#define FA_SYSTEM 0x04
+#define FA_LABEL 0x08
+#define FA_FOLDER 0x10
+#define FA_ARCH 0x20
+
+typedef struct {
+  const char *pattern;
+  const char *name;
+  bool expected;
+} NameCase;
+
+typedef struct {
+  uint8_t search;
+  uint8_t entry;
+  bool expected;
+} AttribCase;
+
+static const NameCase nameCases[] = {
+    // "*.*" is everything, "*" only the names without extension
+    {"*.*", "README", true},
+    {"*.*", "GAME.PRG", true},
+    {"*.*", "A.B", true},
+    {"*", "README", true},
+    {"*", "GAME.PRG", false},
+    // Extension masks
+    {"*.PRG", "GAME.PRG", true},
+    {"*.PRG", "GAME.PRX", false},
+    {"*.PRG", "GAME", false},
+    {"*.PRG", "PRG", false},
+    {"*.prg", "GAME.PRG", true},
+    {"*.PRG", "game.prg", true},
+    {"GAME.*", "GAME", true},
+    {"GAME.*", "GAME.PRG", true},
+    {"GAME.*", "GAMES.PRG", false},
+    {"GAME.", "GAME", true},
+    {"GAME.", "GAME.PRG", false},
+    {"GAME", "GAME", true},
+    {"GAME", "GAME.PRG", false},
+    // '?' is one character or the padding after the name
+    {"????????.DAT", "A.DAT", true},
+    {"????????.DAT", "ABCDEFGH.DAT", true},
+    {"????????.DAT", "A.DA", false},
+    {"?", "A", true},
+    {"?", "AB", false},
+    {"A?C.TXT", "ABC.TXT", true},
+    {"A?C.TXT", "AC.TXT", false},
+    {"*.??", "A.B", true},
+    {"*.??", "A.BCD", false},
+    {"DISK?.ST", "DISK1.ST", true},
+    {"DISK?.ST", "DISK.ST", true},
+    {"DISK?.ST", "DISK12.ST", false},
+    // '*' fills the rest of its part, whatever follows it there
+    {"A*B.TXT", "AXXX.TXT", true},
+    {"A*B.TXT", "B.TXT", false},
+    {"*A.TXT", "XYZ.TXT", true},
+    {"GAME.P*", "GAME.PRG", true},
+    {"GAME.P*", "GAME.P", true},
+    {"GAME.P*", "GAME.ST", false},
+    // Characters after the 8th of the name or the 3rd of the extension
+    {"LONGFILENAME.TXT", "LONGFILE.TXT", true},
+    {"LONGFILE.TXTX", "LONGFILE.TXT", true},
+    {"*.TX", "A.TXT", false},
+    // Names as GEMDRIVE shows them
+    {"LONGFI~1.TXT", "LONGFI~1.TXT", true},
+    {"*.*", "LONGFI~1.TXT", true},
+    {"", "A", false},
+};
+
+static const AttribCase attribCases[] = {
+    // Normal files: read-only and archive do not count
+    {0, 0, true},
+    {0, FA_READONLY, true},
+    {0, FA_ARCH, true},
+    {0, FA_READONLY | FA_ARCH, true},
+    // Hidden, system and folders must be asked for
+    {0, FA_HIDDEN, false},
+    {0, FA_SYSTEM, false},
+    {0, FA_FOLDER, false},
+    {FA_HIDDEN, FA_HIDDEN, true},
+    {FA_HIDDEN, FA_HIDDEN | FA_ARCH, true},
+    {FA_HIDDEN, 0, true},
+    {FA_SYSTEM, FA_SYSTEM, true},
+    {FA_SYSTEM, FA_HIDDEN, false},
+    {FA_HIDDEN | FA_SYSTEM | FA_FOLDER, FA_FOLDER, true},
+    {FA_HIDDEN | FA_SYSTEM | FA_FOLDER, FA_ARCH, true},
+    // All the special bits of the entry must be asked for
+    {FA_HIDDEN, FA_HIDDEN | FA_SYSTEM, false},
+    {FA_HIDDEN | FA_SYSTEM, FA_HIDDEN | FA_SYSTEM, true},
+    {FA_FOLDER, FA_FOLDER | FA_HIDDEN, false},
+    {FA_FOLDER | FA_HIDDEN, FA_FOLDER | FA_HIDDEN, true},
+    // A search for folders finds the normal files too
+    {FA_FOLDER, FA_FOLDER, true},
+    {FA_FOLDER, 0, true},
+    {FA_FOLDER, FA_ARCH, true},
+    {FA_FOLDER, FA_HIDDEN, false},
+    // A search for the label alone only finds the label
+    {FA_LABEL, FA_LABEL, true},
+    {FA_LABEL, 0, false},
+    {FA_LABEL, FA_FOLDER, false},
+    {0, FA_LABEL, false},
+    {FA_LABEL | FA_FOLDER, FA_LABEL, true},
+    {FA_LABEL | FA_FOLDER, FA_HIDDEN, false},
+    {FA_LABEL | FA_FOLDER, 0, true},
+};
+
+#define CASES(table) (sizeof(table) / sizeof((table)[0]))
+
+int main(void) {
+  GemdriveMatch match;
+
+  for (size_t i = 0; i < CASES(nameCases); i++) {
+    const NameCase *c = &nameCases[i];
+    gemdrive_match_compile(&match, c->pattern, 0);
+    bool result = gemdrive_match_name(&match, c->name);
+    CHECK(result == c->expected,
+          "name: pattern \"%s\", name \"%s\": %s, expected %s", c->pattern,
+          c->name, result ? "match" : "no match",
+          c->expected ? "match" : "no match");
+  }
+
+  for (size_t i = 0; i < CASES(attribCases); i++) {
+    const AttribCase *c = &attribCases[i];
+    gemdrive_match_compile(&match, "*.*", c->search);
+    bool result = gemdrive_match_attribs(&match, c->entry);
+    CHECK(result == c->expected,
+          "attributes: search 0x%02x, entry 0x%02x: %s, expected %s",
+          c->search, c->entry, result ? "match" : "no match",
+          c->expected ? "match" : "no match");
+  }
+
+  return check_report();
+}
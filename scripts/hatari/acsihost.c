@@ -0,0 +1,88 @@
+/**
+ * File: acsihost.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the ACSI handler. The firmware code
+ * (rp/src/acsi*.c) is compiled as is and answers the commands of the
+ * cartridge-port shim, with a hard disk image in the volume of the
+ * GEMDRIVE host.
+ */
+
+#include "acsihost.h"
+
+#include <stdio.h>
+
+#include "acsi.h"
+#include "acsi_scancache.h"
+#include "aconfig.h"
+#include "cmdtrace.h"
+#include "hostloop.h"
+
+// Firmware calls the harness answers
+
+// No command trace: the shim keeps its own statistics
+void cmdtrace_setResult(int32_t result) { (void)result; }
+
+// No scan cache: every reset scans the partitions of the image
+uint32_t acsi_scancache_hash(uint32_t hash, const void *data, size_t size) {
+  (void)data;
+  (void)size;
+  return hash;
+}
+
+bool acsi_scancache_load(uint32_t key, void *results, size_t size) {
+  (void)key;
+  (void)results;
+  (void)size;
+  return false;
+}
+
+void acsi_scancache_trace_start(void) {}
+
+void acsi_scancache_trace_target(uint8_t target) { (void)target; }
+
+void acsi_scancache_trace_read(uint32_t lba, uint16_t sectors) {
+  (void)lba;
+  (void)sectors;
+}
+
+void acsi_scancache_store(uint32_t key, const void *results, size_t size) {
+  (void)key;
+  (void)results;
+  (void)size;
+}
+
+void acsi_scancache_note_write(uint8_t target, uint32_t lba,
+                               uint16_t sectors) {
+  (void)target;
+  (void)lba;
+  (void)sectors;
+}
+
+static char imagePathSet[MAX_FILENAME_LENGTH + 1];
+static char driveSet = 'C';
+
+void acsihost_set_image(const char *imagePath, char drive) {
+  snprintf(imagePathSet, sizeof(imagePathSet), "%s",
+           imagePath != NULL ? imagePath : "");
+  driveSet = drive;
+}
+
+bool acsihost_configure(void) {
+  SettingsContext *ctx = aconfig_getContext();
+  const char letter[2] = {driveSet, '\0'};
+  settings_put_bool(ctx, ACONFIG_PARAM_DRIVES_ACSI_ENABLED,
+                    imagePathSet[0] != '\0');
+  settings_put_string(ctx, ACONFIG_PARAM_DRIVES_ACSI_IMAGE, imagePathSet);
+  settings_put_string(ctx, ACONFIG_PARAM_DRIVES_ACSI_DRIVE, letter);
+  return imagePathSet[0] != '\0';
+}
+
+// The main loop of the firmware ticks between commands: delayed writes
+// reach the image after the interval, as on the card
+void acsihost_handler(const CartShimCommand *command, uint8_t *rom4) {
+  (void)rom4;  // The same buffer as __rom_in_ram_start__
+  hostloop_run(command, acsi_loop);
+  acsi_tick();
+}
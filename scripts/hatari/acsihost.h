@@ -0,0 +1,41 @@
+/**
+ * File: acsihost.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the ACSI handler. The firmware code
+ * (rp/src/acsi*.c) is compiled as is and answers the commands of the
+ * cartridge-port shim, with a hard disk image in the volume of the
+ * GEMDRIVE host.
+ */
+
+#ifndef ACSIHOST_H
+#define ACSIHOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cartshim.h"
+
+/**
+ * @brief Sets the hard disk image ACSI serves from the next reset on.
+ *
+ * gemdrivehost_init puts it in the settings and boots the handlers in the
+ * order of the firmware: the partition scan, GEMDRIVE, ACSI, floppies. The
+ * partitions are scanned at every reset, there is no scan cache on the
+ * host. A missing image is reported by the firmware, as on the device.
+ *
+ * @param imagePath Path of the image in the volume, "/acsi/hd.img". NULL
+ * turns ACSI off.
+ * @param drive First drive letter of its partitions, C to Z.
+ */
+void acsihost_set_image(const char *imagePath, char drive);
+
+// Called by gemdrivehost_init. Writes the ACSI settings and returns true if
+// an image is set.
+bool acsihost_configure(void);
+
+// Handler of the shim, registered by gemdrivehost_init
+void acsihost_handler(const CartShimCommand *command, uint8_t *rom4);
+
+#endif  // ACSIHOST_H
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""benchcmp.py - compares two runs of FSBENCH.TOS from BENCH.CSV files.
+
+Every run adds one line per test to BENCH.CSV, tagged with the label given
+with -l. The script takes the median of each test and request size per
+label and compares the new label with the base one: KB/s for the tests that
+move data, operations per second for the others. Under Hatari the timings
+are deterministic, so a small threshold is enough.
+
+Usage:
+  scripts/hatari/benchcmp.py BENCH.CSV [MORE.CSV ...] --base LABEL
+                             --new LABEL [--threshold PERCENT]
+
+Exits with 1 when a test is slower than the threshold, failed in the new
+run, or is missing from it.
+"""
+
+import argparse
+import csv
+import statistics
+import sys
+from collections import defaultdict
+from typing import Dict, List, Tuple
+
+Key = Tuple[str, int]
+
+
+def load(paths: List[str]) -> Dict[str, Dict[Key, List[dict]]]:
+    runs: Dict[str, Dict[Key, List[dict]]] = defaultdict(
+        lambda: defaultdict(list))
+    for path in paths:
+        with open(path, newline="") as fp:
+            for row in csv.DictReader(fp):
+                key = (row["test"], int(row["size"]))
+                runs[row["label"]][key].append(row)
+    return runs
+
+
+def rate(rows: List[dict]) -> Tuple[float, str, bool]:
+    """Median rate of the rows, its unit and whether every row passed."""
+    ok = all(int(row["status"]) == 0 for row in rows)
+    if any(int(row["bytes"]) > 0 for row in rows):
+        return statistics.median(float(r["kb_s"]) for r in rows), "KB/s", ok
+    return statistics.median(float(r["ops_s"]) for r in rows), "ops/s", ok
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Compare two labels of FSBENCH.TOS results")
+    parser.add_argument("csv", nargs="+", help="BENCH.CSV files")
+    parser.add_argument("--base", required=True, help="reference label")
+    parser.add_argument("--new", required=True, help="label to check")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="slowdown in percent that fails (default 5)")
+    args = parser.parse_args()
+
+    runs = load(args.csv)
+    for label in (args.base, args.new):
+        if label not in runs:
+            print(f"error: no results with label {label}", file=sys.stderr)
+            return 2
+
+    base, new = runs[args.base], runs[args.new]
+    failed = 0
+    print(f"{'test':<22} {'size':>6} {'base':>9} {'new':>9} {'':<5}"
+          f" {'change':>8}")
+    for key in sorted(base):
+        test, size = key
+        base_rate, unit, _ = rate(base[key])
+        if key not in new:
+            print(f"{test:<22} {size:>6} {base_rate:>9.1f} {'-':>9} {unit:<5}"
+                  f" {'MISSING':>8}")
+            failed += 1
+            continue
+        new_rate, _, ok = rate(new[key])
+        change = ((new_rate - base_rate) / base_rate * 100.0
+                  if base_rate > 0 else 0.0)
+        verdict = ""
+        if not ok:
+            verdict = "  ERROR"
+        elif change < -args.threshold:
+            verdict = "  SLOWER"
+        if verdict:
+            failed += 1
+        print(f"{test:<22} {size:>6} {base_rate:>9.1f} {new_rate:>9.1f}"
+              f" {unit:<5} {change:>+7.1f}%{verdict}")
+
+    print(f"{len(base)} checks, {failed} failed")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
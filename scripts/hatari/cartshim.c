@@ -0,0 +1,164 @@
+/**
+ * File: cartshim.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host cartridge-port shim for emulators. ROM3 reads become
+ * protocol samples for the firmware tprotocol_parse, ROM4 reads are served
+ * from a 64 KB buffer, and the commands go to host command handlers with
+ * the random token acknowledged as chandler_loop does on the RP2040.
+ */
+
+#include "cartshim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Host shims for the firmware headers, as in scripts/rom3replay
+#define CONSTANTS_H
+#define DEBUG_H
+#define DPRINTF(fmt, ...)
+#define __not_in_flash_func(func) func
+
+static struct {
+  volatile uint32_t timerawl;
+} hostTimer;
+#define timer_hw (&hostTimer)
+
+#include "../../rp/src/include/tprotocol.h"
+
+// Same XOR applied by chandler_consume_rom3_sample
+#define ROM3_ADDRESS_HIGH_BIT 0x8000
+
+// ROM4 as __rom_in_ram_start__: 16-bit words in the RP2040 byte order. Not
+// static: the host builds of the firmware handlers link
+// __rom_in_ram_start__ to it (see gemdrivehost.c).
+uint16_t cartshim_rom4_words[CARTSHIM_BANK_SIZE / 2]
+    __attribute__((aligned(8)));
+
+static CartShimHandler handlers[CARTSHIM_MAX_HANDLERS];
+static size_t handlerCount = 0;
+
+static uint32_t clockHz = 8000000;
+static uint32_t latencyUs = 0;
+static uint32_t incrementalCmdCount = 0;
+static CartShimStats stats;
+
+// The command parsed and not run yet, as pendingProtocol in chandler.c
+static TransmissionProtocol pendingProtocol;
+static bool protocolPending = false;
+static uint64_t pendingSinceUs = 0;
+static uint64_t nowUs = 0;
+
+static void onCommand(const TransmissionProtocol *protocol) {
+  if (protocolPending) stats.commandsLost++;
+  tprotocol_copy_safely(&pendingProtocol, protocol);
+  protocolPending = true;
+  pendingSinceUs = nowUs;
+}
+
+static void onChecksumError(const TransmissionProtocol *protocol) {
+  (void)protocol;
+  stats.checksumErrors++;
+}
+
+// chandler_loop: handlers first, then the token the Atari is waiting for
+static void runPending(void) {
+  if (!protocolPending || nowUs - pendingSinceUs < latencyUs) return;
+  protocolPending = false;
+  stats.busyUs += nowUs - pendingSinceUs;
+
+  if (pendingProtocol.command_id == 0 && pendingProtocol.payload_size == 0 &&
+      pendingProtocol.final_checksum == 0) {
+    return;
+  }
+
+  CartShimCommand command = {
+      .commandId = pendingProtocol.command_id,
+      .payloadSize = pendingProtocol.payload_size,
+      .randomToken = TPROTO_GET_RANDOM_TOKEN(pendingProtocol.payload),
+      .params = pendingProtocol.payload + 2,
+  };
+  for (size_t i = 0; i < handlerCount; i++) {
+    handlers[i](&command, (uint8_t *)cartshim_rom4_words);
+  }
+  stats.commands++;
+  incrementalCmdCount++;
+  TPROTO_SET_RANDOM_TOKEN64(
+      (uint8_t *)cartshim_rom4_words + CARTSHIM_RANDOM_TOKEN_OFFSET,
+      (((uint64_t)incrementalCmdCount) << 32) | command.randomToken);
+}
+
+// The emulator clock, in the microseconds of the RP2040 timer
+static void advanceClock(uint64_t cycles) {
+  nowUs = cycles * 1000000ull / clockHz;
+  hostTimer.timerawl = (uint32_t)nowUs;
+}
+
+void cartshim_init(uint32_t cpuClockHz) {
+  clockHz = cpuClockHz ? cpuClockHz : 8000000;
+  memset(cartshim_rom4_words, 0, sizeof(cartshim_rom4_words));
+  memset(&stats, 0, sizeof(stats));
+  handlerCount = 0;
+  latencyUs = 0;
+  incrementalCmdCount = 0;
+  protocolPending = false;
+  pendingSinceUs = 0;
+  nowUs = 0;
+  hostTimer.timerawl = 0;
+  last_header_found = 0;
+  nextTPstep = HEADER_DETECTION;
+}
+
+bool cartshim_load_rom4(const char *path) {
+  FILE *fp = fopen(path, "rb");
+  if (fp == NULL) return false;
+  uint8_t *bytes = (uint8_t *)cartshim_rom4_words;
+  size_t size = fread(bytes, 1, sizeof(cartshim_rom4_words), fp);
+  bool tooBig = fgetc(fp) != EOF;
+  fclose(fp);
+  if (tooBig) return false;
+
+  // Images are big-endian, like the 68000. The firmware keeps them as
+  // 16-bit words (see target_firmware.h), so each word is swapped here.
+  for (size_t i = 0; i + 1 < size; i += 2) {
+    uint8_t high = bytes[i];
+    bytes[i] = bytes[i + 1];
+    bytes[i + 1] = high;
+  }
+  return true;
+}
+
+void cartshim_add_handler(CartShimHandler handler) {
+  if (handler == NULL || handlerCount == CARTSHIM_MAX_HANDLERS) return;
+  handlers[handlerCount++] = handler;
+}
+
+void cartshim_set_latency_us(uint32_t us) { latencyUs = us; }
+
+uint16_t cartshim_read_word(uint32_t address, uint64_t cycles) {
+  advanceClock(cycles);
+  address &= 0xFFFFFFu;
+  if (address >= CARTSHIM_ROM3_START &&
+      address < CARTSHIM_ROM3_START + CARTSHIM_BANK_SIZE) {
+    // The sample is the address bus, as latched by the RP2040
+    stats.rom3Reads++;
+    uint16_t sample = (uint16_t)(address & 0xFFFFu);
+    tprotocol_parse((uint16_t)(sample ^ ROM3_ADDRESS_HIGH_BIT), onCommand,
+                    onChecksumError);
+    runPending();
+    return CARTSHIM_ROM3_VALUE;
+  }
+  stats.rom4Reads++;
+  runPending();
+  return cartshim_rom4_words[(address & 0xFFFEu) / 2];
+}
+
+uint8_t cartshim_read_byte(uint32_t address, uint64_t cycles) {
+  uint16_t word = cartshim_read_word(address, cycles);
+  return (address & 1u) ? (uint8_t)word : (uint8_t)(word >> 8);
+}
+
+uint8_t *cartshim_rom4(void) { return (uint8_t *)cartshim_rom4_words; }
+
+const CartShimStats *cartshim_stats(void) { return &stats; }
@@ -0,0 +1,92 @@
+/**
+ * File: cartshim.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host cartridge-port shim for emulators. ROM3 reads become
+ * protocol samples for the firmware tprotocol_parse, ROM4 reads are served
+ * from a 64 KB buffer, and the commands go to host command handlers with
+ * the random token acknowledged as chandler_loop does on the RP2040.
+ */
+
+#ifndef CARTSHIM_H
+#define CARTSHIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Cartridge port banks as seen by the 68000
+#define CARTSHIM_ROM4_START 0xFA0000u
+#define CARTSHIM_ROM3_START 0xFB0000u
+#define CARTSHIM_BANK_SIZE 0x10000u
+
+// Mirrors rp/src/include/chandler.h
+#define CARTSHIM_RANDOM_TOKEN_OFFSET 0x8200u
+#define CARTSHIM_SHARED_VARIABLES_OFFSET (CARTSHIM_RANDOM_TOKEN_OFFSET + 8)
+
+// What a ROM3 read returns: the bank is not backed by memory
+#define CARTSHIM_ROM3_VALUE 0xFFFFu
+
+#define CARTSHIM_MAX_HANDLERS 8
+
+// A command accepted by the parser, the random token already skipped
+typedef struct {
+  uint16_t commandId;
+  uint16_t payloadSize;  // With the 4 bytes of the random token
+  uint32_t randomToken;
+  const uint16_t *params;  // Payload after the random token
+} CartShimCommand;
+
+// Same contract as a chandler callback: ignore the commands of other apps,
+// answer in the ROM4 buffer (RP2040 byte order, as __rom_in_ram_start__)
+typedef void (*CartShimHandler)(const CartShimCommand *command,
+                                uint8_t *rom4);
+
+typedef struct {
+  uint64_t rom3Reads;
+  uint64_t rom4Reads;
+  uint32_t commands;
+  uint32_t checksumErrors;
+  uint32_t commandsLost;  // A new command arrived before the last one ran
+  uint64_t busyUs;        // Emulated time with a command waiting to run
+} CartShimStats;
+
+/**
+ * @brief Resets the shim: empty ROM4, parser restarted, no handlers.
+ *
+ * @param cpuClockHz Clock of the emulated 68000, to turn the cycle counter
+ * of the emulator into the microseconds the parser and the latency use.
+ */
+void cartshim_init(uint32_t cpuClockHz);
+
+/**
+ * @brief Copies a cartridge image into ROM4, as the firmware does at boot.
+ *
+ * @return false if the file can't be read or is bigger than the bank.
+ */
+bool cartshim_load_rom4(const char *path);
+
+void cartshim_add_handler(CartShimHandler handler);
+
+/**
+ * @brief Time the firmware takes to notice and run a command.
+ *
+ * The handlers run, and the token is written, on the first cartridge read
+ * this long after the command was parsed. Zero answers at once.
+ */
+void cartshim_set_latency_us(uint32_t latencyUs);
+
+/**
+ * @brief A 68000 read in the cartridge banks.
+ *
+ * @param address 24-bit bus address, 0xFA0000 to 0xFBFFFF.
+ * @param cycles Cycle counter of the emulator at the time of the read.
+ */
+uint16_t cartshim_read_word(uint32_t address, uint64_t cycles);
+uint8_t cartshim_read_byte(uint32_t address, uint64_t cycles);
+
+uint8_t *cartshim_rom4(void);
+const CartShimStats *cartshim_stats(void);
+
+#endif  // CARTSHIM_H
@@ -0,0 +1,43 @@
+/**
+ * File: floppyhost.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the floppy handler. The firmware code
+ * (rp/src/floppy.c) is compiled as is and answers the commands of the
+ * cartridge-port shim, with floppy images in the volume of the GEMDRIVE
+ * host.
+ */
+
+#include "floppyhost.h"
+
+#include <stdio.h>
+
+#include "aconfig.h"
+#include "floppy.h"
+#include "hostloop.h"
+
+static char imageASet[FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH];
+static char imageBSet[FLOPPYEMUL_FATFS_MAX_FOLDER_LENGTH];
+
+void floppyhost_set_images(const char *imageA, const char *imageB) {
+  snprintf(imageASet, sizeof(imageASet), "%s", imageA != NULL ? imageA : "");
+  snprintf(imageBSet, sizeof(imageBSet), "%s", imageB != NULL ? imageB : "");
+}
+
+bool floppyhost_configure(void) {
+  SettingsContext *ctx = aconfig_getContext();
+  settings_put_bool(ctx, ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED,
+                    imageASet[0] != '\0');
+  settings_put_string(ctx, ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A, imageASet);
+  settings_put_string(ctx, ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_B, imageBSet);
+  return imageASet[0] != '\0';
+}
+
+// The main loop of the firmware ticks between commands: delayed writes
+// reach the image after the interval, as on the card
+void floppyhost_handler(const CartShimCommand *command, uint8_t *rom4) {
+  (void)rom4;  // The same buffer as __rom_in_ram_start__
+  hostloop_run(command, floppy_loop);
+  floppy_tick();
+}
@@ -0,0 +1,41 @@
+/**
+ * File: floppyhost.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the floppy handler. The firmware code
+ * (rp/src/floppy.c) is compiled as is and answers the commands of the
+ * cartridge-port shim, with floppy images in the volume of the GEMDRIVE
+ * host.
+ */
+
+#ifndef FLOPPYHOST_H
+#define FLOPPYHOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cartshim.h"
+
+/**
+ * @brief Sets the floppy images inserted from the next reset on.
+ *
+ * gemdrivehost_init puts them in the settings and boots the floppy handler
+ * after GEMDRIVE and ACSI, as the firmware does. As on the device, an image
+ * is read only unless its name ends in .rw, and a missing image leaves its
+ * drive empty.
+ *
+ * @param imageA Path of the image of drive A in the volume. NULL turns the
+ * floppies off.
+ * @param imageB Path of the image of drive B, or NULL for none.
+ */
+void floppyhost_set_images(const char *imageA, const char *imageB);
+
+// Called by gemdrivehost_init. Writes the floppy settings and returns true
+// if an image is set.
+bool floppyhost_configure(void);
+
+// Handler of the shim, registered by gemdrivehost_init
+void floppyhost_handler(const CartShimCommand *command, uint8_t *rom4);
+
+#endif  // FLOPPYHOST_H
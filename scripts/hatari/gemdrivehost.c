@@ -0,0 +1,314 @@
+/**
+ * File: gemdrivehost.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the GEMDRIVE handler. The firmware code
+ * (rp/src/gemdrive.c and what it calls) is compiled as is and answers the
+ * commands of the cartridge-port shim, with FatFS on a disk image file in
+ * place of the SD card.
+ *
+ * The firmware keeps the addresses of the shared memory in 32-bit
+ * integers, so the harness is linked without PIE and __rom_in_ram_start__
+ * is the ROM4 buffer of the shim (-Wl,--defsym, see scripts/Makefile).
+ */
+
+#include "gemdrivehost.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aconfig.h"
+#include "acsi.h"
+#include "acsihost.h"
+#include "bootcache.h"
+#include "cartshim.h"
+#include "diskio.h"
+#include "display.h"
+#include "ff.h"
+#include "floppy.h"
+#include "floppyhost.h"
+#include "gconfig.h"
+#include "gemdrive.h"
+#include "hardware/flash.h"
+#include "hostloop.h"
+#include "perfprofile.h"
+#include "sdcard.h"
+
+#define SECTOR_SIZE 512u
+
+// Work area of f_mkfs
+#define MKFS_WORK_SIZE (64u * SECTOR_SIZE)
+
+// The drive entries of the app settings, as on the card of a new device.
+// ACSI and floppies stay off until acsihost_set_image and
+// floppyhost_set_images.
+static const SettingsConfigEntry defaultEntries[] = {
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_ENABLED, SETTINGS_TYPE_BOOL, "true"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER, SETTINGS_TYPE_STRING,
+     GEMDRIVEHOST_FOLDER},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE, SETTINGS_TYPE_STRING, "C"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_2, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_2, SETTINGS_TYPE_STRING, "D"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_2, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_FOLDER_3, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE_3, SETTINGS_TYPE_STRING, "E"},
+    {ACONFIG_PARAM_DRIVES_GEMDRIVE_READONLY_3, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_ACSI_ENABLED, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_ACSI_ID, SETTINGS_TYPE_INT, "7"},
+    {ACONFIG_PARAM_DRIVES_ACSI_DRIVE, SETTINGS_TYPE_STRING, "C"},
+    {ACONFIG_PARAM_DRIVES_ACSI_IMAGE, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_ACSI_READAHEAD, SETTINGS_TYPE_BOOL, "true"},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_ENABLED, SETTINGS_TYPE_BOOL, "false"},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_FOLDER, SETTINGS_TYPE_STRING, "/floppies"},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_A, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_DRIVE_B, SETTINGS_TYPE_STRING, ""},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_BOOT_ENABLED, SETTINGS_TYPE_BOOL, "true"},
+    {ACONFIG_PARAM_DRIVES_FLOPPY_XBIOS_ENABLED, SETTINGS_TYPE_BOOL, "true"},
+};
+
+// The app settings live in this RAM flash, mapped at XIP_BASE
+uint8_t gemdrivehost_flash[ACONFIG_BUFFER_SIZE];
+static SettingsContext settingsCtx;
+
+timer_hw_t gemdrivehost_timer_hw;
+
+static const PerfProfile hostProfile = {"host", 225000, VREG_VOLTAGE_1_10, 0,
+                                        12500};
+
+static uint32_t displayCommand = 0;
+
+// The disk image behind drive 0 of FatFS
+static int imageFd = -1;
+static LBA_t imageSectors = 0;
+static FATFS hostFs;
+
+// Firmware calls the harness answers
+
+SettingsContext *aconfig_getContext(void) { return &settingsCtx; }
+
+// The SD card entries of the global settings are not used on the host
+SettingsContext *gconfig_getContext(void) { return &settingsCtx; }
+
+const PerfProfile *perfprofile_getActive(void) { return &hostProfile; }
+
+uint32_t display_getCommandAddress() {
+  return (uint32_t)(uintptr_t)&displayCommand;
+}
+
+uint32_t get_rand_32(void) { return ((uint32_t)rand() << 16) ^ rand(); }
+
+absolute_time_t get_absolute_time(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (absolute_time_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+  if (flash_offs + count > sizeof(gemdrivehost_flash)) return;
+  memset(&gemdrivehost_flash[flash_offs], 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data,
+                         size_t count) {
+  if (flash_offs + count > sizeof(gemdrivehost_flash)) return;
+  for (size_t i = 0; i < count; i++) {
+    gemdrivehost_flash[flash_offs + i] &= data[i];
+  }
+}
+
+// No card: the image is opened by gemdrivehost_init
+bool sd_init_driver(void) { return true; }
+size_t sd_get_num() { return 0; }
+sd_card_t *sd_get_by_num(size_t num) {
+  (void)num;
+  return NULL;
+}
+
+// No boot cache: every read goes to FatFS
+int16_t bootcache_open_source(const char *path, FSIZE_t size, WORD fdate,
+                              WORD ftime, uint8_t unitShift) {
+  (void)path;
+  (void)size;
+  (void)fdate;
+  (void)ftime;
+  (void)unitShift;
+  return BOOTCACHE_NO_SOURCE;
+}
+
+FRESULT bootcache_f_read(int16_t source, FIL *fp, void *buff, UINT btr,
+                         UINT *br) {
+  (void)source;
+  return f_read(fp, buff, btr, br);
+}
+
+bool bootcache_read(int16_t source, uint32_t start, uint32_t bytes,
+                    void *buffer) {
+  (void)source;
+  (void)start;
+  (void)bytes;
+  (void)buffer;
+  return false;
+}
+
+void bootcache_record(int16_t source, uint32_t start, uint32_t bytes) {
+  (void)source;
+  (void)start;
+  (void)bytes;
+}
+
+void bootcache_note_write(int16_t source) { (void)source; }
+
+void bootcache_note_write_path(const char *path) { (void)path; }
+
+// FatFS media access and system calls (diskio.h, ffsystem.c), on the image
+
+DSTATUS disk_initialize(BYTE pdrv) { return disk_status(pdrv); }
+
+DSTATUS disk_status(BYTE pdrv) {
+  return (pdrv == 0 && imageFd >= 0) ? 0 : STA_NOINIT;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
+  if (disk_status(pdrv) != 0) return RES_NOTRDY;
+  if (sector + count > imageSectors) return RES_PARERR;
+  size_t bytes = (size_t)count * SECTOR_SIZE;
+  ssize_t done = pread(imageFd, buff, bytes, (off_t)sector * SECTOR_SIZE);
+  return (done == (ssize_t)bytes) ? RES_OK : RES_ERROR;
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) {
+  if (disk_status(pdrv) != 0) return RES_NOTRDY;
+  if (sector + count > imageSectors) return RES_PARERR;
+  size_t bytes = (size_t)count * SECTOR_SIZE;
+  ssize_t done = pwrite(imageFd, buff, bytes, (off_t)sector * SECTOR_SIZE);
+  return (done == (ssize_t)bytes) ? RES_OK : RES_ERROR;
+}
+
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff) {
+  if (disk_status(pdrv) != 0) return RES_NOTRDY;
+  switch (cmd) {
+    case CTRL_SYNC:
+      return (fsync(imageFd) == 0) ? RES_OK : RES_ERROR;
+    case GET_SECTOR_COUNT:
+      *(LBA_t *)buff = imageSectors;
+      return RES_OK;
+    case GET_SECTOR_SIZE:
+      *(WORD *)buff = SECTOR_SIZE;
+      return RES_OK;
+    case GET_BLOCK_SIZE:
+      *(DWORD *)buff = 1;
+      return RES_OK;
+    default:
+      return RES_PARERR;
+  }
+}
+
+DWORD get_fattime(void) {
+  time_t now = time(NULL);
+  struct tm tm;
+  localtime_r(&now, &tm);
+  return ((DWORD)(tm.tm_year - 80) << 25) | ((DWORD)(tm.tm_mon + 1) << 21) |
+         ((DWORD)tm.tm_mday << 16) | ((DWORD)tm.tm_hour << 11) |
+         ((DWORD)tm.tm_min << 5) | ((DWORD)tm.tm_sec >> 1);
+}
+
+void *ff_memalloc(UINT msize) { return malloc(msize); }
+
+void ff_memfree(void *mblock) { free(mblock); }
+
+// The command as chandler_loop hands it to the loops
+void hostloop_run(const CartShimCommand *command, HostLoop loop) {
+  static TransmissionProtocol protocol;
+  memset(&protocol, 0, sizeof(protocol));
+  protocol.command_id = command->commandId;
+  protocol.payload_size =
+      tprotocol_clamp_payload_size(command->payloadSize);
+  protocol.payload[0] = (uint16_t)command->randomToken;
+  protocol.payload[1] = (uint16_t)(command->randomToken >> 16);
+  if (protocol.payload_size > 4) {
+    memcpy(&protocol.payload[2], command->params, protocol.payload_size - 4);
+  }
+  loop(&protocol, &protocol.payload[2]);
+}
+
+static void gemdriveHandler(const CartShimCommand *command, uint8_t *rom4) {
+  (void)rom4;  // The same buffer as __rom_in_ram_start__
+  hostloop_run(command, gemdrive_loop);
+}
+
+static bool openImage(const char *imagePath) {
+  bool created = false;
+  imageFd = open(imagePath, O_RDWR);
+  if (imageFd < 0) {
+    imageFd = open(imagePath, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (imageFd < 0 ||
+        ftruncate(imageFd, (off_t)GEMDRIVEHOST_IMAGE_MB << 20) != 0) {
+      return false;
+    }
+    created = true;
+  }
+  struct stat st;
+  if (fstat(imageFd, &st) != 0) return false;
+  imageSectors = (LBA_t)st.st_size / SECTOR_SIZE;
+
+  if (created) {
+    // No partition table, so mtools and the host can read it as is
+    static BYTE work[MKFS_WORK_SIZE];
+    const MKFS_PARM format = {FM_FAT | FM_FAT32 | FM_SFD, 0, 0, 0, 0};
+    if (f_mkfs("0:", &format, work, sizeof(work)) != FR_OK) return false;
+  }
+
+  // The folder is not created by the firmware
+  if (f_mount(&hostFs, "0:", 1) != FR_OK) return false;
+  FRESULT fr = f_mkdir(GEMDRIVEHOST_FOLDER);
+  f_unmount("0:");
+  return fr == FR_OK || fr == FR_EXIST;
+}
+
+bool gemdrivehost_init(const char *imagePath, char drive) {
+  // A reset of the emulator: the files of the last session are closed
+  // first, as the firmware does before the card goes away
+  if (imageFd >= 0) {
+    gemdrive_release();
+    acsi_release();
+    floppy_release();
+    f_unmount("0:");
+    close(imageFd);
+    imageFd = -1;
+  }
+  if (!openImage(imagePath)) {
+    if (imageFd >= 0) close(imageFd);
+    imageFd = -1;
+    return false;
+  }
+
+  settings_deinit(&settingsCtx);
+  memset(gemdrivehost_flash, 0xFF, sizeof(gemdrivehost_flash));
+  // The flash is blank, so this returns an error with the defaults loaded
+  settings_init(&settingsCtx, defaultEntries,
+                sizeof(defaultEntries) / sizeof(defaultEntries[0]), 0,
+                ACONFIG_BUFFER_SIZE, ACONFIG_MAGIC_NUMBER,
+                ACONFIG_VERSION_NUMBER);
+  const char letter[2] = {drive, '\0'};
+  settings_put_string(&settingsCtx, ACONFIG_PARAM_DRIVES_GEMDRIVE_DRIVE,
+                      letter);
+
+  bool acsi = acsihost_configure();
+  bool floppies = floppyhost_configure();
+
+  // The boot order of emul.c
+  acsi_preInit();
+  gemdrive_init();
+  acsi_init();
+  floppy_init();
+  cartshim_add_handler(gemdriveHandler);
+  if (acsi) cartshim_add_handler(acsihost_handler);
+  if (floppies) cartshim_add_handler(floppyhost_handler);
+  return true;
+}
@@ -0,0 +1,39 @@
+/**
+ * File: gemdrivehost.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host build of the GEMDRIVE handler. The firmware code
+ * (rp/src/gemdrive.c and what it calls) is compiled as is and answers the
+ * commands of the cartridge-port shim, with FatFS on a disk image file in
+ * place of the SD card.
+ */
+
+#ifndef GEMDRIVEHOST_H
+#define GEMDRIVEHOST_H
+
+#include <stdbool.h>
+
+// Size of the images created by gemdrivehost_init
+#define GEMDRIVEHOST_IMAGE_MB 64u
+
+// GEMDRIVE folder of the image, the default of the firmware
+#define GEMDRIVEHOST_FOLDER "/hd"
+
+/**
+ * @brief Opens the image and registers the GEMDRIVE handler with the shim.
+ *
+ * A missing image is created and formatted FAT, with an empty GEMDRIVE
+ * folder. Call it after cartshim_init and cartshim_load_rom4, at every
+ * reset: gemdrive_init writes its shared variables in ROM4. The ACSI and
+ * floppy handlers are booted and registered too when acsihost_set_image or
+ * floppyhost_set_images gave them an image. The volume stays mounted until
+ * the next call, so the caller can use FatFS on it.
+ *
+ * @param imagePath Disk image of a FAT volume, as FatFS mounts it.
+ * @param drive Drive letter of GEMDRIVE on the Atari, C to Z.
+ * @return false if the image can't be created, opened or mounted.
+ */
+bool gemdrivehost_init(const char *imagePath, char drive);
+
+#endif  // GEMDRIVEHOST_H
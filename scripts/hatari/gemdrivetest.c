@@ -0,0 +1,372 @@
+/**
+ * File: gemdrivetest.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host checks of the GEMDRIVE handler of the firmware behind
+ * the cartridge-port shim. Formats a disk image, puts files in it with
+ * FatFS and sends the GEMDOS commands the way the 68000 driver
+ * (target/atarist/src/gemdrive.s) does, reading the answers from ROM4.
+ * Then a sector of a floppy image and of an ACSI image in the same volume
+ * is read through the floppy and ACSI handlers.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "acsi.h"
+#include "acsihost.h"
+#include "cartshim.h"
+#include "check.h"
+#include "ff.h"
+#include "floppy.h"
+#include "floppyhost.h"
+#include "gemdrive.h"
+#include "gemdrivehost.h"
+
+#define CPU_HZ 8000000u
+
+// Cycles of one tst.b (a0,dn.w) and of the token poll loop, roughly
+#define CYCLES_PER_SAMPLE 14u
+#define CYCLES_PER_POLL 24u
+#define POLL_LIMIT 100000u
+
+// send_write_sync sends d3, d4 and d5 and then a buffer of this size
+#define PATH_BUFFER_SIZE 256
+
+#define FILE_SIZE 5000u
+
+#define SECTOR_SIZE 512u
+
+// Floppy image: a boot sector with the BPB of a 360 KB disk, cut short
+#define FLOPPY_FOLDER "/floppies"
+#define FLOPPY_IMAGE FLOPPY_FOLDER "/TEST.ST"
+#define FLOPPY_SECTORS 16u
+#define FLOPPY_SECTOR 3u
+
+// ACSI image: an MBR with one FAT16 partition from sector 1, on drive E
+#define ACSI_FOLDER "/acsi"
+#define ACSI_IMAGE ACSI_FOLDER "/HD.IMG"
+#define ACSI_PARTITION_SECTORS 4200u
+#define ACSI_DRIVE 'E'
+#define ACSI_SECTOR 10u
+
+static uint64_t cycles = 0;
+static uint32_t nextToken = 0x10000u;
+
+static void sendSample(uint16_t word) {
+  // a0 points to the middle of ROM3 and the word is a signed index
+  uint32_t address =
+      CARTSHIM_ROM3_START + 0x8000u + (uint32_t)(int32_t)(int16_t)word;
+  cartshim_read_byte(address, cycles);
+  cycles += CYCLES_PER_SAMPLE;
+}
+
+static uint16_t readWord(uint32_t offset) {
+  return cartshim_read_word(CARTSHIM_ROM4_START + offset, cycles);
+}
+
+static uint32_t readLong(uint32_t offset) {
+  uint32_t high = readWord(offset);
+  uint32_t low = readWord(offset + 2);
+  cycles += CYCLES_PER_POLL;
+  return (high << 16) | low;
+}
+
+static uint32_t sharedVar(uint32_t index) {
+  return readLong(GEMDRIVE_SHARED_VARIABLES_OFFSET + index * 4);
+}
+
+// send_sync: header, command, size, token low and high word, the
+// parameters, then the checksum. Longs go low word first, as the driver
+// sends d3 to d5. Returns false if the token did not come back.
+static bool sendSync(uint16_t commandId, const uint32_t *longs,
+                     uint16_t longCount, const char *path) {
+  uint32_t token = nextToken++;
+  uint16_t size = (uint16_t)(4 + longCount * 4 +
+                             (path != NULL ? PATH_BUFFER_SIZE : 0));
+  uint16_t checksum = commandId + size + (uint16_t)token +
+                      (uint16_t)(token >> 16);
+  sendSample(0xABCD);
+  sendSample(commandId);
+  sendSample(size);
+  sendSample((uint16_t)token);
+  sendSample((uint16_t)(token >> 16));
+  for (uint16_t i = 0; i < longCount; i++) {
+    uint16_t words[2] = {(uint16_t)longs[i], (uint16_t)(longs[i] >> 16)};
+    for (int w = 0; w < 2; w++) {
+      sendSample(words[w]);
+      checksum += words[w];
+    }
+  }
+  if (path != NULL) {
+    // The 68000 sends the bytes of the string as big-endian words
+    char buffer[PATH_BUFFER_SIZE] = {0};
+    strncpy(buffer, path, sizeof(buffer) - 1);
+    for (int i = 0; i < PATH_BUFFER_SIZE; i += 2) {
+      uint16_t word = (uint16_t)((uint8_t)buffer[i] << 8) |
+                      (uint8_t)buffer[i + 1];
+      sendSample(word);
+      checksum += word;
+    }
+  }
+  sendSample(checksum);
+
+  for (uint32_t polls = 0; polls < POLL_LIMIT; polls++) {
+    if (readLong(CARTSHIM_RANDOM_TOKEN_OFFSET) == token) return true;
+  }
+  return false;
+}
+
+static uint8_t pattern(uint32_t offset) {
+  return (uint8_t)(offset * 7u + (offset >> 8));
+}
+
+static bool writeFile(const char *path, uint32_t size) {
+  FIL file;
+  if (f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) return false;
+  bool ok = true;
+  for (uint32_t i = 0; i < size && ok; i++) {
+    uint8_t byte = pattern(i);
+    UINT written = 0;
+    ok = f_write(&file, &byte, 1, &written) == FR_OK && written == 1;
+  }
+  return f_close(&file) == FR_OK && ok;
+}
+
+static void putLe16(uint8_t *buffer, size_t offset, uint16_t value) {
+  buffer[offset] = (uint8_t)value;
+  buffer[offset + 1] = (uint8_t)(value >> 8);
+}
+
+static void putLe32(uint8_t *buffer, size_t offset, uint32_t value) {
+  putLe16(buffer, offset, (uint16_t)value);
+  putLe16(buffer, offset + 2, (uint16_t)(value >> 16));
+}
+
+// FAT16 boot sector, with the 0x55AA signature ACSI wants
+static void bootSector(uint8_t *sector, uint16_t sectorsPerCluster,
+                       uint16_t rootEntries, uint16_t totalSectors,
+                       uint16_t sectorsPerFat) {
+  memset(sector, 0, SECTOR_SIZE);
+  sector[0] = 0xE9;
+  memcpy(&sector[3], "HOSTTEST", 8);
+  putLe16(sector, 11, SECTOR_SIZE);
+  sector[13] = (uint8_t)sectorsPerCluster;
+  putLe16(sector, 14, 1);  // Reserved sectors
+  sector[16] = 2;          // FATs
+  putLe16(sector, 17, rootEntries);
+  putLe16(sector, 19, totalSectors);
+  sector[21] = 0xF8;
+  putLe16(sector, 22, sectorsPerFat);
+  sector[510] = 0x55;
+  sector[511] = 0xAA;
+}
+
+// The pattern, with the first sectors taken from headers
+static bool writeImage(const char *path, uint32_t sectors,
+                       const uint8_t (*headers)[SECTOR_SIZE],
+                       uint32_t headerCount) {
+  FIL file;
+  if (f_open(&file, path, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK) return false;
+  bool ok = true;
+  for (uint32_t i = 0; i < sectors && ok; i++) {
+    uint8_t sector[SECTOR_SIZE];
+    if (i < headerCount) {
+      memcpy(sector, headers[i], SECTOR_SIZE);
+    } else {
+      for (uint32_t b = 0; b < SECTOR_SIZE; b++) {
+        sector[b] = pattern(i * SECTOR_SIZE + b);
+      }
+    }
+    UINT written = 0;
+    ok = f_write(&file, sector, SECTOR_SIZE, &written) == FR_OK &&
+         written == SECTOR_SIZE;
+  }
+  return f_close(&file) == FR_OK && ok;
+}
+
+// True if the sector of the image is in ROM4 at offset, as the Atari reads
+static bool sectorInRom4(uint32_t offset, uint32_t sector) {
+  for (uint32_t b = 0; b < SECTOR_SIZE; b++) {
+    uint8_t byte =
+        cartshim_read_byte(CARTSHIM_ROM4_START + offset + b, cycles);
+    if (byte != pattern(sector * SECTOR_SIZE + b)) return false;
+  }
+  return true;
+}
+
+static uint32_t fopenCall(const char *path, uint16_t mode) {
+  const uint32_t longs[3] = {mode, 0, 0};
+  CHECK(sendSync(GEMDRVEMUL_FOPEN_CALL, longs, 3, path),
+        "Fopen %s not answered", path);
+  return readLong(GEMDRIVE_FOPEN_HANDLE);
+}
+
+// Fread of the driver: one READ_BUFF_CALL per buffer. Returns the bytes
+// read, or -1 if they differ from the pattern.
+static int32_t freadCall(uint16_t handle, uint32_t bytes) {
+  uint32_t offset = 0;
+  while (offset < bytes) {
+    uint32_t pending = bytes - offset;
+    const uint32_t longs[3] = {handle, bytes, pending};
+    CHECK(sendSync(GEMDRVEMUL_READ_BUFF_CALL, longs, 3, NULL),
+          "READ_BUFF not answered");
+    uint32_t got = readLong(GEMDRIVE_READ_BYTES);
+    if (got == 0 || got > pending) break;
+    for (uint32_t i = 0; i < got; i++) {
+      uint8_t byte = cartshim_read_byte(
+          CARTSHIM_ROM4_START + GEMDRIVE_READ_BUFF + i, cycles);
+      if (byte != pattern(offset + i)) return -1;
+    }
+    offset += got;
+  }
+  return (int32_t)offset;
+}
+
+static uint16_t fcloseCall(uint16_t handle) {
+  const uint32_t longs[1] = {handle};
+  CHECK(sendSync(GEMDRVEMUL_FCLOSE_CALL, longs, 1, NULL),
+        "Fclose not answered");
+  return readWord(GEMDRIVE_FCLOSE_STATUS);
+}
+
+static void testInit(const char *image) {
+  cartshim_init(CPU_HZ);
+  CHECK(gemdrivehost_init(image, 'D'), "can't create %s", image);
+  CHECK(sharedVar(GEMDRIVE_SHARED_VARIABLE_ENABLED) == 0xFFFFFFFFu,
+        "enabled %08x", sharedVar(GEMDRIVE_SHARED_VARIABLE_ENABLED));
+  CHECK(sharedVar(GEMDRIVE_SHARED_VARIABLE_DRIVE_LETTER) == 'D',
+        "drive letter %08x", sharedVar(GEMDRIVE_SHARED_VARIABLE_DRIVE_LETTER));
+  CHECK(sharedVar(GEMDRIVE_SHARED_VARIABLE_DRIVE_MASK) == 1u << 3,
+        "drive mask %08x", sharedVar(GEMDRIVE_SHARED_VARIABLE_DRIVE_MASK));
+  CHECK(sharedVar(GEMDRIVE_SHARED_VARIABLE_FIRST_FILE_DESCRIPTOR) ==
+            FIRST_FILE_DESCRIPTOR,
+        "first file descriptor %u",
+        sharedVar(GEMDRIVE_SHARED_VARIABLE_FIRST_FILE_DESCRIPTOR));
+
+  FILINFO info;
+  CHECK(f_stat(GEMDRIVEHOST_FOLDER, &info) == FR_OK &&
+            (info.fattrib & AM_DIR) != 0,
+        "no %s folder in the new image", GEMDRIVEHOST_FOLDER);
+  CHECK(writeFile(GEMDRIVEHOST_FOLDER "/README.TXT", FILE_SIZE),
+        "can't write README.TXT in the image");
+}
+
+static void testRead(void) {
+  uint32_t handle = fopenCall("D:\\README.TXT", 0);
+  CHECK(handle >= FIRST_FILE_DESCRIPTOR && handle < 0x10000u,
+        "Fopen handle %08x", handle);
+  int32_t bytes = freadCall((uint16_t)handle, FILE_SIZE);
+  CHECK(bytes == (int32_t)FILE_SIZE, "Fread got %d bytes of %u", bytes,
+        FILE_SIZE);
+  CHECK(fcloseCall((uint16_t)handle) == GEMDOS_EOK, "Fclose failed");
+  CHECK(fcloseCall((uint16_t)handle) == (uint16_t)GEMDOS_EIHNDL,
+        "a closed handle was closed again");
+
+  handle = fopenCall("\\MISSING.TXT", 0);
+  CHECK(handle == (uint32_t)GEMDOS_EFILNF, "Fopen of a missing file %08x",
+        handle);
+}
+
+static void testDcreate(void) {
+  const uint32_t longs[3] = {0, 0, 0};
+  CHECK(sendSync(GEMDRVEMUL_DCREATE_CALL, longs, 3, "D:\\NEWDIR"),
+        "Dcreate not answered");
+  CHECK(readWord(GEMDRIVE_DCREATE_STATUS) == GEMDOS_EOK, "Dcreate %04x",
+        readWord(GEMDRIVE_DCREATE_STATUS));
+  FILINFO info;
+  CHECK(f_stat(GEMDRIVEHOST_FOLDER "/NEWDIR", &info) == FR_OK &&
+            (info.fattrib & AM_DIR) != 0,
+        "Dcreate made no folder in the image");
+
+  CHECK(sendSync(GEMDRVEMUL_DCREATE_CALL, longs, 3, "D:\\NEWDIR"),
+        "Dcreate not answered");
+  CHECK(readWord(GEMDRIVE_DCREATE_STATUS) == (uint16_t)GEMDOS_EACCDN,
+        "Dcreate of an existing folder %04x",
+        readWord(GEMDRIVE_DCREATE_STATUS));
+}
+
+// The emulator is reset: the image keeps the files of the last session
+static void testReset(const char *image) {
+  uint32_t handle = fopenCall("D:\\README.TXT", 0);
+  CHECK(handle >= FIRST_FILE_DESCRIPTOR, "Fopen handle %08x", handle);
+
+  cartshim_init(CPU_HZ);
+  CHECK(gemdrivehost_init(image, 'D'), "can't open %s again", image);
+  CHECK(fcloseCall((uint16_t)handle) == (uint16_t)GEMDOS_EIHNDL,
+        "a handle outlived the reset");
+  handle = fopenCall("D:\\README.TXT", 0);
+  CHECK(freadCall((uint16_t)handle, FILE_SIZE) == (int32_t)FILE_SIZE,
+        "README.TXT after the reset");
+  fcloseCall((uint16_t)handle);
+}
+
+// ACSI and floppy images in the volume, served from the next reset on
+static void testDrives(const char *image) {
+  uint8_t floppyBoot[1][SECTOR_SIZE];
+  bootSector(floppyBoot[0], 2, 112, 720, 2);
+  CHECK(f_mkdir(FLOPPY_FOLDER) == FR_OK, "can't create %s", FLOPPY_FOLDER);
+  CHECK(writeImage(FLOPPY_IMAGE, FLOPPY_SECTORS, floppyBoot, 1),
+        "can't write %s", FLOPPY_IMAGE);
+
+  uint8_t acsiHeaders[2][SECTOR_SIZE];
+  memset(acsiHeaders[0], 0, SECTOR_SIZE);
+  uint8_t *entry = &acsiHeaders[0][446];
+  entry[4] = 0x06;  // FAT16
+  putLe32(entry, 8, 1);
+  putLe32(entry, 12, ACSI_PARTITION_SECTORS);
+  acsiHeaders[0][510] = 0x55;
+  acsiHeaders[0][511] = 0xAA;
+  bootSector(acsiHeaders[1], 1, 512, ACSI_PARTITION_SECTORS, 17);
+  CHECK(f_mkdir(ACSI_FOLDER) == FR_OK, "can't create %s", ACSI_FOLDER);
+  CHECK(writeImage(ACSI_IMAGE, 1 + ACSI_PARTITION_SECTORS, acsiHeaders, 2),
+        "can't write %s", ACSI_IMAGE);
+
+  acsihost_set_image(ACSI_IMAGE, ACSI_DRIVE);
+  floppyhost_set_images(FLOPPY_IMAGE, NULL);
+  cartshim_init(CPU_HZ);
+  CHECK(gemdrivehost_init(image, 'D'), "can't open %s again", image);
+
+  // Floprd of the driver: d3 is the sector size and the sector, d4 the drive
+  const uint32_t floppyLongs[2] = {(FLOPPY_SECTOR << 16) | SECTOR_SIZE, 0};
+  CHECK(sendSync(FLOPPYEMUL_READ_SECTORS, floppyLongs, 2, NULL),
+        "floppy READ_SECTORS not answered");
+  CHECK(sectorInRom4(FLOPPYEMUL_IMAGE, FLOPPY_SECTOR),
+        "floppy sector %u not in ROM4", FLOPPY_SECTOR);
+
+  // Rwabs of the driver: d3 is the drive and the logical sector
+  const uint32_t acsiLongs[1] = {(ACSI_SECTOR << 16) | (ACSI_DRIVE - 'A')};
+  CHECK(sendSync(ACSIEMUL_READ_SECTOR, acsiLongs, 1, NULL),
+        "ACSI READ_SECTOR not answered");
+  uint32_t status = readLong(ACSIEMUL_SHARED_VARIABLES_OFFSET +
+                             ACSIEMUL_SVAR_RW_STATUS * 4);
+  CHECK(status == 0, "ACSI READ_SECTOR status %08x", status);
+  // The partition starts at sector 1 of the image
+  CHECK(sectorInRom4(ACSIEMUL_IMAGE_BUFFER_OFFSET, ACSI_SECTOR + 1),
+        "ACSI sector %u not in ROM4", ACSI_SECTOR);
+
+  acsihost_set_image(NULL, 'C');
+  floppyhost_set_images(NULL, NULL);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s IMAGE\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  // Formatted again on every run
+  const char *image = argv[1];
+  remove(image);
+
+  testInit(image);
+  testRead();
+  testDcreate();
+  testReset(image);
+  testDrives(image);
+
+  return check_report();
+}
@@ -0,0 +1,34 @@
+/**
+ * File: hostloop.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: The loops of the firmware handlers on the commands of the
+ * cartridge-port shim, for the host builds of GEMDRIVE, ACSI and floppies.
+ * Needs the firmware headers, so the Hatari hook does not include it.
+ */
+
+#ifndef HOSTLOOP_H
+#define HOSTLOOP_H
+
+#include <stdint.h>
+
+#include "cartshim.h"
+#include "tprotocol.h"
+
+// gemdrive_loop, acsi_loop or floppy_loop
+typedef void (*HostLoop)(TransmissionProtocol *lastProtocol,
+                         uint16_t *payloadPtr);
+
+/**
+ * @brief Runs the loop of a firmware handler on a command of the shim.
+ *
+ * Hands the command over as chandler_loop does: the payload with the random
+ * token first, and a pointer to the first parameter.
+ *
+ * @param command Command of the shim.
+ * @param loop Loop of the handler.
+ */
+void hostloop_run(const CartShimCommand *command, HostLoop loop);
+
+#endif  // HOSTLOOP_H
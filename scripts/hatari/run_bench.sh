@@ -0,0 +1,137 @@
+#!/bin/bash
+# Runs FSBENCH.TOS headless in Hatari and appends its results to a CSV.
+#
+# Without a cartridge image the benchmark runs on the GEMDOS drive of
+# Hatari itself: the baseline that checks the harness. With -c the image
+# goes in the cartridge port of a Hatari built with hatari-cartshim.patch
+# (see README.md) and the benchmark runs on the GEMDRIVE drive, in a FAT
+# disk image read back with mtools. -a adds a hard disk image on ACSI, in
+# the same disk image.
+
+set -euo pipefail
+
+usage() {
+    echo "Usage: $0 -t TOS [-c CARTRIDGE] [-b FSBENCH.TOS] [-l LABEL]"
+    echo "       [-o OUT.CSV] [-s SUITES] [-d DRIVE] [-a ACSI.IMG]"
+    echo "       [-A DRIVE] [-n VBLS] [-f]"
+    exit 1
+}
+
+script_dir=$(cd "$(dirname "$0")" && pwd)
+repo_dir=$(cd "$script_dir/../.." && pwd)
+
+hatari=${HATARI:-hatari}
+tos=""
+cartridge=""
+bench="$repo_dir/tests/atarist/dist/FSBENCH.TOS"
+label="$(git -C "$repo_dir" describe --always --dirty 2>/dev/null || echo dev)"
+out="$PWD/BENCH.CSV"
+suites="fdp"
+drive="C"
+acsi=""
+acsi_drive="D"
+vbls=30000
+quick="-q"
+
+while getopts "t:c:b:l:o:s:d:a:A:n:f" opt; do
+    case $opt in
+        t) tos=$OPTARG ;;
+        c) cartridge=$OPTARG ;;
+        b) bench=$OPTARG ;;
+        l) label=$OPTARG ;;
+        o) out=$OPTARG ;;
+        s) suites=$OPTARG ;;
+        d) drive=$OPTARG ;;
+        a) acsi=$OPTARG ;;
+        A) acsi_drive=$OPTARG ;;
+        n) vbls=$OPTARG ;;
+        f) quick="" ;;
+        *) usage ;;
+    esac
+done
+
+if [ -z "$tos" ] || [ ! -f "$tos" ] || [ ! -f "$bench" ]; then
+    usage
+fi
+if [ -n "$acsi" ] && { [ -z "$cartridge" ] || [ ! -f "$acsi" ]; }; then
+    usage
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+mkdir -p "$work/boot" "$work/gemdrive"
+
+# The options go in FSBENCH.ARG: auto-started programs get no command
+# line.
+cp "$bench" "$work/boot/FSBENCH.TOS"
+
+hatari_args=(
+    --tos "$tos"
+    --machine st --memsize 4096
+    --fast-forward on --sound off --confirm-quit false
+    --run-vbls "$vbls"
+)
+
+if [ -n "$cartridge" ]; then
+    for tool in mformat mmd mcopy; do
+        command -v "$tool" > /dev/null || { echo "$tool (mtools) not found"; exit 1; }
+    done
+    # The GEMDOS drive and --auto of Hatari use its own cartridge: the
+    # program starts from the AUTO folder of a floppy instead
+    echo "$quick -d $drive -l $label -s $suites" > "$work/boot/FSBENCH.ARG"
+    mformat -C -i "$work/boot.st" -f 720 ::
+    mmd -i "$work/boot.st" ::/AUTO
+    mcopy -i "$work/boot.st" "$bench" ::/AUTO/FSBENCH.PRG
+    mcopy -i "$work/boot.st" "$work/boot/FSBENCH.ARG" ::/FSBENCH.ARG
+    mcopy -i "$work/boot.st" "$work/boot/FSBENCH.ARG" ::/AUTO/FSBENCH.ARG
+    hatari_args+=(--disk-a "$work/boot.st")
+    # Read by cartshim_hook.c of the patched Hatari. The image is created
+    # and formatted at the first reset.
+    export CARTSHIM_ROM4="$cartridge"
+    export CARTSHIM_GEMDRIVE_IMAGE="$work/gemdrive.img"
+    export CARTSHIM_GEMDRIVE_DRIVE="$drive"
+    export CARTSHIM_LATENCY_US="${CARTSHIM_LATENCY_US:-0}"
+    if [ -n "$acsi" ]; then
+        # ACSI reads its image from the same volume: made here instead,
+        # 64 MB as gemdrivehost_init does, with the GEMDRIVE folder
+        mformat -C -i "$work/gemdrive.img" -t 64 -h 64 -s 32 ::
+        mmd -i "$work/gemdrive.img" ::/hd ::/acsi
+        mcopy -i "$work/gemdrive.img" "$acsi" ::/acsi/HD.IMG
+        export CARTSHIM_ACSI_IMAGE="/acsi/HD.IMG"
+        export CARTSHIM_ACSI_DRIVE="$acsi_drive"
+    fi
+    results="$work/gemdrive"
+else
+    drive="H"
+    echo "$quick -d $drive -l $label -s $suites" > "$work/boot/FSBENCH.ARG"
+    hatari_args+=(
+        --harddrive "$work/boot"
+        --auto "H:\\FSBENCH.TOS"
+        --gemdos-drive H
+    )
+    results="$work/boot"
+fi
+
+echo "Running FSBENCH.TOS on drive $drive: (label $label)"
+SDL_VIDEODRIVER=dummy SDL_AUDIODRIVER=dummy \
+    "$hatari" "${hatari_args[@]}" > "$work/hatari.log" 2>&1 || true
+
+if [ -n "$cartridge" ] && [ -f "$work/gemdrive.img" ]; then
+    # GEMDRIVE serves the /hd folder of the image as the root of the drive
+    mcopy -i "$work/gemdrive.img" ::/hd/BENCH.CSV "$results/BENCH.CSV" \
+        2> /dev/null || true
+fi
+
+if [ ! -s "$results/BENCH.CSV" ]; then
+    echo "No results. Hatari log:"
+    tail -n 20 "$work/hatari.log"
+    exit 1
+fi
+
+# One header line per output file
+if [ -s "$out" ]; then
+    tail -n +2 "$results/BENCH.CSV" >> "$out"
+else
+    cp "$results/BENCH.CSV" "$out"
+fi
+echo "$(($(wc -l < "$results/BENCH.CSV") - 1)) results appended to $out"
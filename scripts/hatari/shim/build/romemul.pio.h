@@ -0,0 +1,14 @@
+/**
+ * File: romemul.pio.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the header pioasm writes to rp/build. The
+ * firmware headers include it as ../../build/romemul.pio.h, which resolves
+ * here from shim/sdk/include. The handlers don't touch the PIO.
+ */
+
+#ifndef CARTSHIM_ROMEMUL_PIO_H
+#define CARTSHIM_ROMEMUL_PIO_H
+
+#endif  // CARTSHIM_ROMEMUL_PIO_H
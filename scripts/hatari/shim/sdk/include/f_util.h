@@ -0,0 +1,12 @@
+/**
+ * File: f_util.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the FatFs helpers of the SD card library.
+ */
+
+#ifndef CARTSHIM_F_UTIL_H
+#define CARTSHIM_F_UTIL_H
+
+#endif  // CARTSHIM_F_UTIL_H
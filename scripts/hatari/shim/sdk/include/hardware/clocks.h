@@ -0,0 +1,12 @@
+/**
+ * File: clocks.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK clocks header.
+ */
+
+#ifndef CARTSHIM_CLOCKS_H
+#define CARTSHIM_CLOCKS_H
+
+#endif  // CARTSHIM_CLOCKS_H
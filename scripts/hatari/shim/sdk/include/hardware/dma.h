@@ -0,0 +1,12 @@
+/**
+ * File: dma.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK DMA.
+ */
+
+#ifndef CARTSHIM_DMA_H
+#define CARTSHIM_DMA_H
+
+#endif  // CARTSHIM_DMA_H
@@ -0,0 +1,12 @@
+/**
+ * File: gpio.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK GPIO header.
+ */
+
+#ifndef CARTSHIM_GPIO_H
+#define CARTSHIM_GPIO_H
+
+#endif  // CARTSHIM_GPIO_H
@@ -0,0 +1,12 @@
+/**
+ * File: pio.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK PIO header.
+ */
+
+#ifndef CARTSHIM_PIO_H
+#define CARTSHIM_PIO_H
+
+#endif  // CARTSHIM_PIO_H
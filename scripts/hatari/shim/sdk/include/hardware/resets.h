@@ -0,0 +1,12 @@
+/**
+ * File: resets.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK resets header.
+ */
+
+#ifndef CARTSHIM_RESETS_H
+#define CARTSHIM_RESETS_H
+
+#endif  // CARTSHIM_RESETS_H
@@ -0,0 +1,12 @@
+/**
+ * File: rtc.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK RTC header.
+ */
+
+#ifndef CARTSHIM_RTC_H
+#define CARTSHIM_RTC_H
+
+#endif  // CARTSHIM_RTC_H
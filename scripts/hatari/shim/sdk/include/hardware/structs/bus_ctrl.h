@@ -0,0 +1,12 @@
+/**
+ * File: bus_ctrl.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK bus fabric registers.
+ */
+
+#ifndef CARTSHIM_BUS_CTRL_H
+#define CARTSHIM_BUS_CTRL_H
+
+#endif  // CARTSHIM_BUS_CTRL_H
@@ -0,0 +1,12 @@
+/**
+ * File: xip_ctrl.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK XIP registers.
+ */
+
+#ifndef CARTSHIM_XIP_CTRL_H
+#define CARTSHIM_XIP_CTRL_H
+
+#endif  // CARTSHIM_XIP_CTRL_H
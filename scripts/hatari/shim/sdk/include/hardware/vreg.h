@@ -0,0 +1,22 @@
+/**
+ * File: vreg.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK voltage regulator header.
+ */
+
+#ifndef CARTSHIM_VREG_H
+#define CARTSHIM_VREG_H
+
+// Values of the RP2040 regulator, only the type is used on the host
+enum vreg_voltage {
+  VREG_VOLTAGE_1_10 = 0x0b,
+  VREG_VOLTAGE_1_15 = 0x0c,
+  VREG_VOLTAGE_1_20 = 0x0d,
+  VREG_VOLTAGE_1_30 = 0x0f,
+  VREG_VOLTAGE_DEFAULT = VREG_VOLTAGE_1_10,
+  VREG_VOLTAGE_MAX = VREG_VOLTAGE_1_30,
+};
+
+#endif  // CARTSHIM_VREG_H
@@ -0,0 +1,12 @@
+/**
+ * File: watchdog.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK watchdog. Nothing to reset.
+ */
+
+#ifndef CARTSHIM_WATCHDOG_H
+#define CARTSHIM_WATCHDOG_H
+
+#endif  // CARTSHIM_WATCHDOG_H
@@ -0,0 +1,12 @@
+/**
+ * File: cyw43_arch.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico W wireless header.
+ */
+
+#ifndef CARTSHIM_CYW43_ARCH_H
+#define CARTSHIM_CYW43_ARCH_H
+
+#endif  // CARTSHIM_CYW43_ARCH_H
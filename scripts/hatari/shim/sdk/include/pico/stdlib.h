@@ -0,0 +1,37 @@
+/**
+ * File: stdlib.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK standard library.
+ */
+
+#ifndef CARTSHIM_STDLIB_H
+#define CARTSHIM_STDLIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define __not_in_flash_func(func_name) func_name
+
+typedef struct {
+  volatile uint32_t timerawl;
+} timer_hw_t;
+
+// Read by tprotocol_parse only. The shim runs its own copy of the parser,
+// with the emulator clock (see cartshim.c).
+extern timer_hw_t gemdrivehost_timer_hw;
+#define timer_hw (&gemdrivehost_timer_hw)
+
+// Microseconds since the harness started, as the RP2040 timer. The ACSI
+// and floppy handlers time their delayed writes with it.
+typedef uint64_t absolute_time_t;
+absolute_time_t get_absolute_time(void);
+static inline uint32_t to_ms_since_boot(absolute_time_t t) {
+  return (uint32_t)(t / 1000u);
+}
+
+// From pico/rand.h, which the SDK headers of the firmware pull in
+uint32_t get_rand_32(void);
+
+#endif  // CARTSHIM_STDLIB_H
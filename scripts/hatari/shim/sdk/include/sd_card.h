@@ -0,0 +1,33 @@
+/**
+ * File: sd_card.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the SD card driver of the FatFs library.
+ * The host has no card: the volume is a disk image (see gemdrivehost.c).
+ */
+
+#ifndef CARTSHIM_SD_CARD_H
+#define CARTSHIM_SD_CARD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ff.h"
+
+// Only the members the firmware touches
+typedef struct {
+  unsigned int baud_rate;
+} spi_t;
+
+typedef struct {
+  spi_t *spi;
+} sd_spi_if_t;
+
+typedef struct {
+  sd_spi_if_t *spi_if_p;
+} sd_card_t;
+
+bool sd_init_driver(void);
+
+#endif  // CARTSHIM_SD_CARD_H
@@ -0,0 +1,216 @@
+/**
+ * File: shimtest.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host checks for the cartridge-port shim. Sends commands the
+ * way the send_sync macro of the 68000 drivers does, byte reads in ROM3
+ * and a poll of the random token in ROM4, and checks what the handlers and
+ * the Atari see. Also times the shim itself.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cartshim.h"
+#include "check.h"
+
+#define CPU_HZ 8000000u
+#define LOOPBACK_COMMAND 0x7F01
+#define ECHO_OFFSET CARTSHIM_SHARED_VARIABLES_OFFSET
+
+// Cycles of one tst.b (a0,dn.w) and of the token poll loop, roughly
+#define CYCLES_PER_SAMPLE 14u
+#define CYCLES_PER_POLL 24u
+#define POLL_LIMIT 100000u
+
+static uint64_t cycles = 0;
+static uint16_t lastCommandId = 0;
+static uint32_t handlerCalls = 0;
+
+// Echoes the parameter words to the shared variables
+static void loopbackHandler(const CartShimCommand *command, uint8_t *rom4) {
+  if (command->commandId != LOOPBACK_COMMAND) return;
+  handlerCalls++;
+  lastCommandId = command->commandId;
+  uint16_t *out = (uint16_t *)(rom4 + ECHO_OFFSET);
+  for (uint16_t i = 0; i < (command->payloadSize - 4) / 2; i++) {
+    out[i] = command->params[i];
+  }
+}
+
+static void sendSample(uint16_t word) {
+  // a0 points to the middle of ROM3 and the word is a signed index
+  uint32_t address =
+      CARTSHIM_ROM3_START + 0x8000u + (uint32_t)(int32_t)(int16_t)word;
+  cartshim_read_byte(address, cycles);
+  cycles += CYCLES_PER_SAMPLE;
+}
+
+static uint32_t readLong(uint32_t offset) {
+  uint32_t high = cartshim_read_word(CARTSHIM_ROM4_START + offset, cycles);
+  uint32_t low = cartshim_read_word(CARTSHIM_ROM4_START + offset + 2, cycles);
+  cycles += CYCLES_PER_POLL;
+  return (high << 16) | low;
+}
+
+// send_sync_command_to_sidecart: header, command, size, token low and high
+// word, the parameters, then the checksum. Returns the polls until the
+// token came back, or 0 on a time out.
+static uint32_t sendSync(uint16_t commandId, uint32_t token,
+                         const uint16_t *params, uint16_t paramWords,
+                         bool garble) {
+  uint16_t size = (uint16_t)(4 + paramWords * 2);
+  uint16_t checksum = commandId + size + (uint16_t)token +
+                      (uint16_t)(token >> 16);
+  sendSample(0xABCD);
+  sendSample(commandId);
+  sendSample(size);
+  sendSample((uint16_t)token);
+  sendSample((uint16_t)(token >> 16));
+  for (uint16_t i = 0; i < paramWords; i++) {
+    sendSample(params[i]);
+    checksum += params[i];
+  }
+  sendSample(garble ? (uint16_t)(checksum + 1) : checksum);
+
+  for (uint32_t polls = 1; polls <= POLL_LIMIT; polls++) {
+    if (readLong(CARTSHIM_RANDOM_TOKEN_OFFSET) == token) return polls;
+  }
+  return 0;
+}
+
+static void testRoundTrip(void) {
+  cartshim_init(CPU_HZ);
+  cartshim_add_handler(loopbackHandler);
+  const uint16_t params[4] = {0x1234, 0x5678, 0x9ABC, 0xDEF0};
+
+  uint32_t polls = sendSync(LOOPBACK_COMMAND, 0x11223344u, params, 4, false);
+  CHECK(polls == 1, "token after %u polls, expected 1", polls);
+  CHECK(handlerCalls == 1 && lastCommandId == LOOPBACK_COMMAND,
+        "handler calls %u", handlerCalls);
+  // The Atari reads D3 and D4 back as they were sent
+  CHECK(readLong(ECHO_OFFSET) == 0x12345678u, "echo D3 %08x",
+        readLong(ECHO_OFFSET));
+  CHECK(readLong(ECHO_OFFSET + 4) == 0x9ABCDEF0u, "echo D4 %08x",
+        readLong(ECHO_OFFSET + 4));
+  // The seed that follows the token is the command count
+  CHECK(readLong(CARTSHIM_RANDOM_TOKEN_OFFSET + 4) == 0x00010000u,
+        "seed %08x", readLong(CARTSHIM_RANDOM_TOKEN_OFFSET + 4));
+
+  polls = sendSync(0x0301, 0xCAFEF00Du, NULL, 0, false);
+  CHECK(polls == 1, "token of a command nobody handles");
+  CHECK(handlerCalls == 1, "the loopback handler took command 0x0301");
+  CHECK(cartshim_stats()->commands == 2, "commands %u",
+        cartshim_stats()->commands);
+}
+
+static void testChecksumError(void) {
+  cartshim_init(CPU_HZ);
+  cartshim_add_handler(loopbackHandler);
+  handlerCalls = 0;
+  const uint16_t params[2] = {1, 2};
+
+  uint32_t polls = sendSync(LOOPBACK_COMMAND, 0x55AA55AAu, params, 2, true);
+  CHECK(polls == 0, "a garbled command was acknowledged");
+  CHECK(handlerCalls == 0, "a garbled command reached the handler");
+  CHECK(cartshim_stats()->checksumErrors == 1, "checksum errors %u",
+        cartshim_stats()->checksumErrors);
+
+  // The retry of send_sync goes through
+  polls = sendSync(LOOPBACK_COMMAND, 0x55AA55ABu, params, 2, false);
+  CHECK(polls > 0 && handlerCalls == 1, "the retry was not acknowledged");
+}
+
+static void testLatency(void) {
+  const uint32_t latencyUs = 200;
+  cartshim_init(CPU_HZ);
+  cartshim_add_handler(loopbackHandler);
+  cartshim_set_latency_us(latencyUs);
+
+  uint64_t start = cycles;
+  uint32_t polls = sendSync(LOOPBACK_COMMAND, 0x0BADBEEFu, NULL, 0, false);
+  uint64_t elapsedUs = (cycles - start) * 1000000ull / CPU_HZ;
+  CHECK(polls > 1, "answered before the latency");
+  CHECK(elapsedUs >= latencyUs && elapsedUs < latencyUs + 20,
+        "round trip %llu us with %u us of latency",
+        (unsigned long long)elapsedUs, latencyUs);
+}
+
+static void testRestart(void) {
+  cartshim_init(CPU_HZ);
+  cartshim_add_handler(loopbackHandler);
+  handlerCalls = 0;
+
+  // A command cut after the size, then the bus is quiet for the parser
+  // restart window: the next header starts over
+  sendSample(0xABCD);
+  sendSample(LOOPBACK_COMMAND);
+  sendSample(8);
+  cycles += CPU_HZ / 50;  // 20 ms
+  uint32_t polls = sendSync(LOOPBACK_COMMAND, 0x01020304u, NULL, 0, false);
+  CHECK(polls == 1 && handlerCalls == 1, "no resync after a cut command");
+}
+
+static void testRom4Image(void) {
+  const char *path = "shimtest.img";
+  FILE *fp = fopen(path, "wb");
+  if (fp == NULL) {
+    CHECK(false, "can't write %s", path);
+    return;
+  }
+  const uint8_t image[4] = {0xAB, 0xCD, 0xEF, 0x42};  // Cartridge magic
+  fwrite(image, 1, sizeof(image), fp);
+  fclose(fp);
+
+  cartshim_init(CPU_HZ);
+  CHECK(cartshim_load_rom4(path), "can't load %s", path);
+  CHECK(readLong(0) == 0xABCDEF42u, "magic %08x", readLong(0));
+  CHECK(cartshim_read_byte(CARTSHIM_ROM4_START + 1, cycles) == 0xCD,
+        "odd byte of ROM4");
+  remove(path);
+}
+
+static void benchmark(void) {
+  enum { COMMANDS = 200000, PARAM_WORDS = 8 };
+  uint16_t params[PARAM_WORDS] = {0};
+  cartshim_init(CPU_HZ);
+  cartshim_add_handler(loopbackHandler);
+
+  struct timespec t0, t1;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  uint32_t lost = 0;
+  for (uint32_t i = 0; i < COMMANDS; i++) {
+    params[0] = (uint16_t)i;
+    if (sendSync(LOOPBACK_COMMAND, 0x10000u + i, params, PARAM_WORDS,
+                 false) == 0) {
+      lost++;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+  CHECK(lost == 0, "%u commands lost in the benchmark", lost);
+  printf("%d commands with %d bytes of parameters: %.0f ns per command\n",
+         COMMANDS, PARAM_WORDS * 2, ns / COMMANDS);
+}
+
+int main(int argc, char *argv[]) {
+  bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+  if (argc > 1 && !bench) {
+    fprintf(stderr, "usage: %s [--bench]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  testRoundTrip();
+  testChecksumError();
+  testLatency();
+  testRestart();
+  testRom4Image();
+  if (bench) benchmark();
+
+  return check_report();
+}
@@ -0,0 +1,611 @@
+/**
+ * File: rom3replay.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host replay and fuzz harness for ROM3 captures. Feeds the
+ * samples recorded by the firmware (ROM3_CAPTURE=true) through the same
+ * tprotocol_parse used on the RP2040 and reports the decoded commands,
+ * timing, and how the parser copes with dropped, duplicated, garbled or
+ * delayed samples. Built with the host GEMDRIVE (ROM3REPLAY_GEMDRIVE), it
+ * also runs the GEMDRIVE commands of the capture through the firmware
+ * handler, on a disk image.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Host shims for the firmware headers. The include guards keep the RP2040
+// constants.h and debug.h (and the Pico SDK behind them) out of the build.
+#define CONSTANTS_H
+#define DEBUG_H
+#define DPRINTF(fmt, ...)
+#define __not_in_flash_func(func) func
+
+static struct {
+  volatile uint32_t timerawl;
+} hostTimer;
+#define timer_hw (&hostTimer)
+
+#include "../../rp/src/include/tprotocol.h"
+
+#ifdef ROM3REPLAY_GEMDRIVE
+#include "cartshim.h"
+#include "gemdrivehost.h"
+
+// The replay clock as the cycle counter of an 8 MHz 68000
+#define REPLAY_CPU_HZ 8000000u
+
+// Mirrors rp/src/include/gemdrive.h
+#define APP_GEMDRVEMUL 0x04
+#endif
+
+// Same XOR applied by chandler_consume_rom3_sample
+#define ROM3_ADDRESS_HIGH_BIT 0x8000
+
+// Mirrors rp/src/include/commemul.h
+#define CAPTURE_MAGIC 0x50433352u  // "R3CP"
+#define CAPTURE_VERSION 2u
+#define CAPTURE_DELTA_MAX 0xFFFEu
+#define CAPTURE_DELTA_GAP 0xFFFFu
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t pioDivider256;
+  uint32_t sysClockKhz;
+} CaptureHeader;
+
+typedef struct {
+  uint16_t sample;
+  uint16_t deltaUs;
+} CaptureRecord;
+
+typedef struct {
+  CaptureRecord *records;
+  size_t count;
+} Capture;
+
+// A command accepted by the parser
+typedef struct {
+  uint32_t timeUs;
+  uint16_t commandId;
+  uint16_t payloadSize;
+  uint16_t checksum;
+  uint32_t params[2];  // First two 32-bit params after the random token
+  uint64_t hash;       // FNV-1a of id, size and payload
+} ReplayCommand;
+
+typedef struct {
+  ReplayCommand *commands;
+  size_t count;
+  size_t capacity;
+  size_t checksumErrors;
+  size_t gaps;
+  size_t lostSamples;
+  double parseNs;
+} ReplayResult;
+
+enum {
+  MUTATE_DROP = 0,
+  MUTATE_DUPLICATE,
+  MUTATE_GARBLE,
+  MUTATE_DELAY,
+  MUTATE_KINDS
+};
+
+static const char *mutationNames[MUTATE_KINDS] = {"drop", "duplicate",
+                                                  "garble", "delay"};
+
+static ReplayResult *currentResult = NULL;
+
+static uint64_t hashCommand(const TransmissionProtocol *protocol) {
+  uint64_t hash = 1469598103934665603ull;
+  const uint8_t *bytes = (const uint8_t *)protocol->payload;
+  uint16_t size = tprotocol_clamp_payload_size(protocol->payload_size);
+
+  hash = (hash ^ protocol->command_id) * 1099511628211ull;
+  hash = (hash ^ protocol->payload_size) * 1099511628211ull;
+  for (uint16_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+static void pushCommand(ReplayResult *result, const ReplayCommand *command) {
+  if (result->count == result->capacity) {
+    size_t capacity = result->capacity ? result->capacity * 2 : 1024;
+    ReplayCommand *grown =
+        realloc(result->commands, capacity * sizeof(*grown));
+    if (grown == NULL) {
+      fprintf(stderr, "error: out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    result->commands = grown;
+    result->capacity = capacity;
+  }
+  result->commands[result->count++] = *command;
+}
+
+static void onCommand(const TransmissionProtocol *protocol) {
+  if (protocol->payload_size > MAX_PROTOCOL_PAYLOAD_SIZE) {
+    // The parser must never accept what it could not have stored
+    fprintf(stderr, "BUG: accepted payload_size %u > %u\n",
+            protocol->payload_size, (unsigned)(MAX_PROTOCOL_PAYLOAD_SIZE));
+    abort();
+  }
+
+  ReplayCommand command = {
+      .timeUs = hostTimer.timerawl,
+      .commandId = protocol->command_id,
+      .payloadSize = protocol->payload_size,
+      .checksum = protocol->final_checksum,
+      .hash = hashCommand(protocol),
+  };
+  // Skip the random token, as chandler_loop does
+  const uint16_t *params = protocol->payload + 2;
+  for (int i = 0; i < 2; i++) {
+    if (protocol->payload_size >= 4 + (i + 1) * 4) {
+      command.params[i] = TPROTO_GET_PAYLOAD_PARAM32(params + i * 2);
+    }
+  }
+  pushCommand(currentResult, &command);
+}
+
+static void onChecksumError(const TransmissionProtocol *protocol) {
+  (void)protocol;
+  currentResult->checksumErrors++;
+}
+
+static void resetParser(void) {
+  last_header_found = 0;
+  new_header_found = 0;
+  nextTPstep = HEADER_DETECTION;
+  memset(&transmission, 0, sizeof(transmission));
+  // The firmware clock is far from zero when the first sample arrives
+  hostTimer.timerawl = PROTOCOL_READ_RESTART_MICROSECONDS * 100u;
+}
+
+static double nowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void replay(const Capture *capture, ReplayResult *result) {
+  memset(result, 0, sizeof(*result));
+  currentResult = result;
+  resetParser();
+
+  double start = nowNs();
+  for (size_t i = 0; i < capture->count; i++) {
+    const CaptureRecord *rec = &capture->records[i];
+    if (rec->deltaUs == CAPTURE_DELTA_GAP) {
+      result->gaps++;
+      result->lostSamples += rec->sample;
+      continue;
+    }
+    hostTimer.timerawl += rec->deltaUs;
+    tprotocol_parse((uint16_t)(rec->sample ^ ROM3_ADDRESS_HIGH_BIT),
+                    onCommand, onChecksumError);
+  }
+  result->parseNs = nowNs() - start;
+}
+
+static void freeResult(ReplayResult *result) {
+  free(result->commands);
+  memset(result, 0, sizeof(*result));
+}
+
+static bool loadCapture(const char *path, Capture *capture,
+                        CaptureHeader *header) {
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "error: %s: %s\n", path, strerror(errno));
+    return false;
+  }
+  if (fread(header, sizeof(*header), 1, f) != 1 ||
+      header->magic != CAPTURE_MAGIC) {
+    fprintf(stderr, "error: %s: not a ROM3 capture\n", path);
+    fclose(f);
+    return false;
+  }
+  if (header->version != CAPTURE_VERSION ||
+      header->recordSize != sizeof(CaptureRecord)) {
+    fprintf(stderr, "error: %s: unsupported version %u / record size %u\n",
+            path, header->version, header->recordSize);
+    fclose(f);
+    return false;
+  }
+
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, sizeof(*header), SEEK_SET);
+  capture->count = (size_t)(size - (long)sizeof(*header)) /
+                   sizeof(CaptureRecord);
+  capture->records = malloc((capture->count + 1) * sizeof(CaptureRecord));
+  if (capture->records == NULL ||
+      fread(capture->records, sizeof(CaptureRecord), capture->count, f) !=
+          capture->count) {
+    fprintf(stderr, "error: %s: short read\n", path);
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+  return true;
+}
+
+static bool saveCapture(const char *path, const Capture *capture) {
+  CaptureHeader header = {
+      .magic = CAPTURE_MAGIC,
+      .version = CAPTURE_VERSION,
+      .recordSize = sizeof(CaptureRecord),
+  };
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) {
+    fprintf(stderr, "error: %s: %s\n", path, strerror(errno));
+    return false;
+  }
+  bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+            fwrite(capture->records, sizeof(CaptureRecord), capture->count,
+                   f) == capture->count;
+  ok = (fclose(f) == 0) && ok;
+  if (!ok) fprintf(stderr, "error: %s: write failed\n", path);
+  return ok;
+}
+
+// Emits the words the Atari side puts on the bus for one command: header,
+// command, size, payload (random token first) and checksum.
+static void synthCommand(Capture *capture, uint16_t commandId,
+                         uint16_t payloadSize, uint32_t *rng,
+                         uint16_t firstDeltaUs) {
+  uint16_t words[3 + MAX_PROTOCOL_PAYLOAD_SIZE / 2 + 1];
+  size_t n = 0;
+  uint16_t checksum = commandId + payloadSize;
+
+  words[n++] = PROTOCOL_HEADER;
+  words[n++] = commandId;
+  words[n++] = payloadSize;
+  for (uint16_t i = 0; i < payloadSize / 2; i++) {
+    *rng = *rng * 1664525u + 1013904223u;
+    uint16_t word = (uint16_t)(*rng >> 16);
+    words[n++] = word;
+    checksum += word;
+  }
+  words[n++] = checksum;
+
+  for (size_t i = 0; i < n; i++) {
+    CaptureRecord *rec = &capture->records[capture->count++];
+    rec->sample = (uint16_t)(words[i] ^ ROM3_ADDRESS_HIGH_BIT);
+    rec->deltaUs = (i == 0) ? firstDeltaUs : 1;
+  }
+}
+
+static bool makeSynthetic(const char *path, unsigned commands,
+                          uint32_t seed) {
+  // ACSI/GEMDRIVE shaped traffic: small control commands and sector reads
+  static const uint16_t ids[] = {0x0501, 0x0502, 0x0503, 0x044E, 0x044F,
+                                 0x0201, 0x0301};
+  static const uint16_t sizes[] = {8, 12, 524, 16, 8, 12, 4};
+  Capture capture = {0};
+  capture.records = malloc((size_t)commands *
+                           (4 + MAX_PROTOCOL_PAYLOAD_SIZE / 2) *
+                           sizeof(CaptureRecord));
+  if (capture.records == NULL) return false;
+
+  uint32_t rng = seed;
+  for (unsigned i = 0; i < commands; i++) {
+    rng = rng * 1664525u + 1013904223u;
+    size_t kind = (rng >> 24) % (sizeof(ids) / sizeof(ids[0]));
+    // Commands are separated by more than the parser restart window
+    synthCommand(&capture, ids[kind], sizes[kind], &rng,
+                 (uint16_t)(PROTOCOL_READ_RESTART_MICROSECONDS + 500u));
+  }
+  bool ok = saveCapture(path, &capture);
+  if (ok) {
+    printf("%u commands, %zu samples written to %s\n", commands,
+           capture.count, path);
+  }
+  free(capture.records);
+  return ok;
+}
+
+#ifdef ROM3REPLAY_GEMDRIVE
+// Sends the samples to the shim as the 68000 reads in ROM3, so the commands
+// reach the GEMDRIVE handler of the firmware as on the device. The shim
+// parses them again, and must find the commands of the replay.
+static int runHandlers(const Capture *capture, const ReplayResult *reference,
+                       const char *imagePath, char drive) {
+  cartshim_init(REPLAY_CPU_HZ);
+  if (!gemdrivehost_init(imagePath, drive)) {
+    fprintf(stderr, "error: %s: can't open the GEMDRIVE image\n", imagePath);
+    return EXIT_FAILURE;
+  }
+
+  uint64_t timeUs = PROTOCOL_READ_RESTART_MICROSECONDS * 100u;
+  double start = nowNs();
+  for (size_t i = 0; i < capture->count; i++) {
+    const CaptureRecord *rec = &capture->records[i];
+    if (rec->deltaUs == CAPTURE_DELTA_GAP) continue;
+    timeUs += rec->deltaUs;
+    cartshim_read_word(CARTSHIM_ROM3_START + rec->sample,
+                       timeUs * (REPLAY_CPU_HZ / 1000000u));
+  }
+  // A last read in ROM4 runs the command of the last samples
+  cartshim_read_word(CARTSHIM_ROM4_START,
+                     (timeUs + 1) * (REPLAY_CPU_HZ / 1000000u));
+  double elapsedNs = nowNs() - start;
+
+  size_t gemdrive = 0;
+  for (size_t i = 0; i < reference->count; i++) {
+    if ((reference->commands[i].commandId >> 8) == APP_GEMDRVEMUL) gemdrive++;
+  }
+  const CartShimStats *stats = cartshim_stats();
+  printf("handlers: %zu GEMDRIVE commands of %" PRIu32 " run on %s, "
+         "%.2f ms total\n",
+         gemdrive, stats->commands, imagePath, elapsedNs / 1e6);
+  if (stats->commands != reference->count) {
+    printf("DIVERGENCE: the shim ran %" PRIu32 " commands, the replay "
+           "decoded %zu\n",
+           stats->commands, reference->count);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+#endif
+
+static uint32_t nextRandom(uint64_t *state) {
+  // xorshift64*
+  *state ^= *state >> 12;
+  *state ^= *state << 25;
+  *state ^= *state >> 27;
+  return (uint32_t)((*state * 2685821657736338717ull) >> 32);
+}
+
+// Applies one mutation in place. The buffer has room for one extra record.
+static int mutate(Capture *capture, uint64_t *rng) {
+  if (capture->count == 0) return MUTATE_DROP;
+  int kind = (int)(nextRandom(rng) % MUTATE_KINDS);
+  size_t at = nextRandom(rng) % capture->count;
+  CaptureRecord *recs = capture->records;
+
+  switch (kind) {
+    case MUTATE_DROP:
+      memmove(&recs[at], &recs[at + 1],
+              (capture->count - at - 1) * sizeof(*recs));
+      capture->count--;
+      break;
+    case MUTATE_DUPLICATE:
+      memmove(&recs[at + 1], &recs[at], (capture->count - at) * sizeof(*recs));
+      recs[at + 1].deltaUs = 0;
+      capture->count++;
+      break;
+    case MUTATE_GARBLE:
+      recs[at].sample ^= (uint16_t)(1u << (nextRandom(rng) % 16));
+      break;
+    case MUTATE_DELAY:
+      // Pushes this sample past the 10 ms restart window
+      recs[at].deltaUs = CAPTURE_DELTA_MAX;
+      break;
+  }
+  return kind;
+}
+
+static int compareHash(const void *a, const void *b) {
+  uint64_t ha = *(const uint64_t *)a;
+  uint64_t hb = *(const uint64_t *)b;
+  return (ha > hb) - (ha < hb);
+}
+
+static bool containsHash(const uint64_t *sorted, size_t n, uint64_t hash) {
+  return bsearch(&hash, sorted, n, sizeof(*sorted), compareHash) != NULL;
+}
+
+static void printCommands(const ReplayResult *result) {
+  uint32_t previous = 0;
+  for (size_t i = 0; i < result->count; i++) {
+    const ReplayCommand *c = &result->commands[i];
+    int32_t gapUs = (i == 0) ? 0 : (int32_t)(c->timeUs - previous);
+    printf("%6zu %12.3f ms %+10" PRId32 " us  cmd=0x%04X size=%4u "
+           "chk=0x%04X p0=0x%08" PRIX32 " p1=0x%08" PRIX32 "\n",
+           i, c->timeUs / 1000.0, gapUs, c->commandId, c->payloadSize, c->checksum, c->params[0],
+           c->params[1]);
+    previous = c->timeUs;
+  }
+}
+
+static void printSummary(const char *label, const Capture *capture,
+                         const ReplayResult *result) {
+  printf("%s: %zu samples, %zu commands, %zu checksum errors, %zu gaps "
+         "(%zu samples lost)\n",
+         label, capture->count, result->count, result->checksumErrors,
+         result->gaps, result->lostSamples);
+  if (capture->count > 0) {
+    printf("  host parse time: %.1f ns/sample, %.2f ms total\n",
+           result->parseNs / (double)capture->count, result->parseNs / 1e6);
+  }
+}
+
+static int runFuzz(const Capture *baseline, const ReplayResult *reference,
+                   unsigned iterations, unsigned mutations, uint64_t seed) {
+  uint64_t *hashes = malloc((reference->count + 1) * sizeof(*hashes));
+  for (size_t i = 0; i < reference->count; i++) {
+    hashes[i] = reference->commands[i].hash;
+  }
+  qsort(hashes, reference->count, sizeof(*hashes), compareHash);
+
+  Capture work = {0};
+  work.records =
+      malloc((baseline->count + mutations + 1) * sizeof(CaptureRecord));
+  unsigned kindCount[MUTATE_KINDS] = {0};
+  size_t totalMissed = 0;
+  size_t totalSpurious = 0;
+  size_t totalChecksum = 0;
+  unsigned divergentRuns = 0;
+
+  for (unsigned it = 0; it < iterations; it++) {
+    uint64_t runSeed = seed + it;
+    uint64_t rng = runSeed ? runSeed : 1;
+    memcpy(work.records, baseline->records,
+           baseline->count * sizeof(CaptureRecord));
+    work.count = baseline->count;
+    for (unsigned m = 0; m < mutations; m++) {
+      kindCount[mutate(&work, &rng)]++;
+    }
+
+    ReplayResult result;
+    replay(&work, &result);
+
+    // A spurious command is one the parser accepted although the Atari
+    // never sent it: corrupted data that still passed the checksum.
+    size_t spurious = 0;
+    for (size_t i = 0; i < result.count; i++) {
+      if (!containsHash(hashes, reference->count, result.commands[i].hash)) {
+        spurious++;
+      }
+    }
+    size_t matched = result.count - spurious;
+    size_t missed =
+        (reference->count > matched) ? reference->count - matched : 0;
+    totalMissed += missed;
+    totalSpurious += spurious;
+    totalChecksum += result.checksumErrors;
+    if (spurious > 0) {
+      divergentRuns++;
+      printf("  seed %" PRIu64 ": %zu spurious command(s) accepted\n",
+             runSeed, spurious);
+    }
+    freeResult(&result);
+  }
+
+  printf("fuzz: %u runs x %u mutation(s) (", iterations, mutations);
+  for (int k = 0; k < MUTATE_KINDS; k++) {
+    printf("%s%s=%u", k ? ", " : "", mutationNames[k], kindCount[k]);
+  }
+  printf(")\n");
+  printf("  commands lost: %zu (%.2f per run)\n", totalMissed,
+         iterations ? (double)totalMissed / iterations : 0.0);
+  printf("  checksum errors: %zu\n", totalChecksum);
+  printf("  spurious commands: %zu in %u run(s)\n", totalSpurious,
+         divergentRuns);
+
+  free(work.records);
+  free(hashes);
+  return (totalSpurious > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [options] CAPTURE\n"
+          "  --list            print every decoded command\n"
+          "  --fuzz N          replay N mutated copies of the capture\n"
+          "  --mutations K     mutations per fuzz run (default 1)\n"
+          "  --seed S          first fuzz seed (default 1)\n"
+          "  --synthetic N     write a capture with N synthetic commands\n"
+          "                    to CAPTURE instead of reading it\n"
+#ifdef ROM3REPLAY_GEMDRIVE
+          "  --image IMAGE     run the GEMDRIVE commands on this disk\n"
+          "                    image, created if missing\n"
+          "  --drive D         GEMDRIVE drive letter (default C)\n"
+#endif
+          ,
+          argv0);
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  bool list = false;
+  unsigned fuzz = 0;
+  unsigned mutations = 1;
+  unsigned synthetic = 0;
+  uint64_t seed = 1;
+#ifdef ROM3REPLAY_GEMDRIVE
+  const char *imagePath = NULL;
+  char drive = 'C';
+#endif
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--list") == 0) {
+      list = true;
+    } else if (strcmp(argv[i], "--fuzz") == 0 && i + 1 < argc) {
+      fuzz = (unsigned)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--mutations") == 0 && i + 1 < argc) {
+      mutations = (unsigned)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--synthetic") == 0 && i + 1 < argc) {
+      synthetic = (unsigned)strtoul(argv[++i], NULL, 0);
+#ifdef ROM3REPLAY_GEMDRIVE
+    } else if (strcmp(argv[i], "--image") == 0 && i + 1 < argc) {
+      imagePath = argv[++i];
+    } else if (strcmp(argv[i], "--drive") == 0 && i + 1 < argc) {
+      drive = argv[++i][0];
+#endif
+    } else if (argv[i][0] != '-' && path == NULL) {
+      path = argv[i];
+    } else {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (path == NULL) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  if (synthetic > 0) {
+    return makeSynthetic(path, synthetic, (uint32_t)seed) ? EXIT_SUCCESS
+                                                          : EXIT_FAILURE;
+  }
+
+  Capture capture = {0};
+  CaptureHeader header;
+  if (!loadCapture(path, &capture, &header)) {
+    return EXIT_FAILURE;
+  }
+  if (header.sysClockKhz != 0) {
+    printf("capture: %u kHz system clock, PIO divider %.3f\n",
+           header.sysClockKhz, header.pioDivider256 / 256.0);
+  }
+
+  ReplayResult reference;
+  replay(&capture, &reference);
+  if (list) printCommands(&reference);
+  printSummary("replay", &capture, &reference);
+
+  // Determinism check: the parser keeps static state between runs
+  ReplayResult again;
+  replay(&capture, &again);
+  int status = EXIT_SUCCESS;
+  if (again.count != reference.count ||
+      (reference.count > 0 &&
+       memcmp(again.commands, reference.commands,
+              reference.count * sizeof(ReplayCommand)) != 0)) {
+    printf("DIVERGENCE: a second replay decoded a different stream\n");
+    status = EXIT_FAILURE;
+  }
+  freeResult(&again);
+
+#ifdef ROM3REPLAY_GEMDRIVE
+  if (imagePath != NULL &&
+      runHandlers(&capture, &reference, imagePath, drive) != EXIT_SUCCESS) {
+    status = EXIT_FAILURE;
+  }
+#endif
+
+  if (fuzz > 0 && runFuzz(&capture, &reference, fuzz, mutations, seed) !=
+                      EXIT_SUCCESS) {
+    status = EXIT_FAILURE;
+  }
+
+  freeResult(&reference);
+  free(capture.records);
+  return status;
+}
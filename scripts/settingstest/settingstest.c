@@ -0,0 +1,447 @@
+/**
+ * File: settingstest.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host unit tests for the settings manager. Runs
+ * rp/src/settings/settings.c against a RAM flash image that behaves as the
+ * RP2040 flash: sectors erase to 0xFF and programming only clears bits.
+ * Covers load, lookups, typed getters, puts, save round-trips and the
+ * overflow region.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "settings.h"
+
+// The settings and overflow sectors sit between guard sectors that must not
+// change
+#define FLASH_IMAGE_SIZE (5u * FLASH_SECTOR_SIZE)
+#define SETTINGS_OFFSET FLASH_SECTOR_SIZE
+#define OVERFLOW_OFFSET (3u * FLASH_SECTOR_SIZE)
+#define GUARD_BYTE 0x5A
+
+// More keys than one sector holds, for the overflow
+#define MANY_COUNT 40u
+
+#define TEST_MAGIC 0x1234
+#define TEST_VERSION 1
+
+uint8_t settingstest_flash[FLASH_IMAGE_SIZE];
+
+static unsigned erases = 0;
+static unsigned programs = 0;
+static unsigned flashErrors = 0;
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+  if ((flash_offs % FLASH_SECTOR_SIZE) != 0 ||
+      (count % FLASH_SECTOR_SIZE) != 0 ||
+      flash_offs + count > FLASH_IMAGE_SIZE) {
+    printf("FLASH erase out of bounds or unaligned: 0x%x + %zu\n",
+           flash_offs, count);
+    flashErrors++;
+    return;
+  }
+  memset(&settingstest_flash[flash_offs], 0xFF, count);
+  erases++;
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data,
+                         size_t count) {
+  if ((flash_offs % FLASH_PAGE_SIZE) != 0 || (count % FLASH_PAGE_SIZE) != 0 ||
+      flash_offs + count > FLASH_IMAGE_SIZE) {
+    printf("FLASH program out of bounds or unaligned: 0x%x + %zu\n",
+           flash_offs, count);
+    flashErrors++;
+    return;
+  }
+  for (size_t i = 0; i < count; i++) {
+    uint8_t *cell = &settingstest_flash[flash_offs + i];
+    if ((data[i] & ~*cell) != 0) {
+      printf("FLASH program sets bits without an erase at 0x%zx\n",
+             flash_offs + i);
+      flashErrors++;
+      return;
+    }
+    *cell &= data[i];
+  }
+  programs++;
+}
+
+// Unsorted on purpose, as the tables of the applications are
+static const SettingsConfigEntry defaults[] = {
+    {"WIFI_SSID", SETTINGS_TYPE_STRING, ""},
+    {"DRIVES_ACSI_ID", SETTINGS_TYPE_INT, "7"},
+    {"BOOT_FEATURE", SETTINGS_TYPE_STRING, "DRIVES"},
+    {"ACSI_ENABLED", SETTINGS_TYPE_BOOL, "false"},
+    {"RTC_ENABLED", SETTINGS_TYPE_BOOL, "true"},
+    {"GEMDRIVE_DRIVE", SETTINGS_TYPE_STRING, "C"},
+    {"UTC_OFFSET", SETTINGS_TYPE_INT, "-5"},
+    {"A", SETTINGS_TYPE_STRING, "first"},
+    {"ZZ_LAST", SETTINGS_TYPE_STRING, "last"},
+    {"YES_FLAG", SETTINGS_TYPE_BOOL, "Yes"},
+    {"ONE_FLAG", SETTINGS_TYPE_BOOL, "1"},
+    {"NOT_A_NUMBER", SETTINGS_TYPE_INT, "12x"},
+    {"ACSI_IMAGE", SETTINGS_TYPE_STRING, "/hd/boot.img"},
+    {"ACSI_IMAGE_2", SETTINGS_TYPE_STRING, ""},
+    {"ACSI_IMAGE_3", SETTINGS_TYPE_STRING, ""},
+    {"BOOT_CACHE", SETTINGS_TYPE_BOOL, "true"},
+};
+
+#define DEFAULTS_COUNT ((uint16_t)(sizeof(defaults) / sizeof(defaults[0])))
+
+// KEY_00 to KEY_39, "default" each
+static SettingsConfigEntry manyDefaults[MANY_COUNT];
+
+static void blankFlash(void) {
+  memset(settingstest_flash, GUARD_BYTE, sizeof(settingstest_flash));
+  memset(&settingstest_flash[SETTINGS_OFFSET], 0xFF, FLASH_SECTOR_SIZE);
+  memset(&settingstest_flash[OVERFLOW_OFFSET], 0xFF, FLASH_SECTOR_SIZE);
+}
+
+static bool guardsIntact(void) {
+  for (uint32_t i = 0; i < FLASH_IMAGE_SIZE; i++) {
+    bool inSettings =
+        (i >= SETTINGS_OFFSET && i < SETTINGS_OFFSET + FLASH_SECTOR_SIZE) ||
+        (i >= OVERFLOW_OFFSET && i < OVERFLOW_OFFSET + FLASH_SECTOR_SIZE);
+    if (!inSettings && settingstest_flash[i] != GUARD_BYTE) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static int openContext(SettingsContext *ctx, uint16_t version) {
+  memset(ctx, 0, sizeof(*ctx));
+  return settings_init(ctx, defaults, DEFAULTS_COUNT, SETTINGS_OFFSET,
+                       FLASH_SECTOR_SIZE, TEST_MAGIC, version);
+}
+
+static int openMany(SettingsContext *ctx, bool withOverflow) {
+  memset(ctx, 0, sizeof(*ctx));
+  if (withOverflow) {
+    settings_set_overflow(ctx, OVERFLOW_OFFSET, FLASH_SECTOR_SIZE);
+  }
+  return settings_init(ctx, manyDefaults, MANY_COUNT, SETTINGS_OFFSET,
+                       FLASH_SECTOR_SIZE, TEST_MAGIC, TEST_VERSION);
+}
+
+static void putMany(SettingsContext *ctx, const char *prefix) {
+  for (unsigned i = 0; i < MANY_COUNT; i++) {
+    char value[SETTINGS_MAX_VALUE_LENGTH];
+    snprintf(value, sizeof(value), "%s%02u", prefix, i);
+    settings_put_string(ctx, manyDefaults[i].key, value);
+  }
+}
+
+// Number of entries holding prefix and their index, the others default
+static unsigned countMany(SettingsContext *ctx, const char *prefix) {
+  unsigned matches = 0;
+  for (unsigned i = 0; i < MANY_COUNT; i++) {
+    char value[SETTINGS_MAX_VALUE_LENGTH];
+    snprintf(value, sizeof(value), "%s%02u", prefix, i);
+    SettingsConfigEntry *entry = settings_find_entry(ctx, manyDefaults[i].key);
+    if (entry != NULL && strcmp(entry->value, value) == 0) {
+      matches++;
+    } else if (entry == NULL || strcmp(entry->value, "default") != 0) {
+      return 0;
+    }
+  }
+  return matches;
+}
+
+static const char *valueOf(SettingsContext *ctx, const char *key) {
+  SettingsConfigEntry *entry = settings_find_entry(ctx, key);
+  return entry != NULL ? entry->value : NULL;
+}
+
+static void testDefaultsOnBlankFlash(void) {
+  SettingsContext ctx;
+  blankFlash();
+  int loaded = openContext(&ctx, TEST_VERSION);
+  CHECK(loaded < 0, "blank flash should report no stored config (%d)",
+        loaded);
+  CHECK(ctx.configData.count == DEFAULTS_COUNT + 1u,
+        "%zu entries, expected %u", ctx.configData.count,
+        DEFAULTS_COUNT + 1u);
+
+  for (uint16_t i = 0; i < DEFAULTS_COUNT; i++) {
+    SettingsConfigEntry *entry = settings_find_entry(&ctx, defaults[i].key);
+    CHECK(entry != NULL && strcmp(entry->key, defaults[i].key) == 0 &&
+              strcmp(entry->value, defaults[i].value) == 0,
+          "lookup of %s", defaults[i].key);
+  }
+  CHECK(settings_find_entry(&ctx, SETTINGS_MAGICVERSION_KEY) != NULL,
+        "magic entry not found");
+  CHECK(settings_find_entry(&ctx, "MISSING") == NULL, "MISSING found");
+  CHECK(settings_find_entry(&ctx, "acsi_id") == NULL, "lowercase key found");
+  CHECK(settings_find_entry(&ctx, "") == NULL, "empty key found");
+  CHECK(settings_find_entry(&ctx, "0") == NULL, "key before all found");
+  CHECK(settings_find_entry(&ctx, "ZZZZ") == NULL, "key after all found");
+  settings_deinit(&ctx);
+}
+
+static void testTypedGetters(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+
+  CHECK(settings_get_bool(&ctx, "RTC_ENABLED", false), "RTC_ENABLED");
+  CHECK(!settings_get_bool(&ctx, "ACSI_ENABLED", true), "ACSI_ENABLED");
+  CHECK(settings_get_bool(&ctx, "YES_FLAG", false), "YES_FLAG");
+  CHECK(settings_get_bool(&ctx, "ONE_FLAG", false), "ONE_FLAG");
+  CHECK(settings_get_bool(&ctx, "MISSING", true), "missing bool default");
+  CHECK(!settings_get_bool(&ctx, "MISSING", false), "missing bool default");
+
+  CHECK(settings_get_int(&ctx, "DRIVES_ACSI_ID", -1) == 7, "DRIVES_ACSI_ID");
+  CHECK(settings_get_int(&ctx, "UTC_OFFSET", 0) == -5, "UTC_OFFSET");
+  CHECK(settings_get_int(&ctx, "NOT_A_NUMBER", 99) == 99, "NOT_A_NUMBER");
+  CHECK(settings_get_int(&ctx, "WIFI_SSID", 42) == 42, "empty string int");
+  CHECK(settings_get_int(&ctx, "MISSING", 3) == 3, "missing int default");
+
+  // The parsed values follow the puts
+  settings_put_integer(&ctx, "DRIVES_ACSI_ID", 3);
+  CHECK(settings_get_int(&ctx, "DRIVES_ACSI_ID", -1) == 3, "put_integer");
+  settings_put_bool(&ctx, "RTC_ENABLED", false);
+  CHECK(!settings_get_bool(&ctx, "RTC_ENABLED", true), "put_bool");
+  settings_put_string(&ctx, "NOT_A_NUMBER", "123");
+  CHECK(settings_get_int(&ctx, "NOT_A_NUMBER", 99) == 123, "put_string int");
+  settings_put_string(&ctx, "ACSI_ENABLED", "yes");
+  CHECK(settings_get_bool(&ctx, "ACSI_ENABLED", false), "put_string bool");
+  CHECK(settings_put_string(&ctx, "MISSING", "x") != 0, "put of MISSING");
+  CHECK(settings_put_bool(&ctx, "lower", true) != 0, "put of bad key");
+  settings_deinit(&ctx);
+}
+
+static void testSaveRoundTrip(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+
+  settings_put_string(&ctx, "ACSI_IMAGE_2", "/hd/second.img");
+  settings_put_integer(&ctx, "UTC_OFFSET", 2);
+  settings_put_bool(&ctx, "ACSI_ENABLED", true);
+  settings_put_string(&ctx, "ZZ_LAST", "changed");
+  erases = programs = 0;
+  CHECK(settings_save(&ctx, true) == 0, "save failed");
+  CHECK(erases == 1 && programs == 1, "save: %u erases, %u programs",
+        erases, programs);
+  settings_deinit(&ctx);
+
+  SettingsContext reloaded;
+  int loaded = openContext(&reloaded, TEST_VERSION);
+  CHECK(loaded == DEFAULTS_COUNT + 1, "reload returned %d", loaded);
+  const char *image = valueOf(&reloaded, "ACSI_IMAGE_2");
+  CHECK(image != NULL && strcmp(image, "/hd/second.img") == 0,
+        "ACSI_IMAGE_2 is %s", image ? image : "(null)");
+  const char *last = valueOf(&reloaded, "ZZ_LAST");
+  CHECK(last != NULL && strcmp(last, "changed") == 0, "ZZ_LAST is %s",
+        last ? last : "(null)");
+  CHECK(settings_get_int(&reloaded, "UTC_OFFSET", 0) == 2, "UTC_OFFSET");
+  CHECK(settings_get_bool(&reloaded, "ACSI_ENABLED", false), "ACSI_ENABLED");
+  // Untouched entries keep their defaults
+  const char *boot = valueOf(&reloaded, "BOOT_FEATURE");
+  CHECK(boot != NULL && strcmp(boot, "DRIVES") == 0, "BOOT_FEATURE");
+  CHECK(settings_get_int(&reloaded, "DRIVES_ACSI_ID", -1) == 7,
+        "DRIVES_ACSI_ID");
+  CHECK(guardsIntact(), "save wrote outside its sector");
+  settings_deinit(&reloaded);
+}
+
+static void testSaveCoalescing(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+
+  settings_put_integer(&ctx, "DRIVES_ACSI_ID", 5);
+  settings_save(&ctx, true);
+
+  // Same content: no erase, no program
+  erases = programs = 0;
+  CHECK(settings_save(&ctx, true) == 0, "second save failed");
+  CHECK(erases == 0 && programs == 0, "unchanged save: %u erases",
+        erases);
+
+  // Putting the value it already has changes nothing either
+  settings_put_integer(&ctx, "DRIVES_ACSI_ID", 5);
+  settings_save(&ctx, true);
+  CHECK(erases == 0 && programs == 0, "same-value save: %u erases", erases);
+
+  // Unless the entry was never set: putting its default pins it
+  settings_put_bool(&ctx, "RTC_ENABLED", true);
+  settings_save(&ctx, true);
+  CHECK(erases == 1 && programs == 1, "pinned default save: %u erases",
+        erases);
+  erases = programs = 0;
+
+  // A real change is written
+  settings_put_integer(&ctx, "DRIVES_ACSI_ID", 6);
+  settings_save(&ctx, true);
+  CHECK(erases == 1 && programs == 1, "changed save: %u erases", erases);
+
+  // Back to the default: the entry stays in the flash image, pinned
+  settings_put_integer(&ctx, "DRIVES_ACSI_ID", 7);
+  settings_save(&ctx, true);
+  CHECK(erases == 2, "default save: %u erases", erases);
+  settings_deinit(&ctx);
+
+  SettingsContext reloaded;
+  openContext(&reloaded, TEST_VERSION);
+  CHECK(settings_get_int(&reloaded, "DRIVES_ACSI_ID", -1) == 7,
+        "DRIVES_ACSI_ID after reset to default");
+  erases = 0;
+  settings_save(&reloaded, true);
+  CHECK(erases == 0, "reloaded save: %u erases", erases);
+  settings_deinit(&reloaded);
+}
+
+// A value the user chose does not follow a new default, an untouched one does
+static void testPinnedDefaults(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+  settings_put_bool(&ctx, "RTC_ENABLED", true);
+  CHECK(settings_save(&ctx, true) == 0, "save failed");
+  settings_deinit(&ctx);
+
+  SettingsConfigEntry newer[DEFAULTS_COUNT];
+  memcpy(newer, defaults, sizeof(newer));
+  for (uint16_t i = 0; i < DEFAULTS_COUNT; i++) {
+    if (strcmp(newer[i].key, "RTC_ENABLED") == 0 ||
+        strcmp(newer[i].key, "BOOT_CACHE") == 0) {
+      strcpy(newer[i].value, "false");
+    }
+  }
+  memset(&ctx, 0, sizeof(ctx));
+  settings_init(&ctx, newer, DEFAULTS_COUNT, SETTINGS_OFFSET,
+                FLASH_SECTOR_SIZE, TEST_MAGIC, TEST_VERSION);
+  CHECK(settings_get_bool(&ctx, "RTC_ENABLED", false),
+        "RTC_ENABLED followed the new default");
+  CHECK(!settings_get_bool(&ctx, "BOOT_CACHE", true),
+        "BOOT_CACHE kept the old default");
+  settings_deinit(&ctx);
+}
+
+static void testOverflow(void) {
+  for (unsigned i = 0; i < MANY_COUNT; i++) {
+    snprintf(manyDefaults[i].key, sizeof(manyDefaults[i].key), "KEY_%02u", i);
+    manyDefaults[i].dataType = SETTINGS_TYPE_STRING;
+    strcpy(manyDefaults[i].value, "default");
+  }
+  CHECK(SETTINGS_FLASH_ENTRIES(FLASH_SECTOR_SIZE, 0) < MANY_COUNT + 1 &&
+            SETTINGS_FLASH_ENTRIES(FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE) >=
+                MANY_COUNT + 1,
+        "the keys must need the overflow, and fit with it");
+
+  // Without the overflow the save fails and the flash is left alone
+  SettingsContext ctx;
+  blankFlash();
+  openMany(&ctx, false);
+  putMany(&ctx, "first");
+  erases = programs = 0;
+  CHECK(settings_save(&ctx, true) != 0, "oversized save succeeded");
+  CHECK(erases == 0 && programs == 0, "failed save wrote the flash");
+  settings_deinit(&ctx);
+
+  // With it, every entry is saved and loaded back
+  openMany(&ctx, true);
+  putMany(&ctx, "first");
+  CHECK(settings_save(&ctx, true) == 0, "save with overflow failed");
+  CHECK(erases == 2 && programs == 2, "overflow save: %u erases", erases);
+  settings_deinit(&ctx);
+  openMany(&ctx, true);
+  CHECK(countMany(&ctx, "first") == MANY_COUNT, "overflow reload: %u",
+        countMany(&ctx, "first"));
+  erases = 0;
+  settings_save(&ctx, true);
+  CHECK(erases == 0, "unchanged overflow save: %u erases", erases);
+
+  // A change in the main region names the overflow again
+  settings_put_string(&ctx, "KEY_00", "second00");
+  settings_save(&ctx, true);
+  CHECK(erases == 2, "main change: %u erases", erases);
+  settings_deinit(&ctx);
+
+  // A save cut short between the regions: the old overflow names another
+  // main region, so its entries take their defaults and the main ones load
+  uint8_t oldOverflow[FLASH_SECTOR_SIZE];
+  memcpy(oldOverflow, &settingstest_flash[OVERFLOW_OFFSET], FLASH_SECTOR_SIZE);
+  openMany(&ctx, true);
+  putMany(&ctx, "third");
+  settings_save(&ctx, true);
+  settings_deinit(&ctx);
+  memcpy(&settingstest_flash[OVERFLOW_OFFSET], oldOverflow, FLASH_SECTOR_SIZE);
+  openMany(&ctx, true);
+  unsigned mainCount = FLASH_SECTOR_SIZE / sizeof(SettingsConfigEntry) - 1;
+  CHECK(countMany(&ctx, "third") == mainCount,
+        "torn save loaded %u entries, expected %u", countMany(&ctx, "third"),
+        mainCount);
+  settings_deinit(&ctx);
+  CHECK(guardsIntact(), "overflow save wrote outside its sectors");
+}
+
+static void testVersionMismatch(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+  settings_put_string(&ctx, "BOOT_FEATURE", "OTHER");
+  settings_save(&ctx, true);
+  settings_deinit(&ctx);
+
+  SettingsContext newer;
+  int loaded = openContext(&newer, TEST_VERSION + 1);
+  CHECK(loaded < 0, "other version loaded (%d)", loaded);
+  const char *boot = valueOf(&newer, "BOOT_FEATURE");
+  CHECK(boot != NULL && strcmp(boot, "DRIVES") == 0,
+        "other version kept BOOT_FEATURE=%s", boot ? boot : "(null)");
+
+  // Saving under the new version rewrites the sector
+  erases = 0;
+  settings_save(&newer, true);
+  CHECK(erases == 1, "new version save: %u erases", erases);
+  settings_deinit(&newer);
+}
+
+static void testErase(void) {
+  SettingsContext ctx;
+  blankFlash();
+  openContext(&ctx, TEST_VERSION);
+  settings_put_bool(&ctx, "BOOT_CACHE", false);
+  settings_save(&ctx, true);
+  CHECK(settings_erase(&ctx) == 0, "erase failed");
+  CHECK(settings_find_entry(&ctx, "BOOT_CACHE") == NULL,
+        "entries left after erase");
+  CHECK(settings_get_bool(&ctx, "BOOT_CACHE", false) == false,
+        "get after erase");
+
+  bool blank = true;
+  for (uint32_t i = 0; i < FLASH_SECTOR_SIZE; i++) {
+    blank = blank && settingstest_flash[SETTINGS_OFFSET + i] == 0xFF;
+  }
+  CHECK(blank, "sector not blank after erase");
+
+  SettingsContext reloaded;
+  CHECK(openContext(&reloaded, TEST_VERSION) < 0, "config left after erase");
+  CHECK(settings_get_bool(&reloaded, "BOOT_CACHE", false),
+        "BOOT_CACHE not back to its default");
+  CHECK(guardsIntact(), "erase wrote outside its sector");
+  settings_deinit(&reloaded);
+}
+
+int main(void) {
+  testDefaultsOnBlankFlash();
+  testTypedGetters();
+  testSaveRoundTrip();
+  testSaveCoalescing();
+  testPinnedDefaults();
+  testOverflow();
+  testVersionMismatch();
+  testErase();
+
+  CHECK(flashErrors == 0, "%u invalid flash operations", flashErrors);
+  return check_report();
+}
@@ -0,0 +1,26 @@
+/**
+ * File: flash.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK flash calls. The flash is a
+ * RAM image provided by the harness, mapped at XIP_BASE.
+ */
+
+#ifndef SETTINGSTEST_FLASH_H
+#define SETTINGSTEST_FLASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FLASH_PAGE_SIZE 256u
+#define FLASH_SECTOR_SIZE 4096u
+
+extern uint8_t settingstest_flash[];
+#define XIP_BASE ((uintptr_t)settingstest_flash)
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data,
+                         size_t count);
+
+#endif  // SETTINGSTEST_FLASH_H
@@ -0,0 +1,11 @@
+/**
+ * File: resets.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Empty host stand-in, settings.h includes it.
+ */
+
+#ifndef SETTINGSTEST_RESETS_H
+#define SETTINGSTEST_RESETS_H
+#endif  // SETTINGSTEST_RESETS_H
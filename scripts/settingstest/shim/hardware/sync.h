@@ -0,0 +1,17 @@
+/**
+ * File: sync.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the Pico SDK interrupt masking.
+ */
+
+#ifndef SETTINGSTEST_SYNC_H
+#define SETTINGSTEST_SYNC_H
+
+#include <stdint.h>
+
+static inline uint32_t save_and_disable_interrupts(void) { return 0; }
+static inline void restore_interrupts(uint32_t status) { (void)status; }
+
+#endif  // SETTINGSTEST_SYNC_H
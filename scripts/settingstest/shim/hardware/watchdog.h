@@ -0,0 +1,11 @@
+/**
+ * File: watchdog.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Empty host stand-in, settings.h includes it.
+ */
+
+#ifndef SETTINGSTEST_WATCHDOG_H
+#define SETTINGSTEST_WATCHDOG_H
+#endif  // SETTINGSTEST_WATCHDOG_H
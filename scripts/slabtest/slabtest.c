@@ -0,0 +1,309 @@
+/**
+ * File: slabtest.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host harness for the fixed-block pools. Runs random
+ * Fopen/Fclose/Fsfirst/Fsnext sequences over pools sized like the GEMDRIVE
+ * ones (rp/src/slab.c, compiled as is), and checks that no block is handed
+ * out twice, that the data of the blocks in use is never overwritten, and
+ * that the counters follow the model.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "slab.h"
+
+// Sizes of the firmware objects (FileDescriptors, DTANode, DIR), close
+// enough for the test
+#define FILE_BLOCK_SIZE 712u
+#define DTA_BLOCK_SIZE 120u
+#define DIR_BLOCK_SIZE 48u
+
+#define FILE_POOL_SIZE 12u  // GEMDRIVE_FILE_POOL_SIZE
+#define DTA_POOL_SIZE 24u   // GEMDRIVE_DTA_POOL_SIZE
+
+#define DEFAULT_STEPS 200000u
+#define DEFAULT_SEED 1u
+
+// xorshift32: the same seed gives the same session on every host
+static uint32_t rngState = DEFAULT_SEED;
+static uint32_t rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+// A block in use is filled with its owner tag, checked when it is freed
+static void stamp(void *block, size_t size, uint32_t tag) {
+  uint32_t *words = (uint32_t *)block;
+  for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+    words[i] = tag ^ (uint32_t)i;
+  }
+}
+
+static bool stampIntact(const void *block, size_t size, uint32_t tag) {
+  const uint32_t *words = (const uint32_t *)block;
+  for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+    if (words[i] != (tag ^ (uint32_t)i)) return false;
+  }
+  return true;
+}
+
+// Model of the GEMDRIVE lists: open files, and DTAs in the order they were
+// last used, each with the directory object of its search, if any
+typedef struct {
+  void *block;
+  uint32_t tag;
+} Open;
+
+typedef struct {
+  void *node;
+  void *dir;
+  uint32_t tag;
+} Search;
+
+static Open files[FILE_POOL_SIZE];
+static unsigned int fileCount = 0;
+static Search searches[DTA_POOL_SIZE];  // [0] is the least recently used
+static unsigned int searchCount = 0;
+static uint32_t nextTag = 1;
+
+static SlabPool filePool;
+static SlabPool dtaPool;
+static SlabPool dirPool;
+
+static uint32_t expectedFileFull = 0;
+static uint32_t expectedDtaFull = 0;
+
+static void closeSearch(unsigned int index) {
+  Search *s = &searches[index];
+  CHECK(stampIntact(s->node, DTA_BLOCK_SIZE, s->tag),
+        "DTA block of tag %" PRIu32 " overwritten", s->tag);
+  if (s->dir != NULL) {
+    CHECK(stampIntact(s->dir, DIR_BLOCK_SIZE, ~s->tag),
+          "DIR block of tag %" PRIu32 " overwritten", s->tag);
+    slab_free(&dirPool, s->dir);
+  }
+  slab_free(&dtaPool, s->node);
+  memmove(&searches[index], &searches[index + 1],
+          (searchCount - index - 1) * sizeof(Search));
+  searchCount--;
+}
+
+static void opFopen(void) {
+  void *block = slab_alloc(&filePool);
+  if (fileCount == FILE_POOL_SIZE) {
+    expectedFileFull++;
+    CHECK(block == NULL, "a full file pool gave a block");
+    return;
+  }
+  CHECK(block != NULL, "no file block with %u open", fileCount);
+  if (block == NULL) return;
+  for (unsigned int i = 0; i < fileCount; i++) {
+    CHECK(files[i].block != block, "file block handed out twice");
+  }
+  files[fileCount].block = block;
+  files[fileCount].tag = nextTag++;
+  stamp(block, FILE_BLOCK_SIZE, files[fileCount].tag);
+  fileCount++;
+}
+
+static void opFclose(void) {
+  if (fileCount == 0) return;
+  unsigned int i = rng() % fileCount;
+  CHECK(stampIntact(files[i].block, FILE_BLOCK_SIZE, files[i].tag),
+        "file block of tag %" PRIu32 " overwritten", files[i].tag);
+  slab_free(&filePool, files[i].block);
+  files[i] = files[--fileCount];
+}
+
+// Fsfirst: a new DTA, the least recently used one is reused when the pool
+// is full, as in insertDTA. Wildcard searches keep a directory object.
+static void opFsfirst(void) {
+  void *node = slab_alloc(&dtaPool);
+  if (node == NULL) {
+    expectedDtaFull++;
+    CHECK(searchCount == DTA_POOL_SIZE, "DTA pool full with %u searches",
+          searchCount);
+    closeSearch(0);
+    node = slab_alloc(&dtaPool);
+  }
+  CHECK(node != NULL, "no DTA block after reusing the least recent");
+  if (node == NULL) return;
+
+  Search *s = &searches[searchCount];
+  s->node = node;
+  s->tag = nextTag++;
+  s->dir = NULL;
+  stamp(node, DTA_BLOCK_SIZE, s->tag);
+  if (rng() % 4u != 0) {
+    s->dir = slab_alloc(&dirPool);
+    CHECK(s->dir != NULL, "no DIR block with a DTA block free");
+    if (s->dir != NULL) stamp(s->dir, DIR_BLOCK_SIZE, ~s->tag);
+  }
+  searchCount++;
+}
+
+// Fsnext: the search ends (no more files) half of the time. Otherwise it
+// becomes the most recently used, as lookupDTA moves it to the head.
+static void opFsnext(void) {
+  if (searchCount == 0) return;
+  unsigned int i = rng() % searchCount;
+  if (rng() % 2u == 0) {
+    closeSearch(i);
+    return;
+  }
+  Search used = searches[i];
+  memmove(&searches[i], &searches[i + 1],
+          (searchCount - i - 1) * sizeof(Search));
+  searches[searchCount - 1] = used;
+}
+
+static void checkCounters(const char *when) {
+  CHECK(filePool.inUse == fileCount, "%s: %u files in use, model %u", when,
+        filePool.inUse, fileCount);
+  CHECK(dtaPool.inUse == searchCount, "%s: %u DTAs in use, model %u", when,
+        dtaPool.inUse, searchCount);
+  CHECK(filePool.exhausted == expectedFileFull,
+        "%s: file pool full %" PRIu32 " times, model %" PRIu32, when,
+        filePool.exhausted, expectedFileFull);
+  CHECK(dtaPool.exhausted == expectedDtaFull,
+        "%s: DTA pool full %" PRIu32 " times, model %" PRIu32, when,
+        dtaPool.exhausted, expectedDtaFull);
+  CHECK(dirPool.exhausted == 0, "%s: DIR pool full", when);
+}
+
+static void initPools(void) {
+  CHECK(slab_init(&filePool, "files", FILE_BLOCK_SIZE, FILE_POOL_SIZE),
+        "file pool init");
+  CHECK(slab_init(&dtaPool, "dta", DTA_BLOCK_SIZE, DTA_POOL_SIZE),
+        "DTA pool init");
+  CHECK(slab_init(&dirPool, "dir", DIR_BLOCK_SIZE, DTA_POOL_SIZE),
+        "DIR pool init");
+  fileCount = 0;
+  searchCount = 0;
+  expectedFileFull = 0;
+  expectedDtaFull = 0;
+}
+
+// Random session: Fopen and Fsfirst weigh more than their counterparts,
+// so the pools fill up and stay near full
+static void testSession(uint32_t seed, unsigned int steps) {
+  rngState = seed ? seed : DEFAULT_SEED;
+  initPools();
+  for (unsigned int step = 0; step < steps; step++) {
+    switch (rng() % 10u) {
+      case 0:
+      case 1:
+      case 2:
+        opFopen();
+        break;
+      case 3:
+      case 4:
+        opFclose();
+        break;
+      case 5:
+      case 6:
+      case 7:
+        opFsfirst();
+        break;
+      default:
+        opFsnext();
+        break;
+    }
+    if (step % 1024u == 0) checkCounters("session");
+  }
+  checkCounters("end of session");
+  CHECK(filePool.peak == FILE_POOL_SIZE, "file pool peak %u",
+        filePool.peak);
+  CHECK(dtaPool.peak == DTA_POOL_SIZE, "DTA pool peak %u", dtaPool.peak);
+
+  // Media change: everything is closed and every block is free again
+  while (fileCount > 0) opFclose();
+  while (searchCount > 0) closeSearch(searchCount - 1);
+  checkCounters("all closed");
+}
+
+// After a reset the blocks come out in the same order
+static void testDeterministic(void) {
+  initPools();
+  void *first[FILE_POOL_SIZE];
+  for (unsigned int i = 0; i < FILE_POOL_SIZE; i++) {
+    first[i] = slab_alloc(&filePool);
+  }
+  for (unsigned int i = 0; i < FILE_POOL_SIZE; i += 2) {
+    slab_free(&filePool, first[i]);
+  }
+  uint8_t *memory = filePool.memory;
+  CHECK(slab_init(&filePool, "files", FILE_BLOCK_SIZE, FILE_POOL_SIZE),
+        "file pool init again");
+  CHECK(filePool.memory == memory, "init again took new memory");
+  CHECK(filePool.inUse == 0 && filePool.peak == 0, "init again kept counts");
+  for (unsigned int i = 0; i < FILE_POOL_SIZE; i++) {
+    void *block = slab_alloc(&filePool);
+    CHECK(block == first[i], "block %u out of order after init", i);
+    CHECK((uintptr_t)block % 4u == 0, "block %u not aligned", i);
+  }
+  CHECK(slab_alloc(&filePool) == NULL, "full pool gave a block");
+  CHECK(filePool.exhausted == 1, "exhausted %" PRIu32, filePool.exhausted);
+}
+
+// Pointers from elsewhere are not taken in
+static void testForeignBlocks(void) {
+  initPools();
+  uint8_t outside[FILE_BLOCK_SIZE];
+  void *block = slab_alloc(&filePool);
+  slab_free(&filePool, outside);
+  slab_free(&filePool, (uint8_t *)block + 4);
+  slab_free(&filePool, NULL);
+  slab_free(&dtaPool, block);
+  CHECK(filePool.inUse == 1, "a foreign free changed the file pool");
+  CHECK(dtaPool.inUse == 0, "the DTA pool took a file block");
+  slab_free(&filePool, block);
+  CHECK(filePool.inUse == 0, "file block not given back");
+}
+
+// No memory at init: every allocation is refused, nothing crashes
+static void testNoMemory(void) {
+  SlabPool huge = {0};
+  CHECK(!slab_init(&huge, "huge", 70000u, 4u), "a block over 64 KB");
+  CHECK(slab_alloc(&huge) == NULL, "a pool without memory gave a block");
+  CHECK(huge.exhausted == 1, "exhausted %" PRIu32, huge.exhausted);
+  slab_deinit(&huge);
+}
+
+int main(int argc, char **argv) {
+  unsigned int steps = DEFAULT_STEPS;
+  uint32_t seed = DEFAULT_SEED;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+      steps = (unsigned int)strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+    } else {
+      fprintf(stderr, "Usage: %s [--steps N] [--seed N]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  testDeterministic();
+  testForeignBlocks();
+  testNoMemory();
+  for (uint32_t i = 0; i < 8u; i++) {
+    testSession(seed + i * 7919u, steps);
+  }
+
+  slab_deinit(&filePool);
+  slab_deinit(&dtaPool);
+  slab_deinit(&dirPool);
+
+  return check_report();
+}
@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""sramreport.py - static RAM of the SidecarTridge Multi-device drives
+emulator firmware per subsystem, against the SRAM budget table.
+
+The linker map written next to rp.elf lists every input section with its
+address, size and object file. This script adds up the sections placed in
+the RAM region (.data, .uninitialized_data and .bss: what is left is the
+heap), groups the object files in subsystems and compares each one with its
+line in rp/src/memmap_budget.ld. The alignment padding, inside and between
+sections, is shown apart: it only counts against the total, like in the
+linker check.
+
+The heap is not in the map. Use the `sram` setup terminal command on the
+device for the heap in use and its high water mark since boot.
+
+Usage:
+  scripts/sramreport/sramreport.py rp.elf.map [--budget FILE]
+                                              [--region NAME] [--top N]
+
+Exits with 1 when a subsystem or the total is over its budget.
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import defaultdict
+from dataclasses import dataclass
+from typing import Dict, List, Optional, Tuple
+
+DEFAULT_BUDGET = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), "..", "..", "rp", "src",
+    "memmap_budget.ld")
+
+# Output sections that are not static RAM even if they sit in the region
+IGNORED_OUTPUT_SECTIONS = (".heap", ".stack_dummy", ".stack1_dummy")
+
+PADDING = "padding"
+UNKNOWN = "sdk"
+
+# Subsystem of an object file, first match wins. The firmware sources are
+# matched on the file name, the libraries on the path.
+SUBSYSTEM_RULES: List[Tuple[str, "re.Pattern[str]"]] = [
+    ("fatfs", re.compile(
+        r"(fatfs-sdk|no-OS-FatFS|/ff15/|/sd_driver/|"
+        r"(^|/)(hw_config|sd_timeouts_config)\.c\.o)", re.I)),
+    ("display", re.compile(
+        r"(/u8g2/|libu8g2\.a|(^|/)(display\w*|term)\.c\.o)")),
+    ("acsi", re.compile(r"(^|/)acsi\w*\.c\.o")),
+    ("floppy", re.compile(r"(^|/)floppy\w*\.c\.o")),
+    ("gemdrive", re.compile(r"(^|/)(gemdrive\w*|dirindex)\.c\.o")),
+    ("comm", re.compile(r"(^|/)(commemul|romemul|chandler|cmdtrace)\.c\.o")),
+    ("usb", re.compile(r"(^|/)usb_\w+\.c\.o")),
+    ("sdk", re.compile(r"(/pico-sdk/|/pico-extras/|\.a\(|/lib\w+\.a)")),
+    ("app", re.compile(r"(^|/)\w+\.c\.o")),
+]
+
+RE_MEMORY = re.compile(
+    r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(\s+\w+)?\s*$")
+RE_OUTPUT = re.compile(r"^(\.[\w.]+)(\s+0x[0-9a-fA-F]+\s+0x[0-9a-fA-F]+)?")
+RE_INPUT = re.compile(
+    r"^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+RE_INPUT_NAME = re.compile(r"^ (\S+)$")
+RE_INPUT_REST = re.compile(
+    r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+RE_FILL = re.compile(r"^ \*fill\*\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+RE_BUDGET = re.compile(
+    r"^\s*__sram_budget_(\w+)\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*([kKmM]?)\s*;")
+
+
+@dataclass
+class Region:
+    origin: int
+    length: int
+
+    def contains(self, address: int) -> bool:
+        return self.origin <= address < self.origin + self.length
+
+
+@dataclass
+class Contribution:
+    output_section: str
+    input_section: str
+    address: int
+    size: int
+    obj: str
+
+
+def parse_map(path: str) -> Tuple[Dict[str, Region], List[Contribution]]:
+    regions: Dict[str, Region] = {}
+    contributions: List[Contribution] = []
+    in_memory = False
+    in_layout = False
+    output_section = ""
+    pending_name: Optional[str] = None
+
+    with open(path, "r", encoding="utf-8", errors="replace") as f:
+        for raw in f:
+            line = raw.rstrip("\n")
+            if line.startswith("Memory Configuration"):
+                in_memory = True
+                continue
+            if line.startswith("Linker script and memory map"):
+                in_memory = False
+                in_layout = True
+                continue
+            if in_memory:
+                m = RE_MEMORY.match(line)
+                if m and m.group(1) != "Name":
+                    regions[m.group(1)] = Region(int(m.group(2), 16),
+                                                 int(m.group(3), 16))
+                continue
+            if not in_layout:
+                continue
+
+            m = RE_OUTPUT.match(line)
+            if m:
+                output_section = m.group(1)
+                pending_name = None
+                continue
+
+            m = RE_FILL.match(line)
+            if m:
+                contributions.append(Contribution(
+                    output_section, "*fill*", int(m.group(1), 16),
+                    int(m.group(2), 16), PADDING))
+                pending_name = None
+                continue
+
+            if pending_name is not None:
+                m = RE_INPUT_REST.match(line)
+                name, pending_name = pending_name, None
+                if m:
+                    contributions.append(Contribution(
+                        output_section, name, int(m.group(1), 16),
+                        int(m.group(2), 16), m.group(3).strip()))
+                    continue
+
+            m = RE_INPUT.match(line)
+            if m:
+                contributions.append(Contribution(
+                    output_section, m.group(1), int(m.group(2), 16),
+                    int(m.group(3), 16), m.group(4).strip()))
+                continue
+
+            m = RE_INPUT_NAME.match(line)
+            if m and not m.group(1).startswith("*"):
+                # Long section names leave address, size and file for the
+                # next line
+                pending_name = m.group(1)
+
+    return regions, contributions
+
+
+def parse_budget(path: str) -> Dict[str, int]:
+    budget: Dict[str, int] = {}
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            m = RE_BUDGET.match(line)
+            if not m:
+                continue
+            value = int(m.group(2), 0)
+            suffix = m.group(3).lower()
+            if suffix == "k":
+                value *= 1024
+            elif suffix == "m":
+                value *= 1024 * 1024
+            budget[m.group(1)] = value
+    return budget
+
+
+def subsystem_of(obj: str) -> str:
+    if obj == PADDING:
+        return PADDING
+    for name, rule in SUBSYSTEM_RULES:
+        if rule.search(obj):
+            return name
+    return UNKNOWN
+
+
+def short_name(obj: str) -> str:
+    # libfoo.a(bar.o) keeps the archive, source objects keep the file name
+    m = re.match(r"^(.*/)?([^/(]+\.a)\((.+)\)$", obj)
+    if m:
+        return f"{m.group(2)}({m.group(3)})"
+    return os.path.basename(obj)
+
+
+def kb(size: int) -> str:
+    return f"{size / 1024:7.1f}k"
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Static RAM per subsystem against the SRAM budget")
+    parser.add_argument("map", help="linker map (rp.elf.map)")
+    parser.add_argument("--budget", default=DEFAULT_BUDGET,
+                        help="budget table (default: rp/src/memmap_budget.ld)")
+    parser.add_argument("--region", default="RAM",
+                        help="memory region to report (default: RAM)")
+    parser.add_argument("--top", type=int, default=15,
+                        help="number of largest objects to list (default: 15)")
+    args = parser.parse_args()
+
+    regions, contributions = parse_map(args.map)
+    if args.region not in regions:
+        print(f"{args.map}: no {args.region} region in the memory "
+              f"configuration", file=sys.stderr)
+        return 2
+    region = regions[args.region]
+    budget = parse_budget(args.budget)
+
+    per_subsystem: Dict[str, int] = defaultdict(int)
+    per_object: Dict[str, int] = defaultdict(int)
+    end = region.origin
+    for c in contributions:
+        if c.size == 0 or not region.contains(c.address):
+            continue
+        if c.output_section in IGNORED_OUTPUT_SECTIONS or c.obj == PADDING:
+            continue
+        per_subsystem[subsystem_of(c.obj)] += c.size
+        per_object[c.obj] += c.size
+        end = max(end, c.address + c.size)
+
+    # Like the linker check: from the start of the region to the end of the
+    # last section, so the gaps between sections are padding too
+    total = end - region.origin
+    per_subsystem[PADDING] = total - sum(per_subsystem.values())
+
+    static_budget = sum(budget.values())
+    heap_budget = region.length - static_budget
+    over = False
+
+    print(f"Static RAM in {args.region} "
+          f"(0x{region.origin:08X}, {region.length // 1024}k)")
+    print()
+    print(f"{'Subsystem':<10} {'Used':>8} {'Budget':>8} {'Use':>6}")
+    names = sorted(set(budget) | set(per_subsystem),
+                   key=lambda n: (n == PADDING, -per_subsystem.get(n, 0), n))
+    for name in names:
+        used = per_subsystem.get(name, 0)
+        if name == PADDING:
+            print(f"{name:<10} {kb(used)} {'-':>8} {'-':>6}")
+            continue
+        limit = budget.get(name)
+        if limit is None:
+            print(f"{name:<10} {kb(used)} {'none':>8} {'-':>6}  OVER")
+            over = True
+            continue
+        percent = 100.0 * used / limit if limit else 0.0
+        flag = "  OVER" if used > limit else ""
+        over = over or used > limit
+        print(f"{name:<10} {kb(used)} {kb(limit)} {percent:5.1f}%{flag}")
+
+    flag = "  OVER" if total > static_budget else ""
+    over = over or total > static_budget
+    print(f"{'total':<10} {kb(total)} {kb(static_budget)} "
+          f"{100.0 * total / static_budget if static_budget else 0:5.1f}%"
+          f"{flag}")
+    print(f"{'heap':<10} {kb(region.length - total)} {kb(heap_budget)} "
+          f"   (left free / budgeted)")
+
+    if args.top > 0 and per_object:
+        print()
+        print("Largest objects:")
+        largest = sorted(per_object.items(), key=lambda kv: -kv[1])
+        for obj, size in largest[:args.top]:
+            print(f"  {kb(size)}  {subsystem_of(obj):<9} {short_name(obj)}")
+
+    return 1 if over else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,26 @@
+/**
+ * File: diskio.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the FatFS diskio.h. usbmsc.c implements
+ * the functions over a RAM disk.
+ */
+
+#ifndef _DISKIO_DEFINED
+#define _DISKIO_DEFINED
+
+#include "ff.h"
+
+typedef enum {
+  RES_OK = 0,
+  RES_ERROR,
+  RES_WRPRT,
+  RES_NOTRDY,
+  RES_PARERR
+} DRESULT;
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count);
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count);
+
+#endif  // _DISKIO_DEFINED
@@ -0,0 +1,23 @@
+/**
+ * File: ff.h
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host stand-in for the FatFS ff.h, with only what
+ * usb_mass_cache.c uses.
+ */
+
+#ifndef FF_DEFINED
+#define FF_DEFINED
+
+#include <stdint.h>
+
+#define FF_MIN_SS 512
+#define FF_MAX_SS 512
+
+typedef unsigned int UINT;
+typedef unsigned char BYTE;
+typedef uint32_t DWORD;
+typedef DWORD LBA_t;
+
+#endif  // FF_DEFINED
@@ -0,0 +1,603 @@
+/**
+ * File: usbmsc.c
+ * Author: Diego Parrilla Santamaría
+ * Date: October 2026
+ * Copyright: 2026 - GOODDATA LABS SL
+ * Description: Host harness for the USB Mass storage sector cache. Replays
+ * host access patterns through the same usb_mass_cache.c the firmware runs,
+ * calling it the way the TinyUSB READ10/WRITE10 callbacks do, over a RAM
+ * disk. Checks every byte read against a reference copy and compares the
+ * SD card accesses with the uncached path.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "usb_mass_cache.h"
+
+#define SECTOR_SIZE USB_MASS_CACHE_SECTOR_SIZE
+#define DEFAULT_DISK_MB 64u
+#define DEFAULT_CHUNK 512u  // CFG_TUD_MSC_EP_BUFSIZE in tusb_config.h
+#define DEFAULT_FILES 40u
+
+// SD card cost model, SPI at 12.5 MHz
+#define DEFAULT_READ_CMD_US 250u
+#define DEFAULT_READ_SECTOR_US 340u
+#define DEFAULT_WRITE_CMD_US 1000u
+#define DEFAULT_WRITE_SECTOR_US 360u
+
+// Synthetic volume: FAT32 layout, 4 KB clusters, root directory in the
+// first cluster of the data area
+#define SYN_VOLUME_LBA 2048u
+#define SYN_RESERVED 32u
+#define SYN_FAT_SECTORS 1024u
+#define SYN_FAT_LBA (SYN_VOLUME_LBA + SYN_RESERVED)
+#define SYN_DATA_LBA (SYN_FAT_LBA + 2u * SYN_FAT_SECTORS)
+#define SYN_CLUSTER 8u
+#define SYN_FAT_ENTRIES_PER_SECTOR (SECTOR_SIZE / 4u)
+
+typedef enum { OP_READ, OP_WRITE, OP_SYNC } OpType;
+
+typedef struct {
+  OpType type;
+  uint32_t lba;
+  uint32_t count;
+} Op;
+
+typedef struct {
+  Op *ops;
+  size_t count;
+  size_t capacity;
+  uint32_t metaStart[USB_MASS_CACHE_RANGES];
+  uint32_t metaCount[USB_MASS_CACHE_RANGES];
+  uint32_t metaRanges;
+} Trace;
+
+typedef struct {
+  const char *name;
+  uint32_t readChunk;     // Sectors per READ10 of file data
+  uint32_t writeChunk;    // Sectors per WRITE10 of file data
+  uint32_t fatRereads;    // FAT sectors read again per file
+  uint32_t dirRereads;    // Directory reads per file
+  bool syncPerFile;       // SYNCHRONIZE CACHE after each file
+  bool appleDouble;       // A "._" companion file per file
+} Profile;
+
+// Modelled on the usual behaviour of each OS with a FAT32 card. Not
+// recordings: use --usbmon or --trace for real sessions.
+static const Profile profiles[] = {
+    {"linux", 240, 240, 1, 1, false, false},
+    {"macos", 256, 256, 4, 3, false, true},
+    {"windows", 128, 128, 2, 2, true, false},
+};
+
+typedef struct {
+  uint32_t diskReads;
+  uint32_t diskReadSectors;
+  uint32_t diskWrites;
+  uint32_t diskWriteSectors;
+} DiskCounters;
+
+static uint8_t *disk = NULL;       // What the card holds
+static uint8_t *reference = NULL;  // What the host expects
+static uint32_t diskSectors = 0;
+static DiskCounters counters;
+static uint64_t rngState = 0x9E3779B97F4A7C15ull;
+
+static uint32_t readCmdUs = DEFAULT_READ_CMD_US;
+static uint32_t readSectorUs = DEFAULT_READ_SECTOR_US;
+static uint32_t writeCmdUs = DEFAULT_WRITE_CMD_US;
+static uint32_t writeSectorUs = DEFAULT_WRITE_SECTOR_US;
+
+static uint32_t rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (uint32_t)(rngState >> 16);
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
+  (void)pdrv;
+  if ((uint64_t)sector + count > diskSectors) return RES_PARERR;
+  counters.diskReads++;
+  counters.diskReadSectors += count;
+  memcpy(buff, disk + (size_t)sector * SECTOR_SIZE,
+         (size_t)count * SECTOR_SIZE);
+  return RES_OK;
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) {
+  (void)pdrv;
+  if ((uint64_t)sector + count > diskSectors) return RES_PARERR;
+  counters.diskWrites++;
+  counters.diskWriteSectors += count;
+  memcpy(disk + (size_t)sector * SECTOR_SIZE, buff,
+         (size_t)count * SECTOR_SIZE);
+  return RES_OK;
+}
+
+static void traceAdd(Trace *trace, OpType type, uint32_t lba,
+                     uint32_t count) {
+  if (type != OP_SYNC) {
+    if (count == 0 || lba >= diskSectors) return;
+    if (count > diskSectors - lba) count = diskSectors - lba;
+  }
+  if (trace->count == trace->capacity) {
+    size_t capacity = trace->capacity ? trace->capacity * 2 : 1024;
+    Op *ops = realloc(trace->ops, capacity * sizeof(Op));
+    if (ops == NULL) {
+      fprintf(stderr, "Out of memory\n");
+      exit(1);
+    }
+    trace->ops = ops;
+    trace->capacity = capacity;
+  }
+  trace->ops[trace->count++] = (Op){type, lba, count};
+}
+
+static void traceAddMeta(Trace *trace, uint32_t start, uint32_t count) {
+  if (trace->metaRanges >= USB_MASS_CACHE_RANGES) {
+    fprintf(stderr, "Only %u metadata ranges are kept\n",
+            (unsigned)USB_MASS_CACHE_RANGES);
+    return;
+  }
+  trace->metaStart[trace->metaRanges] = start;
+  trace->metaCount[trace->metaRanges] = count;
+  trace->metaRanges++;
+}
+
+// File data goes in pieces of the OS transfer size
+static void traceData(Trace *trace, OpType type, uint32_t lba,
+                      uint32_t sectors, uint32_t chunk) {
+  for (uint32_t done = 0; done < sectors; done += chunk) {
+    uint32_t count = sectors - done;
+    if (count > chunk) count = chunk;
+    traceAdd(trace, type, lba + done, count);
+  }
+}
+
+static uint32_t clusterLba(uint32_t cluster) {
+  return SYN_DATA_LBA + (cluster - 2u) * SYN_CLUSTER;
+}
+
+static uint32_t fatLba(uint32_t copy, uint32_t cluster) {
+  return SYN_FAT_LBA + copy * SYN_FAT_SECTORS +
+         cluster / SYN_FAT_ENTRIES_PER_SECTOR;
+}
+
+// Create a file: directory lookup, FAT scan, data, FAT and directory update
+static void synWriteFile(Trace *trace, const Profile *profile,
+                         uint32_t *nextCluster, uint32_t clusters) {
+  for (uint32_t i = 0; i < profile->dirRereads; ++i) {
+    traceAdd(trace, OP_READ, clusterLba(2), SYN_CLUSTER);
+  }
+  for (uint32_t i = 0; i < profile->fatRereads; ++i) {
+    traceAdd(trace, OP_READ, fatLba(0, *nextCluster), 1);
+  }
+  uint32_t first = *nextCluster;
+  *nextCluster += clusters;
+  traceData(trace, OP_WRITE, clusterLba(first), clusters * SYN_CLUSTER,
+            profile->writeChunk);
+  for (uint32_t copy = 0; copy < 2; ++copy) {
+    uint32_t fatFirst = fatLba(copy, first);
+    traceAdd(trace, OP_WRITE, fatFirst,
+             fatLba(copy, first + clusters - 1) - fatFirst + 1);
+  }
+  traceAdd(trace, OP_WRITE, clusterLba(2) + (rng() % SYN_CLUSTER), 1);
+}
+
+static void synReadFile(Trace *trace, const Profile *profile,
+                        uint32_t firstCluster, uint32_t clusters) {
+  for (uint32_t i = 0; i < profile->dirRereads; ++i) {
+    traceAdd(trace, OP_READ, clusterLba(2), SYN_CLUSTER);
+  }
+  for (uint32_t i = 0; i < profile->fatRereads; ++i) {
+    traceAdd(trace, OP_READ, fatLba(0, firstCluster), 1);
+  }
+  traceData(trace, OP_READ, clusterLba(firstCluster), clusters * SYN_CLUSTER,
+            profile->readChunk);
+}
+
+// Mount, copy files to the card, then copy them back
+static void synthesize(Trace *trace, const Profile *profile, uint32_t files) {
+  traceAddMeta(trace, 0, SYN_DATA_LBA);
+  traceAddMeta(trace, clusterLba(2), SYN_CLUSTER);
+
+  traceAdd(trace, OP_READ, 0, 1);
+  traceAdd(trace, OP_READ, SYN_VOLUME_LBA, 1);
+  traceAdd(trace, OP_READ, SYN_VOLUME_LBA + 1, 1);
+  traceAdd(trace, OP_READ, SYN_FAT_LBA, 8);
+  traceAdd(trace, OP_READ, clusterLba(2), SYN_CLUSTER);
+
+  uint32_t maxClusters = (diskSectors - SYN_DATA_LBA) / SYN_CLUSTER;
+  uint32_t nextCluster = 3;
+  uint32_t *firsts = calloc(files, sizeof(uint32_t));
+  uint32_t *sizes = calloc(files, sizeof(uint32_t));
+  if (firsts == NULL || sizes == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    exit(1);
+  }
+
+  for (uint32_t f = 0; f < files; ++f) {
+    // 4 KB to 1 MB, most of them small like a game collection
+    uint32_t clusters = 1u + (rng() % ((rng() & 3u) ? 16u : 256u));
+    uint32_t needed = clusters + (profile->appleDouble ? 1u : 0u);
+    if (nextCluster + needed >= maxClusters) break;
+    firsts[f] = nextCluster;
+    sizes[f] = clusters;
+    synWriteFile(trace, profile, &nextCluster, clusters);
+    if (profile->appleDouble) synWriteFile(trace, profile, &nextCluster, 1);
+    if (profile->syncPerFile) traceAdd(trace, OP_SYNC, 0, 0);
+  }
+  traceAdd(trace, OP_SYNC, 0, 0);
+
+  for (uint32_t f = 0; f < files; ++f) {
+    if (sizes[f] == 0) continue;
+    synReadFile(trace, profile, firsts[f], sizes[f]);
+  }
+  free(firsts);
+  free(sizes);
+}
+
+// Text trace: "R lba count", "W lba count", "S", "M start count" for a
+// metadata range, "#" comments
+static bool loadTrace(Trace *trace, const char *path) {
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    return false;
+  }
+  char line[256];
+  unsigned lineNumber = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    lineNumber++;
+    char kind = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+    int fields = sscanf(line, " %c %lu %lu", &kind, &a, &b);
+    if (fields <= 0 || kind == '#') continue;
+    if (kind == 'S') {
+      traceAdd(trace, OP_SYNC, 0, 0);
+    } else if (fields == 3 && (kind == 'R' || kind == 'W')) {
+      traceAdd(trace, kind == 'R' ? OP_READ : OP_WRITE, (uint32_t)a,
+               (uint32_t)b);
+    } else if (fields == 3 && kind == 'M') {
+      traceAddMeta(trace, (uint32_t)a, (uint32_t)b);
+    } else {
+      fprintf(stderr, "%s:%u: cannot parse '%s'\n", path, lineNumber, line);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+// Linux usbmon text capture (/sys/kernel/debug/usb/usbmon/<bus>u). Only
+// the Command Block Wrappers sent to the device are used.
+static bool loadUsbmon(Trace *trace, const char *path) {
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    return false;
+  }
+  char line[512];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (strstr(line, " S Bo:") == NULL) continue;
+    char *data = strchr(line, '=');
+    if (data == NULL) continue;
+
+    uint8_t cbw[32] = {0};
+    size_t length = 0;
+    for (char *p = data + 1; *p != '\0' && length < sizeof(cbw);) {
+      if (*p == ' ' || *p == '\n') {
+        p++;
+        continue;
+      }
+      unsigned byte = 0;
+      if (sscanf(p, "%2x", &byte) != 1) break;
+      cbw[length++] = (uint8_t)byte;
+      p += 2;
+    }
+    if (length < 25 || memcmp(cbw, "USBC", 4) != 0) continue;
+
+    const uint8_t *cdb = &cbw[15];
+    uint32_t lba = ((uint32_t)cdb[2] << 24) | ((uint32_t)cdb[3] << 16) |
+                   ((uint32_t)cdb[4] << 8) | cdb[5];
+    uint32_t count = ((uint32_t)cdb[7] << 8) | cdb[8];
+    if (cdb[0] == 0x28) {
+      traceAdd(trace, OP_READ, lba, count);
+    } else if (cdb[0] == 0x2A) {
+      traceAdd(trace, OP_WRITE, lba, count);
+    } else if (cdb[0] == 0x35) {
+      traceAdd(trace, OP_SYNC, 0, 0);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+static bool saveTrace(const Trace *trace, const char *path) {
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    return false;
+  }
+  for (uint32_t i = 0; i < trace->metaRanges; ++i) {
+    fprintf(file, "M %" PRIu32 " %" PRIu32 "\n", trace->metaStart[i],
+            trace->metaCount[i]);
+  }
+  for (size_t i = 0; i < trace->count; ++i) {
+    const Op *op = &trace->ops[i];
+    if (op->type == OP_SYNC) {
+      fprintf(file, "S\n");
+    } else {
+      fprintf(file, "%c %" PRIu32 " %" PRIu32 "\n",
+              op->type == OP_READ ? 'R' : 'W', op->lba, op->count);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+// Disk accesses of the uncached usb_mass_read_chunked/write_chunked for
+// one callback
+static void countDirect(DiskCounters *direct, bool write, uint32_t offset,
+                        uint32_t bytes) {
+  uint32_t head = offset % SECTOR_SIZE;
+  uint32_t remaining = bytes;
+  if (head != 0) {
+    uint32_t chunk = SECTOR_SIZE - head;
+    if (chunk > remaining) chunk = remaining;
+    direct->diskReads++;
+    direct->diskReadSectors++;
+    if (write) {
+      direct->diskWrites++;
+      direct->diskWriteSectors++;
+    }
+    remaining -= chunk;
+  }
+  uint32_t full = remaining / SECTOR_SIZE;
+  if (full > 0) {
+    if (write) {
+      direct->diskWrites++;
+      direct->diskWriteSectors += full;
+    } else {
+      direct->diskReads++;
+      direct->diskReadSectors += full;
+    }
+    remaining -= full * SECTOR_SIZE;
+  }
+  if (remaining > 0) {
+    direct->diskReads++;
+    direct->diskReadSectors++;
+    if (write) {
+      direct->diskWrites++;
+      direct->diskWriteSectors++;
+    }
+  }
+}
+
+static uint64_t modelUs(const DiskCounters *c) {
+  return (uint64_t)c->diskReads * readCmdUs +
+         (uint64_t)c->diskReadSectors * readSectorUs +
+         (uint64_t)c->diskWrites * writeCmdUs +
+         (uint64_t)c->diskWriteSectors * writeSectorUs;
+}
+
+// What TinyUSB does with a READ10/WRITE10: one callback per endpoint
+// buffer, then write10_complete
+static bool replay(const Trace *trace, uint32_t chunk, DiskCounters *direct,
+                   uint64_t *hostBytes) {
+  uint8_t *buffer = malloc(chunk);
+  if (buffer == NULL) return false;
+  bool ok = true;
+  uint64_t mismatches = 0;
+
+  for (size_t i = 0; i < trace->count && ok; ++i) {
+    const Op *op = &trace->ops[i];
+    if (op->type == OP_SYNC) {
+      ok = usb_mass_cache_flush() && !usb_mass_cache_takeWriteError();
+      continue;
+    }
+    uint64_t total = (uint64_t)op->count * SECTOR_SIZE;
+    for (uint64_t offset = 0; offset < total && ok; offset += chunk) {
+      uint32_t bytes = (uint32_t)((total - offset < chunk) ? total - offset
+                                                           : chunk);
+      uint8_t *expected =
+          reference + (size_t)op->lba * SECTOR_SIZE + (size_t)offset;
+      countDirect(direct, op->type == OP_WRITE, (uint32_t)offset, bytes);
+      *hostBytes += bytes;
+      if (op->type == OP_READ) {
+        int32_t res =
+            usb_mass_cache_read(op->lba, (uint32_t)offset, buffer, bytes);
+        ok = (res == (int32_t)bytes);
+        if (ok && memcmp(buffer, expected, bytes) != 0) {
+          if (mismatches++ < 5) {
+            fprintf(stderr, "Mismatch: READ10 lba %" PRIu32 " offset %" PRIu64
+                    "\n", op->lba, offset);
+          }
+        }
+      } else {
+        for (uint32_t b = 0; b < bytes; ++b) buffer[b] = (uint8_t)rng();
+        memcpy(expected, buffer, bytes);
+        int32_t res =
+            usb_mass_cache_write(op->lba, (uint32_t)offset, buffer, bytes);
+        ok = (res == (int32_t)bytes);
+      }
+    }
+    if (op->type == OP_WRITE && ok) {
+      // tud_msc_write10_complete_cb
+      ok = usb_mass_cache_flush();
+    }
+  }
+  free(buffer);
+  if (!ok) fprintf(stderr, "A callback failed\n");
+  return ok && mismatches == 0;
+}
+
+static void printRow(const char *label, const DiskCounters *c,
+                     uint64_t hostBytes) {
+  uint64_t us = modelUs(c);
+  double mbs = us ? (double)hostBytes / (double)us : 0.0;
+  printf("%-8s %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32
+         " %10.1f %7.2f\n",
+         label, c->diskReads, c->diskReadSectors, c->diskWrites,
+         c->diskWriteSectors, (double)us / 1000.0, mbs);
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "Usage: %s [options] (--synthetic OS | --trace FILE | "
+          "--usbmon FILE)\n"
+          "  --synthetic linux|macos|windows  generated session\n"
+          "  --files N          files in the synthetic session (%u)\n"
+          "  --trace FILE       text trace (R/W/S/M lines)\n"
+          "  --usbmon FILE      Linux usbmon text capture\n"
+          "  --meta START:COUNT metadata range (up to %u)\n"
+          "  --save FILE        write the pattern as a text trace\n"
+          "  --disk-mb N        RAM disk size (%u)\n"
+          "  --chunk BYTES      bytes per callback (%u)\n"
+          "  --seed N           random seed\n"
+          "  --cost R,r,W,w     us per read cmd, read sector, write cmd,\n"
+          "                     write sector (%u,%u,%u,%u)\n",
+          argv0, DEFAULT_FILES, (unsigned)USB_MASS_CACHE_RANGES,
+          DEFAULT_DISK_MB, DEFAULT_CHUNK, DEFAULT_READ_CMD_US,
+          DEFAULT_READ_SECTOR_US, DEFAULT_WRITE_CMD_US,
+          DEFAULT_WRITE_SECTOR_US);
+}
+
+int main(int argc, char **argv) {
+  const char *synthetic = NULL;
+  const char *tracePath = NULL;
+  const char *usbmonPath = NULL;
+  const char *savePath = NULL;
+  uint32_t files = DEFAULT_FILES;
+  uint32_t diskMb = DEFAULT_DISK_MB;
+  uint32_t chunk = DEFAULT_CHUNK;
+  Trace trace = {0};
+  Trace extraMeta = {0};
+
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if (value == NULL) {
+      usage(argv[0]);
+      return 2;
+    }
+    i++;
+    if (strcmp(arg, "--synthetic") == 0) {
+      synthetic = value;
+    } else if (strcmp(arg, "--files") == 0) {
+      files = (uint32_t)strtoul(value, NULL, 0);
+    } else if (strcmp(arg, "--trace") == 0) {
+      tracePath = value;
+    } else if (strcmp(arg, "--usbmon") == 0) {
+      usbmonPath = value;
+    } else if (strcmp(arg, "--meta") == 0) {
+      unsigned long start = 0;
+      unsigned long count = 0;
+      if (sscanf(value, "%lu:%lu", &start, &count) != 2) {
+        usage(argv[0]);
+        return 2;
+      }
+      traceAddMeta(&extraMeta, (uint32_t)start, (uint32_t)count);
+    } else if (strcmp(arg, "--save") == 0) {
+      savePath = value;
+    } else if (strcmp(arg, "--disk-mb") == 0) {
+      diskMb = (uint32_t)strtoul(value, NULL, 0);
+    } else if (strcmp(arg, "--chunk") == 0) {
+      chunk = (uint32_t)strtoul(value, NULL, 0);
+    } else if (strcmp(arg, "--seed") == 0) {
+      rngState = strtoull(value, NULL, 0) | 1u;
+    } else if (strcmp(arg, "--cost") == 0) {
+      if (sscanf(value, "%u,%u,%u,%u", &readCmdUs, &readSectorUs, &writeCmdUs,
+                 &writeSectorUs) != 4) {
+        usage(argv[0]);
+        return 2;
+      }
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if ((synthetic != NULL) + (tracePath != NULL) + (usbmonPath != NULL) != 1 ||
+      chunk == 0 || diskMb == 0) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  diskSectors = diskMb * (1024u * 1024u / SECTOR_SIZE);
+  disk = malloc((size_t)diskSectors * SECTOR_SIZE);
+  reference = malloc((size_t)diskSectors * SECTOR_SIZE);
+  if (disk == NULL || reference == NULL) {
+    fprintf(stderr, "Cannot allocate a %u MB disk\n", (unsigned)diskMb);
+    return 1;
+  }
+  for (size_t i = 0; i < (size_t)diskSectors * SECTOR_SIZE; ++i) {
+    disk[i] = (uint8_t)rng();
+  }
+  memcpy(reference, disk, (size_t)diskSectors * SECTOR_SIZE);
+
+  const char *patternName = NULL;
+  if (synthetic != NULL) {
+    const Profile *profile = NULL;
+    for (size_t i = 0; i < sizeof(profiles) / sizeof(profiles[0]); ++i) {
+      if (strcmp(profiles[i].name, synthetic) == 0) profile = &profiles[i];
+    }
+    if (profile == NULL || diskSectors <= SYN_DATA_LBA + SYN_CLUSTER) {
+      usage(argv[0]);
+      return 2;
+    }
+    synthesize(&trace, profile, files);
+    patternName = profile->name;
+  } else if (tracePath != NULL) {
+    if (!loadTrace(&trace, tracePath)) return 1;
+    patternName = tracePath;
+  } else {
+    if (!loadUsbmon(&trace, usbmonPath)) return 1;
+    patternName = usbmonPath;
+  }
+  for (uint32_t i = 0; i < extraMeta.metaRanges; ++i) {
+    traceAddMeta(&trace, extraMeta.metaStart[i], extraMeta.metaCount[i]);
+  }
+  if (savePath != NULL && !saveTrace(&trace, savePath)) return 1;
+
+  if (!usb_mass_cache_init(diskSectors)) {
+    fprintf(stderr, "usb_mass_cache_init failed\n");
+    return 1;
+  }
+  for (uint32_t i = 0; i < trace.metaRanges; ++i) {
+    usb_mass_cache_addMetadataRange(trace.metaStart[i], trace.metaCount[i]);
+  }
+
+  DiskCounters direct = {0};
+  uint64_t hostBytes = 0;
+  bool verified = replay(&trace, chunk, &direct, &hostBytes);
+  usb_mass_cache_release();
+  if (memcmp(disk, reference, (size_t)diskSectors * SECTOR_SIZE) != 0) {
+    fprintf(stderr, "The disk does not hold what the host wrote\n");
+    verified = false;
+  }
+
+  UsbMassCacheStats stats;
+  usb_mass_cache_getStats(&stats);
+  printf("Pattern: %s, %zu commands, %u bytes per callback\n", patternName,
+         trace.count, (unsigned)chunk);
+  printf("%-8s %10s %10s %10s %10s %10s %7s\n", "", "reads", "sectors",
+         "writes", "sectors", "model ms", "MB/s");
+  printRow("direct", &direct, hostBytes);
+  printRow("cached", &counters, hostBytes);
+  printf("Sectors served from RAM: %" PRIu32 " of %" PRIu32 " (%.1f%%)\n",
+         stats.sectorsHit, stats.sectorsRead,
+         stats.sectorsRead ? 100.0 * stats.sectorsHit / stats.sectorsRead
+                           : 0.0);
+  printf("Verify: %s\n", verified ? "OK" : "FAILED");
+
+  free(trace.ops);
+  free(disk);
+  free(reference);
+  return verified ? 0 : 1;
+}
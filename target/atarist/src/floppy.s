@@ -39,8 +39,10 @@ SVAR_XBIOS_TRAP_ENABLED:    equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 0)      ; XBI
 SVAR_BOOT_ENABLED:          equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 1)      ; Boot sector enabled
 SVAR_EMULATION_MODE:        equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 2)      ; Emulation mode
 SVAR_ENABLED:               equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 3)      ; Enabled flag
-SVAR_MEDIA_CHANGED_A:       equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 4)      ; Media change state A
-SVAR_MEDIA_CHANGED_B:       equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 5)      ; Media change state B
+SVAR_MEDIA_GEN_A:           equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 4)      ; Media generation A, bumped by the RP on each new image
+SVAR_MEDIA_GEN_B:           equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 5)      ; Media generation B
+SVAR_MEDIA_SEEN_A:          equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 6)      ; Media generation A whose BPB TOS already has
+SVAR_MEDIA_SEEN_B:          equ (FLOPPYEMUL_SHARED_VARIABLE_SIZE + 7)      ; Media generation B whose BPB TOS already has
 
 MED_NOCHANGE:               equ 0
 MED_UNKNOWN:                equ 1
@@ -86,7 +88,7 @@ _longframe      equ $59e    ; Address of the long frame flag. If this value is 0
     include inc/sidecart_macros.s
 
     
-    org $FA2800         ; Start of the code. First 4KB bytes are reserved for the terminal.
+    org $FA3000         ; Start of the code. First 4KB bytes are reserved for the terminal.
 
 floppy_start:
     tst.l (FLOPPY_SHARED_VARIABLES + (SVAR_ENABLED * 4))
@@ -394,7 +396,7 @@ _bios_trap_notlong:
     cmp.w #Getbpb,6(a0)                  ; is it BIOS call Getbpb?
     beq.s bios_getbpb                    ; if yes, go to getbpb
     cmp.w #Mediach,6(a0)                 ; is it BIOS call Mediach?
-    beq.s bios_mediach                   ; if yes, go to media change
+    beq bios_mediach                     ; if yes, go to media change
     cmp.w #Rwabs,6(a0)                   ; is it BIOS call Rwabs?
     beq bios_rwabs                       ; if yes, go to rwabs
 
@@ -416,7 +418,16 @@ _bios_get_bpb_load_emul_bpp_A:
     ; Test Drive A
     btst   #0, (FLOPPY_SHARED_VARIABLES + (SVAR_EMULATION_MODE * 4) + 3) ; Bit 0: Emulate A
     beq.s _bios_get_bpb_not_emul_bpp
-    ; Emulate A
+    ; Emulate A. TOS gets the BPB of the new image: tell the RP once
+    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_GEN_A * 4)),d0
+    cmp.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_SEEN_A * 4)),d0
+    beq.s _bios_get_bpb_seen_A
+    movem.l d1-d7/a0-a6, -(sp)
+    move.l #SVAR_MEDIA_SEEN_A, d3
+    move.l d0, d4
+    send_sync CMD_SET_SHARED_VAR, 8
+    movem.l (sp)+, d1-d7/a0-a6
+_bios_get_bpb_seen_A:
     move.l #BPB_data_A,d0         ; Load the emulated BPP A
     rte  
 
@@ -424,6 +435,15 @@ _bios_get_bpb_load_emul_bpp_B:
     ; Test Drive B
     btst   #1, (FLOPPY_SHARED_VARIABLES + (SVAR_EMULATION_MODE * 4) + 3) ; Bit 1: Emulate B
     beq.s _bios_get_bpb_not_emul_bpp
+    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_GEN_B * 4)),d0
+    cmp.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_SEEN_B * 4)),d0
+    beq.s _bios_get_bpb_seen_B
+    movem.l d1-d7/a0-a6, -(sp)
+    move.l #SVAR_MEDIA_SEEN_B, d3
+    move.l d0, d4
+    send_sync CMD_SET_SHARED_VAR, 8
+    movem.l (sp)+, d1-d7/a0-a6
+_bios_get_bpb_seen_B:
     move.l #BPB_data_B,d0         ; Load the emulated BPP B
     rte
 
@@ -436,18 +456,30 @@ _bios_mediach_continue:
     move.l old_bios_handler, -(sp) ; Save the old BIOS handler
     rts
 
+; Changed until Getbpb hands TOS the BPB of the current generation. No
+; round-trip to the RP: polling Mediach costs two compares.
 _bios_mediach_changed_A:
     ; Test Drive A
     btst   #0, (FLOPPY_SHARED_VARIABLES + (SVAR_EMULATION_MODE * 4) + 3) ; Bit 0: Emulate A
     beq.s _bios_mediach_continue
-    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_CHANGED_A * 4)),d0
+    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_GEN_A * 4)),d0
+    cmp.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_SEEN_A * 4)),d0
+    bne.s _bios_mediach_changed
+    moveq #MED_NOCHANGE,d0
     rte
 
 _bios_mediach_changed_B:
     ; Test Drive B
     btst   #1, (FLOPPY_SHARED_VARIABLES + (SVAR_EMULATION_MODE * 4) + 3) ; Bit 1: Emulate B
     beq.s _bios_mediach_continue
-    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_CHANGED_B * 4)),d0
+    move.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_GEN_B * 4)),d0
+    cmp.l (FLOPPY_SHARED_VARIABLES + (SVAR_MEDIA_SEEN_B * 4)),d0
+    bne.s _bios_mediach_changed
+    moveq #MED_NOCHANGE,d0
+    rte
+
+_bios_mediach_changed:
+    moveq #MED_CHANGED,d0
     rte
 
 
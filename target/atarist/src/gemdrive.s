@@ -98,6 +98,8 @@ CMD_WRITE_BUFF_CALL     equ ($88 + APP_GEMDRVEMUL)           ; Command code to s
 CMD_WRITE_BUFF_CHECK    equ ($89 + APP_GEMDRVEMUL)           ; Write to sdCard the write buffer check call
 CMD_DTA_EXIST_CALL      equ ($8A + APP_GEMDRVEMUL)           ; Check if the DTA exists in the rp2040 memory
 CMD_DTA_RELEASE_CALL    equ ($8B + APP_GEMDRVEMUL)           ; Release the DTA from the rp2040 memory
+CMD_PEXEC_LOAD_START    equ ($8C + APP_GEMDRVEMUL)           ; Start loading and relocating a program in the rp2040
+CMD_PEXEC_LOAD_NEXT     equ ($8D + APP_GEMDRVEMUL)           ; Next relocated chunk of the program
 
 
 
@@ -109,6 +111,8 @@ SHARED_VARIABLE_DRIVE_NUMBER            equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZ
 SHARED_VARIABLE_PEXEC_RESTORE           equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 3             ; Pexec address to restore the program
 SHARED_VARIABLE_FAKE_FLOPPY             equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 4             ; Fake floppy drive to launch AUTO programs
 SHARED_VARIABLE_ENABLED                 equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 5             ; Enabled flag
+SHARED_VARIABLE_DRIVE_MASK              equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 6             ; Bit n set if drive n is emulated
+SHARED_VARIABLE_ACTIVE_DRIVE            equ SHARED_VARIABLE_SHARED_FUNCTIONS_SIZE + 7             ; Emulated drive of the paths without drive letter
 
 GEMDRVEMUL_VARIABLES_OFFSET             equ (RANDOM_TOKEN_ADDR + $100)  ; The variables used by GEMDRIVE start at 0x8100
 
@@ -231,7 +235,20 @@ reentry_gem_lock	macro
 reentry_gem_unlock  macro
                     send_sync CMD_REENTRY_UNLOCK, 0          ; Send the command to unlock the reentry
                 	endm
-; Check if the drive is the emulated one. If not, exec_old_handler the code
+; Make the emulated drive in d0 the one of the paths without drive letter.
+; Only a change of drive costs a command to the Sidecart
+select_emulated_drive   macro
+                        cmp.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_ACTIVE_DRIVE * 4)), d0 ; Check if the drive is already the active one
+                        beq.s .\@select_emulated_drive_done
+                        movem.l d3-d4, -(sp)                 ; Keep the payload of the call
+                        move.l #SHARED_VARIABLE_ACTIVE_DRIVE, d3
+                        move.l d0, d4                        ; The new active drive
+                        send_sync CMD_SET_SHARED_VAR, 8      ; Send the command to the Sidecart. 8 bytes of payload
+                        movem.l (sp)+, d3-d4
+.\@select_emulated_drive_done:
+                        endm
+
+; Check if the drive is one of the emulated ones. If not, exec_old_handler the code
 ; otherwise continue with the code
 detect_emulated_drive   macro
                         reentry_gem_lock
@@ -240,8 +257,10 @@ detect_emulated_drive   macro
                         reentry_gem_unlock              
                         move.w (sp)+, d0                     ; Restore the drive number
                         and.l #$FFFF, d0                     ; Mask the upper word of the drive number
-                        cmp.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d0            ; Check if the drive is the emulated one
-                        bne .exec_old_handler
+                        move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d1 ; Get the emulated drives
+                        btst d0, d1                          ; Check if the drive is one of the emulated ones
+                        beq .exec_old_handler
+                        select_emulated_drive                ; Paths without drive letter are in this drive now
                         endm
 
 ; Check if the first letter of the path is the emulated drive. If not, exec_old_handler the code
@@ -249,10 +268,16 @@ detect_emulated_drive   macro
 detect_emulated_drive_letter   macro
                         cmp.b #':', 1(a4)                    ; Check if the second character of the file specification string is the colon
                         bne.s .\@detect_emulated_drive_continue; If not, try to detect the current drive
+                        moveq #0, d0
                         move.b (a4), d0                      ; Get the first letter of the file specification string
-                        cmp.b (GEMDRVEMUL_SHARED_VARIABLES + 3 + (SHARED_VARIABLE_DRIVE_LETTER * 4)), d0 ; Check if the first letter is the emulated drive
-                        bne .exec_old_handler                ; If not, exec_old_handler the code. Otherwise continue with the code
-                        bra.s .\@detect_emulated_drive_ignore; The drive is the emulated one, ignoe detect the current drive
+                        and.b #$DF, d0                       ; Upper case
+                        sub.b #'A', d0                       ; Drive number of the letter
+                        cmp.b #('Z' - 'A'), d0               ; Check if it is a letter
+                        bhi .exec_old_handler                ; If not, exec_old_handler the code
+                        move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d1 ; Get the emulated drives
+                        btst d0, d1                          ; Check if the letter is one of the emulated drives
+                        beq .exec_old_handler                ; If not, exec_old_handler the code. Otherwise continue with the code
+                        bra .\@detect_emulated_drive_ignore ; The drive is emulated, ignore the current drive
 .\@detect_emulated_drive_continue:
                         detect_emulated_drive                ; Check if the drive is the emulated one.
 .\@detect_emulated_drive_ignore:
@@ -304,14 +329,12 @@ create_virtual_hard_disk:
     move.l #1,_drvbits.w                 ; Create the drive A bit
     move.w #1,_nflops.w                  ; Simulate that floppy A is attached
 .create_virtual_hard_disk:
-    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d0    ; Get the drive number
-    moveq.l #1, d1
-    lsl.l d0, d1                         ; Calculate the bit number of the drive
-    or.l d1, _drvbits.w                  ; Set the drive bit (all drives, so desktop sees it)
-
-    cmp.w #2, d0                         ; Only set boot device if drive is C: (2)
-    bne.s .skip_bootdev
-    move.w d0, _bootdev.w                ; Set the boot device to C:
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d0    ; Get the emulated drives
+    or.l d0, _drvbits.w                  ; Set the drive bits (all drives, so desktop sees them)
+
+    btst #2, d0                          ; Only set boot device if C: (2) is emulated
+    beq.s .skip_bootdev
+    move.w #2, _bootdev.w                ; Set the boot device to C:
 .skip_bootdev:
 
 ;    move.l #hdv_default, _hdv_mediach.w ; Set the media change handler to a default handler
@@ -564,8 +587,11 @@ _notlong:
 
 .Dfree_real_drive:
     subq.l #1, d3                        ; Remove 1 to the drive number. I don't want to use the default drive
-    cmp.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d3            ; Check if the drive is the emulated one
-    bne .exec_old_handler                ; If not, exec_old_handler the code
+    cmp.l #31, d3                        ; Check if the drive number is valid
+    bhi .exec_old_handler                ; If not, exec_old_handler the code
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d1 ; Get the emulated drives
+    btst d3, d1                          ; Check if the drive is one of the emulated ones
+    beq .exec_old_handler                ; If not, exec_old_handler the code
     send_sync CMD_DFREE_CALL, 2          ; Send the command to the Sidecart. 2 bytes of payload
     move.l GEMDRVEMUL_DFREE_STATUS, d0   ; Copy here the result status of the Dfree call
     tst.l d0                             ; Check if the call was successful
@@ -603,8 +629,7 @@ _notlong:
 .Dsetpath:
     move.l 8(a0),a4                      ; Address to the new GEMDOS path
 
-    detect_emulated_drive 0              ; Check if the drive is the emulated one. If not, exec_old_handler the code. 
-                                         ; Otherwise continue with the code
+    detect_emulated_drive_letter         ; If not, exec_old_handler the code. Otherwise continue with the code
 
     ; This is the emulated drive, it's our moment!
     send_write_sync CMD_DSETPATH_CALL, 256    
@@ -617,14 +642,24 @@ _notlong:
     move.l 8(a0),a4                      ; Address to the  new GEMDOS path
     move.w 12(a0),d3                     ; get the drive number
     tst.w d3                             ; Check if the drive number is 0 (current drive)
-    beq.s .Dgetpath_current_drive        ; If it's the current drive, continue with the code
+    bne.s .Dgetpath_real_drive           ; If it's not the current drive, continue with the code
+
+    reentry_gem_lock
+    gemdos Dgetdrv, 2                    ; Call Dgetdrv() and get the drive number
+    move.l d0, -(sp)                     ; Save the return value with the drive number
+    reentry_gem_unlock
+    move.l (sp)+, d3                     ; Restore the drive number
+    addq.l #1, d3                        ; Add 1 to the drive number.
+
+.Dgetpath_real_drive:
     subq.l #1, d3                        ; Remove 1 to the drive number. A is 0, B is 1, C is 2, etc.
-    cmp.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d3            ; Check if the drive is the emulated one
-    bne .exec_old_handler                ; If not, exec_old_handler the code        
+    cmp.l #31, d3                        ; Check if the drive number is valid
+    bhi .exec_old_handler                ; If not, exec_old_handler the code
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d1 ; Get the emulated drives
+    btst d3, d1                          ; Check if the drive is one of the emulated ones
+    beq .exec_old_handler                ; If not, exec_old_handler the code
 
-.Dgetpath_current_drive:
-;    detect_emulated_drive                ; Check if the drive is the emulated one. If not, exec_old_handler the code.
-    ; This is the emulated drive, it's our moment!
+    ; This is an emulated drive, it's our moment!
     send_sync CMD_DGETPATH_CALL, 2       ; Two bytes of payload
 
     move.w #$7F, d0                      ; Maximum length of the path
@@ -950,19 +985,8 @@ _notlong:
     move.l 8(a0), a4                     ; Get the address of the file specification string
     move.w 12(a0),d4                     ; get attribs
 
-    cmp.b #':', 1(a4)                    ; Check if the second character of the file specification string is the colon
-    bne .fs_first_check_drive            ; If not, go and check if the drive is the emulated one or not
-    move.b (a4), d0                      ; Get the first character of the file specification string
-.fs_first_check_drive_others:
-
-    cmp.b (GEMDRVEMUL_SHARED_VARIABLES + 3 + (SHARED_VARIABLE_DRIVE_LETTER * 4)), d0   ; Check if the first letter of the file specification string is the hard disk drive letter
-    beq.s .fs_first_emulated             ; If so, execute specific fsfirst emulated code
-    bra .exec_old_handler              ; Now it's safe to execute the old handler
-
-.fs_first_check_drive:
-    detect_emulated_drive                ; If not, exec_old_handler the code. Otherwise continue with the code
+    detect_emulated_drive_letter         ; If not, exec_old_handler the code. Otherwise continue with the code
 
-.fs_first_emulated:
     reentry_gem_lock
     gemdos Fgetdta, 2                    ; Call Fgetdta() and get the address of the DTA
     move.l d0, -(sp)                     ; Save the return value with the address of the DTA
@@ -989,7 +1013,7 @@ _notlong:
 
     ; We need to exit with the emulated drive as current drive
     reentry_gem_lock
-    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d0 ; Get the emulated drive number
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_ACTIVE_DRIVE * 4)), d0 ; Get the emulated drive of the search
     move.w d0, -(sp)                            ; Save the drive number in the stack
     gemdos Dsetdrv, 4                           ; Call Dsetdrv() to set the current drive to the emulated one
     reentry_gem_unlock
@@ -1010,7 +1034,7 @@ _notlong:
 
     ; We need to exit with the emulated drive as current drive
     reentry_gem_lock
-    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)), d0 ; Get the emulated drive number
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_ACTIVE_DRIVE * 4)), d0 ; Get the emulated drive of the search
     move.w d0, -(sp)                            ; Save the drive number in the stack
     gemdos Dsetdrv, 4                           ; Call Dsetdrv() to set the current drive to the emulated one
     reentry_gem_unlock
@@ -1029,8 +1053,11 @@ _notlong:
 
     move.l (sp), a0                       ; Restore the DTA value into a0
     move.l 12(a0), d0                     ; Get the drive number from the DTA
-    cmp.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_NUMBER * 4)),d0 ; Check if the drive is the emulated one
-    bne .Fsnext_bypass                  ; If not, exec_old_handler the code
+    cmp.l #31, d0                         ; Check if the drive number is valid
+    bhi .Fsnext_bypass                    ; If not, exec_old_handler the code
+    move.l (GEMDRVEMUL_SHARED_VARIABLES + (SHARED_VARIABLE_DRIVE_MASK * 4)), d1 ; Get the emulated drives
+    btst d0, d1                           ; Check if the drive is one of the emulated ones
+    beq .Fsnext_bypass                    ; If not, exec_old_handler the code
 
     move.l (sp), d3                       ; Restore the DTA value
     send_sync CMD_FSNEXT_CALL, 4          ; Send the command to the Sidecart.
@@ -1118,6 +1145,62 @@ _notlong:
 
     send_write_sync CMD_SAVE_BASEPAGE, 256 ; Send the command to the Sidecart. 256 bytes of buffer to send
 
+; The Sidecart reads TEXT and DATA and applies the relocation table. We only
+; copy them in place. If it can't, load and relocate the program here.
+.pexec_load_relocated:
+    lea GEMDRVEMUL_EXEC_PD, a4
+    move.l 8(a4), d4                     ; Start of the text segment
+    move.l GEMDRVEMUL_FOPEN_HANDLE, d3   ; Pass the file handle
+    send_sync CMD_PEXEC_LOAD_START, 8    ; Send the command to the Sidecart. handle.w, padding.w, text_address.l
+    tst.l GEMDRVEMUL_READ_BYTES          ; GEMDOS error if the Sidecart can't load it
+    bmi .pexec_read_rest_of_file         ; Load and relocate the program here
+    move.l d4, a4                        ; Copy from the start of the text segment
+
+.pexec_load_relocated_next:
+    send_sync CMD_PEXEC_LOAD_NEXT, 4     ; Send the command to the Sidecart. handle.w, padding.w
+    move.l GEMDRVEMUL_READ_BYTES, d0     ; signed 32-bit: relocated bytes or GEMDOS error
+    bmi .pexec_load_relocated_error      ; negative -> error, exit
+    beq.s .pexec_load_relocated_done     ; zero -> TEXT and DATA loaded
+
+    lea GEMDRVEMUL_READ_BUFFER, a5       ; Address of the buffer to copy the data from the Sidecart
+    move.l d0, d7                        ; Number of bytes to copy
+    lsr.l #4, d7                         ; 16 bytes per iteration. The chunks are never bigger than BUFFER_READ_SIZE
+    beq.s .pexec_load_relocated_tail     ; Less than 16 bytes, copy the tail only
+    subq.w #1, d7                        ; We need to copy one block less because dbf counts 0
+.pexec_load_relocated_copy:
+    move.l (a5)+, (a4)+                  ; Copy longword. The text segment is even and so are all the chunks but the last
+    move.l (a5)+, (a4)+                  ; Copy longword
+    move.l (a5)+, (a4)+                  ; Copy longword
+    move.l (a5)+, (a4)+                  ; Copy longword
+    dbf d7, .pexec_load_relocated_copy   ; Loop until we copy all the blocks
+.pexec_load_relocated_tail:
+    and.w #15, d0                        ; Bytes left
+    bra.s .pexec_load_relocated_tail_next
+.pexec_load_relocated_tail_copy:
+    move.b (a5)+, (a4)+                  ; Copy the byte
+.pexec_load_relocated_tail_next:
+    dbf d0, .pexec_load_relocated_tail_copy
+    bra.s .pexec_load_relocated_next     ; Next chunk
+
+.pexec_load_relocated_done:
+    move.l GEMDRVEMUL_FOPEN_HANDLE, d3   ; Pass the file handle to close
+    send_sync CMD_FCLOSE_CALL, 2         ; Send the command to the Sidecart.
+    move.w GEMDRVEMUL_FCLOSE_STATUS, d0  ; Error code obtained from the Sidecart
+    ext.l d0                             ; Extend the sign of the value
+    bmi .pexec_exit                      ; If there is an error, exit
+    bra .zeroing_bss                     ; Already relocated
+
+.pexec_load_relocated_error:
+    move.l d0, d6                        ; Keep the error code
+    move.l GEMDRVEMUL_FOPEN_HANDLE, d3   ; Pass the file handle to close
+    send_sync CMD_FCLOSE_CALL, 2         ; Send the command to the Sidecart.
+    reentry_gem_lock
+    move.l GEMDRVEMUL_EXEC_PD, -(sp)     ; Pointer to the BASEPAGE structure of the new process
+    gemdos Mfree, 6                      ; Release the memory of the new process
+    reentry_gem_unlock
+    move.l d6, d0                        ; Return the error
+    bra .pexec_exit
+
 ; Now we need to load the file in the area where the memory is
 .pexec_read_rest_of_file:
     lea GEMDRVEMUL_EXEC_HEADER, a5        ; Address of the buffer to receive the header
@@ -1251,9 +1334,27 @@ _notlong:
 ; Output registers:
 ; a5: modified
 ; d5: modified
+; d0-d1: modified
 .fill_zero:
     tst.l d5                            ; Check if the size is 0
     beq.s .fill_zero_exit               ; If 0, we are done
+    move.l a5, d0                       ; Test if the address is odd or even
+    btst #0, d0                         ; Check if the address is odd
+    bne.s .fill_zero_loop               ; If odd, zero byte by byte
+    moveq #0, d0                        ; Value to fill
+    move.l d5, d1                       ; Number of 16 bytes blocks
+    lsr.l #4, d1                        ; Divide the size by 16
+    beq.s .fill_zero_tail               ; Less than 16 bytes, zero the tail only
+.fill_zero_block:
+    move.l d0, (a5)+                    ; Zero longword
+    move.l d0, (a5)+                    ; Zero longword
+    move.l d0, (a5)+                    ; Zero longword
+    move.l d0, (a5)+                    ; Zero longword
+    subq.l #1, d1                       ; Decrement the counter
+    bne.s .fill_zero_block              ; Loop until the counter is 0
+.fill_zero_tail:
+    and.l #15, d5                       ; Bytes left
+    beq.s .fill_zero_exit               ; If 0, we are done
 .fill_zero_loop:
     clr.b (a5)+                         ; Zero the memory
     subq.l #1, d5                       ; Decrement the counter
@@ -30,11 +30,18 @@ SCREEN_SIZE			equ (-4096)	; Use the memory before the screen memory to store the
 COLS_HIGH			equ 20		; 16 bit columns in the ST
 ROWS_HIGH			equ 200		; 200 rows in the ST
 BYTES_ROW_HIGH		equ 80		; 80 bytes per row in the ST
+TILE_ROWS			equ 25		; 25 rows of 8x8 tiles in the framebuffer
+TILE_ROW_LINES		equ 8		; 8 lines in a row of tiles
+TILE_ROW_BYTES		equ (FRAMEBUFFER_SIZE / TILE_ROWS)	; 320 bytes of framebuffer in a row of tiles
+TILE_ROW_SCREEN_BYTES equ 1280	; 320 bytes expanded to the screen, in low and high resolution
+DISPLAY_GENERATION	equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 4)	; Generation of the last refresh that changed the framebuffer
+DISPLAY_ROW_GENERATIONS	equ (FRAMEBUFFER_ADDR + FRAMEBUFFER_SIZE + 8)	; Generation of the last change of each row of tiles
+FULL_COPY_FRAMES	equ 50		; Copy every row of tiles once every 50 frames
 PRE_RESET_WAIT		equ $FFFFF
 TRANSTABLE			equ $FA0800	; Translation table for high resolution
 GEMDRIVE			equ $FA1000 ; GEMDRIVE address
-FLOPPYEMUL 			equ $FA2800 ; Floppy emulation address
-RTCEMUL 			equ $FA3400 ; RTC emulation address
+FLOPPYEMUL 			equ $FA3000 ; Floppy emulation address
+RTCEMUL 			equ $FA3C00 ; RTC emulation address
 ACSIEMUL 			equ $FA5400 ; ACSI emulation address
 
 ; Reservation carved below _membot before GEMDOS init so TOS never hands
@@ -226,6 +233,7 @@ start_rom_code:
 
 ; Get the resolution of the screen
 .get_resolution:
+	sub.l a5, a5				; A5 keeps the generation of the last copy. None yet.
 	get_rez
 	cmp.w #2, d0				; Check if the resolution is 640x400 (high resolution)
 	beq .print_loop_high		; If it is, print the message in high resolution
@@ -233,10 +241,36 @@ start_rom_code:
 .print_loop_low:
 	vsync_wait
 
+; The Multi-device draws straight into the framebuffer: a row copied while it
+; was drawn is not copied again if the redraw left it as it was. Copy every
+; row now and then.
+	lea .full_copy_countdown(pc), a0
+	subq.w #1, (a0)
+	bne.s .check_generation_low
+	move.w #FULL_COPY_FRAMES, (a0)
+	move.l DISPLAY_GENERATION, d6	; Generation of this copy
+	sub.l a5, a5				; Copy every row changed since the start
+	bra.s .copy_tile_rows_low
+
+.check_generation_low:
+; Nothing to copy if the framebuffer did not change since the last copy
+	move.l DISPLAY_GENERATION, d6	; Generation of this copy
+	cmp.l a5, d6
+	beq .check_commands_low
+	bhi.s .copy_tile_rows_low
+	sub.l a5, a5				; The count went back: the Multi-device restarted
+
+.copy_tile_rows_low:
 ; We must move from the cartridge ROM to the screen memory to display the messages
 	move.l a6, a0				; Set the screen memory address in a0
 	move.l #FRAMEBUFFER_ADDR, a1			; Set the cartridge ROM address in a1
-	move.l #((FRAMEBUFFER_SIZE / 2) -1), d0			; Set the number of words to copy
+	move.l #DISPLAY_ROW_GENERATIONS, a4	; Set the generations of the rows in a4
+	moveq #(TILE_ROWS - 1), d5	; Set the number of rows of tiles to copy - 1
+.copy_tile_row_low:
+	move.l (a4)+, d3			; Generation of the last change of the row
+	sub.l a5, d3
+	ble.s .skip_tile_row_low	; Skip the row if it did not change since the last copy
+	move.l #((TILE_ROW_BYTES / 2) -1), d0			; Set the number of words to copy
 .copy_screen_low:
 	move.w (a1)+ , d1			; Copy a word from the cartridge ROM
 	ifne DISPLAY_BYPASS_FRAMEBUFFER == 1
@@ -247,8 +281,17 @@ start_rom_code:
 	move.w d1, d2				; Copy the word to d2
 	move.l d2, (a0)+			; Copy the word to the screen memory
 	move.l d2, (a0)+			; Copy the word to the screen memory
-	dbf d0, .copy_screen_low    ; Loop until all the message is copied
+	dbf d0, .copy_screen_low    ; Loop until all the row is copied
+	bra.s .next_tile_row_low
 
+.skip_tile_row_low:
+	lea TILE_ROW_BYTES(a1), a1	; Move to the next row of tiles in the cartridge ROM
+	lea TILE_ROW_SCREEN_BYTES(a0), a0	; Move to the next row of tiles in the screen
+.next_tile_row_low:
+	dbf d5, .copy_tile_row_low	; Loop until all the rows of tiles are checked
+	move.l d6, a5				; Remember the generation of this copy
+
+.check_commands_low:
 ; Check the different commands and the keyboard
 	check_commands
 
@@ -257,13 +300,39 @@ start_rom_code:
 .print_loop_high:
 	vsync_wait
 
+; The Multi-device draws straight into the framebuffer: a row copied while it
+; was drawn is not copied again if the redraw left it as it was. Copy every
+; row now and then.
+	lea .full_copy_countdown(pc), a0
+	subq.w #1, (a0)
+	bne.s .check_generation_high
+	move.w #FULL_COPY_FRAMES, (a0)
+	move.l DISPLAY_GENERATION, d6	; Generation of this copy
+	sub.l a5, a5				; Copy every row changed since the start
+	bra.s .copy_tile_rows_high
+
+.check_generation_high:
+; Nothing to copy if the framebuffer did not change since the last copy
+	move.l DISPLAY_GENERATION, d6	; Generation of this copy
+	cmp.l a5, d6
+	beq .check_commands_high
+	bhi.s .copy_tile_rows_high
+	sub.l a5, a5				; The count went back: the Multi-device restarted
+
+.copy_tile_rows_high:
 ; We must move from the cartridge ROM to the screen memory to display the messages
 	move.l a6, a1				; Set the screen memory address in a1
 	move.l a6, a2
 	lea BYTES_ROW_HIGH(a2), a2	; Move to the next line in the screen
 	move.l #FRAMEBUFFER_ADDR, a0		; Set the cartridge ROM address in a0
 	move.l #TRANSTABLE, a3		; Set the translation table in a3
-	move.l #(ROWS_HIGH -1), d0	; Set the number of rows to copy - 1
+	move.l #DISPLAY_ROW_GENERATIONS, a4	; Set the generations of the rows in a4
+	moveq #(TILE_ROWS - 1), d5	; Set the number of rows of tiles to copy - 1
+.copy_tile_row_high:
+	move.l (a4)+, d3			; Generation of the last change of the row
+	sub.l a5, d3
+	ble.s .skip_tile_row_high	; Skip the row if it did not change since the last copy
+	move.l #(TILE_ROW_LINES -1), d0	; Set the number of rows to copy - 1
 .copy_screen_row_high:
 	move.l #(COLS_HIGH -1), d1	; Set the number of columns to copy - 1 
 .copy_screen_col_high:
@@ -291,13 +360,26 @@ start_rom_code:
 	lea BYTES_ROW_HIGH(a1), a1	; Move to the next line in the screen
 	lea BYTES_ROW_HIGH(a2), a2	; Move to the next line in the screen
 
-	dbf d0, .copy_screen_row_high   ; Loop until all the message is copied
+	dbf d0, .copy_screen_row_high   ; Loop until all the row is copied
+	bra.s .next_tile_row_high
+
+.skip_tile_row_high:
+	lea TILE_ROW_BYTES(a0), a0	; Move to the next row of tiles in the cartridge ROM
+	lea TILE_ROW_SCREEN_BYTES(a1), a1	; Move to the next row of tiles in the screen
+	lea TILE_ROW_SCREEN_BYTES(a2), a2
+.next_tile_row_high:
+	dbf d5, .copy_tile_row_high	; Loop until all the rows of tiles are checked
+	move.l d6, a5				; Remember the generation of this copy
 
+.check_commands_high:
 ; Check the different commands and the keyboard
 	check_commands
 
 	bra .print_loop_high		; Continue printing the message
-	
+
+.full_copy_countdown:
+	dc.w FULL_COPY_FRAMES		; Frames left before the next full copy, in the copied code
+
 .reset:
     move.l #PRE_RESET_WAIT, d6
 .wait_me:
@@ -0,0 +1,102 @@
+#include "bench.h"
+
+#define HZ_200 ((volatile unsigned long *)0x4BAL)
+#define SYSBASE ((volatile unsigned long *)0x4F2L)
+
+static FILE *csv_fp = NULL;
+static const BenchOptions *csv_options = NULL;
+static char csv_stamp[20];
+static unsigned int tos_version = 0;
+static char current_drive = 'A';
+static unsigned long rand_state = 1;
+
+static long read_hz_200(void) { return (long)*HZ_200; }
+
+static long read_tos_version(void) {
+  return *(volatile unsigned short *)(*SYSBASE + 2);
+}
+
+// The program stays in user mode, Pexec needs it: the system variables are
+// read through Supexec
+unsigned long bench_ticks(void) { return (unsigned long)Supexec(read_hz_200); }
+
+void bench_srand(unsigned long seed) { rand_state = seed ? seed : 1; }
+
+unsigned long bench_rand(void) {
+  // 32-bit LCG, Numerical Recipes constants
+  rand_state = rand_state * 1664525UL + 1013904223UL;
+  return rand_state >> 8;
+}
+
+// Rate per second with one decimal, as "123.4"
+static void format_rate(char *out, unsigned long amount, unsigned long divisor,
+                        unsigned long ticks) {
+  if (ticks == 0) ticks = 1;  // Faster than the timer can tell
+  unsigned long long tenths = (unsigned long long)amount *
+                              (BENCH_TICKS_PER_SECOND * 10UL) /
+                              ((unsigned long long)divisor * ticks);
+  sprintf(out, "%lu.%lu", (unsigned long)(tenths / 10),
+          (unsigned long)(tenths % 10));
+}
+
+int bench_open_csv(const BenchOptions *options) {
+  csv_options = options;
+  tos_version = (unsigned int)Supexec(read_tos_version);
+  current_drive = 'A' + Dgetdrv();
+
+  unsigned int date = Tgetdate();
+  unsigned int time = Tgettime();
+  sprintf(csv_stamp, "%04u-%02u-%02u %02u:%02u:%02u",
+          ((date >> 9) & 0x7F) + 1980, (date >> 5) & 0x0F, date & 0x1F,
+          (time >> 11) & 0x1F, (time >> 5) & 0x3F, (time & 0x1F) * 2);
+
+  // A new file starts with the header line
+  FILE *probe = fopen(BENCH_CSV_FILE, "r");
+  int exists = (probe != NULL);
+  if (probe) fclose(probe);
+
+  csv_fp = fopen(BENCH_CSV_FILE, "a");
+  if (!csv_fp) {
+    print("Cannot open %s, results are only shown\r\n", BENCH_CSV_FILE);
+    return -1;
+  }
+  if (!exists) {
+    fprintf(csv_fp,
+            "date,label,tos,drive,test,size,ops,bytes,ticks,kb_s,ops_s,"
+            "status\n");
+  }
+  return 0;
+}
+
+void bench_close_csv(void) {
+  if (csv_fp) {
+    fclose(csv_fp);
+    csv_fp = NULL;
+  }
+}
+
+void bench_report(const char *test, long size, long ops, long bytes,
+                  unsigned long ticks, long status) {
+  char kb_s[16];
+  char ops_s[16];
+  format_rate(kb_s, (unsigned long)bytes, 1024UL, ticks);
+  format_rate(ops_s, (unsigned long)ops, 1UL, ticks);
+
+  if (status != 0) {
+    print("%-22s %6ld  error %ld\r\n", test, size, status);
+  } else if (bytes > 0) {
+    print("%-22s %6ld  %5ld ops %5lu ms  %8s KB/s  %7s ops/s\r\n", test,
+          size, ops, ticks * 5UL, kb_s, ops_s);
+  } else {
+    print("%-22s %6ld  %5ld ops %5lu ms  %7s ops/s\r\n", test, size, ops,
+          ticks * 5UL, ops_s);
+  }
+
+  if (csv_fp) {
+    fprintf(csv_fp, "%s,%s,%x.%02x,%c,%s,%ld,%ld,%ld,%lu,%s,%s,%ld\n",
+            csv_stamp, csv_options->label, tos_version >> 8,
+            tos_version & 0xFF, current_drive, test, size, ops, bytes, ticks,
+            kb_s, ops_s, status);
+    fflush(csv_fp);
+  }
+}
@@ -0,0 +1,104 @@
+#include "bench.h"
+#include "folder_listing_tests.h"
+
+// Each folder is listed this many times
+#define LISTING_PASSES 3
+
+static const long entries[] = {10L, 100L, 1000L};
+#define ENTRIES_COUNT (sizeof(entries) / sizeof(entries[0]))
+
+static DTA dta;
+
+static void entry_name(char *out, const char *folder, long index) {
+  sprintf(out, "%s\\F%04ld.DAT", folder, index);
+}
+
+// Create the files of a folder. Returns the number created.
+static long fill_folder(const char *folder, long count, long *status) {
+  char name[32];
+  long created = 0;
+  unsigned long start = bench_ticks();
+  for (; created < count; created++) {
+    entry_name(name, folder, created);
+    long fd = Fcreate(name, 0);
+    if (fd < 0) {
+      *status = fd;
+      break;
+    }
+    Fclose((int)fd);
+  }
+  bench_report("fcreate", count, created, 0, bench_ticks() - start,
+               *status);
+  return created;
+}
+
+static void list_folder(const char *folder, long count) {
+  char pattern[32];
+  sprintf(pattern, "%s\\*.*", folder);
+  Fsetdta(&dta);
+
+  long found = 0;
+  long status = 0;
+  unsigned long start = bench_ticks();
+  for (int pass = 0; pass < LISTING_PASSES; pass++) {
+    long pass_found = 0;
+    long result = Fsfirst(pattern, 0);
+    while (result == 0) {
+      pass_found++;
+      result = Fsnext();
+    }
+    found += pass_found;
+    if (pass_found != count) {
+      status = (result < 0 && result != -49) ? result : -1;
+      break;
+    }
+  }
+  bench_report("fsfirst_fsnext", count, found, 0, bench_ticks() - start,
+               status);
+}
+
+static void empty_folder(const char *folder, long count) {
+  char name[32];
+  long status = 0;
+  long deleted = 0;
+  unsigned long start = bench_ticks();
+  for (; deleted < count; deleted++) {
+    entry_name(name, folder, deleted);
+    long result = Fdelete(name);
+    if (result != 0) {
+      status = result;
+      break;
+    }
+  }
+  bench_report("fdelete", count, deleted, 0, bench_ticks() - start, status);
+  // Whatever is left after an error
+  for (long i = deleted; i < count; i++) {
+    entry_name(name, folder, i);
+    Fdelete(name);
+  }
+}
+
+// Fsfirst/Fsnext over folders of 10, 100 and 1000 entries. Creating and
+// deleting the entries is timed too.
+void run_dirs_bench(const BenchOptions *options) {
+  print("=== Fsfirst / Fsnext ===\r\n");
+  for (unsigned int i = 0; i < ENTRIES_COUNT; i++) {
+    long count = entries[i];
+    if (options->quick && count > 100) continue;
+
+    char folder[16];
+    sprintf(folder, "BDIR%ld", count);
+    long status = Dcreate(folder);
+    if (status != 0) {
+      bench_report("fcreate", count, 0, 0, 0, status);
+      continue;
+    }
+    status = 0;
+    long created = fill_folder(folder, count, &status);
+    if (status == 0) {
+      list_folder(folder, count);
+    }
+    empty_folder(folder, created);
+    Ddelete(folder);
+  }
+}
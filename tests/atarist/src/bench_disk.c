@@ -0,0 +1,130 @@
+#include "bench.h"
+
+// Sequential Rwabs reads move 16 KB per call
+#define RWABS_CHUNK 16384L
+#define RWABS_SEQ_BYTES 262144L
+#define RWABS_RANDOM_OPS 128L
+
+// Floppy tracks read per side, from track 0
+#define FLOPRD_TRACKS 20
+
+typedef struct {
+  short recsiz;
+  short clsiz;
+  short clsizb;
+  short rdlen;
+  short fsiz;
+  short fatrec;
+  short datrec;
+  short numcl;
+  short bflags;
+} BenchBpb;
+
+static unsigned int read_le16(const unsigned char *p) {
+  return (unsigned int)p[0] | ((unsigned int)p[1] << 8);
+}
+
+static void bench_rwabs(const BenchOptions *options, char letter) {
+  int dev = letter - 'A';
+  char test[24];
+  const BenchBpb *bpb = (const BenchBpb *)Getbpb(dev);
+  sprintf(test, "rwabs_seq_%c", letter);
+  if (bpb == NULL || bpb->recsiz <= 0 || bpb->recsiz > RWABS_CHUNK) {
+    bench_report(test, 0, 0, 0, 0, -1);
+    return;
+  }
+
+  long recsiz = bpb->recsiz;
+  long total = (long)bpb->datrec +
+               (long)(unsigned short)bpb->numcl * (long)bpb->clsiz;
+  long count = RWABS_CHUNK / recsiz;
+  long bytes = options->quick ? RWABS_SEQ_BYTES / 4 : RWABS_SEQ_BYTES;
+  long calls = bytes / (count * recsiz);
+  long status = 0;
+  long done = 0;
+  unsigned long start = bench_ticks();
+  for (long recno = 0; done < calls && recno + count <= total;
+       done++, recno += count) {
+    long result = Rwabs(0, options->buffer, (int)count, (int)recno, dev);
+    if (result != 0) {
+      status = result;
+      break;
+    }
+  }
+  bench_report(test, count * recsiz, done, done * count * recsiz,
+               bench_ticks() - start, status);
+
+  sprintf(test, "rwabs_rand_%c", letter);
+  long ops = options->quick ? RWABS_RANDOM_OPS / 4 : RWABS_RANDOM_OPS;
+  long limit = total < 32768L ? total : 32768L;  // Rwabs takes a word
+  bench_srand(recsiz);
+  status = 0;
+  done = 0;
+  start = bench_ticks();
+  for (; done < ops; done++) {
+    long recno = (long)(bench_rand() % (unsigned long)limit);
+    long result = Rwabs(0, options->buffer, 1, (int)recno, dev);
+    if (result != 0) {
+      status = result;
+      break;
+    }
+  }
+  bench_report(test, recsiz, done, done * recsiz, bench_ticks() - start,
+               status);
+}
+
+// Whole tracks of drive A with Floprd, geometry from the boot sector
+static void bench_floprd(const BenchOptions *options) {
+  unsigned char *buffer = options->buffer;
+  long result = Floprd(buffer, 0L, 0, 1, 0, 0, 1);
+  if (result != 0) {
+    bench_report("floprd_track", 0, 0, 0, 0, result);
+    return;
+  }
+  unsigned int spt = read_le16(buffer + 24);
+  unsigned int sides = read_le16(buffer + 26);
+  unsigned int sectors = read_le16(buffer + 19);
+  if (spt == 0 || spt * 512L > BENCH_BUFFER_SIZE || sides == 0 ||
+      sides > 2) {
+    bench_report("floprd_track", 0, 0, 0, 0, -1);
+    return;
+  }
+  unsigned int tracks = sectors / (spt * sides);
+  unsigned int max = options->quick ? FLOPRD_TRACKS / 4 : FLOPRD_TRACKS;
+  if (tracks > max) tracks = max;
+
+  long size = spt * 512L;
+  long status = 0;
+  long done = 0;
+  unsigned long start = bench_ticks();
+  for (unsigned int track = 0; track < tracks && status == 0; track++) {
+    for (unsigned int side = 0; side < sides; side++) {
+      result = Floprd(buffer, 0L, 0, 1, (int)track, (int)side, (int)spt);
+      if (result != 0) {
+        status = result;
+        break;
+      }
+      done++;
+    }
+  }
+  bench_report("floprd_track", size, done, done * size,
+               bench_ticks() - start, status);
+}
+
+// Rwabs on the selected drives (floppy and ACSI) and Floprd on drive A.
+// Only reads: the images are not changed.
+void run_disk_bench(const BenchOptions *options) {
+  print("=== Rwabs / Floprd ===\r\n");
+  unsigned long map = Drvmap();
+  for (const char *p = options->rwabsDrives; *p; p++) {
+    char letter = *p;
+    if (letter < 'A' || letter > 'P' || !(map & (1UL << (letter - 'A')))) {
+      print("Drive %c: not present, skipped\r\n", letter);
+      continue;
+    }
+    bench_rwabs(options, letter);
+  }
+  if (map & 1UL) {
+    bench_floprd(options);
+  }
+}
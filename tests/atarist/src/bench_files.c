@@ -0,0 +1,145 @@
+#include "bench.h"
+
+#define RANDOM_FILE_NAME "BENCHRND.BIN"
+
+// Request sizes: a small record, a sector, a cluster and a large block
+static const long sizes[] = {16L, 512L, 4096L, 32768L};
+#define SIZES_COUNT (sizeof(sizes) / sizeof(sizes[0]))
+
+// Requests per test, so the small sizes do not take minutes
+#define MAX_SEQ_OPS 1024L
+#define RANDOM_OPS 256L
+
+static long file_size(const BenchOptions *options) {
+  return options->quick ? BENCH_FILE_SIZE / 4 : BENCH_FILE_SIZE;
+}
+
+static long seq_ops(const BenchOptions *options, long size) {
+  long ops = file_size(options) / size;
+  long max = options->quick ? MAX_SEQ_OPS / 4 : MAX_SEQ_OPS;
+  return ops < max ? ops : max;
+}
+
+static void bench_write_seq(const BenchOptions *options, long size) {
+  long ops = seq_ops(options, size);
+  long fd = Fcreate(BENCH_FILE_NAME, 0);
+  if (fd < 0) {
+    bench_report("fwrite_seq", size, 0, 0, 0, fd);
+    return;
+  }
+  long status = 0;
+  long done = 0;
+  unsigned long start = bench_ticks();
+  for (; done < ops; done++) {
+    long written = Fwrite((int)fd, size, options->buffer);
+    if (written != size) {
+      status = written < 0 ? written : -1;
+      break;
+    }
+  }
+  Fclose((int)fd);  // Flushes: part of the cost of writing
+  bench_report("fwrite_seq", size, done, done * size, bench_ticks() - start,
+               status);
+}
+
+static void bench_read_seq(const BenchOptions *options, long size) {
+  long ops = seq_ops(options, size);
+  long fd = Fopen(BENCH_FILE_NAME, 0);
+  if (fd < 0) {
+    bench_report("fread_seq", size, 0, 0, 0, fd);
+    return;
+  }
+  long status = 0;
+  long done = 0;
+  unsigned long start = bench_ticks();
+  for (; done < ops; done++) {
+    long read = Fread((int)fd, size, options->buffer);
+    if (read != size) {
+      status = read < 0 ? read : -1;
+      break;
+    }
+  }
+  unsigned long ticks = bench_ticks() - start;
+  Fclose((int)fd);
+  bench_report("fread_seq", size, done, done * size, ticks, status);
+}
+
+// Requests at random offsets aligned on their size, over the whole file
+static void bench_random(const BenchOptions *options, long size, int write) {
+  const char *test = write ? "fwrite_rand" : "fread_rand";
+  long ops = options->quick ? RANDOM_OPS / 4 : RANDOM_OPS;
+  long slots = file_size(options) / size;
+  long fd = Fopen(RANDOM_FILE_NAME, write ? 2 : 0);
+  if (fd < 0) {
+    bench_report(test, size, 0, 0, 0, fd);
+    return;
+  }
+  bench_srand(size);
+  long status = 0;
+  long done = 0;
+  unsigned long start = bench_ticks();
+  for (; done < ops; done++) {
+    long offset = (long)(bench_rand() % (unsigned long)slots) * size;
+    long pos = Fseek(offset, (int)fd, 0);
+    if (pos != offset) {
+      status = pos < 0 ? pos : -1;
+      break;
+    }
+    long moved = write ? Fwrite((int)fd, size, options->buffer)
+                       : Fread((int)fd, size, options->buffer);
+    if (moved != size) {
+      status = moved < 0 ? moved : -1;
+      break;
+    }
+  }
+  unsigned long ticks;
+  if (write) {
+    Fclose((int)fd);  // Flushes: part of the cost of writing
+    ticks = bench_ticks() - start;
+  } else {
+    ticks = bench_ticks() - start;
+    Fclose((int)fd);
+  }
+  bench_report(test, size, done, done * size, ticks, status);
+}
+
+// The file of the random tests, written in large blocks and not timed
+static long create_random_file(const BenchOptions *options) {
+  long fd = Fcreate(RANDOM_FILE_NAME, 0);
+  if (fd < 0) return fd;
+  for (long left = file_size(options); left > 0; left -= BENCH_BUFFER_SIZE) {
+    long chunk = left < BENCH_BUFFER_SIZE ? left : BENCH_BUFFER_SIZE;
+    long written = Fwrite((int)fd, chunk, options->buffer);
+    if (written != chunk) {
+      Fclose((int)fd);
+      return written < 0 ? written : -1;
+    }
+  }
+  Fclose((int)fd);
+  return 0;
+}
+
+void run_files_bench(const BenchOptions *options) {
+  print("=== Fread / Fwrite ===\r\n");
+  for (long i = 0; i < BENCH_BUFFER_SIZE; i++) {
+    options->buffer[i] = (unsigned char)i;
+  }
+
+  for (unsigned int i = 0; i < SIZES_COUNT; i++) {
+    bench_write_seq(options, sizes[i]);
+    bench_read_seq(options, sizes[i]);
+  }
+  Fdelete(BENCH_FILE_NAME);
+
+  long status = create_random_file(options);
+  if (status != 0) {
+    bench_report("fread_rand", 0, 0, 0, 0, status);
+    Fdelete(RANDOM_FILE_NAME);
+    return;
+  }
+  for (unsigned int i = 0; i < SIZES_COUNT; i++) {
+    bench_random(options, sizes[i], FALSE);
+    bench_random(options, sizes[i], TRUE);
+  }
+  Fdelete(RANDOM_FILE_NAME);
+}
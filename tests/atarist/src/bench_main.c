@@ -0,0 +1,142 @@
+#include <stdlib.h>
+
+#include "bench.h"
+
+// Suites, one letter each, for the -s option
+#define SUITES_ALL "fdpr"
+
+// Auto-started programs get no command line: the options can also come
+// from this file in the current folder, on one line
+#define ARGS_FILE "FSBENCH.ARG"
+#define ARGS_MAX 16
+
+static BenchOptions options;
+static char suites[8] = SUITES_ALL;
+
+static void usage(void) {
+  print("FSBENCH [-q] [-d drive] [-l label] [-r drives] [-s %s]\r\n",
+        SUITES_ALL);
+  print("  -q  quick run: smaller files, fewer requests\r\n");
+  print("  -d  drive to benchmark (default: the current one)\r\n");
+  print("  -l  label of the run in BENCH.CSV (e.g. firmware version)\r\n");
+  print("  -r  drives for Rwabs, e.g. AC (default: A and C)\r\n");
+  print("  -s  suites: f files, d folders, p Pexec, r Rwabs/Floprd\r\n");
+}
+
+static void copy_option(char *out, size_t size, const char *value) {
+  strncpy(out, value, size - 1);
+  out[size - 1] = '\0';
+  for (char *p = out; *p; p++) {
+    if (*p == ',' || *p == '\r' || *p == '\n') *p = ';';  // Keep the CSV
+    if (out == options.rwabsDrives && *p >= 'a' && *p <= 'z') *p -= 32;
+  }
+}
+
+static int parse_args(int argc, char *argv[]) {
+  strcpy(options.label, VERSION);
+  options.rwabsDrives[0] = '\0';
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "-q") == 0) {
+      options.quick = TRUE;
+    } else if (strcmp(arg, "-d") == 0 && i + 1 < argc) {
+      char letter = argv[++i][0];
+      if (letter >= 'a' && letter <= 'z') letter -= 32;
+      if (letter < 'A' || letter > 'P' ||
+          !(Drvmap() & (1UL << (letter - 'A')))) {
+        print("Drive %c: not present\r\n", letter);
+        return -1;
+      }
+      Dsetdrv(letter - 'A');
+      Dsetpath("\\");
+    } else if (strcmp(arg, "-l") == 0 && i + 1 < argc) {
+      copy_option(options.label, sizeof(options.label), argv[++i]);
+    } else if (strcmp(arg, "-r") == 0 && i + 1 < argc) {
+      copy_option(options.rwabsDrives, sizeof(options.rwabsDrives),
+                  argv[++i]);
+    } else if (strcmp(arg, "-s") == 0 && i + 1 < argc) {
+      copy_option(suites, sizeof(suites), argv[++i]);
+    } else {
+      usage();
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// The options of ARGS_FILE as a command line. Returns 1 (no options) if
+// there is no file.
+static int read_args_file(char *line, int size, char *argv[]) {
+  argv[0] = "FSBENCH";
+  FILE *fp = fopen(ARGS_FILE, "r");
+  if (!fp) return 1;
+  int argc = 1;
+  if (fgets(line, size, fp)) {
+    for (char *tok = strtok(line, " \t\r\n"); tok && argc < ARGS_MAX;
+         tok = strtok(NULL, " \t\r\n")) {
+      argv[argc++] = tok;
+    }
+  }
+  fclose(fp);
+  return argc;
+}
+
+// Default Rwabs drives: the floppy, and C unless the benchmark runs on it
+static void default_rwabs_drives(void) {
+  if (options.rwabsDrives[0] != '\0') return;
+  char *p = options.rwabsDrives;
+  *p++ = 'A';
+  if ((Drvmap() & (1UL << 2)) && Dgetdrv() != 2) *p++ = 'C';
+  *p = '\0';
+}
+
+static int run() {
+#ifdef _LOG
+  open_log();
+#endif
+
+  print("Atari ST GEMDRIVE Benchmark %s\r\n", VERSION);
+  print("Label: %s  Drive: %c:  Mode: %s\r\n\r\n", options.label,
+        'A' + Dgetdrv(), options.quick ? "quick" : "full");
+
+  bench_open_csv(&options);
+  if (strchr(suites, 'f')) run_files_bench(&options);
+  if (strchr(suites, 'd')) run_dirs_bench(&options);
+  if (strchr(suites, 'p')) run_pexec_bench(&options);
+  if (strchr(suites, 'r')) run_disk_bench(&options);
+  bench_close_csv();
+
+#ifdef _LOG
+  close_log();
+#endif
+
+  print("\r\nResults appended to %s\r\n", BENCH_CSV_FILE);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  static char args_line[128];
+  static char *file_argv[ARGS_MAX];
+  if (argc <= 1) {
+    argc = read_args_file(args_line, sizeof(args_line), file_argv);
+    argv = file_argv;
+  }
+  if (parse_args(argc, argv) != 0) {
+    Pterm(1);
+    return EXIT_FAILURE;
+  }
+  options.buffer = malloc(BENCH_BUFFER_SIZE);
+  if (options.buffer == NULL) {
+    print("Not enough memory\r\n");
+    Pterm(1);
+    return EXIT_FAILURE;
+  }
+  default_rwabs_drives();
+
+  // User mode, unlike the test suite: Pexec runs child programs
+  run();
+
+  free(options.buffer);
+  Pterm(0);
+  return EXIT_SUCCESS;
+}
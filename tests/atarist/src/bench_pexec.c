@@ -0,0 +1,82 @@
+#include "bench.h"
+
+#define PRG_NAME "BENCHPRG.PRG"
+#define PRG_HEADER_SIZE 28L
+#define PRG_RUNS 3
+
+// Text and data of the program. Most of it is padding: what is timed is
+// GEMDOS loading the file.
+#define PRG_SEGMENT_SIZE 131072L
+
+static void put_word(unsigned char *p, unsigned int value) {
+  p[0] = (unsigned char)(value >> 8);
+  p[1] = (unsigned char)value;
+}
+
+static void put_long(unsigned char *p, unsigned long value) {
+  put_word(p, (unsigned int)(value >> 16));
+  put_word(p + 2, (unsigned int)value);
+}
+
+// A program that ends at once: clr.w -(sp), trap #1 (Pterm0), then zeros.
+// No relocation and the fastload flag, so the size of the RAM of the
+// machine does not change the result.
+static long write_program(const BenchOptions *options, long segment) {
+  unsigned char *buffer = options->buffer;
+  memset(buffer, 0, BENCH_BUFFER_SIZE);
+  put_word(buffer, 0x601A);
+  put_long(buffer + 2, segment);   // Text
+  put_long(buffer + 6, segment);   // Data
+  put_long(buffer + 10, 0);        // BSS
+  put_long(buffer + 14, 0);        // Symbols
+  put_long(buffer + 18, 0);        // Reserved
+  put_long(buffer + 22, 1);        // Flags: fastload
+  put_word(buffer + 26, 0);        // Relocation follows
+  put_word(buffer + PRG_HEADER_SIZE, 0x4267);
+  put_word(buffer + PRG_HEADER_SIZE + 2, 0x4E41);
+
+  long fd = Fcreate(PRG_NAME, 0);
+  if (fd < 0) return fd;
+  long left = PRG_HEADER_SIZE + 2 * segment + 4;  // + empty fixup list
+  int first = TRUE;
+  while (left > 0) {
+    long chunk = left < BENCH_BUFFER_SIZE ? left : BENCH_BUFFER_SIZE;
+    long written = Fwrite((int)fd, chunk, buffer);
+    if (written != chunk) {
+      Fclose((int)fd);
+      return written < 0 ? written : -1;
+    }
+    left -= chunk;
+    if (first) {
+      memset(buffer, 0, PRG_HEADER_SIZE + 4);
+      first = FALSE;
+    }
+  }
+  Fclose((int)fd);
+  return PRG_HEADER_SIZE + 2 * segment + 4;
+}
+
+void run_pexec_bench(const BenchOptions *options) {
+  print("=== Pexec ===\r\n");
+  long segment = options->quick ? PRG_SEGMENT_SIZE / 4 : PRG_SEGMENT_SIZE;
+  long size = write_program(options, segment);
+  if (size < 0) {
+    bench_report("pexec", 0, 0, 0, 0, size);
+    Fdelete(PRG_NAME);
+    return;
+  }
+
+  long status = 0;
+  long runs = 0;
+  unsigned long start = bench_ticks();
+  for (; runs < PRG_RUNS; runs++) {
+    long result = Pexec(0, PRG_NAME, "", NULL);
+    if (result != 0) {
+      status = result;
+      break;
+    }
+  }
+  bench_report("pexec", size, runs, runs * size, bench_ticks() - start,
+               status);
+  Fdelete(PRG_NAME);
+}
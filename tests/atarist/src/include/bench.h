@@ -0,0 +1,51 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <osbind.h>
+
+#include "test_runner.h"
+
+// Results of every run are appended to this file in the current folder
+#define BENCH_CSV_FILE "BENCH.CSV"
+
+// Transfer buffer, large enough for the biggest Fread/Fwrite size and for
+// one floppy track or 16 KB of Rwabs sectors
+#define BENCH_BUFFER_SIZE 32768L
+
+// Sequential tests read and write a file of this size. Quick runs use a
+// quarter of it.
+#define BENCH_FILE_SIZE 262144L
+#define BENCH_FILE_NAME "BENCHSEQ.BIN"
+
+// The 200 Hz system timer: one tick is 5 ms
+#define BENCH_TICKS_PER_SECOND 200L
+
+typedef struct {
+  int quick;                  // Smaller sizes and counts, for emulators
+  char label[32];             // Free text, e.g. the firmware version
+  char rwabsDrives[17];       // Drive letters for the Rwabs tests
+  unsigned char *buffer;      // BENCH_BUFFER_SIZE bytes
+} BenchOptions;
+
+// Ticks of the 200 Hz system timer
+unsigned long bench_ticks(void);
+
+// Pseudo-random numbers, the same sequence on every run
+void bench_srand(unsigned long seed);
+unsigned long bench_rand(void);
+
+// Show a result and append it to the CSV. size is the request size in
+// bytes (0 when it does not apply), ops the requests done and bytes the
+// data moved. status is 0, or the GEMDOS/BIOS/XBIOS error that stopped
+// the test.
+int bench_open_csv(const BenchOptions *options);
+void bench_close_csv(void);
+void bench_report(const char *test, long size, long ops, long bytes,
+                  unsigned long ticks, long status);
+
+void run_files_bench(const BenchOptions *options);
+void run_dirs_bench(const BenchOptions *options);
+void run_pexec_bench(const BenchOptions *options);
+void run_disk_bench(const BenchOptions *options);
+
+#endif  // BENCH_H